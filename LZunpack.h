@@ -0,0 +1,94 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef LZunpack_h
+#define LZunpack_h
+
+/// @file
+/// Streaming decompressor for firmware images packed with hex2c.tcl -z or
+/// lzpack.tcl, both in examples/Ports/isp_prepare/.
+///
+/// The packed format is a simple LZ77 variant with a 512-byte window, which is
+/// all the RAM it needs. It starts with the unpacked size as a varint, i.e. 7
+/// bits per byte, lowest first, with bit 7 set in all but the last byte. Then
+/// follow groups of 8 items, each preceded by a byte with one flag per item,
+/// starting from bit 0. A 1 bit is a literal byte, a 0 bit is a 2-byte match,
+/// stored as a little-endian word: the low 9 bits are the distance back minus
+/// 1, the top 7 bits the length minus 3. Matches may overlap what they produce,
+/// which is how runs of the same byte are packed.
+
+#if ARDUINO >= 100
+#include <Arduino.h> // Arduino 1.0
+#else
+#include <WProgram.h> // Arduino 0022
+#endif
+#include <avr/pgmspace.h>
+
+/// Unpack a compressed image stored in flash memory, one byte or one block
+/// at a time, e.g. to feed it page by page into a programming loop.
+class LZUnpack {
+public:
+    enum { WINDOW = 512, MINLEN = 3 };
+
+    /// Set up for a packed image in flash memory, i.e. with PROGMEM.
+    LZUnpack (const byte* data) { begin(data); }
+
+    /// Start again, with the same or another packed image.
+    void begin(const byte* data) {
+        in = data;
+        total = 0;
+        byte b, shift = 0;
+        do {
+            b = next();
+            total |= (long) (b & 0x7F) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        left = total;
+        pos = copy = 0;
+        flags = 1;
+    }
+
+    /// Returns the size of the unpacked image.
+    long size() const { return total; }
+    /// Returns the number of bytes not yet unpacked.
+    long remaining() const { return left; }
+
+    /// Returns the next byte of the image, call this at most size() times.
+    byte get() {
+        --left;
+        if (copy == 0) {
+            if (flags == 1)
+                flags = 0x100 | next();
+            byte literal = flags & 1;
+            flags >>= 1;
+            if (literal)
+                return put(next());
+            word w = next();
+            w |= next() << 8;
+            from = pos - (w & (WINDOW - 1)) - 1;
+            copy = (w >> 9) + MINLEN;
+        }
+        --copy;
+        return put(window[from++ % WINDOW]);
+    }
+
+    /// Unpack up to count bytes into a buffer, returns how many there were.
+    word read(byte* buf, word count) {
+        if (count > left)
+            count = left;
+        for (word i = 0; i < count; ++i)
+            buf[i] = get();
+        return count;
+    }
+
+private:
+    const byte* in;
+    long total, left;
+    word pos, from, flags;  // window offsets wrap, WINDOW must divide 65536
+    byte copy;
+    byte window [WINDOW];
+
+    byte next() { return pgm_read_byte(in++); }
+    byte put(byte b) { window[pos++ % WINDOW] = b; return b; }
+};
+
+#endif
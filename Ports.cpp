@@ -5,6 +5,7 @@
 #include "Ports.h"
 #include <avr/sleep.h>
 #include <util/atomic.h>
+#include <util/crc16.h>
 
 // #define DEBUG_DHT 1 // add code to send info over the serial port of non-zero
 
@@ -815,7 +816,7 @@ float CompassBoard::heading () {
 
 
 InfraredPlug::InfraredPlug (uint8_t num)
-        : Port (num), slot (140), gap (80), fill (-1), prev (0) {
+        : Port (num), slot (140), gap (80), fill (-1), decoded (0), prev (0) {
     digiWrite(0);
     mode(OUTPUT);
     mode2(INPUT);
@@ -870,41 +871,306 @@ uint8_t InfraredPlug::done() {
     return result;
 }
 
+// protocol descriptors for decoder(), adding a protocol only needs an entry
+// in the table below, all times are in microseconds
+
+enum { IR_DIST, IR_WIDTH, IR_BIPHASE }; // bits are in spaces, marks, or both
+enum { IR_STOP = 1, IR_LEAD_SPACE = 2, IR_ONE_MARK_FIRST = 4 };
+
+typedef struct {
+    byte type, coding, flags;
+    byte minBits, maxBits;
+    byte wide;          // index of a double-width bit (biphase), 0 if none
+    word hdrMark, hdrSpace;
+    word mark0, space0; // bit 0, or stop mark, or biphase half-bit time
+    word mark1, space1; // bit 1
+} IrProtocol;
+
+static const IrProtocol irProtocols [] PROGMEM = {
+    { InfraredPlug::NEC,     IR_DIST,    IR_STOP,            32, 32, 0,
+                             9000, 4500,  560,  560,  560, 1690 },
+    { InfraredPlug::NEC_REP, IR_DIST,    IR_STOP,             0,  0, 0,
+                             9000, 2250,  560,    0,    0,    0 },
+    { InfraredPlug::SAMSUNG, IR_DIST,    IR_STOP,            32, 32, 0,
+                             4500, 4500,  560,  560,  560, 1690 },
+    { InfraredPlug::SONY,    IR_WIDTH,   0,                  12, 20, 0,
+                             2400,  600,  600,  600, 1200,  600 },
+    { InfraredPlug::RC5,     IR_BIPHASE, IR_LEAD_SPACE,      14, 14, 0,
+                                0,    0,  889,    0,    0,    0 },
+    { InfraredPlug::RC6,     IR_BIPHASE, IR_ONE_MARK_FIRST,  21, 21, 4,
+                             2666,  889,  444,    0,    0,    0 },
+};
+
+// the range of times a nibble can represent, in us, see InfraredPlug::poll()
+static void irRange (const byte* buf, byte pos, byte slot, word& lo, word& hi) {
+    byte n = (buf[pos>>1] >> ((pos & 1) << 2)) & 0x0F;
+    // work in half slots, as each slot count was rounded
+    word lo2 = 2 * n, hi2 = 2 * n + 1;
+    if (n > 10) { // two slot counts per nibble, and 15 means 19 or more
+        lo2 = 4 * n - 22;
+        hi2 = n < 15 ? 4 * n - 19 : 0xFFFF / (2 * slot);
+    }
+    lo = lo2 > 0 ? (lo2 - 1) * 2 * slot : 0;
+    hi = hi2 * 2 * slot;
+}
+
+// true if a nibble matches the expected time, within 25%
+static bool irNear (const byte* buf, byte pos, byte slot, word us) {
+    word lo, hi;
+    irRange(buf, pos, slot, lo, hi);
+    return lo <= us + us / 4 && hi >= us - us / 4;
+}
+
+// how far off a nibble is from the expected time, relative, in 1/64ths
+static byte irError (const byte* buf, byte pos, byte slot, word us) {
+    word lo, hi;
+    irRange(buf, pos, slot, lo, hi);
+    word off = us < lo ? lo - us : us > hi ? us - hi : 0;
+    return ((uint32_t) off << 6) / us;
+}
+
+// best estimate of the time represented by a nibble
+static word irTime (const byte* buf, byte pos, byte slot) {
+    word lo, hi;
+    irRange(buf, pos, slot, lo, hi);
+    return lo + (hi - lo) / 2;
+}
+
+// decode bits in the mark or space lengths, returns bit count or -1
+static char irPulses (const IrProtocol& p, const byte* buf, byte slot,
+                        byte count, byte* out, word& err) {
+    byte pos = p.hdrMark ? 2 : 0, bits = 0;
+    for (; pos < count; pos += 2) {
+        if ((p.flags & IR_STOP) && pos == count - 1) {
+            err += irError(buf, pos, slot, p.mark0);
+            return irNear(buf, pos, slot, p.mark0) && bits >= p.minBits ?
+                    bits : -1;
+        }
+        if (bits >= p.maxBits)
+            return -1;
+        // the space after the last mark is not captured, it's the gap
+        bool last = pos + 1 >= count;
+        bool one = irNear(buf, pos, slot, p.mark1) &&
+                    (last || irNear(buf, pos + 1, slot, p.space1));
+        bool zero = irNear(buf, pos, slot, p.mark0) &&
+                    (last || irNear(buf, pos + 1, slot, p.space0));
+        word e1 = irError(buf, pos, slot, p.mark1) +
+                    (last ? 0 : irError(buf, pos + 1, slot, p.space1));
+        word e0 = irError(buf, pos, slot, p.mark0) +
+                    (last ? 0 : irError(buf, pos + 1, slot, p.space0));
+        if (one && zero) // both plausible, pick the closest one
+            one = e1 < e0;
+        else if (!one && !zero)
+            return -1;
+        err += one ? e1 : e0;
+        if (one)
+            out[bits/8] |= 0x80 >> (bits % 8);
+        ++bits;
+    }
+    return !(p.flags & IR_STOP) && bits >= p.minBits ? bits : -1;
+}
+
+// decode bits encoded as pairs of half-bit levels, returns bit count or -1
+static char irBiphase (const IrProtocol& p, const byte* buf, byte slot,
+                        byte count, byte* out, word& err) {
+    // expand to a sequence of half-bit levels, one bit each, 1 = mark
+    byte halves [12], h = 0;
+    memset(halves, 0, sizeof halves);
+    if (p.flags & IR_LEAD_SPACE)
+        ++h; // the leading space is not captured, it is part of the gap
+    for (byte pos = p.hdrMark ? 2 : 0; pos < count; ++pos) {
+        byte k = (irTime(buf, pos, slot) + p.mark0 / 2) / p.mark0;
+        if (k < 1 || k > 4 || h + k > 8 * sizeof halves)
+            return -1;
+        err += irError(buf, pos, slot, k * p.mark0);
+        if ((pos & 1) == 0)
+            for (byte i = h; i < h + k; ++i)
+                bitSet(halves[i/8], i % 8);
+        h += k;
+    }
+    // each bit must be a level change in the middle, trailing spaces are
+    // implied since they are not captured
+    byte at = 0;
+    for (byte bits = 0; bits < p.maxBits; ++bits) {
+        byte w = p.wide != 0 && bits == p.wide ? 2 : 1;
+        byte level [4];
+        for (byte i = 0; i < 2 * w; ++i)
+            level[i] = at + i < h && bitRead(halves[(at+i)/8], (at+i) % 8);
+        if (level[0] == level[w] || level[0] != level[w-1] ||
+                                    level[w] != level[2*w-1])
+            return -1;
+        if (p.flags & IR_ONE_MARK_FIRST ? level[0] : level[w])
+            out[bits/8] |= 0x80 >> (bits % 8);
+        at += 2 * w;
+    }
+    return at >= h ? p.maxBits : -1;
+}
+
 uint8_t InfraredPlug::decoder(uint8_t nibbles) {
-    switch (nibbles) {
-        case 67: // 2 + 64 + 1 nibbles could be a NEC packet
-            if (buf[0] == 0x8D && buf[33] == 0x01) {
-                // check that all nibbles are either 1 or 3
-                for (byte i = 1; i < 33; ++i)
-                    if ((buf[i] & ~0x20) != 0x11)
-                        return UNKNOWN;
-                // valid packet, convert in-place
-                for (byte i = 0; i < 4; ++i) {
-                    byte v = 0;
-                    for (byte j = 0; j < 8; ++j)
-                        v = (v << 1) | (buf[1+j+8*i] >> 5);
-                    buf[i] = v;
-                }
-                return NEC;
-            }
-            break;
-        case 3: // 2 + 1 nibbles could be a NEC repeat packet
-            if (buf[0] == 0x4D && buf[1] == 0x01)
-                return NEC_REP;
-            break;
+    // try all protocols, and keep the one which matches the timing best
+    byte type = UNKNOWN, best [8];
+    word bestErr = ~0;
+    for (byte i = 0; i < sizeof irProtocols / sizeof *irProtocols; ++i) {
+        IrProtocol p;
+        memcpy_P(&p, irProtocols + i, sizeof p);
+        if (p.hdrMark && (nibbles < 2 || !irNear(buf, 0, slot, p.hdrMark)
+                                      || !irNear(buf, 1, slot, p.hdrSpace)))
+            continue;
+        word err = p.hdrMark ? irError(buf, 0, slot, p.hdrMark) +
+                                irError(buf, 1, slot, p.hdrSpace) : 0;
+        byte out [8];
+        memset(out, 0, sizeof out);
+        char n = p.coding == IR_BIPHASE
+                    ? irBiphase(p, buf, slot, nibbles, out, err)
+                    : irPulses(p, buf, slot, nibbles, out, err);
+        if (n >= 0 && err < bestErr) {
+            type = p.type;
+            decoded = n;
+            bestErr = err;
+            memcpy(best, out, sizeof best);
+        }
     }
-    return UNKNOWN;
+    if (type != UNKNOWN)
+        memcpy(buf, best, sizeof best); // valid packet, convert in-place
+    return type;
 }
     
 void InfraredPlug::send(const uint8_t* data, uint16_t bits) {
-    // TODO: switch to an interrupt-driven design
-    for (byte i = 0; i < bits; ++i) {
+    // blocking version, see sendBits() for an interrupt-driven alternative
+    for (word i = 0; i < bits; ++i) {
         digiWrite(bitRead(data[i/8], i%8));
         delayMicroseconds(4 * slot);
     }
     digiWrite(0);
 }
 
+#ifdef TCCR2A
+
+// the queue of pending transmissions, shared by all infrared plugs, all this
+// state is used by the timer 2 interrupt code
+static volatile struct {
+    const void* data;
+    word count;     // number of bits, or number of times
+    byte slot;      // slot size for bits (as with configure), or 0 for times
+    byte pin;
+} irQueue [4];
+
+static volatile byte irHead, irFill; // queue position and number of entries
+static volatile word irPos, irLeft; // in the current entry, and ticks left
+static volatile byte irLevel, irMask; // current output level and bit mask
+static volatile byte* volatile irOut; // output register of the current entry
+static volatile word irHz = 38000, irScale; // carrier, ticks per us * 65536
+
+void InfraredPlug::setCarrier(word hz) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        irHz = hz;
+    }
+}
+
+static void irSetLevel (byte on) {
+    if (on == irLevel)
+        return; // keep the carrier phase going across equal bits
+    irLevel = on;
+    if (on)
+        *irOut |= irMask;
+    else
+        *irOut &= ~irMask;
+}
+
+// move to the next mark or space, or to the next entry in the queue
+static void irNext () {
+    while (irFill > 0) {
+        byte i = irHead;
+        if (irPos == 0) {
+            irOut = portOutputRegister(digitalPinToPort(irQueue[i].pin));
+            irMask = digitalPinToBitMask(irQueue[i].pin);
+        }
+        if (irPos < irQueue[i].count) {
+            byte on;
+            word us;
+            if (irQueue[i].slot) {
+                const byte* bits = (const byte*) irQueue[i].data;
+                on = bitRead(bits[irPos/8], irPos%8);
+                us = 4 * irQueue[i].slot;
+            } else {
+                on = (irPos & 1) == 0;
+                us = ((const word*) irQueue[i].data)[irPos];
+            }
+            ++irPos;
+            irLeft = ((uint32_t) us * irScale + 0x8000) >> 16;
+            if (irLeft == 0)
+                irLeft = 1;
+            irSetLevel(on);
+            return;
+        }
+        irSetLevel(0);
+        irHead = (irHead + 1) % (sizeof irQueue / sizeof *irQueue);
+        irPos = 0;
+        --irFill;
+    }
+    bitClear(TIMSK2, OCIE2A); // all done, stop the timer interrupts
+}
+
+void InfraredPlug::timerEvent() {
+    if (irLevel && irHz)
+        *irOut ^= irMask; // generate the carrier
+    if (--irLeft == 0)
+        irNext();
+}
+
+static bool irEnqueue (const void* data, word count, byte slot, byte pin) {
+    bool ok = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (irFill < sizeof irQueue / sizeof *irQueue) {
+            byte i = (irHead + irFill) % (sizeof irQueue / sizeof *irQueue);
+            irQueue[i].data = data;
+            irQueue[i].count = count;
+            irQueue[i].slot = slot;
+            irQueue[i].pin = pin;
+            ok = true;
+            if (irFill++ == 0) {
+                // tick at twice the carrier frequency, in CTC mode
+                word hz = irHz ? irHz : 38000;
+                word top = F_CPU / 2 / hz;
+                byte prescale = top > 256 ? 8 : 1;
+                top /= prescale;
+                irScale = (F_CPU / prescale / top) * 4096UL / 62500;
+                TCCR2A = bit(WGM21);
+                TCCR2B = prescale == 8 ? bit(CS21) : bit(CS20);
+                OCR2A = top - 1;
+                TCNT2 = 0;
+                irPos = 0;
+                irNext();
+                bitSet(TIFR2, OCF2A); // clear a pending match, if any
+                bitSet(TIMSK2, OCIE2A);
+            }
+        }
+    }
+    return ok;
+}
+
+bool InfraredPlug::sendBits(const uint8_t* data, uint16_t bits) {
+    return irEnqueue(data, bits, slot, digiPin());
+}
+
+bool InfraredPlug::sendTimes(const word* times, uint8_t count) {
+    return irEnqueue(times, count, 0, digiPin());
+}
+
+uint8_t InfraredPlug::sending() {
+    return irFill;
+}
+
+#else
+
+void InfraredPlug::setCarrier(word hz) {}
+bool InfraredPlug::sendBits(const uint8_t* data, uint16_t bits) { return false; }
+bool InfraredPlug::sendTimes(const word* times, uint8_t count) { return false; }
+uint8_t InfraredPlug::sending() { return 0; }
+void InfraredPlug::timerEvent() {}
+
+#endif
+
 void ProximityPlug::begin() {
     delay(100);
     setReg(CONFIG, 0x04);   // reset, STOP1
@@ -937,7 +1203,8 @@ void AnalogPlug::begin (byte mode) {
   select(1);
 }
 
-void AnalogPlug::select (byte channel) {
+void AnalogPlug::select (byte chan) {
+  channel = chan;
   send();
   write(0x80 | ((channel - 1) << 5) | (config & 0x1F));
   stop();    
@@ -954,10 +1221,20 @@ long AnalogPlug::reading () {
   return raw;
 }
 
+void AnalogPlug::start () {
+  select(channel);
+  // conversion time for 12, 14, 16, and 18 bits, i.e. 240, 60, 15, 3.75 SPS
+  static const word times[] PROGMEM = { 5, 17, 67, 270 };
+  waitFor(pgm_read_word(times + ((config >> 2) & 3)));
+}
+
+bool AnalogPlug::collect () {
+  raw = reading();
+  return true;
+}
+
 void HYT131::reading (int& temp, int& humi, byte (*delayFun)(word ms)) {
-    // Start measurement
-    send();
-    stop();
+    start();
     
     // Wait for completion (using user-supplied (low-power?) delay function)
     if (delayFun)
@@ -965,23 +1242,54 @@ void HYT131::reading (int& temp, int& humi, byte (*delayFun)(word ms)) {
     else
         delay(100);
     
+    collect();
+    result(temp, humi);
+}
+
+void HYT131::start () {
+    // Start measurement
+    send();
+    stop();
+    waitFor(100);
+}
+
+bool HYT131::collect () {
     // Extract readings
     receive();
-    uint16_t h = (read(0) & 0x3F) << 8;
-    h |= read(0);
-    uint16_t t = read(0) << 6;
-    t |= read(1) >> 2;
-    
+    raw[0] = (read(0) & 0x3F) << 8;
+    raw[0] |= read(0);
+    raw[1] = read(0) << 6;
+    raw[1] |= read(1) >> 2;
+    return true;
+}
+
+void HYT131::result (int& temp, int& humi) const {
     // convert 0..16383 to 0..100% (*10)
-    humi = (h * 1000L >> 14);
+    humi = (raw[0] * 1000L >> 14);
     // convert 0..16383 to -40 .. 125 (*10)
-    temp = (t * 1650L >> 14) - 400;
+    temp = (raw[1] * 1650L >> 14) - 400;
 }
 
-DHTxx::DHTxx (byte pinNum) : pin (pinNum) {
+DHTxx* DHTxx::active;
+
+DHTxx::DHTxx (byte pinNum) : pin (pinNum), state (0) {
   digitalWrite(pin, HIGH);
 }
 
+// check and convert the 5 bytes of data, as received in data[1..5]
+static bool dhtConvert (const byte* data, int& temp, int &humi, bool precise) {
+  byte sum = data[1] + data[2] + data[3] + data[4];
+  if (sum != data[5])
+    return false;
+  
+  humi = precise ? (data[1] << 8) | data[2] : 10 * data[1];
+
+  word t = precise ? ((data[3] & 0x7F) << 8) | data[4] : 10 * data[3];
+  temp = data[3] & 0x80 ? - t : t;
+
+  return true;
+}
+
 bool DHTxx::reading (int& temp, int &humi, bool precise) {
   pinMode(pin, OUTPUT);
   delay(10); // wait for any previous transmission to end
@@ -1042,18 +1350,90 @@ bool DHTxx::reading (int& temp, int &humi, bool precise) {
   Serial.println();
 #endif
   
-  byte sum = data[1] + data[2] + data[3] + data[4];
-  if (sum != data[5])
-    return false;
-  
-  humi = precise ? (data[1] << 8) | data[2] : 10 * data[1];
+  return dhtConvert(data, temp, humi, precise);
+}
 
-  word t = precise ? ((data[3] & 0x7F) << 8) | data[4] : 10 * data[3];
-  temp = data[3] & 0x80 ? - t : t;
+// enable or disable the pin-change interrupt for this pin, if possible
+static void dhtPinChange (byte pin, bool on) {
+#ifdef digitalPinToPCMSK
+  if (digitalPinToPCMSK(pin) != 0) {
+    if (on) {
+      *digitalPinToPCICR(pin) |= bit(digitalPinToPCICRbit(pin));
+      *digitalPinToPCMSK(pin) |= bit(digitalPinToPCMSKbit(pin));
+    } else
+      *digitalPinToPCMSK(pin) &= ~bit(digitalPinToPCMSKbit(pin));
+  }
+#endif
+}
 
+void DHTxx::start () {
+  // pull the line low for 18 ms, ready() will release it again
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, LOW);
+  timer.set(20);
+  waitFor(20);
+  state = 1;
+}
+
+bool DHTxx::ready () {
+  switch (state) {
+    case 1: // end of start pulse, release the line and start collecting
+      if (!timer.poll())
+        return false;
+      count = high = 0;
+      digitalWrite(pin, HIGH);
+      pinMode(pin, INPUT);
+      active = this;
+      dhtPinChange(pin, true);
+      timer.set(10); // the whole bit train takes about 5 ms
+      state = 2;
+      return false;
+    case 2: // wait until all pulses are in, or until the timeout
+      if (count < sizeof widths && !timer.poll())
+        return false;
+      dhtPinChange(pin, false);
+      active = 0;
+      state = 0;
+  }
   return true;
 }
 
+bool DHTxx::collect () {
+  if (ready())
+    return true;
+  // the bit train takes about 5 ms, keep polling the timeout every ms
+  waitFor(1);
+  return false;
+}
+
+bool DHTxx::result (int& temp, int &humi, bool precise) {
+  if (state != 0 || count < sizeof widths)
+    return false;
+  // skip the response pulse, then each bit is a 26 us (0) or 70 us (1) pulse
+  byte data[6];
+  for (byte i = 0; i < 40; ++i) {
+    byte offset = 1 + i / 8;
+    data[offset] <<= 1;
+    data[offset] |= widths[i+1] > 48;
+  }
+  return dhtConvert(data, temp, humi, precise);
+}
+
+void DHTxx::edge () {
+  DHTxx* d = active;
+  if (d == 0)
+    return;
+  word now = micros();
+  if (digitalRead(d->pin)) {
+    d->rise = now;
+    d->high = 1;
+  } else if (d->high && d->count < sizeof d->widths) {
+    word width = now - d->rise;
+    d->widths[d->count++] = width < 255 ? width : 255;
+    d->high = 0;
+  }
+}
+
 void ColorPlug::setGain (byte gain, byte prescaler) {
     send();
     write(0x80 | GAIN); // write to Gain regiser
@@ -1078,24 +1458,69 @@ const word* ColorPlug::getData () {
     return data.w;
 }
 
+// returns (a * b) >> 16, exact as long as the result fits, without 64-bit math
+static long mulQ16 (long a, long b) {
+    long ah = a >> 16, bh = b >> 16;
+    word al = a, bl = b;
+    return ah * bh * 65536L + ah * bl + al * bh + ((uint32_t) al * bl >> 16);
+}
+
+// returns 1000 * v / sum, rounded down, using a reciprocal of sum
+static word ratio (long v, long sum, uint32_t recip) {
+    word q = ((v * recip >> 16) * 1000) >> 16; // may be one or two too low
+    while ((q + 1) * sum <= 1000 * v)
+        ++q;
+    return q;
+}
+
 const word* ColorPlug::chromaCCT () {
-    chromacct[0] = chromacct[1] = chromacct[2] = 0;
-    long X = -14282L * data.w[0] + 154924L * data.w[1] - 95641L * data.w[2];
-    long Y = -32466L * data.w[0] + 157837L * data.w[1] - 73191L * data.w[2];
-    long Z = -68202L * data.w[0] +  77073L * data.w[1] + 56332L * data.w[2];
-    if (X > 0 && Y > 0 && Z > 0) { // chromaticity valid 
-      // it'd be nice if we could get rid of these floating point calculations
-      // but X, Y, or Z may have up to 28 bits, so we'd need to drop precision
-      chromacct[0] = (X * 1000.0) / (X + Y + Z);
-      chromacct[1] = (Y * 1000.0) / (X + Y + Z);
-      double n = (chromacct[0] - 332.0) / (185.8 - chromacct[1]);
-      chromacct[2] = 449 * n * n * n + 3525 * n * n + 6823.3 * n + 5520.33;      
-      if (chromacct[2] > 10000) // improbable value for color temperature
-        chromacct[2] = 0;
-    }
+    chromaCCT(data.w, chromacct);
     return chromacct;
 }
 
+/** Convert raw readings to chromaticity and color temperature, using only
+ *  fixed-point math. This does not access the plug, so it can also be used to
+ *  convert a batch of stored samples, with only two divisions per sample.
+ *  The x and y values match the original floating point calculation, apart
+ *  from an occasional off-by-one due to scaling down to 20 bits first, and
+ *  the CCT is then within 1 K (it is very sensitive to x and y, however).
+ *  @param rgbc Red, green, blue, and clear values, as returned by getData().
+ *  @param out Receives x and y (both scaled by 1000), and the CCT in Kelvin,
+ *             all three are set to zero for invalid readings.
+ *  @param count Number of samples, rgbc must have 4 and out 3 words for each.
+ */
+void ColorPlug::chromaCCT (const word* rgbc, word* out, byte count) {
+    for (; count > 0; --count, rgbc += 4, out += 3) {
+        out[0] = out[1] = out[2] = 0;
+        long X = -14282L * rgbc[0] + 154924L * rgbc[1] - 95641L * rgbc[2];
+        long Y = -32466L * rgbc[0] + 157837L * rgbc[1] - 73191L * rgbc[2];
+        long Z = -68202L * rgbc[0] +  77073L * rgbc[1] + 56332L * rgbc[2];
+        if (X <= 0 || Y <= 0 || Z <= 0)
+            continue; // chromaticity not valid
+        // scale down to 20 bits, then use one reciprocal for both x and y
+        while ((X | Y | Z) >= 0x100000L) {
+            X >>= 1;
+            Y >>= 1;
+            Z >>= 1;
+        }
+        long sum = X + Y + Z;
+        uint32_t recip = 0xFFFFFFFFUL / sum;
+        out[0] = ratio(X, sum, recip);
+        out[1] = ratio(Y, sum, recip);
+        // n = (x - 0.332) / (0.1858 - y), as 16.16 fixed point
+        long n = (10L * out[0] - 3320) * 65536L / (1858 - 10L * out[1]);
+        // CCT = 449 n^3 + 3525 n^2 + 6823.3 n + 5520.33, it is negative or
+        // well above 10000 K outside this range, and the math would overflow
+        if (n < -6 * 65536L || n > 65536L)
+            continue;
+        long t = 449 * n + (3525L << 16);
+        t = mulQ16(t, n) + 447171789L;  // 6823.3 << 16
+        t = mulQ16(t, n) + 361780347L;  // 5520.33 << 16
+        if (t >= 0 && t <= 10000L << 16) // else improbable color temperature
+            out[2] = t >> 16;
+    }
+}
+
 // ISR(WDT_vect) { Sleepy::watchdogEvent(); }
 
 static volatile byte watchdogCounter;
@@ -1182,6 +1607,41 @@ void Sleepy::watchdogEvent() {
     ++watchdogCounter;
 }
 
+void Sensor::run (Sensor* const* list, byte count, byte (*sleepFun)(word ms)) {
+    word pending = 0;
+    if (count > 8 * sizeof pending)
+        return; // more sensors than bits in the pending mask
+    for (byte i = 0; i < count; ++i) {
+        list[i]->start();
+        bitSet(pending, i);
+    }
+    while (pending) {
+        // find the sensor which needs attention first
+        Sensor* next = 0;
+        int wait = 0;
+        for (byte i = 0; i < count; ++i)
+            if (bitRead(pending, i)) {
+                int w = list[i]->readyAt() - (word) millis();
+                if (next == 0 || w < wait) {
+                    next = list[i];
+                    wait = w;
+                }
+            }
+        if (wait > 0) {
+            // sleep or wait, then re-check, since sleep may end prematurely
+            if (sleepFun != 0 && wait >= 16)
+                sleepFun(wait);
+            else
+                delay(wait);
+            continue;
+        }
+        if (next->collect())
+            for (byte i = 0; i < count; ++i)
+                if (list[i] == next)
+                    bitClear(pending, i);
+    }
+}
+
 Scheduler::Scheduler (byte size) : remaining (~0), maxTasks (size) {
     byte bytes = size * sizeof *tasks;
     tasks = (word*) malloc(bytes);
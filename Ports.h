@@ -405,6 +405,40 @@ public:
     byte idle(byte task) { return tasks[task] == ~0U; }
 };
 
+#include "PortsDedup.h"
+
+/// Common interface for sensors which need some time to produce a reading.
+/// Each start() begins a conversion, and collect() must be called once the
+/// time returned by readyAt() has been reached. Sensors which need several
+/// phases (e.g. temperature, then pressure) start their next phase inside
+/// collect() and return false, in which case readyAt() will have moved on.
+/// Use run() to start several sensors at once and collect each of them as
+/// soon as it is done, so that their conversion times overlap.
+class Sensor {
+protected:
+    word due; // millis() value at which collect() should be called
+    /// Set the time when collect() should be called, relative to now.
+    void waitFor(word ms) { due = millis() + ms; }
+public:
+    /// Start a new conversion, this returns without waiting for it.
+    virtual void start() =0;
+    /// Return the (16-bit) millis() value after which collect() can be used.
+    word readyAt() const { return due; }
+    /// Read out the results, once readyAt() has been reached.
+    /// @return true when done, false if another call is needed at readyAt().
+    virtual bool collect() =0;
+
+    /// Start all the sensors in a list, then collect each one when ready.
+    /// @param list Array of pointers to sensors, up to 16.
+    /// @param count Number of entries in the list, with more than 16 nothing
+    ///              is started and this returns right away.
+    /// @param sleepFun Optional low-power delay function, such as
+    ///                 Sleepy::loseSomeTime(), used for waits of 16 ms or
+    ///                 more. Shorter waits always use delay().
+    static void run(Sensor* const* list, byte count,
+                    byte (*sleepFun)(word ms) =0);
+};
+
 /// Interface for the Blink Plug - see http://jeelabs.org/bp
 class BlinkPlug : public Port {
     MilliTimer debounce;
@@ -498,7 +532,7 @@ public:
 };
 
 /// Interface for the Lux Plug - see http://jeelabs.org/xp
-class LuxPlug : public DeviceI2C {
+class LuxPlug : public DeviceI2C, public Sensor {
     union { byte b[4]; word w[2]; } data;
 public:
     enum {
@@ -531,10 +565,16 @@ public:
     const word* getData();
 
     word calcLux(byte iGain =0, byte tInt =2) const;
+
+    /// Power up and wait for one integration period (402 ms by default).
+    virtual void start() { begin(); waitFor(403); }
+    /// Read the data, for use with calcLux(). Does not power down.
+    virtual bool collect() { getData(); return true; }
 };
 
 // Interface for the HYT131 thermometer/hygrometer - see http://jeelabs.org/2012/06/30/new-hyt131-sensor/
-class HYT131 : public DeviceI2C {
+class HYT131 : public DeviceI2C, public Sensor {
+    word raw[2]; // humidity and temperature, as 14-bit values
 public:
     // Constructor for the HYT131 sensor.
     HYT131 (PortI2C& port) : DeviceI2C (port, 0x28) {}
@@ -544,10 +584,16 @@ public:
     // @param humi in which to store the humidity (int, tenths of percent)
     // @param delayFun (optional) supply delayFun that takes ms delay as argument, for low-power waiting during reading (e.g. Sleepy::loseSomeTime()). By default, delay() is used
     void reading (int& temp, int& humi, byte (*delayFun)(word ms) =0);
+
+    // Start a measurement, it will be ready for collect() 100 ms later
+    virtual void start();
+    virtual bool collect();
+    // Convert the readings obtained by collect(), same units as reading()
+    void result (int& temp, int& humi) const;
 };
 
 /// Interface for the Gravity Plug - see http://jeelabs.org/gp
-class GravityPlug : public DeviceI2C {
+class GravityPlug : public DeviceI2C, public Sensor {
     /// Data storage for getAxes() and sensitivity()
     union { byte b[6]; int w[3]; } data;
 public:
@@ -567,6 +613,13 @@ public:
     /// Read out the temperature (only for BMA150, not the older BMA020)
     /// @return temp, in half deg C steps, from -30C to +50C (i.e. times 2)
     char temperature();
+
+    /// The plug measures continuously, start() does nothing.
+    virtual void start() { waitFor(0); }
+    /// Read the axes, same as getAxes(), the results are available via axes().
+    virtual bool collect() { getAxes(); return true; }
+    /// Return the values read by the last getAxes() or collect() call.
+    const int* axes() const { return data.w; }
 };
 
 /// Interface for the Input Plug - see http://jeelabs.org/ip
@@ -582,6 +635,7 @@ public:
 class InfraredPlug : public Port {
     uint8_t slot, gap, buf [40];
     char fill;
+    uint8_t decoded;
     uint32_t prev;
 public:
     /// Initialize with default values for NEC protocol
@@ -596,16 +650,44 @@ public:
     /// Returns number of nibbles read, or 0 if not yet ready
     uint8_t done();
 
-    enum { UNKNOWN, NEC, NEC_REP };
+    enum { UNKNOWN, NEC, NEC_REP, SAMSUNG, SONY, RC5, RC6 };
     /// Try to decode a received packet, return type of packet
-    /// if recognized, the receive buffer will be overwritten with the results
+    /// if recognized, the receive buffer will be overwritten with the results:
+    /// all bits as received (incl. start bits), first one in bit 7 of buf[0].
+    /// RC6 needs a finer slot than the NEC default, i.e. configure(111).
     uint8_t decoder(uint8_t nibbles);
+    /// Number of bits found by the last successful decoder() call
+    uint8_t decodedBits() const { return decoded; }
     
     /// Access to the receive buffer
     const uint8_t* buffer() { return buf; }
     
     /// Send out a bit pattern, cycle time is the "slot4" config value
     void send(const uint8_t* data, uint16_t bits);
+
+    /// The following calls use Timer2 to send in the background, with the
+    /// carrier generated in software. They require an interrupt handler in
+    /// your code which calls timerEvent(), i.e.
+    ///
+    ///     ISR(TIMER2_COMPA_vect) { InfraredPlug::timerEvent(); }
+    ///
+    /// Timer2 is then no longer available for PWM on pins 3 and 11, or tone().
+    /// None of this is available on ATtiny, which has no Timer2.
+
+    /// Set the carrier frequency in Hz for sendBits() and sendTimes(), or 0
+    /// to turn the LED on without modulation during marks (default 38 kHz).
+    static void setCarrier(word hz);
+    /// Queue a bit pattern, same as send() but without waiting for it. The
+    /// data must remain unchanged until sent. Returns false if queue is full.
+    bool sendBits(const uint8_t* data, uint16_t bits);
+    /// Queue alternating mark and space times in us, starting with a mark.
+    /// The data must remain unchanged until sent. Returns false if queue is
+    /// full.
+    bool sendTimes(const word* times, uint8_t count);
+    /// Returns the number of queued transmissions, including the current one.
+    static uint8_t sending();
+    /// This must be called from your Timer2 compare match interrupt code.
+    static void timerEvent();
 };
 
 /// Interface for the Heading Board - see http://jeelabs.org/hb
@@ -660,11 +742,12 @@ public:
 };
 
 /// Interface for the Analog Plug - see http://jeelabs.org/ap
-class AnalogPlug : public DeviceI2C {
-  byte config;
+class AnalogPlug : public DeviceI2C, public Sensor {
+  byte config, channel;
+  long raw;
 public:
   AnalogPlug (const PortI2C& port, byte addr =0x69)
-    : DeviceI2C (port, addr), config (0x1C) {}
+    : DeviceI2C (port, addr), config (0x1C), channel (1) {}
   
   /// Default mode is channel 1, continuous, 18-bit, gain x1
   void begin (byte mode =0x1C);
@@ -672,20 +755,51 @@ public:
   void select (byte channel);
   /// Read out 4 bytes, caller will need to shift out the irrelevant lower bits
   long reading ();
+
+  /// Restart a conversion on the last selected channel, the wait depends on
+  /// the resolution (from about 5 ms for 12-bit, up to 270 ms for 18-bit)
+  virtual void start ();
+  /// Read out the conversion started by start(), see result()
+  virtual bool collect ();
+  /// Value obtained by the last collect(), same format as reading()
+  long result () const { return raw; }
 };
 
 /// Interface for the DHT11 and DHT22 sensors, does not use floating point
-class DHTxx {
+class DHTxx : public Sensor {
   byte pin;
+  byte state;             // 0 = idle, 1 = start pulse, 2 = collecting
+  volatile byte count;    // number of high pulses collected so far
+  volatile byte high;     // true if the last edge seen was a rising one
+  word rise;              // time of the last rising edge, in µs
+  byte widths [41];       // high pulse widths in µs, response + 40 data bits
+  MilliTimer timer;
+  static DHTxx* active;   // the one collecting edges, if any
 public:
   DHTxx (byte pinNum);
   /// Results are returned in tenths of a degree and percent, respectively.
   /// Set "precise" to true for the more accurate DHT21 and DHT22 sensors.
   bool reading (int& temp, int &humi, bool precise =false);
+
+  /// Start a new measurement, without blocking and without disabling
+  /// interrupts. Requires a pin-change interrupt handler in your code which
+  /// calls edge(), for example for pins 0..7 on an ATmega328:
+  ///
+  ///     ISR(PCINT2_vect) { DHTxx::edge(); }
+  ///
+  virtual void start ();
+  /// Call this regularly after start(), returns true once done (or timed out).
+  bool ready ();
+  /// Same as ready(), but sets readyAt() to the next time it should be called.
+  virtual bool collect ();
+  /// Decode the collected data, same results as reading(), after ready().
+  bool result (int& temp, int &humi, bool precise =false);
+  /// This must be called from your pin-change interrupt code.
+  static void edge ();
 };
 
 /// Interface for the Color Plug - see http://jeelabs.org/cp
-class ColorPlug : public DeviceI2C {
+class ColorPlug : public DeviceI2C, public Sensor {
     union { byte b[8]; word w[4]; } data;
     word chromacct[3];
 public:
@@ -711,7 +825,15 @@ public:
     // returns four 16-bit values: red, green, blue, and clear intensities
     const word* getData();
     
+    // returns x and y chromaticity (times 1000), and color temperature (K)
     const word* chromaCCT();
+
+    static void chromaCCT(const word* rgbc, word* out, byte count =1);
+
+    /// Power up and wait for one integration period (12 ms by default).
+    virtual void start() { begin(); waitFor(13); }
+    /// Read the data, for use with chromaCCT().
+    virtual bool collect() { getData(); return true; }
 };
 
 #ifdef Stream_h // only available in recent Arduino IDE versions
@@ -32,6 +32,28 @@ int32_t BMP085::getResult(uint8_t type) {
     return meas[type];
 }
 
+void BMP085::start() {
+    phase = tempCount == 0 ? TEMP : PRES;
+    waitFor(startMeas(phase));
+}
+
+bool BMP085::collect() {
+    getResult(phase);
+    if (phase == PRES) {
+        if (tempCount > 0)
+            --tempCount;
+        return true;
+    }
+    // re-use this temperature for a while, unless it is still changing
+    int16_t prev = temperature();
+    b5 = calcB5(meas[TEMP]);
+    int16_t diff = temperature() - prev;
+    tempCount = -1 <= diff && diff <= 1 ? tempEvery : 1;
+    phase = PRES;
+    waitFor(startMeas(PRES));
+    return false;
+}
+
 ///Call this during setup() if you want to use calculate() later on.
 void BMP085::getCalibData() {
     readFromReg(0xAA);
@@ -53,15 +75,23 @@ void BMP085::getCalibData() {
  * @param pval Raw pressure value.
  */
 void BMP085::calculate(int16_t& tval, int32_t& pval) const {
-    int32_t ut = meas[TEMP], up = meas[PRES];
-    int32_t x1, x2, x3, b3, b5, b6, p;
-    uint32_t b4, b7;
+    int32_t b5 = calcB5(meas[TEMP]);
+    tval = (b5 + 8) >> 4;
+    pval = calcPres(b5, meas[PRES]);
+}
+
+int32_t BMP085::calcB5(int32_t ut) const {
+    int32_t x1, x2;
 
     x1 = (ut - ac6) * ac5 >> 15;
     x2 = ((int32_t) mc << 11) / (x1 + md);
-    b5 = x1 + x2;
-    tval = (b5 + 8) >> 4;
-    
+    return x1 + x2;
+}
+
+int32_t BMP085::calcPres(int32_t b5, int32_t up) const {
+    int32_t x1, x2, x3, b3, b6, p;
+    uint32_t b4, b7;
+
     b6 = b5 - 4000;
     x1 = (b2 * (b6 * b6 >> 12)) >> 11; 
     x2 = ac2 * b6 >> 11;
@@ -77,5 +107,67 @@ void BMP085::calculate(int16_t& tval, int32_t& pval) const {
     x1 = (p >> 8) * (p >> 8);
     x1 = (x1 * 3038) >> 16;
     x2 = (-7357 * p) >> 16;
-    pval = p + ((x1 + x2 + 3791) >> 4);
+    return p + ((x1 + x2 + 3791) >> 4);
+}
+
+// altitude in m for a p/p0 ratio of 0.5 + i/128, i.e. 44330 * (1 - r^0.1903)
+static const int16_t altTab [] PROGMEM = {
+    5478, 5363, 5250, 5138, 5027, 4918, 4810, 4703, 4597, 4493, 4390, 4288,
+    4186, 4086, 3988, 3890, 3793, 3697, 3602, 3508, 3415, 3322, 3231, 3140,
+    3051, 2962, 2874, 2787, 2700, 2614, 2529, 2445, 2362, 2279, 2197, 2115,
+    2034, 1954, 1875, 1796, 1717, 1640, 1563, 1486, 1410, 1335, 1260, 1186,
+    1112, 1039, 966, 894, 823, 752, 681, 611, 541, 472, 403, 335, 267, 200,
+    133, 66, 0, -66, -131, -196, -260, -324, -388, -451, -514, -577, -639,
+    -701, -762, -824, -884, -945
+};
+
+// p0/p ratio times 16384, for an altitude of -512 + 64 * i m,
+// i.e. (1 - h/44330)^-5.255
+static const uint16_t seaTab [] PROGMEM = {
+    15425, 15541, 15658, 15776, 15896, 16016, 16138, 16260, 16384, 16509,
+    16635, 16762, 16890, 17020, 17150, 17282, 17415, 17550, 17685, 17822,
+    17960, 18099, 18240, 18382, 18525, 18669, 18815, 18963, 19111, 19261,
+    19413, 19565, 19720, 19875, 20033, 20191, 20351, 20513, 20676, 20841,
+    21007, 21175, 21345, 21516, 21688, 21863, 22039, 22217, 22396, 22577,
+    22760, 22945, 23132, 23320, 23510, 23702, 23896, 24092, 24289, 24489,
+    24690, 24894, 25099, 25307, 25516, 25728, 25942, 26158, 26376, 26596,
+    26818, 27043, 27270, 27499, 27730, 27964, 28200, 28438, 28679, 28922,
+    29168
+};
+
+/** Calculate the altitude from the pressure, using the international
+ *  barometric formula, but with a lookup table instead of pow().
+ *  Valid from about -900 to 5400 m, to within 1.5 m.
+ *  @param pval Pressure in Pa, as returned by calculate() or pressure().
+ *  @param p0 Pressure at sea level, in Pa.
+ *  @return Altitude in meters.
+ */
+int16_t BMP085::altitude(int32_t pval, int32_t p0) {
+    // ratio p/p0 as 16.16 fixed point, in two steps to avoid overflow
+    int32_t r = (pval << 8) / p0;
+    r = (r << 8) + ((pval << 8) % p0 << 8) / p0;
+    int32_t i = (r - 32768) >> 9;
+    if (i < 0) i = 0;
+    if (i > 78) i = 78;
+    int16_t a = pgm_read_word(altTab + i), b = pgm_read_word(altTab + i + 1);
+    int32_t f = r - 32768 - (i << 9); // 0..511, or beyond at both ends
+    return a + (((b - a) * f + 256) >> 9);
+}
+
+/** Calculate the pressure at sea level, given the altitude at which it was
+ *  measured. This is the inverse of altitude(), also without using pow().
+ *  Valid from -512 to 4608 m, to within about 10 Pa.
+ *  @param pval Pressure in Pa, as returned by calculate() or pressure().
+ *  @param alt Altitude in meters.
+ *  @return Pressure at sea level, in Pa.
+ */
+int32_t BMP085::seaLevel(int32_t pval, int16_t alt) {
+    int16_t h = alt + 512;
+    if (h < 0) h = 0;
+    if (h > 5120) h = 5120;
+    uint8_t i = h >> 6;
+    if (i > 79) i = 79;
+    uint16_t a = pgm_read_word(seaTab + i), b = pgm_read_word(seaTab + i + 1);
+    uint16_t f = a + (((b - a) * (uint32_t) (h - (i << 6)) + 32) >> 6);
+    return ((uint32_t) pval * f + 8192) >> 14;
 }
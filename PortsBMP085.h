@@ -5,14 +5,20 @@
 /// See http://jeelabs.org/pp1
 
 /// Interface for the Pressure Plug - see http://jeelabs.org/pp
-class BMP085 : public DeviceI2C {
+class BMP085 : public DeviceI2C, public Sensor {
     int16_t ac1, ac2, ac3, b1, b2, mb, mc, md;
     uint16_t ac4, ac5, ac6;
+    uint8_t phase; // conversion in progress for start() and collect()
+    uint8_t tempEvery, tempCount; // see setTempInterval()
+    int32_t b5; // temperature term, as calculated by the last collect()
     
     uint16_t readWord(uint8_t last) const
         { uint16_t v = read(0) << 8; return v | read(last); }
     void readFromReg(uint8_t reg) const
         { send(); write(reg); receive(); }
+
+    int32_t calcB5(int32_t ut) const;
+    int32_t calcPres(int32_t b5, int32_t up) const;
             
 public:
     enum { TEMP, PRES };
@@ -23,7 +29,8 @@ public:
     /// @param p I2C port to be used.
     /// @param osrs 0..3 Oversampling setting.
     BMP085 (const PortI2C& p, uint8_t osrs =0)
-        : DeviceI2C (p, 0x77), oss (osrs) {}
+        : DeviceI2C (p, 0x77), tempEvery (1), tempCount (0), b5 (0),
+          oss (osrs) {}
 
     /// Set the oversampling setting for the high resolution mode.
     /// @param osrs 0..3.
@@ -41,6 +48,25 @@ public:
     int32_t measure(uint8_t type)
         { delay(startMeas(type)); return getResult(type); }
 
+    /// Measure temperature and then pressure, without blocking. Results are
+    /// in meas[], same as with measure(), once collect() returns true.
+    /// The temperature is skipped when it is not needed, see setTempInterval().
+    virtual void start();
+    virtual bool collect();
+
+    /// Let start() measure temperature only once every n pressure readings,
+    /// as long as it stays within 0.1 degree of the previous one. The default
+    /// is 1, i.e. always measure both.
+    void setTempInterval(uint8_t n) { tempEvery = n; tempCount = 0; }
+    /// Temperature in tenths of a degree, as obtained by collect().
+    int16_t temperature() const { return (b5 + 8) >> 4; }
+    /// Pressure in Pa, as obtained by collect(), compensated using the last
+    /// temperature reading.
+    int32_t pressure() const { return calcPres(b5, meas[PRES]); }
+
     void getCalibData();
     void calculate(int16_t& tval, int32_t& pval) const;
+
+    static int16_t altitude(int32_t pval, int32_t p0 =101325);
+    static int32_t seaLevel(int32_t pval, int16_t alt);
 };
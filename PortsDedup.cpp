@@ -0,0 +1,76 @@
+/// @file
+/// Duplicate packet detection, see PortsDedup.h.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include "PortsDedup.h"
+#include <stdlib.h>
+#include <string.h>
+#include <util/crc16.h>
+
+// the largest power of 2 which is at most size, as a bit mask
+static byte dedupMask (byte size) {
+    byte n = 1;
+    while (n <= size / 2)
+        n *= 2;
+    return n - 1;
+}
+
+DedupCache::DedupCache (byte size, word tenths)
+        : mask (dedupMask(size) | 1), maxAge (tenths) {
+    slots = (word*) malloc(2 * (mask + 1) * sizeof *slots);
+    clear();
+}
+
+DedupCache::DedupCache (word* buf, byte size, word tenths)
+        : slots (buf), mask (dedupMask(size)), maxAge (tenths) {
+    if (mask == 0)
+        slots = 0; // too small for a pair of entries
+    clear();
+}
+
+void DedupCache::clear() {
+    if (slots != 0)
+        memset(slots, 0, 2 * (mask + 1) * sizeof *slots);
+}
+
+word DedupCache::crc(const void* ptr, byte len) {
+    word sum = ~0;
+    for (byte i = 0; i < len; ++i)
+        sum = _crc16_update(sum, ((const byte*) ptr)[i]);
+    return sum;
+}
+
+bool DedupCache::seen(byte source, word key) {
+    if (slots == 0)
+        return false;
+    // the CRC over the 3 bytes never maps two keys of one source to the same
+    // fingerprint, only keys from different sources can collide
+    word fp = _crc16_update(_crc16_update(_crc16_update(~0, source),
+                                            key), key >> 8);
+    if (fp == 0)
+        fp = 1;
+    word now = millis() / 100;
+    // look in both entries of the pair, and track which one to replace
+    // the pair is picked with other bits than the fingerprint, so that all
+    // 16 bits of it are significant when comparing
+    byte index = (key ^ (key >> 8) ^ source) & mask & ~1;
+    word* pair = slots + index * 2;
+    word* victim = pair;
+    word oldest = 0;
+    for (byte i = 0; i < 4; i += 2) {
+        word age = now - pair[i+1];
+        if (pair[i] == 0 || age > maxAge)
+            age = ~0; // unused or expired, this one can be replaced first
+        else if (pair[i] == fp) {
+            pair[i+1] = now; // keep dropping while repeats keep coming in
+            return true;
+        }
+        if (age >= oldest) {
+            oldest = age;
+            victim = pair + i;
+        }
+    }
+    victim[0] = fp;
+    victim[1] = now;
+    return false;
+}
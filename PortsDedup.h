@@ -0,0 +1,51 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef PortsDedup_h
+#define PortsDedup_h
+
+/// @file
+/// Duplicate packet detection, as used by relays and gateways. This only
+/// depends on millis(), so that it can also be built and benchmarked on a
+/// host, see examples/RF12/ookRelay2/host/dedupBench.cpp.
+
+#if ARDUINO >= 100
+#include <Arduino.h> // Arduino 1.0
+#else
+#include <WProgram.h> // Arduino 0022
+#endif
+
+/// Remembers recently seen packets, so that repeats and retries can be dropped
+/// instead of being reported or forwarded again. Each packet is identified by
+/// a source (node ID, decoder type, etc) and a 16-bit key (CRC, sequence
+/// number, etc). These select a pair of entries in a small table, which store
+/// a 16-bit fingerprint of both. Entries expire once a packet has not been
+/// seen for the specified time. Fingerprints from different sources can collide,
+/// causing a false drop at most once in about 32768 lookups of new packets.
+class DedupCache {
+    word* slots; // pairs of words: fingerprint (0 = unused) and time
+    byte mask;
+    word maxAge;
+public:
+    /// Initialize for a number of entries, which must be a power of 2, and at
+    /// least 2. Other sizes are rounded down to a power of 2, and up to 2.
+    /// With a caller-supplied buffer of less than 2 entries, nothing is kept,
+    /// i.e. seen() then always returns false.
+    /// @param size Number of entries, e.g. 8 or 16 (uses 4 bytes each).
+    /// @param tenths How long to remember each packet, in tenths of seconds.
+    DedupCache (byte size, word tenths =10);
+    DedupCache (word* buf, byte size, word tenths =10);
+
+    /// Check whether a packet has been seen recently, and remember it.
+    /// @return true if this is a repeat, i.e. it should be dropped.
+    bool seen(byte source, word key);
+    /// Same, using a CRC over the packet data as key.
+    bool seen(byte source, const void* ptr, byte len)
+        { return seen(source, crc(ptr, len)); }
+    /// Forget all packets.
+    void clear();
+
+    /// Calculate the CRC-16 of some data, which can be used as key.
+    static word crc(const void* ptr, byte len);
+};
+
+#endif
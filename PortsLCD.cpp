@@ -14,6 +14,8 @@ void LiquidCrystalBase::begin(byte cols, byte lines, byte dotsize) {
   }
   _numlines = lines;
   _currline = 0;
+  _numcols = cols;
+  _currcol = 0;
 
   // for some 1 line displays you can select a 10 pixel high font
   if ((dotsize != 0) && (lines == 1)) {
@@ -85,12 +87,20 @@ void LiquidCrystalBase::clear()
 {
   command(LCD_CLEARDISPLAY);  // clear display, set cursor position to zero
   delayMicroseconds(2000);  // this command takes a long time!
+  _currcol = _currline = 0;
+  if (_buf != 0) {
+    // the display is blank now, so the buffer is blank and up to date as well
+    byte cells = _numcols * _numlines;
+    memset(_buf, ' ', cells);
+    memset(_buf + cells, 0, (cells + 7) / 8);
+  }
 }
 
 void LiquidCrystalBase::home()
 {
   command(LCD_RETURNHOME);  // set cursor position to zero
   delayMicroseconds(2000);  // this command takes a long time!
+  _currcol = _currline = 0;
 }
 
 void LiquidCrystalBase::setCursor(byte col, byte row)
@@ -99,8 +109,12 @@ void LiquidCrystalBase::setCursor(byte col, byte row)
   if ( row > _numlines ) {
     row = _numlines-1;    // we count rows starting w/0
   }
+  _currcol = col;
+  _currline = row;
   
-  command(LCD_SETDDRAMADDR | (col + row_offsets[row]));
+  // with a frame buffer, the cursor is only moved when flushing
+  if (_buf == 0)
+    command(LCD_SETDDRAMADDR | (col + row_offsets[row]));
 }
 
 /// Turn the display on/off (quickly)
@@ -171,10 +185,74 @@ void LiquidCrystalBase::createChar(byte location, byte charmap[]) {
   location &= 0x7; // we only have 8 locations 0-7
   command(LCD_SETCGRAMADDR | (location << 3));
   for (int i=0; i<8; i++) {
-    write(charmap[i]);
+    send(charmap[i], HIGH); // not write(), this must bypass the frame buffer
+  }
+  if (_buf != 0)
+    command(LCD_SETDDRAMADDR); // switch back to DDRAM, flush will move it
+}
+
+/// Keep all written characters in a frame buffer, and only send them to the
+/// display when flush() is called, and only if they actually changed. The
+/// buffer must be LCD_BUFSIZE(cols, rows) bytes. This assumes left-to-right
+/// text and no autoscroll. Also, setCursor() only takes effect in the buffer,
+/// i.e. the visible cursor (if enabled) will be left wherever flush() ends up.
+void LiquidCrystalBase::useBuffer(byte* buf) {
+  _buf = buf;
+  if (_buf != 0) {
+    // contents of the display are unknown, so mark every cell as changed
+    byte cells = _numcols * _numlines;
+    memset(_buf, ' ', cells);
+    memset(_buf + cells, 0xFF, (cells + 7) / 8);
   }
 }
 
+/// Send all changed characters in the frame buffer to the display, with one
+/// cursor move for each run of consecutive changed characters in a row. At
+/// most "limit" characters are sent per call, so that flush() can be called
+/// often in a loop without stalling other work. Calling flush() without a
+/// limit, as Print::flush(), sends all changes at once.
+/// @return true if there are more changes, which still need to be sent.
+bool LiquidCrystalBase::flush(byte limit) {
+  static const byte row_offsets[] = { 0x00, 0x40, 0x14, 0x54 };
+  if (_buf == 0)
+    return false;
+  byte cells = _numcols * _numlines;
+  byte* dirty = _buf + cells;
+  byte pending = 0;
+  for (byte row = 0; row < _numlines; ++row) {
+    byte pos = row * _numcols;
+    for (byte col = 0; col < _numcols; ) {
+      byte n = 0;
+      while (col + n < _numcols && bitRead(dirty[(pos + n) / 8], (pos + n) % 8))
+        ++n;
+      if (n == 0) {
+        ++col;
+        ++pos;
+      } else if (limit == 0) {
+        pending = 1;
+        break;
+      } else {
+        if (n > limit)
+          n = limit;
+        command(LCD_SETDDRAMADDR | (col + row_offsets[row]));
+        sendChars(_buf + pos, n);
+        for (byte i = 0; i < n; ++i, ++pos)
+          bitClear(dirty[pos / 8], pos % 8);
+        col += n;
+        limit -= n;
+      }
+    }
+  }
+  return pending;
+}
+
+/// Send a number of characters to consecutive positions on the display.
+/// This can be overridden to send them more efficiently than one by one.
+void LiquidCrystalBase::sendChars(const byte* data, byte count) {
+  while (count-- > 0)
+    send(*data++, HIGH);
+}
+
 /*********** mid level commands, for sending data/cmds */
 
 inline void LiquidCrystalBase::command(byte value) {
@@ -182,7 +260,19 @@ inline void LiquidCrystalBase::command(byte value) {
 }
 
 inline WRITE_RESULT LiquidCrystalBase::write(byte value) {
-  send(value, HIGH);
+  if (_buf == 0)
+    send(value, HIGH);
+  else {
+    // only update the frame buffer, and mark the cell if it changed
+    if (_currcol < _numcols && _currline < _numlines) {
+      byte pos = _currline * _numcols + _currcol;
+      if (_buf[pos] != value) {
+        _buf[pos] = value;
+        bitSet(_buf[_numcols * _numlines + pos / 8], pos % 8);
+      }
+    }
+    ++_currcol;
+  }
 #if ARDUINO >= 100 && !defined(__AVR_ATtiny84__) && !defined(__AVR_ATtiny85__) && !defined(__AVR_ATtiny44__) && !defined(__AVR_ATtiny45__)
   return 1;
 #endif
@@ -371,6 +461,24 @@ void LiquidCrystalI2C::send(byte value, byte mode) {
   write4bits((value & 0x0F) | mode);
 }
 
+/// send a burst of characters as one I2C transaction, this works because
+/// sequential mode is off (SEQOP = 1), so all bytes written go to GPIO
+void LiquidCrystalI2C::sendChars(const byte* data, byte count) {
+  device.send();
+  device.write(MCP_GPIO);
+  while (count-- > 0) {
+    byte c = *data++;
+    for (byte i = 0; i < 2; ++i) {
+      byte value = (i == 0 ? c >> 4 : c & 0x0F) |
+                    MCP_REGSEL | MCP_BACKLIGHT | MCP_ENABLE;
+      device.write(value);
+      device.write(value ^ MCP_ENABLE);
+      device.write(value);
+    }
+  }
+  device.stop();
+}
+
 void LiquidCrystalI2C::write4bits(byte value) {
   value |= MCP_BACKLIGHT | MCP_ENABLE;
   device.send();
@@ -49,6 +49,9 @@
 #define LCD_5x10DOTS 0x04
 #define LCD_5x8DOTS 0x00
 
+/// Size of the buffer needed by useBuffer(), for the given display size.
+#define LCD_BUFSIZE(cols, rows) ((cols) * (rows) + ((cols) * (rows) + 7) / 8)
+
 /// Base class for different types of interfaces to character LCD's.
 /// This class defines the basic functionality needed to drive an LCD display.
 /// It is an incomplete (abstract) base class, which needs to be extended.
@@ -56,7 +59,7 @@
 
 class LiquidCrystalBase : public Print {
 public:
-  LiquidCrystalBase () {}
+  LiquidCrystalBase () : _buf (0) {}
   
   void begin(byte cols, byte rows, byte charsize = LCD_5x8DOTS);
 
@@ -80,16 +83,23 @@ public:
   void setCursor(byte, byte); 
   virtual WRITE_RESULT write(byte);
   void command(byte);
+
+  void useBuffer(byte* buf);
+  bool flush(byte limit);
+  virtual void flush() { flush(255); } // overrides Print::flush()
 protected:
   virtual void config() =0;
   virtual void send(byte, byte) =0;
   virtual void write4bits(byte) =0;
+  virtual void sendChars(const byte*, byte);
 
   byte _displayfunction;
   byte _displaycontrol;
   byte _displaymode;
   byte _initialized;
   byte _numlines,_currline;
+  byte _numcols,_currcol;
+  byte* _buf; // optional frame buffer, with one dirty bit per cell at the end
 };
 
 /// Interface to character LCD's connected via 4 to 8 I/O pins.
@@ -142,6 +152,7 @@ protected:
   virtual void config();
   virtual void send(byte, byte);
   virtual void write4bits(byte);
+  virtual void sendChars(const byte*, byte);
 };
 
 #endif
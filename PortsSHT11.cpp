@@ -103,8 +103,8 @@ uint8_t SHT11::readByte(uint8_t ack) const {
     return value;
 }
 
-///Call this during setup()
-void SHT11::start() const {
+// transmission start sequence, also resets the crc
+void SHT11::transStart() const {
     clock(0);
     mode(OUTPUT);
     digiWrite(1);
@@ -129,7 +129,7 @@ void SHT11::connReset() const {
         clock(1);
         clock(0);
     }
-    start();
+    transStart();
 }
 
 void SHT11::softReset() const {
@@ -139,7 +139,7 @@ void SHT11::softReset() const {
 }
 
 uint8_t SHT11::readStatus() const {
-    start();
+    transStart();
     writeByte(STATUS_REG_R);
     uint8_t value = readByte(1);
     readByte(0);
@@ -147,7 +147,7 @@ uint8_t SHT11::readStatus() const {
 }
 
 void SHT11::writeStatus(uint8_t value) const {
-    start();
+    transStart();
     writeByte(STATUS_REG_W);
     writeByte(value);
 }
@@ -159,22 +159,10 @@ void SHT11::writeStatus(uint8_t value) const {
  *  @return raw sensor value
  */
 uint8_t SHT11::measure(uint8_t type, void (*delayFun)()) {
-    start();
-    writeByte(type == TEMP? MEASURE_TEMP : MEASURE_HUMI);
+    startMeas(type);
     for (uint8_t i = 0; i < 250; ++i) {
-        if (!digiRead()) {
-            meas[type] = readByte(1) << 8;
-            meas[type] |= readByte(1);
-            uint8_t flipped = 0;
-            for (uint8_t j = 0x80; j != 0; j >>= 1) {
-                flipped >>= 1;
-                if (crc8 & j)
-                    flipped |= 0x80;
-            }
-            if (readByte(0) != flipped)
-                break;
-            return 0;
-        }
+        if (ready())
+            return getResult();
         if (delayFun)
             delayFun();
         else
@@ -184,6 +172,126 @@ uint8_t SHT11::measure(uint8_t type, void (*delayFun)()) {
     return 1;
 }
 
+/** Start a measurement, without waiting for it to complete. This takes up to
+ *  320 ms for 14-bit readings, during which the caller can do other work or
+ *  sleep, then poll ready() and call getResult() once it returns true.
+ *  @param type SHT11::TEMP or SHT11::HUMI
+ */
+void SHT11::startMeas(uint8_t type) {
+    pending = type;
+    transStart();
+    writeByte(type == TEMP? MEASURE_TEMP : MEASURE_HUMI);
+}
+
+/** Collect the result of the measurement started with startMeas(), and store
+ *  it in meas[TEMP] or meas[HUMI]. Only call this once ready() returns true.
+ *  @return 0 if ok, 1 if the CRC check failed
+ */
+uint8_t SHT11::getResult() {
+    // redo the crc of the command, in case another SHT11 was used meanwhile
+    crc8 = 0;
+    crcFun(pending == TEMP? MEASURE_TEMP : MEASURE_HUMI);
+    meas[pending] = readByte(1) << 8;
+    meas[pending] |= readByte(1);
+    uint8_t flipped = 0;
+    for (uint8_t j = 0x80; j != 0; j >>= 1) {
+        flipped >>= 1;
+        if (crc8 & j)
+            flipped |= 0x80;
+    }
+    if (readByte(0) == flipped)
+        return 0;
+    connReset();
+    return 1;
+}
+
+void SHT11::start() {
+    startMeas(TEMP);
+    polls = 0;
+    waitFor(320); // worst case for 14-bit
+}
+
+bool SHT11::collect() {
+    if (!ready()) {
+        if (++polls < 10) { // not done yet, check again a bit later
+            waitFor(10);
+            return false;
+        }
+        connReset(); // no response, meas[] keeps its previous value
+    } else {
+        uint16_t previous = meas[pending];
+        // only a failed check counts when enableCRC() was called, else
+        // getResult() compares against a CRC which was never calculated
+        if (getResult() != 0 && crcFun != &dummyCRC)
+            meas[pending] = previous; // bad CRC, keep the previous value
+    }
+    if (pending == HUMI)
+        return true;
+    startMeas(HUMI);
+    polls = 0;
+    waitFor(80); // worst case for 12-bit
+    return false;
+}
+
+/** Calculate the current relative humidity and temperature, like calculate()
+ *  below, but in tenths and using only integer arithmetic. Results are within
+ *  0.1 of the float version (except right at the 99% clamping point), and this
+ *  also works on ATtiny, where the float version is not available.
+ *  @param rh_true Variable to store the true relative humidity into, in tenths
+ *                 of a percent.
+ *  @param t_C Variable to store the temperature into, in tenths of a degree.
+ */
+void SHT11::calculateInt(int& rh_true, int& t_C) const {
+    int t = meas[TEMP] - 3966; // in hundredths of a degree, for 3.3 V
+    t_C = (t + (t >= 0 ? 5 : -5)) / 10;
+
+    // same coefficients as in the float version, in units of 0.0001 %RH
+    long rh = meas[HUMI];
+    long rh_e4 = -20468 + 367 * rh - ((((rh * rh) >> 6) * 1046) >> 10)
+                    + (t - 2500L) * (500 + 4 * rh) / 500;
+    if (rh_e4 > 990000) rh_e4 = 1000000;
+    if (rh_e4 < 1000) rh_e4 = 1000;
+    rh_true = (rh_e4 + 500) / 1000;
+}
+
+// log2(1 + i/16) for i = 0..16, scaled by 4096
+static const uint16_t log2Tab [] PROGMEM = {
+    0, 358, 696, 1016, 1319, 1607, 1882, 2145, 2396,
+    2637, 2869, 3092, 3307, 3514, 3715, 3908, 4096
+};
+
+// natural log of x / 1000, scaled by 4096, for x in 1..1000
+static long lnPermille (uint16_t x) {
+    uint8_t e = 0;
+    while ((x >> e) > 1)
+        ++e;
+    uint16_t f = (x << (15 - e)) & 0x7FFF; // fraction after the top 1 bit
+    uint8_t i = f >> 11;
+    uint16_t a = pgm_read_word(log2Tab + i), b = pgm_read_word(log2Tab + i + 1);
+    long log2x = ((long) e << 12) + a + (((b - a) * (long) (f & 0x7FF)) >> 11);
+    // subtract log2(1000), then convert from log2 to ln, i.e. times ln(2)
+    return ((log2x - 40820) * 45426) >> 16;
+}
+
+/** Calculate the current dewpoint based on h and t, like dewpoint() below,
+ *  but in tenths and using only integer arithmetic and a small log2 table.
+ *  Results are within 0.1 degree of the float version, for h >= 1%.
+ *  @param h The relative humidity, in tenths of a percent (1..1000).
+ *  @param t The temperature, in tenths of a degree.
+ *  @return The dewpoint, in tenths of a degree.
+ */
+int SHT11::dewpointInt(int h, int t) {
+    if (h < 1) h = 1;
+    if (h > 1000) h = 1000;
+    // k = ln(h/100) + 17.62*t/(243.12+t), scaled by 4096
+    long num = 1762L * t, den = 243120L + 100L * t;
+    long k = lnPermille(h) + (num / den << 12) + ((num % den << 12) / den);
+    // dewpoint = 243.12*k/(17.62-k), in tenths
+    num = 24312L * k;
+    den = (72172 - k) * 10;
+    return (num + (num >= 0 ? den / 2 : -den / 2)) / den;
+}
+
 #if !defined(__AVR_ATtiny84__) && !defined(__AVR_ATtiny44__)
 /** Calculate the current relative humidity and temperature.
  *  @param rh_true Variable to store the true relative humidity into.
@@ -213,6 +321,4 @@ float SHT11::dewpoint(float h, float t) {
     float k = (log10(h)-2)/0.4343 + (17.62*t)/(243.12+t); 
     return 243.12*k/(17.62-k);  
 } 
-#else
-//XXX TINY!
 #endif
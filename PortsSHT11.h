@@ -5,18 +5,21 @@
 
 /// Interface to the SHT11 temperature + humidity sensor.
 /// See: http://jeelabs.org/rb1
-class SHT11 : public Port {
+class SHT11 : public Port, public Sensor {
     void clock(uint8_t x) const;
     void release() const;
 
     uint8_t writeByte(uint8_t value) const;
     uint8_t waitAck() const;
     uint8_t readByte(uint8_t ack) const;
-    void start() const;
+    void transStart() const;
 
     static void crcCalc(uint8_t x);    
     static void (*crcFun)(uint8_t);
     static uint8_t crc8;
+    
+    uint8_t pending; // type of the measurement started with startMeas()
+    uint8_t polls;   // number of times collect() found the sensor still busy
 public:
     static void enableCRC();
     
@@ -25,7 +28,7 @@ public:
 
     /// Initialize this SHT11 instance.
     /// @param num The number of the port to which the SHT11 is connected.
-    SHT11 (uint8_t num) : Port (num) { connReset(); }
+    SHT11 (uint8_t num) : Port (num), pending (TEMP), polls (0) { connReset(); }
     
     void connReset() const;
     void softReset() const;
@@ -35,11 +38,24 @@ public:
 
     uint8_t measure(uint8_t type, void (*delayFun)() =0);
 
+    void startMeas(uint8_t type);
+    /// Returns true once the measurement started with startMeas() is done.
+    uint8_t ready() const { return !digiRead(); }
+    uint8_t getResult();
+
+    /// Measure temperature and then humidity, without blocking. Results are
+    /// in meas[], same as with measure(), once collect() returns true. When a
+    /// reading gets no response or fails the CRC check (with enableCRC()),
+    /// its entry in meas[] keeps the previous value.
+    virtual void start();
+    virtual bool collect();
+
+    void calculateInt(int& rh_true, int& t_C) const;
+    static int dewpointInt(int h, int t);
+
 #if !defined(__AVR_ATtiny84__) && !defined(__AVR_ATtiny44__)
     void calculate(float& rh_true, float& t_C) const;
 
     static float dewpoint(float h, float t);
-#else
-    //XXX TINY!
 #endif
 };
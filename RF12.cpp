@@ -7,6 +7,7 @@
 #include <util/crc16.h>
 #include <avr/eeprom.h>
 #include <avr/sleep.h>
+#include <util/atomic.h>
 #if ARDUINO >= 100
 #include <Arduino.h> // Arduino 1.0
 #else
@@ -145,6 +146,8 @@ static uint8_t cs_pin = SS_BIT;     // chip select pin
 static uint8_t nodeid;              // address of this node
 static uint8_t group;               // network group
 static uint16_t frequency;          // Frequency within selected band
+static uint8_t radioBand;           // frequency band, 0 if not initialized
+static uint8_t asleep;              // set while put to sleep by rf12_sleep()
 static volatile uint8_t rxfill;     // number of data bytes in rf12_buf
 static volatile int8_t rxstate;     // current transceiver state
 
@@ -162,9 +165,32 @@ volatile uint8_t rf12_buf[RF_MAX];  // recv/xmit buf, including hdr & crc bytes
 long rf12_seq;                      // seq number of encrypted packet (or -1)
 static uint8_t rf12_fixed_pkt_len;  // fixed packet length reception
 
+uint8_t rf12_sub;                   // subscriber tag of last matching filter
+
+static const uint16_t* hopTable;    // frequency values to hop across
+static uint8_t hopCount;            // number of entries in hopTable, 0 = off
+static uint16_t hopDwell;           // ms to stay on each frequency
+static uint32_t hopStart;           // millis() value at the start of slot 0
+static uint16_t hopFreq;            // frequency the radio is now tuned to
+static const RF12Filter* volatile filterTable; // receive filter (null if off)
+static volatile uint8_t filterCount; // number of entries in filterTable
+
+#define SPECK_ROUNDS 27             // also the number of Speck round keys
+
 static uint32_t seqNum;             // encrypted send sequence number
-static uint32_t cryptKey[4];        // encryption key to use
+static uint32_t* cryptKey;          // encryption key, or Speck round keys
+static uint32_t groupKey[SPECK_ROUNDS]; // single key, from rf12_encrypt()
 void (*crypter)(uint8_t);           // does en-/decryption (null if disabled)
+static uint8_t cryptMax;            // max payload the crypter has room for
+
+#define KEY_SLOTS   4               // number of per-node keys cached in RAM
+#define KEY_NODES   32              // number of keys in the key table
+
+static const uint8_t* keyTable;     // EEPROM base of the per-node key table
+static uint8_t keyNode[KEY_SLOTS];  // node ID of each cached key, 0xFF = free
+static uint32_t keyCache[KEY_SLOTS][SPECK_ROUNDS]; // keys, or round keys
+static uint8_t keyVictim;           // cache slot to replace on the next miss
+static uint32_t lastSeq[RF12_HDR_MASK+1]; // last accepted auth seq, per node
 
 #if RF12_COMPAT
 const uint8_t whitening[] = {
@@ -317,6 +343,22 @@ uint16_t rf12_control(uint16_t cmd) {
     return r;
 }
 
+// called from the ISR as soon as the header byte is in, returns true if the
+// packet should be received, i.e. if any entry in the filter table matches
+static uint8_t rf12_filter () {
+    const RF12Filter* table = filterTable;
+    uint8_t count = filterCount;
+    for (uint8_t i = 0; i < count; ++i) {
+        const RF12Filter* f = table + i;
+        if ((f->group == 0 || f->group == rf12_grp) &&
+                (rf12_hdr & f->hdrMask) == f->hdrMatch) {
+            rf12_sub = f->sub;
+            return 1;
+        }
+    }
+    return 0;
+}
+
 static void rf12_interrupt () {
     // a transfer of 2x 16 bits @ 2 MHz over SPI takes 2x 8 us inside this ISR
     // correction: now takes 2 + 8 µs, since sending can be done at 8 MHz
@@ -334,7 +376,12 @@ static void rf12_interrupt () {
         rf12_buf[rxfill++] = in;
         rf12_crc = crc_update(rf12_crc, in);
 
-        if (rxfill >= rf12_len + 5 + RF12_COMPAT || rxfill >= RF_MAX)
+        // drop unwanted packets as soon as the header byte has come in
+        if (rxfill == 2 + 2 * RF12_COMPAT && filterTable != 0 &&
+                !rf12_filter()) {
+            rf12_xfer(RF_IDLE_MODE);
+            rxstate = TXIDLE; // rf12_recvDone() will restart reception
+        } else if (rxfill >= rf12_len + 5 + RF12_COMPAT || rxfill >= RF_MAX)
             rf12_xfer(RF_IDLE_MODE);
     } else {
         uint8_t out;
@@ -392,6 +439,22 @@ static void rf12_interrupt () {
     #endif
 #endif
 
+// pick the frequency for a time slot, in a pseudo-random order per net group
+static uint16_t rf12_hopFrequency (uint16_t slot) {
+    uint16_t h = _crc16_update(group, slot);
+    h = _crc16_update(h, slot >> 8);
+    return hopTable[h % hopCount];
+}
+
+// retune the radio if the current time slot uses a different frequency
+static void rf12_hopCheck () {
+    uint16_t f = rf12_hopFrequency(rf12_hopSlot());
+    if (f != hopFreq) {
+        hopFreq = f;
+        rf12_control(0xA000 + f); // keeps the radio interrupt out meanwhile
+    }
+}
+
 static void rf12_recvStart () {
     if (rf12_fixed_pkt_len) {
         rf12_rawlen = rf12_fixed_pkt_len;
@@ -439,6 +502,9 @@ static void rf12_recvStart () {
 ///      }
 /// @see http://jeelabs.org/2010/12/11/rf12-acknowledgements/
 uint8_t rf12_recvDone () {
+    if (hopCount != 0 && (rxstate == TXIDLE ||
+                            (rxstate == TXRECV && rxfill == 0)))
+        rf12_hopCheck();
     if (rxstate == TXRECV &&
             (rxfill >= rf12_len + 5 + RF12_COMPAT || rxfill >= RF_MAX)) {
         rxstate = TXIDLE;
@@ -504,13 +570,19 @@ void rf12_sendStart (uint8_t hdr) {
     rf12_hdr = hdr & RF12_HDR_DST ? hdr :
                 (hdr & ~RF12_HDR_MASK) + (nodeid & NODE_ID);
 #endif
-    if (crypter != 0)
+    if (crypter != 0) {
+        // truncate what doesn't fit in the buffer with the added crypto bytes
+        if (rf12_len > cryptMax)
+            rf12_rawlen -= rf12_len - cryptMax;
         crypter(1);
+    }
 
     rf12_crc = crc_initVal;
 #if RF12_VERSION >= 2 && !RF12_COMPAT
     rf12_crc = crc_update(rf12_crc, group);
 #endif
+    if (hopCount != 0)
+        rf12_hopCheck();
     rxstate = TXPRE1;
     rf12_xfer(RF_XMITTER_ON); // bytes will be fed via interrupts
 }
@@ -542,7 +614,8 @@ void rf12_sendStart (uint8_t hdr) {
 ///            packet to send, and flags such as whether this should be
 ///            acknowledged - or if it actually is an acknowledgement.
 /// @param ptr Pointer to the data to send as packet.
-/// @param len Number of data bytes to send. Must be in the range 0 .. 65.
+/// @param len Number of data bytes to send. Must be in the range 0 .. 65, or
+///            0 .. 58 with rf12_encryptAuth(), longer payloads are truncated.
 void rf12_sendStart (uint8_t hdr, const void* ptr, uint8_t len) {
     rf12_rawlen = len;
 #if RF12_COMPAT
@@ -592,6 +665,76 @@ void rf12_sendWait (uint8_t mode) {
         }
 }
 
+// radio settings which do not depend on the args passed to rf12_initialize()
+static const uint16_t initCmds[] PROGMEM = {
+    0xC2AC, // AL,!ml,DIG,DQD4
+    0xC483, // @PWR,NO RSTRIC,!st,!fi,OE,EN
+    0xCC77, // OB1，OB0, LPX,！ddy，DDIT，BW0
+    0xE000, // NOT USE
+    0xC800, // NOT USE
+    0xC049, // 1.66MHz,3.1V
+    0
+};
+
+// configuration setting for each frequency band, index is the band arg
+static const uint16_t bandCmds[] PROGMEM = {
+    0x80C7, // EL (ena TX), EF (ena RX FIFO), 12.0pF, no band
+    0x80D7, // same, 433 MHz
+    0x80E7, // same, 868 MHz
+    0x80F7, // same, 915 MHz
+};
+
+// sync pattern settings, without and with the net group as second sync byte
+static const uint16_t syncCmds[][2] PROGMEM = {
+    { 0xCA8B, 0xCE2D }, // FIFO8,1-SYNC,!ff,DR - SYNC=2D
+    { 0xCA83, 0xCE00 }, // FIFO8,2-SYNC,!ff,DR - SYNC=2DXX, group added
+};
+
+// modem settings for one profile: the data rate is 10000/29/(1+div) Kbps, the
+// receiver bandwidth is given as its code, i.e. 1 = 400 .. 6 = 67 kHz, with
+// VDI,FAST,0dBm,-91dBm, and the deviation is a multiple of 15 kHz, the low 3
+// bits of the TX setting are filled in with the power attenuation
+#define PROFILE(div, bw, fdev) { \
+    0xC600 | (div), 0x9402 | (bw) << 5, 0x9800 | ((fdev) / 15 - 1) << 4 }
+
+static const uint16_t profileCmds[][3] PROGMEM = {
+    PROFILE(0x47, 6,  45), // 4.8 Kbps, 67 kHz
+    PROFILE(0x23, 6,  45), // 9.6 Kbps, 67 kHz
+    PROFILE(0x11, 5,  60), // 19.2 Kbps, 134 kHz
+    PROFILE(0x08, 5,  90), // 38.4 Kbps, 134 kHz
+    PROFILE(0x06, 5,  90), // 49.2 Kbps, 134 kHz, the default
+    PROFILE(0x05, 4, 120), // 57.6 Kbps, 200 kHz
+};
+
+static uint8_t radioProfile = RF12_PROFILE_49K2; // set by rf12_setProfile()
+static uint8_t radioPower;          // TX attenuation in 2.5 dB steps, 0 = max
+
+// one of the 3 commands for the selected modem profile and power level
+static uint16_t rf12_profileCmd (uint8_t i) {
+    uint16_t cmd = pgm_read_word(profileCmds[radioProfile] + i);
+    return i == 2 ? cmd | radioPower : cmd;
+}
+
+/// @details
+/// Select the data rate, receiver bandwidth, and frequency deviation, as one
+/// of the RF12_PROFILE_* values, and the transmit power. This can be called
+/// before or after rf12_initialize(), the settings are also kept for later
+/// calls to it. All nodes which need to talk to each other must use the same
+/// profile. The default is RF12_PROFILE_49K2, at full power.
+/// @param profile One of RF12_PROFILE_4K8 .. RF12_PROFILE_57K6, other values
+///                are ignored.
+/// @param power Attenuation of the transmit power, in steps of 2.5 dB, from 0
+///              for full power down to 7 for -17.5 dB.
+void rf12_setProfile (uint8_t profile, uint8_t power) {
+    if (profile >= sizeof profileCmds / sizeof *profileCmds)
+        return;
+    radioProfile = profile;
+    radioPower = power & 7;
+    if (radioBand != 0) // else rf12_initialize() will send it
+        for (uint8_t i = 0; i < 3; ++i)
+            rf12_control(rf12_profileCmd(i));
+}
+
 /// @details
 /// Call this once with the node ID (0-31), frequency band (0-3), and
 /// optional group (0-255 for RFM12B, only 212 allowed for RFM12).
@@ -623,10 +766,31 @@ void rf12_sendWait (uint8_t mode) {
 /// rf12_initialize. The choice whether to use rf12_initialize() or
 /// rf12_config() at the top of every sketch is one of personal preference.
 /// To set EEPROM settings for use with rf12_config() use the RF12demo sketch.
+///
+/// When the RFM12B was put to sleep with rf12_sleep() and rf12_initialize() is
+/// called again with the same arguments, the radio is simply woken up again:
+/// it retains all its settings while asleep, so there is no need to wait for
+/// its power-up reset or to send all the commands again. This keeps the awake
+/// time short for battery-powered nodes which re-initialize after each sleep.
+/// If the radio's power was actually removed, call rf12_sleep(RF12_WAKEUP)
+/// first, to force a full initialization.
 uint8_t rf12_initialize (uint8_t id, uint8_t band, uint8_t g, uint16_t f) {
+    // warm restart: the RFM12B keeps all its settings while asleep, so if it
+    // was put to sleep by rf12_sleep() and nothing changed, just wake it up
+    if (asleep && id == nodeid && band == radioBand && g == group &&
+                                                    f == frequency) {
+        rf12_xfer(RF_WAKEUP_TIMER); // disable the wake-up timer
+        rf12_xfer(RF_IDLE_MODE);
+        asleep = 0;
+        rxstate = TXIDLE;
+        return nodeid = id;
+    }
+
     nodeid = id;
     group = g;
     frequency = f;
+    radioBand = band;
+    asleep = 0;
 // caller should validate!    if (frequency < 96) frequency = 1600;
 
     rf12_spiInit();
@@ -638,24 +802,15 @@ uint8_t rf12_initialize (uint8_t id, uint8_t band, uint8_t g, uint16_t f) {
     while (digitalRead(RFM_IRQ) == 0)
         rf12_xfer(0x0000);
 
-    rf12_xfer(0x80C7 | (band << 4)); // EL (ena TX), EF (ena RX FIFO), 12.0pF
+    rf12_xfer(pgm_read_word(bandCmds + (band & 3)));
     rf12_xfer(0xA000 + frequency); // 96-3960 freq range of values within band
-    rf12_xfer(0xC606); // approx 49.2 Kbps, i.e. 10000/29/(1+6) Kbps
-    rf12_xfer(0x94A2); // VDI,FAST,134kHz,0dBm,-91dBm
-    rf12_xfer(0xC2AC); // AL,!ml,DIG,DQD4
-    if (group != 0) {
-        rf12_xfer(0xCA83); // FIFO8,2-SYNC,!ff,DR
-        rf12_xfer(0xCE00 | group); // SYNC=2DXX；
-    } else {
-        rf12_xfer(0xCA8B); // FIFO8,1-SYNC,!ff,DR
-        rf12_xfer(0xCE2D); // SYNC=2D；
-    }
-    rf12_xfer(0xC483); // @PWR,NO RSTRIC,!st,!fi,OE,EN
-    rf12_xfer(0x9850); // !mp,90kHz,MAX OUT
-    rf12_xfer(0xCC77); // OB1，OB0, LPX,！ddy，DDIT，BW0
-    rf12_xfer(0xE000); // NOT USE
-    rf12_xfer(0xC800); // NOT USE
-    rf12_xfer(0xC049); // 1.66MHz,3.1V
+    const uint16_t* sync = syncCmds[group != 0];
+    rf12_xfer(pgm_read_word(sync));
+    rf12_xfer(pgm_read_word(sync + 1) | group);
+    for (uint8_t i = 0; i < 3; ++i)
+        rf12_xfer(rf12_profileCmd(i));
+    for (const uint16_t* p = initCmds; pgm_read_word(p) != 0; ++p)
+        rf12_xfer(pgm_read_word(p));
 
     rxstate = TXIDLE;
 #if PINCHG_IRQ
@@ -774,6 +929,9 @@ void rf12_configDump () {
     if (flags & 0x08) {
         Serial.print(" q1");
     }
+    if (flags & 0x10) {
+        Serial.print(" u1");
+    }
     if (flags & 0x03) {
         Serial.print(" x");
         Serial.print(flags & 0x03);
@@ -811,6 +969,7 @@ void rf12_sleep (char n) {
         if (n > 0)
             rf12_control(RF_WAKEUP_MODE);
     }
+    asleep = n >= 0;
     rxstate = TXIDLE;
 }
 
@@ -925,6 +1084,63 @@ char rf12_easySend (const void* data, uint8_t size) {
     return 1;
 }
 
+/// @details
+/// Set up frequency hopping, so that a single narrowband interferer can no
+/// longer take out all the communication within a net group. Time is divided
+/// into slots of "dwell" ms each, and the radio hops to a new frequency from
+/// the given list at the start of each slot. The order depends on the slot
+/// number and the net group, so different groups use different hop sequences.
+///
+/// The radio is retuned inside rf12_recvDone() (only when no packet is coming
+/// in) and rf12_sendStart(), so these need to be called regularly, as usual.
+/// Retries which are sent after more than "dwell" ms (such as those of the
+/// rf12_easyPoll() code, which waits 1000 ms) will be sent on another frequency.
+///
+/// All nodes in a group need to agree on the current slot. One node, usually
+/// the central node, acts as time reference and sends out beacon packets with
+/// its slot number. All other nodes use that to resynchronize:
+///
+///     // central node, every few seconds:
+///     uint16_t slot = rf12_hopSlot();
+///     rf12_sendStart(0, &slot, sizeof slot);
+///
+///     // other nodes, after receiving a beacon:
+///     rf12_hopSync(*(uint16_t*) rf12_data);
+///
+/// Beacons sent right at the start of a slot keep the nodes in step to within
+/// a few ms, see the hopBeacon example.
+///
+/// Call this after rf12_initialize(). The slot counter starts at 0.
+/// @param table Pointer to an array of frequency values in RAM, in the same
+///              units as the last arg of rf12_initialize(). Must remain valid
+///              while hopping is enabled. A null pointer turns hopping off.
+/// @param count Number of entries in the table.
+/// @param dwell Number of milliseconds to stay on each frequency.
+void rf12_hopInit (const uint16_t* table, uint8_t count, uint16_t dwell) {
+    hopTable = table;
+    hopCount = table != 0 ? count : 0;
+    hopDwell = dwell;
+    hopStart = millis();
+    hopFreq = frequency;
+    if (hopCount == 0)
+        rf12_control(0xA000 + frequency); // back to the fixed frequency
+}
+
+/// @details
+/// Return the current frequency hopping time slot number. This can be sent to
+/// other nodes in a beacon packet, so that they can use rf12_hopSync().
+uint16_t rf12_hopSlot () {
+    return hopDwell != 0 ? (millis() - hopStart) / hopDwell : 0;
+}
+
+/// @details
+/// Resynchronize the frequency hopping time slots with another node.
+/// @param slot The slot number as returned by rf12_hopSlot() on the other node.
+/// @param elapsed How many ms that slot had already lasted (default 0).
+void rf12_hopSync (uint16_t slot, uint16_t elapsed) {
+    hopStart = millis() - (uint32_t) slot * hopDwell - elapsed;
+}
+
 /// @details
 /// When receiving data from other RFM12B/RFM12/RFM01 based units (Fine Offset
 /// weather stations, EMR power measurement plugs etc) is is convenient to let
@@ -955,6 +1171,43 @@ void rf12_setRawRecvMode(uint8_t fixed_pkt_len) {
     rf12_fixed_pkt_len = fixed_pkt_len > RF_MAX ? RF_MAX : fixed_pkt_len;
 }
 
+/// @details
+/// Set up a receive filter, to only accept packets from specific net groups
+/// and/or with specific header bits. This is mostly useful in a monitoring
+/// gateway initialized with group 0, which then receives packets from all net
+/// groups. Use node ID 31 (63 in RF12_COMPAT mode) to also see all packets
+/// which are addressed to other nodes.
+///
+/// The filter is applied inside the interrupt code, right after the header
+/// byte has been received. Packets which match none of the entries are dropped
+/// at that point: the receiver is restarted without the rest of the packet
+/// being read in, and rf12_recvDone() will not report them.
+///
+/// Entries are checked in order, and the first one which matches wins. Its
+/// subscriber tag is then stored in the "uint8_t rf12_sub" global, so that
+/// the caller can dispatch each packet to the right consumer once
+/// rf12_recvDone() returns true. For example, to accept packets from node 5
+/// in group 212 and all packets in group 100:
+///
+///     static const RF12Filter filters[] = {
+///         { 212, RF12_HDR_MASK, 5, 1 },
+///         { 100, 0, 0, 2 },
+///     };
+///     rf12_setFilter(filters, 2);
+///
+/// The table is accessed from the interrupt code, it must remain valid (and
+/// unchanged) for as long as the filter is in use. Each entry adds a few
+/// cycles to the interrupt code, so keep the table short.
+/// @param table Pointer to an array of filter entries in RAM, or null to turn
+///              filtering off again.
+/// @param count Number of entries in the table.
+void rf12_setFilter (const RF12Filter* table, uint8_t count) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        filterTable = table;
+        filterCount = count;
+    }
+}
+
 // XXTEA by David Wheeler, adapted from http://en.wikipedia.org/wiki/XXTEA
 
 #define DELTA 0x9E3779B9
@@ -1039,9 +1292,237 @@ static void cryptFun (uint8_t send) {
 void rf12_encrypt (const uint8_t* key) {
     // by using a pointer to cryptFun, we only link it in when actually used
     if (key != 0) {
-        for (uint8_t i = 0; i < sizeof cryptKey; ++i)
-            ((uint8_t*) cryptKey)[i] = eeprom_read_byte(key + i);
+        for (uint8_t i = 0; i < RF12_EEPROM_ELEN; ++i)
+            ((uint8_t*) groupKey)[i] = eeprom_read_byte(key + i);
+        cryptKey = groupKey;
         crypter = cryptFun;
+        cryptMax = RF12_MAXDATA;
+    } else
+        crypter = 0;
+}
+
+// Speck64/128 by Beaulieu et al (NSA). The key schedule is expanded once,
+// when a key is loaded, so each block only costs the rounds themselves.
+
+#define ROR(x,r) ((x >> r) | (x << (32 - r)))
+#define ROL(x,r) ((x << r) | (x >> (32 - r)))
+
+// replace the 128-bit key in the first 4 words by all round keys, in place
+static void speckExpand (uint32_t* rk) {
+    uint32_t k = rk[0], l0 = rk[1], l1 = rk[2], l2 = rk[3];
+    for (uint8_t i = 0; i < SPECK_ROUNDS; ++i) {
+        rk[i] = k;
+        uint32_t l = (ROR(l0, 8) + k) ^ i;
+        k = ROL(k, 3) ^ l;
+        l0 = l1;
+        l1 = l2;
+        l2 = l;
+    }
+}
+
+static void speckBlock (uint32_t* blk) {
+    uint32_t x = blk[0], y = blk[1];
+    for (uint8_t i = 0; i < SPECK_ROUNDS; ++i) {
+        x = (ROR(x, 8) + y) ^ cryptKey[i];
+        y = ROL(y, 3) ^ x;
+    }
+    blk[0] = x;
+    blk[1] = y;
+}
+
+// CCM-style authenticated encryption: Speck in counter mode, then a CBC-MAC
+// over the length and ciphertext, both bound to the header byte, group, and
+// sequence number. Costs 2 + 2 * ceil(len/8) block encryptions per packet.
+static void authFun (uint8_t send) {
+    uint8_t len = rf12_len, *p = (uint8_t*) rf12_data;
+    if (!send) {
+        if (len < 8) {
+            rf12_crc = 1; // too short to be valid, report as a bad crc
+            rf12_seq = -1;
+            return;
+        }
+        len -= 8;
+    } else
+        *(uint32_t*)(p + len) = ++seqNum;
+    uint32_t seq = *(uint32_t*)(p + len);
+    uint32_t nonce = rf12_hdr | (uint16_t) ((send ? group : rf12_grp) << 8);
+    uint32_t ctr[2], mac[2];
+    // the MAC is over the ciphertext: calculate it after encrypting when
+    // sending, and before decrypting when receiving
+    for (uint8_t pass = 0; pass < 2; ++pass) {
+        if (pass == send) {
+            // CBC-MAC, with the length in the first block
+            mac[0] = seq;
+            mac[1] = nonce | ((uint32_t) len << 16) | 0x49000000L;
+            speckBlock(mac);
+            for (uint8_t i = 0; i < len; ++i) {
+                ((uint8_t*) mac)[i&7] ^= p[i];
+                if ((i & 7) == 7 || i == len - 1)
+                    speckBlock(mac);
+            }
+        } else
+            // counter mode, XOR the payload with the encrypted counter blocks
+            for (uint8_t i = 0; i < len; ++i) {
+                if ((i & 7) == 0) {
+                    ctr[0] = seq;
+                    ctr[1] = nonce | ((uint32_t) (i / 8 + 1) << 16) |
+                                                                0x01000000L;
+                    speckBlock(ctr);
+                }
+                p[i] ^= ((uint8_t*) ctr)[i&7];
+            }
+    }
+    // the tag itself is encrypted with counter block zero
+    ctr[0] = seq;
+    ctr[1] = nonce | 0x01000000L;
+    speckBlock(ctr);
+    mac[0] ^= ctr[0];
+    if (send) {
+        *(uint32_t*)(p + len + 4) = mac[0];
+        rf12_rawlen += 8;
+    } else {
+        // compare all 4 tag bytes, to take the same time on a mismatch
+        uint8_t diff = 0;
+        for (uint8_t i = 0; i < 4; ++i)
+            diff |= p[len+4+i] ^ ((uint8_t*) mac)[i];
+        rf12_rawlen -= 8;
+        // only accept sequence numbers which are newer, to reject replays
+        uint32_t* last = lastSeq + (rf12_hdr & RF12_HDR_MASK);
+        if (diff || seq <= *last) {
+            rf12_crc = 1; // authentication failed, report as a bad crc
+            rf12_seq = -1;
+        } else {
+            *last = seq;
+            rf12_seq = seq & 0x7FFFFFFFL;
+        }
+    }
+}
+
+/// @details
+/// This enables or disables authenticated encryption, as an alternative to the
+/// XXTEA mode of rf12_encrypt(). The payload is encrypted with the Speck64/128
+/// block cipher in counter mode, so it keeps its exact length, and can be as
+/// short as 0 bytes. A 32-bit sequence number and a 32-bit authentication tag
+/// are appended, i.e. each packet grows by 8 bytes. The tag is a CBC-MAC over
+/// the header byte, group, sequence number, length, and encrypted payload.
+///
+/// Packets which fail the tag check (or are less than 8 bytes) are reported as
+/// having a bad crc, i.e. rf12_crc will be non-zero and rf12_seq will be -1.
+/// The same happens to replayed packets: the last accepted sequence number is
+/// kept for each node ID in the header, and only higher ones are accepted.
+/// These are cleared by each call to this function and rf12_encryptTable().
+/// A sender which starts counting from 1 again, e.g. after a reset, is ignored
+/// until it gets past the last number seen, so senders should not be reset
+/// more often than receivers.
+/// On reception, the payload length is adjusted back to the original length
+/// passed to rf12_sendStart() and rf12_seq is set to the sequence number.
+///
+/// The sequence number is also the nonce for counter mode, together with the
+/// header byte and group. Each sender must therefore use its own key, or else
+/// two senders can end up reusing the same counter values: rf12_encryptTable()
+/// with one key per node is the recommended way to use this mode.
+///
+/// Since the 8 extra bytes have to fit in the packet buffer, the maximum
+/// payload drops to RF12_MAXDATA - 8, i.e. 58 bytes. Longer payloads passed to
+/// rf12_sendStart() are truncated to that length.
+///
+/// The key is expanded into its 27 round keys when this is called, which take
+/// 108 bytes of RAM.
+/// @param key Pointer to a 16-byte (128-bit) encryption key in EEPROM. A null
+///            pointer disables encryption again.
+void rf12_encryptAuth (const uint8_t* key) {
+    rf12_encrypt(key);
+    if (key != 0) {
+        speckExpand(groupKey);
+        memset(lastSeq, 0, sizeof lastSeq);
+        crypter = authFun;
+        cryptMax = RF12_MAXDATA - 8;
+    }
+}
+
+// look up the key for the node ID in the header, loading it on a cache miss,
+// returns 0 if that node ID has no entry in the key table
+static uint8_t selectKey (uint8_t expand) {
+    uint8_t node = rf12_hdr & RF12_HDR_MASK;
+    if (node >= KEY_NODES)
+        return 0; // only possible with RF12_COMPAT, which has 6-bit node IDs
+    uint8_t slot = 0;
+    while (slot < KEY_SLOTS && keyNode[slot] != node)
+        ++slot;
+    if (slot >= KEY_SLOTS) {
+        slot = keyVictim;
+        if (++keyVictim >= KEY_SLOTS)
+            keyVictim = 0;
+        const uint8_t* key = keyTable + RF12_EEPROM_ELEN * node;
+        for (uint8_t i = 0; i < RF12_EEPROM_ELEN; ++i)
+            ((uint8_t*) keyCache[slot])[i] = eeprom_read_byte(key + i);
+        if (expand)
+            speckExpand(keyCache[slot]);
+        keyNode[slot] = node;
+    }
+    cryptKey = keyCache[slot];
+    return 1;
+}
+
+// without a key, received packets are bad, and sent ones lose their payload
+static void noKey (uint8_t send) {
+    if (send)
+        rf12_rawlen -= rf12_len;
+    else {
+        rf12_crc = 1;
+        rf12_seq = -1;
+    }
+}
+
+static void tableCryptFun (uint8_t send) {
+    if (selectKey(0))
+        cryptFun(send);
+    else
+        noKey(send);
+}
+
+static void tableAuthFun (uint8_t send) {
+    if (selectKey(1))
+        authFun(send);
+    else
+        noKey(send);
+}
+
+/// @details
+/// This enables or disables encryption with a separate key for each node ID,
+/// using the same algorithm and packet format as rf12_encrypt(), or as
+/// rf12_encryptAuth() when the auth flag is set. The key
+/// is selected by the node ID in the header byte: the sender's ID for packets
+/// without RF12_HDR_DST, and the destination ID for packets which have it set.
+/// This means that both broadcasts from a node and the replies sent back to it
+/// use the key of that node, while a gateway's own broadcasts use the key
+/// stored for the gateway's node ID.
+///
+/// Keys are read from EEPROM the first time they are needed, and are then kept
+/// in a small RAM cache, so that a gateway does not have to read EEPROM for
+/// each packet. The cache holds the keys of the 4 most recently used nodes, in
+/// auth mode already expanded into Speck round keys. It takes 432 bytes of RAM.
+///
+/// Only node IDs 0..31 have a key. With RF12_COMPAT, node IDs go up to 63:
+/// packets from or to the higher IDs are then reported as having a bad crc,
+/// and are sent without their payload.
+///
+/// Field nodes only ever need their own key, so they can keep using
+/// rf12_encrypt() with a single key - only that key has to be stored on them.
+/// A node which gets compromised then no longer exposes the keys of all others.
+/// @param table Pointer to a table of 32 consecutive 16-byte keys, indexed by
+///              node ID. A null pointer disables encryption again. Note: this
+///              is an EEPROM address, not RAM! - RF12_EEPROM_KTAB can be used,
+///              except on the ATtiny84, which has too little EEPROM for it.
+/// @param auth Use authenticated encryption instead of XXTEA when non-zero,
+///             which lowers the maximum payload, as with rf12_encryptAuth().
+void rf12_encryptTable (const uint8_t* table, uint8_t auth) {
+    if (table != 0) {
+        keyTable = table;
+        memset(keyNode, 0xFF, sizeof keyNode); // flush all cached keys
+        memset(lastSeq, 0, sizeof lastSeq);
+        crypter = auth ? tableAuthFun : tableCryptFun;
+        cryptMax = auth ? RF12_MAXDATA - 8 : RF12_MAXDATA;
     } else
         crypter = 0;
 }
@@ -64,6 +64,15 @@
 #define RF12_EEPROM_ELEN    16                 ///< EE number of bytes.
 #define RF12_EEPROM_VERSION 1                  ///< Only this version is valid.
 
+// The per-node key table for rf12_encryptTable() takes 32 x 16 = 512 bytes,
+// which only fits in chips with at least 1 Kb of EEPROM. Define this before
+// including RF12.h to put the table elsewhere.
+#ifndef RF12_EEPROM_KTAB
+#if !defined(__AVR_ATtiny84__) && !defined(__AVR_ATtiny44__)
+#define RF12_EEPROM_KTAB    ((uint8_t*) 0x200) ///< EE per-node key table.
+#endif
+#endif
+
 /// Shorthand to simplify detecting a request for an ACK.
 #define RF12_WANTS_ACK ((rf12_hdr & RF12_HDR_ACK) && !(rf12_hdr & RF12_HDR_CTL))
 /// Shorthand to simplify sending out the proper ACK reply.
@@ -74,12 +83,42 @@
 #define RF12_SLEEP 0        ///< Enter sleep mode.
 #define RF12_WAKEUP -1      ///< Wake up from sleep mode.
 
+/// Modem profiles, for use with rf12_setProfile().
+enum {
+    RF12_PROFILE_4K8,   ///< 4.8 kbps, 45 kHz deviation, 67 kHz bandwidth
+    RF12_PROFILE_9K6,   ///< 9.6 kbps, 45 kHz deviation, 67 kHz bandwidth
+    RF12_PROFILE_19K2,  ///< 19.2 kbps, 60 kHz deviation, 134 kHz bandwidth
+    RF12_PROFILE_38K4,  ///< 38.4 kbps, 90 kHz deviation, 134 kHz bandwidth
+    RF12_PROFILE_49K2,  ///< 49.2 kbps, 90 kHz deviation, the default
+    RF12_PROFILE_57K6,  ///< 57.6 kbps, 120 kHz deviation, 200 kHz bandwidth
+};
+
+// Some features are not implemented for the RFM69 in compatibility mode, so
+// calls to them fail to compile there, rather than silently doing nothing.
+#ifdef RF69_compat_h
+#define RF12_NOT_RF69 __attribute__((error("not supported with RF69_COMPAT")))
+#else
+#define RF12_NOT_RF69
+#endif
+
 /// Running crc value, should be zero at end.
 extern volatile uint16_t rf12_crc;
 /// Recv/xmit buf including hdr & crc bytes.
 extern volatile uint8_t rf12_buf[];
 /// Seq number of encrypted packet (or -1).
 extern long rf12_seq;
+#ifndef RF69_compat_h
+/// Subscriber tag of the filter entry which matched the last packet.
+extern uint8_t rf12_sub;
+#endif
+
+/// One entry of a receive filter table, see rf12_setFilter().
+typedef struct {
+    uint8_t group;      ///< Net group to accept, or 0 to accept any group.
+    uint8_t hdrMask;    ///< Header bits which need to match.
+    uint8_t hdrMatch;   ///< Required value of those header bits.
+    uint8_t sub;        ///< Subscriber tag, reported in rf12_sub on a match.
+} RF12Filter;
 
 /// Option to set RFM12 CS (or SS) pin for use on different hardware setups.
 /// Set to Dig10 by default for JeeNode. Can be Dig10, Dig9 or Dig8
@@ -91,6 +130,9 @@ void rf12_spiInit(void);
 /// Call this once with the node ID, frequency band, and optional group.
 uint8_t rf12_initialize(uint8_t id, uint8_t band, uint8_t group=0xD4, uint16_t frequency=1600);
 
+/// Select the data rate and bandwidth, and the TX power attenuation (0..7).
+void rf12_setProfile(uint8_t profile, uint8_t power =0) RF12_NOT_RF69;
+
 /// Initialize the RFM12B module from settings stored in EEPROM by "RF12demo"
 /// don't call rf12_initialize() if you init the hardware with rf12_config().
 /// @return the node ID as 1..31, or 0 if there is no config on EEPROM.
@@ -142,9 +184,26 @@ char rf12_easySend(const void* data, uint8_t size);
 /// Enable encryption (null arg disables it again).
 void rf12_encrypt(const uint8_t*);
 
+/// Enable authenticated encryption (null arg disables it again).
+/// This leaves room for at most RF12_MAXDATA - 8 bytes of payload.
+void rf12_encryptAuth(const uint8_t*) RF12_NOT_RF69;
+
+/// Enable encryption with a key table indexed by node ID (null disables it).
+void rf12_encryptTable(const uint8_t*, uint8_t auth =0) RF12_NOT_RF69;
+
 /// Enable raw receive mode with fixed packet length.
 void rf12_setRawRecvMode(uint8_t fixed_pkt_len);
 
+/// Only accept packets which match an entry in this table (null disables it).
+void rf12_setFilter(const RF12Filter* table, uint8_t count) RF12_NOT_RF69;
+
+/// Hop across a list of frequencies, changing every "dwell" ms (null = off).
+void rf12_hopInit(const uint16_t* table, uint8_t count, uint16_t dwell);
+/// Return the current frequency hopping time slot, e.g. to send in a beacon.
+uint16_t rf12_hopSlot(void);
+/// Synchronize the frequency hopping time slot to the one from a beacon.
+void rf12_hopSync(uint16_t slot, uint16_t elapsed =0);
+
 /// Low-level control of the RFM12B via direct register access.
 /// http://tools.jeelabs.org/rfm12b is useful for calculating these.
 uint16_t rf12_control(uint16_t cmd);
@@ -0,0 +1,272 @@
+// Fragmentation layer on top of the RF12 driver
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <JeeLib.h>
+#include <RF12frag.h>
+
+#define FRAG_WAIT       50      // ms to wait for a status reply, doubles on
+                                // each retry, up to 4 times as long
+#define FRAG_RETRIES    10      // status requests without reply before failing
+#define FRAG_TIMEOUT    3000    // ms after which an idle slot is given up
+
+// Each packet starts with its type, the node ID of the sender, the node ID it
+// is for, and the message ID, each in a byte of their own. Both IDs are needed
+// because the RF12 header only holds one of them, and with RF12_COMPAT there
+// is no RF12_HDR_DST bit, so that packets can't be addressed to one node: all
+// of them go out as broadcasts, with the sender's ID in the header.
+#define FRAG_HDR        4       // bytes before the index in fragments
+
+// packet types, in the first payload byte
+#define FRAG_DATA       0xF0    // one fragment
+#define FRAG_DATA_POLL  0xF1    // last fragment of a burst, wants a status
+#define FRAG_POLL       0xF2    // only wants a status, after a lost reply
+#define FRAG_STATUS     0xF3    // status reply, bitmap of missing fragments
+
+// slot states
+enum { S_FREE, S_BUSY, S_READY, S_DONE };
+
+// return the first fragment index in bitmap at or after pos, or ~0 if none
+static byte nextMissing (const byte* map, byte pos, byte last) {
+    for (; pos <= last; ++pos)
+        if (map[pos/8] & bit(pos%8))
+            return pos;
+    return ~0;
+}
+
+// milliseconds since a slot was last used
+static word age (word stamp) {
+    return (word) millis() - stamp;
+}
+
+static void setMissing (byte* map, byte last) {
+    memset(map, 0, RF12Frag::MAXFRAGS/8);
+    for (byte i = 0; i <= last; ++i)
+        map[i/8] |= bit(i%8);
+}
+
+RF12Frag::RF12Frag (byte slots, word size)
+        : numSlots (slots), myId (0), slotSize (size), replySlot (0),
+          rxSlot (0), txState (IDLE), txId (0) {
+    pool = (Slot*) calloc(slots, sizeof (Slot));
+    for (byte i = 0; pool != 0 && i < slots; ++i) {
+        pool[i].data = (byte*) malloc(size);
+        if (pool[i].data == 0) {
+            while (i > 0)
+                free(pool[--i].data);
+            free(pool);
+            pool = 0;
+        }
+    }
+    // out of memory: nothing can be received, but sending still works
+    if (pool == 0)
+        numSlots = 0;
+}
+
+bool RF12Frag::send (byte dest, const void* ptr, word len) {
+    if (txState == BUSY || len == 0 || len > MAXSIZE)
+        return false;
+    txData = (const byte*) ptr;
+    txLen = len;
+    txDest = dest;
+    ++txId;
+    txLast = (len - 1) / FRAGSIZE;
+    setMissing(txMissing, txLast);
+    txNext = txRetries = txPoll = 0;
+    txState = BUSY;
+    return true;
+}
+
+void RF12Frag::sendFragment (byte index, byte poll) {
+    word offset = index * FRAGSIZE;
+    byte count = txLen - offset < FRAGSIZE ? txLen - offset : FRAGSIZE;
+    byte buf [RF12_MAXDATA];
+    buf[0] = poll ? FRAG_DATA_POLL : FRAG_DATA;
+    buf[FRAG_HDR] = index;
+    buf[FRAG_HDR+1] = txLast;
+    memcpy(buf + FRAG_HDR + 2, txData + offset, count);
+    sendPacket(txDest, txId, buf, FRAG_HDR + 2 + count);
+}
+
+// fill in the node IDs and the message ID, and send to one node, which is a
+// broadcast with RF12_COMPAT, just as with RF12_ACK_REPLY
+void RF12Frag::sendPacket (byte dest, byte msgId, byte* buf, byte len) {
+    buf[1] = myId;
+    buf[2] = dest;
+    buf[3] = msgId;
+    rf12_sendStart(RF12_HDR_DST | dest, buf, len);
+}
+
+RF12Frag::Slot* RF12Frag::findSlot (byte node, byte msgId) {
+    for (byte i = 0; i < numSlots; ++i) {
+        Slot& s = pool[i];
+        if (s.state != S_FREE && s.node == node && s.msgId == msgId &&
+                (s.state == S_READY || age(s.stamp) < FRAG_TIMEOUT))
+            return &s;
+    }
+    return 0;
+}
+
+RF12Frag::Slot* RF12Frag::newSlot (byte node, byte msgId, byte last) {
+    if (last * FRAGSIZE >= slotSize)
+        return 0;
+    // prefer an older message from the same node, then a free slot, then one
+    // which is only remembered to answer repeated status requests, and lastly
+    // one which has not seen any new fragments for a while
+    Slot* p = 0;
+    byte best = 0;
+    for (byte i = 0; i < numSlots; ++i) {
+        Slot& s = pool[i];
+        byte score = 0;
+        if (s.state == S_FREE)
+            score = 3;
+        else if (s.state != S_READY) {
+            if (s.node == node)
+                score = 4;
+            else if (s.state == S_DONE)
+                score = 2;
+            else if (age(s.stamp) >= FRAG_TIMEOUT)
+                score = 1;
+        }
+        if (score > best) {
+            best = score;
+            p = &s;
+        }
+    }
+    if (p != 0) {
+        p->state = S_BUSY;
+        p->node = node;
+        p->msgId = msgId;
+        p->last = last;
+        p->len = 0;
+        setMissing(p->missing, last);
+    }
+    return p;
+}
+
+bool RF12Frag::accept () {
+    byte type = rf12_data[0];
+    if (rf12_len < FRAG_HDR || (type & 0xFC) != 0xF0)
+        return false;
+    // packets for other nodes also arrive here with RF12_COMPAT, or when this
+    // node listens to all packets
+    byte node = rf12_data[1], msgId = rf12_data[3];
+    if (rf12_data[2] != myId)
+        return true;
+
+    if (type == FRAG_STATUS) {
+        if (txState == BUSY && txPoll && node == txDest && msgId == txId &&
+                rf12_len > FRAG_HDR) {
+            memset(txMissing, 0, sizeof txMissing);
+            byte n = rf12_len - FRAG_HDR;
+            memcpy(txMissing, (const byte*) rf12_data + FRAG_HDR,
+                    n < sizeof txMissing ? n : sizeof txMissing);
+            if (nextMissing(txMissing, 0, txLast) > txLast)
+                txState = DONE;
+            txNext = txRetries = txPoll = 0;
+        }
+        return true;
+    }
+
+    byte index = 0, last = rf12_data[FRAG_HDR];
+    if (type != FRAG_POLL) {
+        index = rf12_data[FRAG_HDR];
+        last = rf12_data[FRAG_HDR+1];
+    }
+    if (rf12_len < FRAG_HDR + (type == FRAG_POLL ? 1 : 3) || index > last ||
+            last >= MAXFRAGS)
+        return true;
+
+    Slot* s = findSlot(node, msgId);
+    if (s == 0)
+        s = newSlot(node, msgId, last);
+    if (s == 0 || s->last != last)
+        return true;
+    s->stamp = millis();
+
+    if (type != FRAG_POLL && s->state == S_BUSY &&
+            (s->missing[index/8] & bit(index%8))) {
+        word offset = index * FRAGSIZE;
+        byte count = rf12_len - FRAG_HDR - 2;
+        if ((index < last && count != FRAGSIZE) || offset + count > slotSize)
+            return true;
+        memcpy(s->data + offset, (const byte*) rf12_data + FRAG_HDR + 2,
+                count);
+        s->missing[index/8] &= ~bit(index%8);
+        if (index == last)
+            s->len = offset + count;
+        if (nextMissing(s->missing, 0, last) > last)
+            s->state = S_READY;
+    }
+
+    if (type != FRAG_DATA)
+        replySlot = s - pool + 1;
+    return true;
+}
+
+void RF12Frag::poll () {
+    if (replySlot && rf12_canSend()) {
+        Slot& s = pool[replySlot-1];
+        byte buf [FRAG_HDR + MAXFRAGS/8];
+        buf[0] = FRAG_STATUS;
+        byte n = s.last / 8 + 1;
+        memcpy(buf + FRAG_HDR, s.missing, n);
+        sendPacket(s.node, s.msgId, buf, FRAG_HDR + n);
+        replySlot = 0;
+        return;
+    }
+
+    if (txState != BUSY)
+        return;
+
+    if (txPoll) {
+        // waiting for a status reply, ask again if it doesn't come
+        if (txTimer.poll()) {
+            if (++txRetries > FRAG_RETRIES) {
+                txState = FAILED;
+                return;
+            }
+            txPoll = 2;
+        }
+        if (txPoll == 2 && rf12_canSend()) {
+            byte buf [FRAG_HDR + 1];
+            buf[0] = FRAG_POLL;
+            buf[FRAG_HDR] = txLast;
+            sendPacket(txDest, txId, buf, sizeof buf);
+            txPoll = 1;
+            txTimer.set(FRAG_WAIT << (txRetries < 2 ? txRetries : 2));
+        }
+    } else if (rf12_canSend()) {
+        // send the next missing fragment, ask for a status after the last one
+        byte index = nextMissing(txMissing, txNext, txLast);
+        txNext = index + 1;
+        byte more = nextMissing(txMissing, txNext, txLast) <= txLast;
+        sendFragment(index, !more);
+        if (!more) {
+            txPoll = 1;
+            txTimer.set(FRAG_WAIT);
+        }
+    }
+}
+
+const byte* RF12Frag::received (word& len, byte& node) {
+    for (byte i = 0; i < numSlots; ++i) {
+        Slot& s = pool[i];
+        if (s.state == S_READY) {
+            len = s.len;
+            node = s.node;
+            rxSlot = i + 1;
+            return s.data;
+        }
+    }
+    return 0;
+}
+
+void RF12Frag::release () {
+    if (rxSlot) {
+        // remember it for a while, to answer repeated status requests
+        Slot& s = pool[rxSlot-1];
+        s.state = S_DONE;
+        s.stamp = millis();
+        rxSlot = 0;
+    }
+}
@@ -0,0 +1,92 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef RF12frag_h
+#define RF12frag_h
+
+/// @file
+/// Fragmentation layer on top of the RF12.h driver, for messages of up to
+/// 7.5 Kb, i.e. far more than the RF12_MAXDATA bytes which fit in one packet.
+///
+/// A message is sent as a burst of numbered fragments, without waiting for an
+/// ack after each one. The last fragment of a burst asks for a status reply,
+/// which is a bitmap of all the fragments still missing. Only those are then
+/// sent again, until none are left. Fragments can arrive in any order, they're
+/// placed straight into a free slot of the receiver's buffer pool. Slots which
+/// don't get any new fragments for a few seconds are given up and re-used.
+///
+/// Fragment packets start with a byte in the range 0xF0..0xF3, so make sure
+/// that no other packets exchanged with these nodes look like this. They also
+/// carry the node IDs of both ends, and work the same with RF12_COMPAT, where
+/// they are sent as broadcasts.
+
+/// Sends and receives fragmented messages, one outgoing message at a time.
+class RF12Frag {
+public:
+    enum {
+        FRAGSIZE = RF12_MAXDATA - 6,    ///< message bytes per fragment
+        MAXFRAGS = 128,                 ///< max number of fragments
+        MAXSIZE = MAXFRAGS * FRAGSIZE   ///< max message size
+    };
+    /// Status of the outgoing message, as returned by sendStatus().
+    enum { IDLE, BUSY, DONE, FAILED };
+
+    /// Initialize for a number of messages to receive at the same time.
+    /// @param slots Number of slots in the pool, 0 for a node which only sends.
+    /// @param size Max size of each message, the pool uses slots x size bytes.
+    /// If there is not enough memory for all that, there are no slots at all,
+    /// which slots() will report.
+    RF12Frag (byte slots =0, word size =0);
+    /// Return the number of slots in the pool, i.e. 0 if it could not be set up.
+    byte slots() const { return numSlots; }
+
+    /// Set the node ID of this node, needed for sending and receiving, as
+    /// returned by rf12_initialize() or rf12_configSilent().
+    void begin(byte id) { myId = id & RF12_HDR_MASK; }
+
+    /// Start sending a message, which has to stay unchanged until sendStatus()
+    /// no longer returns BUSY. Returns false if another message is still busy
+    /// or the message is too large.
+    bool send(byte dest, const void* ptr, word len);
+    /// Returns one of IDLE, BUSY, DONE, or FAILED.
+    byte sendStatus() const { return txState; }
+
+    /// Call this with each good packet obtained through rf12_recvDone(), it
+    /// returns true if the packet was a fragment or status reply for this layer.
+    bool accept();
+    /// Call this often, it sends fragments and status replies when due.
+    void poll();
+
+    /// Return the next complete message, or 0 if there is none. It stays valid
+    /// until release() is called.
+    const byte* received(word& len, byte& node);
+    /// Release the message returned by received(), so that its slot can be used
+    /// for a new message.
+    void release();
+
+private:
+    struct Slot {
+        byte state, node, msgId, last;  // last = number of fragments - 1
+        word len, stamp;                // stamp = (word) millis() of last use
+        byte missing [MAXFRAGS/8];      // one bit per fragment not yet received
+        byte* data;
+    };
+
+    Slot* pool;
+    byte numSlots, myId;
+    word slotSize;
+    byte replySlot;                     // slot index + 1 of pending status reply
+    byte rxSlot;                        // slot index + 1 returned by received()
+
+    const byte* txData;
+    word txLen;
+    byte txState, txDest, txId, txLast, txNext, txRetries, txPoll;
+    byte txMissing [MAXFRAGS/8];
+    MilliTimer txTimer;
+
+    Slot* findSlot(byte node, byte msgId);
+    Slot* newSlot(byte node, byte msgId, byte last);
+    void sendFragment(byte index, byte poll);
+    void sendPacket(byte dest, byte msgId, byte* buf, byte len);
+};
+
+#endif
@@ -0,0 +1,197 @@
+/// @file
+/// Interrupt-driven OOK transmitter, and encoders for some OOK protocols.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <JeeLib.h>
+#include <RF12ook.h>
+#include <util/atomic.h>
+
+// The RFM12B takes longer to start transmitting than to stop, and the old
+// delay-based code compensated by making marks 175 us longer and spaces
+// 175 us shorter (including its 25 us of SPI overhead per switch). The same
+// correction is applied here, once per change of level.
+#define OOK_ADJUST 175
+
+// longest time to wait in one timer period, the rest is done in more periods
+#define OOK_MAX_WAIT 20000
+
+static byte parity (byte value) {
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return value & 1;
+}
+
+bool OokPacket::add(byte index) {
+    if (count >= 4 * sizeof symbols)
+        return false;
+    byte shift = 2 * (count % 4);
+    byte* p = symbols + count / 4;
+    *p = (*p & ~(3 << shift)) | (index << shift);
+    ++count;
+    return true;
+}
+
+void OokPacket::addBits(unsigned long value, byte bits, byte zero, byte one) {
+    while (bits > 0)
+        add(bitRead(value, --bits) ? one : zero);
+}
+
+void OokPacket::fs20(word house, byte addr, byte cmd) {
+    // 12 zero bits and a one as sync, then 5 bytes, each followed by an even
+    // parity bit, then a final 0 bit with a 10 ms gap before the repeat
+    define(0, 400, 400);
+    define(1, 600, 600);
+    define(2, 400, 400 + 10000);
+    count = 0;
+    repeats = 3;
+    addBits(1, 13);
+    byte data [5] = { (byte) (house >> 8), (byte) house, addr, cmd, 0 };
+    data[4] = 6 + data[0] + data[1] + data[2] + data[3];
+    for (byte i = 0; i < 5; ++i)
+        addBits((data[i] << 1) | parity(data[i]), 9);
+    add(2);
+}
+
+void OokPacket::kaku(char addr, byte device, byte on) {
+    // 12 bits, lowest first, each a short mark and a long space, followed by
+    // a long mark and a short space for a one, or again a short mark and a
+    // long space for a zero, then a short mark and an 11 ms gap
+    word cmd = 0x600 | ((device - 1) << 4) | ((addr - 1) & 0xF);
+    if (on)
+        cmd |= 0x800;
+    define(0, 375, 1125);
+    define(1, 1125, 375);
+    define(2, 375, 375 + 11000);
+    count = 0;
+    repeats = 4;
+    for (byte i = 0; i < 12; ++i) {
+        add(0);
+        add(bitRead(cmd, i));
+    }
+    add(2);
+}
+
+void OokPacket::kakuA(unsigned long addr, byte device, byte on, byte group) {
+    // sync, then 26 address bits, group, on/off, and 4 device bits, where a
+    // 0 is T-T-T-5T and a 1 is T-5T-T-T, then a final mark and a long gap
+    enum { T = 260 };
+    define(0, T, T);
+    define(1, T, 5 * T);
+    define(2, T, 10 * T);
+    define(3, T, 40 * T);
+    count = 0;
+    repeats = 4;
+    add(2);
+    unsigned long cmd = (addr << 6) | ((group != 0) << 5) | ((on != 0) << 4) |
+                        ((device - 1) & 0xF);
+    for (byte i = 32; i-- > 0; ) {
+        byte b = bitRead(cmd, i);
+        add(b);
+        add(!b);
+    }
+    add(3);
+}
+
+void OokPacket::x10(byte addr, byte cmd) {
+    // 9 ms mark and 4.5 ms space as header, then 4 bytes, each lowest bit
+    // first, with a short space for a 0 and a long one for a 1
+    define(0, 560, 560);
+    define(1, 560, 1690);
+    define(2, 8800, 4400);
+    define(3, 560, 40000);
+    count = 0;
+    repeats = 5;
+    add(2);
+    byte data [4] = { addr, (byte) ~addr, cmd, (byte) ~cmd };
+    for (byte i = 0; i < 4; ++i)
+        for (byte j = 0; j < 8; ++j)
+            add(bitRead(data[i], j));
+    add(3);
+}
+
+#ifdef TCCR1B
+
+// the queue of pending packets, and the progress through the current one,
+// all shared with the timer 1 interrupt code
+static const OokPacket* volatile ookQueue [4];
+static volatile byte ookHead, ookFill, ookPhase, ookRepeat, ookLevel;
+static volatile word ookLeft; // us still to wait in the current mark or space
+
+static void ookStop () {
+    bitClear(TIMSK1, OCIE1A);
+    TCCR1B = 0;
+}
+
+void rf12_ookTimer () {
+    for (;;) {
+        if (ookLeft > 0) {
+            word us = ookLeft < OOK_MAX_WAIT ? ookLeft : OOK_MAX_WAIT;
+            ookLeft -= us;
+            OCR1A = (uint32_t) us * (F_CPU / 1000000) / 8 - 1;
+            return;
+        }
+        const OokPacket* p = ookQueue[ookHead];
+        if (ookPhase >= 2 * p->count) {
+            ookPhase = 0;
+            if (++ookRepeat >= p->repeats) {
+                ookRepeat = 0;
+                ookHead = (ookHead + 1) % (sizeof ookQueue / sizeof *ookQueue);
+                if (--ookFill == 0) {
+                    rf12_onOff(ookLevel = 0);
+                    ookStop();
+                    return;
+                }
+            }
+            continue;
+        }
+        // even phases are marks, odd phases are spaces, and 0 means skip
+        byte level = (ookPhase & 1) == 0;
+        word us = p->widths[2 * p->symbol(ookPhase / 2) + !level];
+        ++ookPhase;
+        if (us == 0)
+            continue;
+        if (level != ookLevel) {
+            rf12_onOff(ookLevel = level);
+            if (level)
+                us += OOK_ADJUST;
+            else
+                us = us > OOK_ADJUST + 50 ? us - OOK_ADJUST : 50;
+        }
+        ookLeft = us;
+    }
+}
+
+bool rf12_ookSend (const OokPacket& packet) {
+    bool ok = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (ookFill < sizeof ookQueue / sizeof *ookQueue) {
+            byte i = (ookHead + ookFill) % (sizeof ookQueue / sizeof *ookQueue);
+            ookQueue[i] = &packet;
+            ok = true;
+            if (ookFill++ == 0) {
+                // 8x prescaler in CTC mode, i.e. 0.5 us per tick at 16 MHz
+                ookPhase = ookRepeat = ookLeft = 0;
+                TCCR1A = 0;
+                TCCR1B = bit(WGM12) | bit(CS11);
+                TCNT1 = 0;
+                OCR1A = 100; // start a little later
+                bitSet(TIFR1, OCF1A); // clear a pending match, if any
+                bitSet(TIMSK1, OCIE1A);
+            }
+        }
+    }
+    return ok;
+}
+
+uint8_t rf12_ookBusy () {
+    return ookFill;
+}
+
+#else
+
+bool rf12_ookSend (const OokPacket& packet) { return false; }
+uint8_t rf12_ookBusy () { return 0; }
+void rf12_ookTimer () {}
+
+#endif
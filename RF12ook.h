@@ -0,0 +1,59 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+/// @file
+/// Interrupt-driven OOK transmitter on top of the RF12.h driver.
+///
+/// Packets are played from a Timer1 compare-match interrupt, which the sketch
+/// has to pass on to this code, i.e. add this line to the sketch:
+///
+///     ISR(TIMER1_COMPA_vect) { rf12_ookTimer(); }
+///
+/// Set up the radio with node ID 0 (which disables its interrupts) and the
+/// proper band before sending, and don't call any other rf12_* functions until
+/// rf12_ookBusy() returns false again.
+
+/// An OOK packet is a list of up to 96 symbols, each picking one of 4 entries
+/// in a table of mark and space widths. A width of 0 skips that part, so that
+/// a symbol can also be a lone mark or a lone space. This keeps packets small,
+/// e.g. an FS20 command is 15 bytes of symbols i.s.o. 118 separate widths.
+/// The encoders below produce the same signals as the devices decoded by the
+/// ookRelay2 sketch.
+class OokPacket {
+public:
+    word widths [8];    ///< mark and space of each symbol, in microseconds
+    byte symbols [24];  ///< 2 bits per symbol, first one in the lowest bits
+    byte count;         ///< number of symbols
+    byte repeats;       ///< number of times the packet will be sent
+
+    OokPacket () : count (0), repeats (1) {}
+
+    /// Set up the mark and space widths of one symbol, in microseconds.
+    void define(byte index, word mark, word space)
+        { widths[2*index] = mark; widths[2*index+1] = space; }
+    /// Append one symbol, returns false if there is no room for it.
+    bool add(byte index);
+    /// Append bits, most significant first, as symbols zero and one.
+    void addBits(unsigned long value, byte bits, byte zero =0, byte one =1);
+    /// Return the symbol at a given position.
+    byte symbol(byte pos) const
+        { return (symbols[pos/4] >> 2 * (pos % 4)) & 3; }
+
+    /// FS20 command on 868 MHz, as used by Conrad/ELV (FSX in ookRelay2).
+    void fs20(word house, byte addr, byte cmd);
+    /// Klik-Aan-Klik-Uit command with code wheels on 433 MHz (KAKU).
+    void kaku(char addr, byte device, byte on);
+    /// Klik-Aan-Klik-Uit command with learned 26-bit addresses (KAKUA),
+    /// device is 1..16 as with kaku().
+    void kakuA(unsigned long addr, byte device, byte on, byte group =0);
+    /// X10 RF command on 433 MHz, i.e. two bytes, each followed by their
+    /// complement (XRF).
+    void x10(byte addr, byte cmd);
+};
+
+/// Queue a packet for sending, it must stay unchanged until it has been sent.
+/// @return false if the queue is full.
+bool rf12_ookSend (const OokPacket& packet);
+/// Returns the number of packets not yet completely sent.
+uint8_t rf12_ookBusy ();
+/// To be called from ISR(TIMER1_COMPA_vect), see above.
+void rf12_ookTimer ();
@@ -0,0 +1,177 @@
+// Over-the-air firmware image transfer on top of the RF12 driver
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <JeeLib.h>
+#include <RF12ota.h>
+#include <util/crc16.h>
+
+#define OTA_WAIT        500     // ms without a new chunk before asking again
+#define OTA_RETRIES     20      // requests without progress before failing
+#define OTA_IMAGE       256     // address of the image data in the store
+
+// packet types, in the first payload byte
+#define OTA_REQ         0xF6    // type, version, chunk (~0 for info), count
+#define OTA_INFO        0xF7    // type, version, size, hash
+#define OTA_DATA        0xF8    // type, version, chunk, crc, 32 bytes of data
+
+static word crc16 (const byte* ptr, byte len) {
+    word crc = ~0;
+    while (len-- > 0)
+        crc = _crc16_update(crc, *ptr++);
+    return crc;
+}
+
+RF12Ota::RF12Ota (OtaStore& s, byte type, byte version)
+        : store (s), myType (type), myVersion (version), state (IDLE),
+          retries (0), due (0), windowEnd (0) {
+    memset(&hdr, 0, sizeof hdr);
+}
+
+uint32_t RF12Ota::hash (uint32_t h, const byte* ptr, byte len) {
+    while (len-- > 0) {
+        h ^= *ptr++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+void RF12Ota::saveHeader () {
+    hdr.crc = crc16((const byte*) &hdr, offsetof(OtaHeader, crc));
+    store.save(0, &hdr, sizeof hdr);
+}
+
+// read the entire image back from the store and check its hash
+bool RF12Ota::verify () {
+    uint32_t h = 2166136261UL;
+    byte buf [CHUNK];
+    for (long pos = 0; pos < hdr.size; pos += CHUNK) {
+        byte n = CHUNK;
+        if (hdr.size - pos < n)
+            n = hdr.size - pos;
+        store.load(OTA_IMAGE + pos, buf, n);
+        h = hash(h, buf, n);
+    }
+    return h == hdr.hash;
+}
+
+void RF12Ota::check () {
+    store.load(0, &hdr, sizeof hdr);
+    if (crc16((const byte*) &hdr, offsetof(OtaHeader, crc)) != hdr.crc)
+        memset(&hdr, 0, sizeof hdr); // nothing valid stored yet
+    state = CHECKING;
+    retries = 0;
+    due = 1;
+}
+
+bool RF12Ota::accept () {
+    byte type = rf12_data[0];
+    if (rf12_len < 3 || type < OTA_REQ || type > OTA_DATA)
+        return false;
+    // requests from other nodes and packets for other types are ignored
+    if (type == OTA_REQ || rf12_data[1] != myType)
+        return true;
+    byte version = rf12_data[2];
+
+    if (type == OTA_INFO) {
+        if (state != CHECKING || rf12_len < 9)
+            return true;
+        word size = rf12_data[3] | (rf12_data[4] << 8);
+        uint32_t h = rf12_data[5] | (rf12_data[6] << 8) |
+                        ((uint32_t) rf12_data[7] << 16) |
+                        ((uint32_t) rf12_data[8] << 24);
+        if (version == myVersion || size == 0) {
+            state = IDLE; // up to date, or no image available
+            timer.set(0);
+            return true;
+        }
+        // resume the previous transfer if it was for the same image
+        if (hdr.type != myType || hdr.version != version ||
+                hdr.size != size || hdr.hash != h) {
+            memset(&hdr, 0, sizeof hdr);
+            hdr.type = myType;
+            hdr.version = version;
+            hdr.size = size;
+            hdr.hash = h;
+            saveHeader();
+        }
+        state = hdr.staged ? STAGED : LOADING;
+        retries = 0;
+        due = state == LOADING;
+        timer.set(0);
+        return true;
+    }
+
+    if (state != LOADING || version != hdr.version || rf12_len != 7 + CHUNK)
+        return true;
+    word chunk = rf12_data[3] | (rf12_data[4] << 8);
+    word crc = rf12_data[5] | (rf12_data[6] << 8);
+    const byte* data = (const byte*) rf12_data + 7;
+    if (chunk != hdr.next) {
+        // the end of the window arrived, but something before it was lost
+        if (chunk > hdr.next && chunk + 1 == windowEnd)
+            due = 1;
+        return true;
+    }
+    if (crc16(data, CHUNK) != crc)
+        return true;
+
+    // save the chunk, and check that it can be read back
+    long addr = OTA_IMAGE + (long) chunk * CHUNK;
+    store.save(addr, data, CHUNK);
+    byte buf [CHUNK];
+    store.load(addr, buf, CHUNK);
+    if (crc16(buf, CHUNK) != crc)
+        return true; // it'll be asked for again
+
+    retries = 0;
+    if ((long) ++hdr.next * CHUNK >= hdr.size) {
+        hdr.staged = verify();
+        if (!hdr.staged)
+            hdr.next = 0;
+        state = hdr.staged ? STAGED : FAILED;
+        saveHeader();
+        timer.set(0);
+    } else {
+        if (hdr.next % WINDOW == 0)
+            saveHeader();
+        if (hdr.next >= windowEnd)
+            due = 1;
+        else
+            timer.set(OTA_WAIT);
+    }
+    return true;
+}
+
+void RF12Ota::poll () {
+    if (state != CHECKING && state != LOADING)
+        return;
+    if (timer.poll()) {
+        if (++retries > OTA_RETRIES) {
+            state = FAILED; // the progress so far has been saved
+            return;
+        }
+        due = 1;
+    }
+    if (due && rf12_canSend()) {
+        byte buf [6];
+        buf[0] = OTA_REQ;
+        buf[1] = myType;
+        if (state == CHECKING) {
+            buf[2] = myVersion;
+            buf[3] = buf[4] = 0xFF;
+            buf[5] = 0;
+        } else {
+            buf[2] = hdr.version;
+            buf[3] = hdr.next;
+            buf[4] = hdr.next >> 8;
+            buf[5] = WINDOW;
+            windowEnd = hdr.next + WINDOW;
+            word chunks = ((long) hdr.size + CHUNK - 1) / CHUNK;
+            if (windowEnd > chunks)
+                windowEnd = chunks;
+        }
+        rf12_sendStart(0, buf, sizeof buf);
+        due = 0;
+        timer.set(OTA_WAIT);
+    }
+}
@@ -0,0 +1,92 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+/// @file
+/// Over-the-air firmware image transfer on top of the RF12.h driver.
+///
+/// Nodes pull a new image from a server, which is a Linux box with a JeeLink
+/// running RF12demo, see examples/RF12/otaNode/otaServer.tcl. The image is
+/// staged in external storage, such as a Memory Plug, for a bootloader to
+/// pick up. Nodes identify their firmware by a type and a version byte:
+///
+/// - A node asks for info about the current image of its type, and ignores
+///   the answer if its own version is the same.
+/// - It then asks for a window of 32-byte chunks at a time. Each chunk has
+///   a CRC, which is checked again after reading the chunk back from storage.
+/// - Progress is saved in storage along with the image, so the transfer can
+///   resume after a reset or a failure.
+/// - Once all chunks are in, the whole image is read back and compared to the
+///   32-bit FNV-1a hash sent by the server.
+///
+/// All packets are broadcasts, so nodes of the same type store each other's
+/// chunks when they happen to be the next ones they need. These packets start
+/// with a byte in the range 0xF6..0xF8, next to RF12frag.h and RF12stream.h.
+
+/// Storage for a staged image, with a header at address 0 and the image data
+/// from address 256 on. Accesses never cross a 32-byte boundary.
+class OtaStore {
+public:
+    virtual void load(long addr, void* buf, byte count) =0;
+    virtual void save(long addr, const void* buf, byte count) =0;
+};
+
+/// Image storage on a Memory Plug, starting at the specified 256-byte page.
+class OtaMemoryPlug : public OtaStore {
+    MemoryPlug& mem;
+    word first;
+public:
+    OtaMemoryPlug (MemoryPlug& plug, word page =0) : mem (plug), first (page) {}
+
+    virtual void load(long addr, void* buf, byte count)
+        { mem.load(first + (addr >> 8), addr, buf, count); }
+    virtual void save(long addr, const void* buf, byte count)
+        { mem.save(first + (addr >> 8), addr, buf, count); }
+};
+
+/// Progress of an image transfer, as saved at the start of the OtaStore.
+struct OtaHeader {
+    byte type, version;     ///< the image being staged
+    word size;              ///< image size in bytes
+    uint32_t hash;          ///< FNV-1a hash of the entire image
+    word next;              ///< next chunk needed
+    byte staged;            ///< set once the image has been verified
+    byte spare;
+    word crc;               ///< over all the above, to detect a blank store
+};
+
+/// Client side of the image transfer, one per node.
+class RF12Ota {
+public:
+    enum { CHUNK = 32, WINDOW = 8 };
+    /// Status, as returned by status().
+    enum { IDLE, CHECKING, LOADING, STAGED, FAILED };
+
+    /// Set up for a store, and the type and version of the running firmware.
+    RF12Ota (OtaStore& store, byte type, byte version);
+
+    /// Ask the server whether there is a new image, and load it if so.
+    /// Returns to IDLE if this node is up to date.
+    void check();
+    /// Call this with each good packet obtained through rf12_recvDone(), it
+    /// returns true if the packet was an image transfer packet.
+    bool accept();
+    /// Call this often, it sends requests when due.
+    void poll();
+
+    /// Returns one of IDLE, CHECKING, LOADING, STAGED, or FAILED.
+    byte status() const { return state; }
+    /// Returns the details and progress of the latest image.
+    const OtaHeader& image() const { return hdr; }
+
+    /// Update an FNV-1a hash, which starts off as 2166136261.
+    static uint32_t hash(uint32_t h, const byte* ptr, byte len);
+
+private:
+    OtaStore& store;
+    OtaHeader hdr;
+    byte myType, myVersion, state, retries, due;
+    word windowEnd;
+    MilliTimer timer;
+
+    void saveHeader();
+    bool verify();
+};
@@ -0,0 +1,184 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef RF12pack_h
+#define RF12pack_h
+
+/// @file
+/// Compact packet payloads, described by a schema shared by sender and receiver.
+///
+/// Unlike the RF12 class in RF12sio.h, nothing about the layout is sent along:
+/// both sides compile the same field list, so each value only takes as many
+/// bytes as its varint encoding needs. A schema is a macro which applies its
+/// argument to each (encoding, name) pair, usually kept in a small header file
+/// which is also included by the code decoding these packets, e.g. on a host
+/// (with a backslash at the end of each line of the define):
+///
+///     #define ROOM_FIELDS(F)
+///         F(PackVarint<byte>, light)
+///         F(PackVarint<byte>, moved)
+///         F(PackDelta< PackVarint<byte> >, humi)
+///         F(PackFixed<10>, temp)
+///
+///     RF12_SCHEMA(RoomPayload, ROOM_FIELDS)
+///
+/// This defines a struct with a member for each field, an encode() and decode()
+/// member, and a MAXSIZE constant. A compile-time check makes sure MAXSIZE fits
+/// in RF12_MAXDATA. Fields should only ever be added at the end, since decode()
+/// ignores any trailing bytes it doesn't know about.
+///
+/// Delta fields are sent as the difference with the previous packet, for values
+/// which change slowly, such as counters. If there are any, the payload starts
+/// with a byte holding a 7-bit sequence number, and bit 7 set for "full" packets,
+/// which are encoded as deltas from zero. Delta packets are refused by decode()
+/// until the next full one if a packet was missed, so send a full packet every
+/// so often when packets can get lost. The first packet is always a full one.
+
+#include <RF12.h>
+
+/// Append an unsigned value as a varint: 7 bits per byte, lowest bits first,
+/// with bit 7 set in all but the last byte.
+static inline void rf12_packVarint (uint8_t*& ptr, uint32_t value) {
+    while (value >= 0x80) {
+        *ptr++ = (uint8_t) value | 0x80;
+        value >>= 7;
+    }
+    *ptr++ = value;
+}
+
+/// Extract a varint, returns false if it runs past the end or is too long.
+static inline bool rf12_unpackVarint (const uint8_t*& ptr, const uint8_t* end,
+                                        uint32_t& value) {
+    value = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        if (ptr >= end)
+            return false;
+        uint8_t b = *ptr++;
+        value |= (uint32_t) (b & 0x7F) << shift;
+        if (b < 0x80)
+            return true;
+    }
+    return false;
+}
+
+/// Map signed values to unsigned ones, so that small negative numbers also
+/// turn into short varints: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+static inline uint32_t rf12_zigzag (int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+/// Inverse of rf12_zigzag().
+static inline int32_t rf12_unzigzag (uint32_t value) {
+    return (int32_t) ((value >> 1) ^ -(value & 1));
+}
+
+/// Field encoding for unsigned integers of up to 32 bits.
+template< typename T >
+struct PackVarint {
+    typedef T type;
+    enum { MAX = (8 * sizeof (T) + 6) / 7, DELTA = 0 };
+    static uint32_t toInt (T v) { return v; }
+    static T fromInt (uint32_t v) { return v; }
+    static uint32_t wire (T v, uint32_t&) { return v; }
+    static T unwire (uint32_t w, uint32_t&) { return w; }
+};
+
+/// Field encoding for signed integers of up to 32 bits.
+template< typename T >
+struct PackZigzag {
+    typedef T type;
+    enum { MAX = (8 * sizeof (T) + 6) / 7, DELTA = 0 };
+    static uint32_t toInt (T v) { return (int32_t) v; }
+    static T fromInt (uint32_t v) { return (int32_t) v; }
+    static uint32_t wire (T v, uint32_t&) { return rf12_zigzag(v); }
+    static T unwire (uint32_t w, uint32_t&) { return rf12_unzigzag(w); }
+};
+
+/// Field encoding for floats, sent as a signed integer after multiplying by
+/// SCALE, i.e. PackFixed<10> keeps one decimal.
+template< int SCALE >
+struct PackFixed {
+    typedef float type;
+    enum { MAX = 5, DELTA = 0 };
+    static uint32_t toInt (float v)
+        { return (int32_t) (v * SCALE + (v < 0 ? -0.5f : 0.5f)); }
+    static float fromInt (uint32_t v) { return (int32_t) v / (float) SCALE; }
+    static uint32_t wire (float v, uint32_t&) { return rf12_zigzag(toInt(v)); }
+    static float unwire (uint32_t w, uint32_t&)
+        { return fromInt(rf12_unzigzag(w)); }
+};
+
+/// Field encoding which sends the difference with the previous value, using
+/// one of the above for the values themselves.
+template< class E >
+struct PackDelta {
+    typedef typename E::type type;
+    enum { MAX = (8 * sizeof (type) + 7) / 7, DELTA = 1 };
+    static uint32_t wire (type v, uint32_t& prev) {
+        uint32_t i = E::toInt(v), d = i - prev;
+        prev = i;
+        return rf12_zigzag(d);
+    }
+    static type unwire (uint32_t w, uint32_t& prev) {
+        prev += rf12_unzigzag(w);
+        return E::fromInt(prev);
+    }
+};
+
+#define RF12_PACK_MEMBER(enc, name) enc::type name; uint32_t name##_prev;
+#define RF12_PACK_CLEAR(enc, name)  name = 0; name##_prev = 0;
+#define RF12_PACK_FULL(enc, name)   name##_prev = 0;
+#define RF12_PACK_DELTA(enc, name)  + enc::DELTA
+#define RF12_PACK_MAX(enc, name)    + enc::MAX
+#define RF12_PACK_PUT(enc, name) \
+    rf12_packVarint(p, enc::wire(name, name##_prev));
+#define RF12_PACK_GET(enc, name) \
+    if (!rf12_unpackVarint(p, end, w)) { seq = 0x80; return false; } \
+    name = enc::unwire(w, name##_prev);
+
+/// Define a struct called NAME for the schema FIELDS, see the description above.
+#define RF12_SCHEMA(NAME, FIELDS) \
+struct NAME { \
+    FIELDS(RF12_PACK_MEMBER) \
+    uint8_t seq; \
+    enum { DELTAS = 0 FIELDS(RF12_PACK_DELTA), \
+           MAXSIZE = (DELTAS ? 1 : 0) FIELDS(RF12_PACK_MAX) }; \
+    typedef char payload_exceeds_RF12_MAXDATA \
+                    [MAXSIZE <= RF12_MAXDATA ? 1 : -1]; \
+    NAME () { clear(); } \
+    void clear () { FIELDS(RF12_PACK_CLEAR) seq = 0x80; } \
+    uint8_t encode (uint8_t* buf, bool full =false) { \
+        uint8_t* p = buf; \
+        if (DELTAS != 0) { \
+            if (seq & 0x80) \
+                full = true; \
+            *p++ = (full ? 0x80 : 0) | (seq & 0x7F); \
+            seq = (seq + 1) & 0x7F; \
+            if (full) { FIELDS(RF12_PACK_FULL) } \
+        } \
+        FIELDS(RF12_PACK_PUT) \
+        return p - buf; \
+    } \
+    bool decode (const uint8_t* buf, uint8_t len) { \
+        const uint8_t *p = buf, *end = buf + len; \
+        if (DELTAS != 0) { \
+            if (len == 0) \
+                return false; \
+            uint8_t hdr = *p++; \
+            if (hdr & 0x80) { \
+                FIELDS(RF12_PACK_FULL) \
+                hdr &= 0x7F; \
+            } else if (hdr != seq) { \
+                if (((hdr + 1) & 0x7F) != seq) \
+                    seq = 0x80; /* missed one, wait for a full packet */ \
+                return false; \
+            } \
+            seq = (hdr + 1) & 0x7F; \
+        } \
+        uint32_t w; \
+        FIELDS(RF12_PACK_GET) \
+        (void) w; \
+        return true; \
+    } \
+};
+
+#endif
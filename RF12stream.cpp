@@ -0,0 +1,152 @@
+// Reliable byte stream on top of the RF12 driver
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <JeeLib.h>
+#include <RF12stream.h>
+
+#define STREAM_RETRY    50      // ms without ack before sending again
+#define STREAM_PROBE    250     // ms between checks of a full receive buffer
+
+// packet types, in the first payload byte
+#define STREAM_DATA     0xF4    // offset of first byte, then the data
+#define STREAM_ACK      0xF5    // offset of next byte expected, free space
+
+RF12Stream::RF12Stream (byte node)
+        : txAcked (0), txSent (0), txEnd (0), rxRead (0), rxNext (0),
+          myId (0), peer (node), peerRoom (255), rxRoom (255),
+          ackPending (0), txPush (0) {}
+
+bool RF12Stream::accept () {
+    byte type = rf12_data[0];
+    if (rf12_len < 4 || (type & 0xFE) != STREAM_DATA)
+        return false;
+    byte node = rf12_data[1] & RF12_HDR_MASK;
+    if (peer == 0)
+        peer = node;
+    if (node != peer)
+        return true;
+    word offset = rf12_data[2] | (rf12_data[3] << 8);
+
+    if (type == STREAM_DATA) {
+        // only accept data in order, anything else just gets an ack again
+        byte count = rf12_len - 4;
+        if (offset == rxNext && count <= RXSIZE - (word) (rxNext - rxRead))
+            for (byte i = 0; i < count; ++i)
+                rxBuf[rxNext++ % RXSIZE] = rf12_data[4+i];
+        ackPending = 1;
+    } else if (rf12_len >= 5) {
+        // ignore acks for data which was never sent, i.e. from a previous run
+        if ((word) (offset - txAcked) <= (word) (txEnd - txAcked)) {
+            if (offset != txAcked)
+                txTimer.set(STREAM_RETRY);
+            txAcked = offset;
+            // after sending again from an earlier point, a late ack can get
+            // ahead of what has been sent since
+            if ((word) (txSent - txAcked) > (word) (txEnd - txAcked))
+                txSent = txAcked;
+        }
+        peerRoom = rf12_data[4];
+        if (txAcked == txEnd)
+            txTimer.set(0);
+        else if (peerRoom == 0)
+            txTimer.set(STREAM_PROBE);
+    }
+    return true;
+}
+
+void RF12Stream::sendData (byte count) {
+    byte buf [RF12_MAXDATA];
+    buf[0] = STREAM_DATA;
+    buf[1] = myId;
+    buf[2] = txSent;
+    buf[3] = txSent >> 8;
+    for (byte i = 0; i < count; ++i)
+        buf[4+i] = txBuf[txSent++ % TXSIZE];
+    // until the other side is known, broadcast to pair with whoever answers
+    rf12_sendStart(peer ? RF12_HDR_DST | peer : 0, buf, 4 + count);
+    txTimer.set(peerRoom > 0 ? STREAM_RETRY : STREAM_PROBE);
+}
+
+void RF12Stream::poll () {
+    if (ackPending && rf12_canSend()) {
+        word room = RXSIZE - (word) (rxNext - rxRead);
+        rxRoom = room < 255 ? room : 255;
+        byte buf [5];
+        buf[0] = STREAM_ACK;
+        buf[1] = myId;
+        buf[2] = rxNext;
+        buf[3] = rxNext >> 8;
+        buf[4] = rxRoom;
+        rf12_sendStart(RF12_HDR_DST | peer, buf, sizeof buf);
+        ackPending = 0;
+        return;
+    }
+
+    // no ack in time: go back to the first byte not acked, and send it all
+    // again, this also checks whether a full receive buffer has room again
+    byte probe = 0;
+    if (txTimer.poll()) {
+        txSent = txAcked;
+        probe = 1;
+    }
+
+    word pending = txEnd - txSent, inFlight = txSent - txAcked;
+    word room = inFlight < peerRoom ? peerRoom - inFlight : 0;
+    byte count = FRAMESIZE;
+    if (count > pending)
+        count = pending;
+    if (count > room)
+        count = room;
+    // hold back small packets while waiting for acks, so that more data
+    // can be collected in the mean time
+    if (count < FRAMESIZE && inFlight > 0 && !txPush && !probe)
+        count = 0;
+    if ((count > 0 || probe) && rf12_canSend()) {
+        sendData(count);
+        if (txSent == txEnd)
+            txPush = 0;
+    } else if (probe)
+        txTimer.set(STREAM_RETRY);
+}
+
+int RF12Stream::availableForWrite () {
+    return TXSIZE - (word) (txEnd - txAcked);
+}
+
+int RF12Stream::available () {
+    return (word) (rxNext - rxRead);
+}
+
+int RF12Stream::read () {
+    if (rxRead == rxNext)
+        return -1;
+    byte b = rxBuf[rxRead++ % RXSIZE];
+    // tell the sender when a full buffer has room for a packet again
+    if (rxRoom < FRAMESIZE && RXSIZE - (word) (rxNext - rxRead) >= FRAMESIZE)
+        ackPending = 1;
+    return b;
+}
+
+int RF12Stream::peek () {
+    return rxRead != rxNext ? rxBuf[rxRead % RXSIZE] : -1;
+}
+
+void RF12Stream::flush () {
+    txPush = txSent != txEnd;
+}
+
+size_t RF12Stream::write (byte data) {
+    if (availableForWrite() == 0)
+        return 0;
+    txBuf[txEnd++ % TXSIZE] = data;
+    return 1;
+}
+
+size_t RF12Stream::write (const uint8_t* ptr, size_t len) {
+    size_t n = availableForWrite();
+    if (n > len)
+        n = len;
+    for (size_t i = 0; i < n; ++i)
+        txBuf[txEnd++ % TXSIZE] = ptr[i];
+    return n;
+}
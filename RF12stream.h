@@ -0,0 +1,68 @@
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef RF12stream_h
+#define RF12stream_h
+
+/// @file
+/// Reliable byte stream between two nodes, on top of the RF12.h driver.
+///
+/// Bytes written to the stream are collected in full packets whenever possible.
+/// A small packet only goes out once all earlier data has been acknowledged,
+/// or after flush(). Up to 255 bytes can be in flight at the same time,
+/// limited by the free space in the receiver's buffer, which comes along with
+/// each ack. Acks are cumulative, i.e. they report how many bytes have arrived
+/// in order so far. Anything not acked in time is sent again from that point.
+///
+/// Stream packets start with a byte 0xF4 or 0xF5, so make sure that no other
+/// packets exchanged with these nodes look like this.
+
+/// A Stream to send and receive bytes over the air, usable anywhere Serial is.
+/// Needs Arduino 1.0 or later, which introduced the Stream class.
+class RF12Stream : public Stream {
+public:
+    enum {
+        FRAMESIZE = RF12_MAXDATA - 4,   ///< max data bytes per packet
+        TXSIZE = 256,                   ///< bytes buffered for sending
+        RXSIZE = 256                    ///< bytes buffered after receiving
+    };
+
+    /// Set up a stream to a specific node, or 0 to pair with the first node
+    /// heard from, which only works with just two nodes around.
+    RF12Stream (byte node =0);
+
+    /// Set the node ID of this node, as returned by rf12_initialize() or
+    /// rf12_configSilent().
+    void begin(byte id) { myId = id; }
+
+    /// Call this with each good packet obtained through rf12_recvDone(), it
+    /// returns true if the packet was a data packet or ack for this stream.
+    bool accept();
+    /// Call this often, it sends data and acks when due.
+    void poll();
+
+    /// Returns the number of bytes which can be written without being dropped.
+    int availableForWrite();
+
+    virtual int available();
+    virtual int read();
+    virtual int peek();
+    /// Send out all pending data, even if it doesn't fill a packet. This does
+    /// not wait, the data still goes out from poll().
+    virtual void flush();
+    virtual size_t write(byte);
+    virtual size_t write(const uint8_t* ptr, size_t len);
+    using Print::write; // keep write(const char*) and the others visible
+
+private:
+    byte txBuf [TXSIZE], rxBuf [RXSIZE];
+    word txAcked, txSent, txEnd;        // stream offsets, wrap around
+                                        // (buffer sizes must divide 65536)
+    word rxRead, rxNext;                // stream offsets, wrap around
+    byte myId, peer, peerRoom, rxRoom;  // free space in receive buffers
+    byte ackPending, txPush;
+    MilliTimer txTimer;
+
+    void sendData(byte count);
+};
+
+#endif
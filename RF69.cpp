@@ -57,10 +57,10 @@ static volatile int8_t rxstate;     // current transceiver state
 static ROM_UINT8 configRegs_compat [] ROM_DATA = {
   0x01, 0x04, // OpMode = standby
   0x02, 0x00, // DataModul = packet mode, fsk
-  0x03, 0x02, // BitRateMsb, data rate = 49,261 khz
-  0x04, 0x8A, // BitRateLsb, divider = 32 MHz / 650
-  0x05, 0x05, // FdevMsb = 90 KHz
-  0x06, 0xC3, // FdevLsb = 90 KHz
+  0x03, RF69_BITRATE(49230) >> 8, // BitRateMsb, data rate = 49,261 khz
+  0x04, RF69_BITRATE(49230) & 0xFF, // BitRateLsb, divider = 32 MHz / 650
+  0x05, RF69_FDEV(90000) >> 8, // FdevMsb = 90 KHz
+  0x06, RF69_FDEV(90000) & 0xFF, // FdevLsb = 90 KHz
   // 0x07, 0xD9, // FrfMsb, freq = 868.000 MHz
   // 0x08, 0x00, // FrfMib, divider = 14221312
   // 0x09, 0x00, // FrfLsb, step = 61.03515625
@@ -81,6 +81,23 @@ static ROM_UINT8 configRegs_compat [] ROM_DATA = {
   0
 };
 
+// register settings for one modem profile: bit rate, deviation, and RxBw,
+// where RxBw is 0x40 (DccFreq 4%) + mantissa (0x00 = 16, 0x08 = 20,
+// 0x10 = 24) + exponent, giving 32 MHz / (mantissa * 2 ^ (exponent + 2))
+#define PROFILE(bps, fdev, rxbw) { \
+  0x03, RF69_BITRATE(bps) >> 8, 0x04, RF69_BITRATE(bps) & 0xFF, \
+  0x05, RF69_FDEV(fdev) >> 8, 0x06, RF69_FDEV(fdev) & 0xFF, \
+  0x19, rxbw, 0 }
+
+static ROM_UINT8 profileRegs [][11] ROM_DATA = {
+  PROFILE(  4800,   5000, 0x54), // RxBw 20.8 kHz
+  PROFILE(  9600,  20000, 0x44), // RxBw 31.3 kHz
+  PROFILE( 49230,  90000, 0x42), // RxBw 125 kHz
+  PROFILE(100000, 100000, 0x51), // RxBw 167 kHz
+  PROFILE(200000, 100000, 0x41), // RxBw 250 kHz
+  PROFILE(300000, 150000, 0x50), // RxBw 333 kHz
+};
+
 uint8_t RF69::control(uint8_t cmd, uint8_t val) {
     PreventInterrupt irq0;
     return spiTransfer(cmd, val);
@@ -105,6 +122,15 @@ static void setMode (uint8_t mode) {
     //     ;
 }
 
+static void writeRegs (ROM_UINT8* init) {
+    for (;;) {
+        uint8_t cmd = ROM_READ_UINT8(init);
+        if (cmd == 0) break;
+        writeReg(cmd, ROM_READ_UINT8(init+1));
+        init += 2;
+    }
+}
+
 static void initRadio (ROM_UINT8* init) {
     spiInit();
     do
@@ -113,12 +139,7 @@ static void initRadio (ROM_UINT8* init) {
     do
         writeReg(REG_SYNCVALUE1, 0x55);
     while (readReg(REG_SYNCVALUE1) != 0x55);
-    for (;;) {
-        uint8_t cmd = ROM_READ_UINT8(init);
-        if (cmd == 0) break;
-        writeReg(cmd, ROM_READ_UINT8(init+1));
-        init += 2;
-    }
+    writeRegs(init);
 }
 
 void RF69::setFrequency (uint32_t freq) {
@@ -130,6 +151,22 @@ void RF69::setFrequency (uint32_t freq) {
     frf = ((freq << 2) / (32000000L >> 11)) << 6;
 }
 
+void RF69::retune () {
+    // send the frequency set with setFrequency() to the radio
+    writeReg(REG_FRFMSB, frf >> 16);
+    writeReg(REG_FRFMSB+1, frf >> 8);
+    writeReg(REG_FRFMSB+2, frf);
+    // a new frequency only takes effect in the receiver after a restart
+    if (rxstate == TXRECV)
+        writeReg(REG_PACKETCONFIG2, readReg(REG_PACKETCONFIG2) | 0x04);
+}
+
+void RF69::setProfile (uint8_t profile) {
+    // the radio must be initialized, and both sides must use the same profile
+    if (profile < sizeof profileRegs / sizeof *profileRegs)
+        writeRegs(profileRegs[profile]);
+}
+
 bool RF69::canSend () {
     if (rxstate == TXRECV && rxfill == 0) {
         rxstate = TXIDLE;
@@ -158,11 +195,8 @@ void RF69::configure_compat () {
     // writeReg(REG_SYNCCONFIG, group ? 0x88 : 0x80);
     writeReg(REG_SYNCVALUE3, group);
 
-    writeReg(REG_FRFMSB, frf >> 16);
-    writeReg(REG_FRFMSB+1, frf >> 8);
-    writeReg(REG_FRFMSB+2, frf);
-
     rxstate = TXIDLE;
+    retune();
 }
 
 uint8_t* recvBuf;
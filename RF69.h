@@ -1,13 +1,37 @@
 #ifndef RF69_h
 #define RF69_h
 
+// compile-time conversions to RFM69 register values, using a 32 MHz crystal:
+// the frequency step size is 32 MHz / 2^19 = 61.03515625 Hz = 15625 / 256 Hz
+
+/// Value for the 24-bit FRF register, for a frequency given in Hz. This avoids
+/// the run-time calculation in setFrequency() when the frequency is known, use
+/// as: RF69::frf = RF69_FRF(868300000L); RF69::retune();
+#define RF69_FRF(hz)        ((uint32_t) (((hz) * 256ULL + 7812) / 15625))
+/// Value for the 16-bit BitRate register, for a bit rate given in bits/sec.
+#define RF69_BITRATE(bps)   ((uint16_t) ((32000000L + (bps) / 2) / (bps)))
+/// Value for the 14-bit Fdev register, for a frequency deviation given in Hz.
+#define RF69_FDEV(hz)       ((uint16_t) (((hz) * 256L + 7812) / 15625))
+
 namespace RF69 {
+    /// Modem profiles, for use with setProfile().
+    enum {
+        PROFILE_4K8,    ///< 4.8 kbps, 5 kHz deviation, long range
+        PROFILE_9K6,    ///< 9.6 kbps, 20 kHz deviation
+        PROFILE_49K2,   ///< 49.2 kbps, 90 kHz deviation, the RF12 default
+        PROFILE_100K,   ///< 100 kbps, 100 kHz deviation
+        PROFILE_200K,   ///< 200 kbps, 100 kHz deviation
+        PROFILE_300K,   ///< 300 kbps, 150 kHz deviation, short range
+    };
+
     extern uint32_t frf;
     extern uint8_t  group;
     extern uint8_t  node;
     extern uint8_t  rssi;
 
     void setFrequency (uint32_t freq);
+    void retune ();
+    void setProfile (uint8_t profile);
     bool canSend ();
     bool sending ();
     void sleep (bool off);
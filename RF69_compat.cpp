@@ -7,6 +7,16 @@ volatile uint16_t rf69_crc;
 volatile uint8_t rf69_buf[72];
 
 static byte nodeid; // only used in the easyPoll code
+static byte band;   // only used to convert frequencies when hopping
+static byte asleep; // set while put to sleep by rf69_sleep()
+
+// same as in RF12
+static const uint16_t* hopTable;    // frequency values to hop across
+static uint8_t hopCount;            // number of entries in hopTable, 0 = off
+static uint16_t hopDwell;           // ms to stay on each frequency
+static uint32_t hopStart;           // millis() value at the start of slot 0
+static uint16_t hopFreq;            // frequency the radio is now tuned to
+static uint16_t frequency;          // frequency when not hopping
 
 // same as in RF12
 #define RETRIES     8               // stop retrying after 8 times
@@ -25,14 +35,29 @@ static long ezNextSend[2];          // when was last retry [0] or data [1] sent
 // void rf69_spiInit () {
 // }
 
-uint8_t rf69_initialize (uint8_t id, uint8_t band, uint8_t group, uint16_t off) {
+// convert an RF12-style frequency value within the band to Hz
+static uint32_t toHz (uint16_t off) {
     uint8_t freq = 0;
     switch (band) {
         case RF12_433MHZ: freq = 43; break;
         case RF12_868MHZ: freq = 86; break;
         case RF12_915MHZ: freq = 90; break;
     }
-    RF69::setFrequency(freq * 10000000L + band * 2500L * off);
+    return freq * 10000000L + band * 2500L * off;
+}
+
+uint8_t rf69_initialize (uint8_t id, uint8_t b, uint8_t group, uint16_t off) {
+    // same as in RF12: if nothing changed while asleep, only wake up again
+    if (asleep && id == nodeid && b == band && group == RF69::group &&
+                                                        off == frequency) {
+        RF69::sleep(false);
+        asleep = 0;
+        return nodeid;
+    }
+    asleep = 0;
+    band = b;
+    frequency = off;
+    RF69::setFrequency(toHz(off));
     RF69::group = group;
     RF69::node = id & RF12_HDR_MASK;
     delay(20); // needed to make RFM69 work properly on power-up
@@ -77,7 +102,49 @@ uint8_t rf69_config (uint8_t show) {
     return id;
 }
 
+// same as in RF12
+void rf69_hopInit (const uint16_t* table, uint8_t count, uint16_t dwell) {
+    hopTable = table;
+    hopCount = table != 0 ? count : 0;
+    hopDwell = dwell;
+    hopStart = millis();
+    hopFreq = frequency;
+    if (hopCount == 0) {
+        RF69::setFrequency(toHz(frequency)); // back to the fixed frequency
+        RF69::retune();
+    }
+}
+
+// same as in RF12
+uint16_t rf69_hopSlot () {
+    return hopDwell != 0 ? (millis() - hopStart) / hopDwell : 0;
+}
+
+// same as in RF12
+void rf69_hopSync (uint16_t slot, uint16_t elapsed) {
+    hopStart = millis() - (uint32_t) slot * hopDwell - elapsed;
+}
+
+// same as in RF12
+static uint16_t hopFrequency (uint16_t slot) {
+    uint16_t h = _crc16_update(RF69::group, slot);
+    h = _crc16_update(h, slot >> 8);
+    return hopTable[h % hopCount];
+}
+
+// same as in RF12, but using RF69::retune() to change the frequency
+static void hopCheck () {
+    uint16_t f = hopFrequency(rf69_hopSlot());
+    if (f != hopFreq) {
+        hopFreq = f;
+        RF69::setFrequency(toHz(f));
+        RF69::retune();
+    }
+}
+
 uint8_t rf69_recvDone () {
+    if (hopCount != 0 && !RF69::sending())
+        hopCheck();
     rf69_crc = RF69::recvDone_compat((uint8_t*) rf69_buf);
     return rf69_crc != ~0;
 }
@@ -90,6 +157,8 @@ uint8_t rf69_canSend () {
 // }
 
 void rf69_sendStart (uint8_t hdr, const void* ptr, uint8_t len) {
+    if (hopCount != 0)
+        hopCheck();
     RF69::sendStart_compat(hdr, ptr, len);
 }
 
@@ -120,6 +189,7 @@ void rf69_onOff (uint8_t value) {
 
 void rf69_sleep (char n) {
     RF69::sleep(n == RF12_SLEEP);
+    asleep = n == RF12_SLEEP;
 }
 
 // char rf69_lowbat () {
@@ -30,6 +30,12 @@
 #define rf12_easyPoll       rf69_easyPoll
 #define rf12_easySend       rf69_easySend
 #define rf12_encrypt        rf69_encrypt
+#define rf12_encryptAuth    rf69_encryptAuth
+#define rf12_encryptTable   rf69_encryptTable
+#define rf12_setFilter      rf69_setFilter
+#define rf12_hopInit        rf69_hopInit
+#define rf12_hopSlot        rf69_hopSlot
+#define rf12_hopSync        rf69_hopSync
 #define rf12_control        rf69_control
 
 #endif
@@ -0,0 +1,49 @@
+// Stand-in for the I2C and Sensor parts of Ports.h, the bus is the mock in
+// bmp085Ref.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Ports_h
+#define Ports_h
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+class PortI2C {
+public:
+    PortI2C (uint8_t) {}
+    uint8_t start(uint8_t addr) const;
+    void stop() const;
+    uint8_t write(uint8_t data) const;
+    uint8_t read(uint8_t last) const;
+};
+
+// same as in Ports.h
+class DeviceI2C {
+    const PortI2C& port;
+    uint8_t addr;
+public:
+    DeviceI2C(const PortI2C& p, uint8_t me) : port (p), addr (me << 1) {}
+    uint8_t send() const
+        { return port.start(addr); }
+    uint8_t receive() const
+        { return port.start(addr | 1); }
+    void stop() const
+        { port.stop(); }
+    uint8_t write(uint8_t data) const
+        { return port.write(data); }
+    uint8_t read(uint8_t last) const
+        { return port.read(last); }
+};
+
+// same as in Ports.h, without run()
+class Sensor {
+protected:
+    word due;
+    void waitFor(word ms) { due = millis() + ms; }
+public:
+    virtual void start() =0;
+    word readyAt() const { return due; }
+    virtual bool collect() =0;
+};
+
+#endif
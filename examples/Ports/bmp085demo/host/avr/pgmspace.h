@@ -0,0 +1,13 @@
+// Stand-in for <avr/pgmspace.h>, flash is just memory on the host.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef pgmspace_h
+#define pgmspace_h
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define pgm_read_word(p)    (*(const uint16_t*) (p))
+
+#endif
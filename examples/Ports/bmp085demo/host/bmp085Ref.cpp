@@ -0,0 +1,160 @@
+// Check the BMP085 code against the reference values from the Bosch data sheet.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o bmp085Ref bmp085Ref.cpp
+//
+// Usage: bmp085Ref
+//
+// The I2C bus is a mock of the BMP085, with the calibration data of the
+// example calculation in the Bosch Sensortec data sheet (rev. 1.2, 5.3), and
+// which returns UT = 27898 and UP = 23843 after a conversion. PortsBMP085.cpp
+// reads these over the mock bus, with getCalibData() and measure(), and with
+// start() and collect(), and must come up with the same 15.0 degrees and
+// 69964 Pa as the data sheet. The same is done for each oversampling setting,
+// with UP scaled up to match, where the result may be off by a few Pa due to
+// the extra resolution. Then altitude() and seaLevel() are compared against
+// the barometric formula with pow(), over the range their comments document.
+// Exits with status 1 if any check failed.
+//
+// Note that int is 32 bits here, but 16 bits on the ATmega, so this does not
+// catch overflows in int arithmetic. All calculations use int32_t, though.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../../../PortsBMP085.cpp"
+
+// the BMP085, only its registers as seen over I2C
+static struct Chip {
+    uint8_t regs [256];
+    uint8_t reg;            // register pointer
+    bool first;             // the next byte written is the register address
+    long ut, up;            // raw readings returned after a conversion
+
+    void setWord (uint8_t r, uint16_t v) {
+        regs[r] = v >> 8;
+        regs[r+1] = v;
+    }
+
+    void write (uint8_t value) {
+        if (first) {
+            reg = value;
+            first = false;
+            return;
+        }
+        if (reg == 0xF4) { // start a conversion, completes instantly here
+            uint8_t oss = value >> 6;
+            if (value == 0x2E)
+                setWord(0xF6, ut);
+            else if ((value & 0x3F) == 0x34) {
+                long v = up << (8 - oss);
+                regs[0xF6] = v >> 16;
+                regs[0xF7] = v >> 8;
+                regs[0xF8] = v;
+            }
+        }
+        regs[reg++] = value;
+    }
+} chip;
+
+uint8_t PortI2C::start (uint8_t addr) const {
+    chip.first = (addr & 1) == 0;
+    return (addr >> 1) == 0x77;
+}
+
+void PortI2C::stop () const {}
+
+uint8_t PortI2C::write (uint8_t data) const {
+    chip.write(data);
+    return 1;
+}
+
+uint8_t PortI2C::read (uint8_t) const {
+    return chip.regs[chip.reg++];
+}
+
+static bool allOk = true;
+
+static void check (const char* what, long value, long expected, long slack) {
+    bool ok = labs(value - expected) <= slack;
+    printf("%-36s %8ld %8ld%s\n", what, value, expected, ok ? "" : "  FAILED");
+    allOk = allOk && ok;
+}
+
+int main () {
+    // calibration data from the data sheet example
+    static const int16_t calib [] = {
+        408, -72, -14383, 32741, 32757, 23153, 6190, 4, -32768, -8711, 2868
+    };
+    for (uint8_t i = 0; i < 11; ++i)
+        chip.setWord(0xAA + 2 * i, calib[i]);
+    chip.ut = 27898;
+    chip.up = 23843;
+
+    PortI2C bus (1);
+    BMP085 psensor (bus);
+    psensor.getCalibData();
+
+    printf("%-36s %8s %8s\n", "", "result", "expected");
+    char what [40];
+    for (uint8_t oss = 0; oss < 4; ++oss) {
+        psensor.setOverSampling(oss);
+        chip.up = 23843L << oss;
+        // the extra bits of a higher setting are zero, so the result can only
+        // differ by what the rounding in calcPres() does with them
+        const long slack = oss == 0 ? 0 : 2;
+
+        psensor.measure(BMP085::TEMP);
+        psensor.measure(BMP085::PRES);
+        int16_t t;
+        int32_t p;
+        psensor.calculate(t, p);
+        snprintf(what, sizeof what, "oss %d, measure(), temperature", oss);
+        check(what, t, 150, 0);
+        snprintf(what, sizeof what, "oss %d, measure(), pressure", oss);
+        check(what, p, 69964, slack);
+
+        psensor.start();
+        if (psensor.collect() || !psensor.collect()) {
+            printf("collect() did not take two steps\n");
+            allOk = false;
+        }
+        snprintf(what, sizeof what, "oss %d, collect(), temperature", oss);
+        check(what, psensor.temperature(), 150, 0);
+        snprintf(what, sizeof what, "oss %d, collect(), pressure", oss);
+        check(what, psensor.pressure(), 69964, slack);
+    }
+
+    // altitude(): documented to be within 1.5 m from about -900 to 5400 m
+    double maxAlt = 0;
+    for (long p0 = 95000; p0 <= 105000; p0 += 2500)
+        for (long p = 30000; p <= 110000; p += 7) {
+            double ref = 44330 * (1 - pow((double) p / p0, 0.1903));
+            if (ref < -900 || ref > 5400)
+                continue;
+            double d = fabs(BMP085::altitude(p, p0) - ref);
+            if (d > maxAlt)
+                maxAlt = d;
+        }
+    printf("\naltitude() largest error %.2f m\n", maxAlt);
+    allOk = allOk && maxAlt <= 1.5;
+
+    // seaLevel(): documented to be within about 10 Pa from -512 to 4608 m
+    double maxSea = 0;
+    for (int alt = -512; alt <= 4608; ++alt) {
+        double ratio = pow(1 - alt / 44330.0, -5.255);
+        for (long p0 = 95000; p0 <= 105000; p0 += 2500) {
+            long p = p0 / ratio + 0.5;
+            double d = fabs(BMP085::seaLevel(p, alt) - p * ratio);
+            if (d > maxSea)
+                maxSea = d;
+        }
+    }
+    printf("seaLevel() largest error %.2f Pa\n", maxSea);
+    allOk = allOk && maxSea <= 10;
+
+    return !allOk;
+}
@@ -0,0 +1,145 @@
+// Compare the fixed-point ColorPlug::chromaCCT() against the float version.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o colorCheck colorCheck.cpp
+//
+// Usage: colorCheck [-n samples]
+//  -n samples  random readings to convert, default 1000000
+//
+// Random red, green, and blue readings are converted with chromaCCT() from
+// Ports.cpp and with the floating point code it replaced, in float as on the
+// ATmega. Half the samples use the full 16-bit range, the others are scaled
+// down by a random power of two, as with dim light or a low gain. Both
+// versions must agree on which readings are valid. Where they are, x and y
+// may be off by one, and where x and y are the same, the CCT must be within
+// 1 K. The number of valid readings, the x and y differences, and the largest
+// CCT difference are printed. Then all samples are converted again in one
+// call, which must give the same results. Exits with status 1 if any check
+// failed.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../../../Ports.cpp"
+
+volatile uint8_t ADCSRA, MCUCR, MCUSR, PORTD, WDTCSR, SREG, TCCR2A, TCCR2B,
+                 TCNT2, OCR2A, TIMSK2, TIFR2, PCICR, PCMSK0, PCMSK1, PCMSK2;
+volatile unsigned long timer0_millis;
+
+// used by RemoteNode in Ports.cpp, but PortsRF12.cpp is not needed here
+void RemoteHandler::setup (uint8_t, uint8_t, uint8_t) {}
+uint8_t RemoteHandler::poll (RemoteNode&, uint8_t) { return 0; }
+
+unsigned long millis () { return 0; }
+unsigned long micros () { return 0; }
+void delay (unsigned long) {}
+void delayMicroseconds (unsigned int) {}
+void pinMode (uint8_t, uint8_t) {}
+void digitalWrite (uint8_t, uint8_t) {}
+int digitalRead (uint8_t) { return 1; }
+int analogRead (uint8_t) { return 0; }
+void analogWrite (uint8_t, int) {}
+unsigned long pulseIn (uint8_t, uint8_t, unsigned long) { return 0; }
+void shiftOut (uint8_t, uint8_t, uint8_t, uint8_t) {}
+
+// the calculation chromaCCT() used before, with float instead of double
+static void floatCCT (const word* rgbc, word* out) {
+    out[0] = out[1] = out[2] = 0;
+    long X = -14282L * rgbc[0] + 154924L * rgbc[1] - 95641L * rgbc[2];
+    long Y = -32466L * rgbc[0] + 157837L * rgbc[1] - 73191L * rgbc[2];
+    long Z = -68202L * rgbc[0] +  77073L * rgbc[1] + 56332L * rgbc[2];
+    if (X > 0 && Y > 0 && Z > 0) {
+        out[0] = (X * 1000.0f) / (X + Y + Z);
+        out[1] = (Y * 1000.0f) / (X + Y + Z);
+        float n = (out[0] - 332.0f) / (185.8f - out[1]);
+        float t = 449 * n * n * n + 3525 * n * n + 6823.3f * n + 5520.33f;
+        // a negative value does not convert to word, count it as improbable
+        out[2] = t >= 0 && t <= 10000 ? (word) t : 0;
+    }
+}
+
+int main (int argc, char** argv) {
+    long samples = 1000000;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+        switch (opt) {
+            case 'n': samples = atol(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n samples]\n", argv[0]);
+                return 1;
+        }
+    if (samples < 1 || samples > 1000000000L / 7) {
+        fprintf(stderr, "%s: need 1 or more samples\n", argv[0]);
+        return 1;
+    }
+
+    srand(1);
+    std::vector<word> rgbc (4 * samples), out (3 * samples);
+    long valid = 0, validDiffers = 0, xyOffByOne = 0, xyWorse = 0;
+    long cctCompared = 0, cctWorse = 0, cctValidDiffers = 0;
+    int maxCCT = 0;
+
+    for (long i = 0; i < samples; ++i) {
+        word* s = &rgbc[4 * i];
+        int shift = i % 2 ? rand() % 12 : 0;
+        for (byte j = 0; j < 3; ++j)
+            s[j] = (rand() & 0xFFFF) >> shift;
+        s[3] = s[0] + s[1] + s[2];
+
+        word fixed [3], ref [3];
+        ColorPlug::chromaCCT(s, fixed);
+        floatCCT(s, ref);
+        bool okFixed = fixed[0] || fixed[1], okRef = ref[0] || ref[1];
+        if (okFixed != okRef) {
+            ++validDiffers;
+            continue;
+        }
+        if (!okRef)
+            continue;
+        ++valid;
+        int dx = abs(fixed[0] - ref[0]), dy = abs(fixed[1] - ref[1]);
+        if (dx > 1 || dy > 1)
+            ++xyWorse;
+        else if (dx || dy)
+            ++xyOffByOne;
+        else if ((fixed[2] != 0) != (ref[2] != 0))
+            ++cctValidDiffers;
+        else if (ref[2] != 0) {
+            ++cctCompared;
+            int d = abs(fixed[2] - ref[2]);
+            if (d > maxCCT)
+                maxCCT = d;
+            cctWorse += d > 1;
+        }
+    }
+
+    // the batch form must give the same results as one sample at a time,
+    // in chunks of up to 255 samples since the count is a byte
+    long batchDiffers = 0;
+    for (long i = 0; i < samples; i += 255) {
+        byte n = samples - i < 255 ? samples - i : 255;
+        ColorPlug::chromaCCT(&rgbc[4 * i], &out[3 * i], n);
+        for (byte j = 0; j < n; ++j) {
+            word one [3];
+            ColorPlug::chromaCCT(&rgbc[4 * (i + j)], one);
+            batchDiffers += memcmp(one, &out[3 * (i + j)], sizeof one) != 0;
+        }
+    }
+
+    printf("%ld samples, %ld with valid chromaticity\n\n", samples, valid);
+    printf("validity differs               %8ld\n", validDiffers);
+    printf("x or y off by one              %8ld\n", xyOffByOne);
+    printf("x or y off by more             %8ld\n", xyWorse);
+    printf("CCT validity differs           %8ld\n", cctValidDiffers);
+    printf("CCT compared, same x and y     %8ld\n", cctCompared);
+    printf("CCT off by more than 1 K       %8ld\n", cctWorse);
+    printf("largest CCT difference         %8d K\n", maxCCT);
+    printf("batch differs from single      %8ld\n", batchDiffers);
+    return validDiffers != 0 || xyWorse != 0 || cctWorse != 0 ||
+            batchDiffers != 0;
+}
@@ -0,0 +1,275 @@
+// Test the interrupt-driven DHTxx decoder against simulated sensor timing.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o dhtTest dhtTest.cpp
+//
+// Usage: dhtTest [-r runs] [-j us] [-l us]
+//  -r runs     readings for each case, default 1000
+//  -j us       max random deviation of each pulse from its nominal width,
+//              default 5
+//  -l us       max interrupt latency, i.e. the time from an edge on the pin
+//              until DHTxx::edge() runs, default 10
+//
+// The sensor model answers the start pulse from DHTxx::start() as the data
+// sheets describe: after 30 us it pulls the line low for 80 us, releases it
+// for 80 us, then sends 40 bits as 50 us low followed by 26 us (0) or 70 us
+// (1) high, and ends with 50 us low. Each edge calls DHTxx::edge() as the
+// pin-change interrupt would, after a random latency, but only while the
+// pin-change interrupt for the pin is enabled. When the latency makes the
+// interrupt run after the next edge, both edges are handled by one call, as
+// on the ATmega. The main loop calls ready() every 100 us, which is how often
+// a busy sketch might get around to it. The simulated micros() starts at a
+// random value, so that its 16-bit roll-over happens during the readings.
+//
+// Random DHT22 and DHT11 readings must come out exactly as encoded, readings
+// with a bad checksum must be rejected, and so must a missing sensor. Then
+// the fraction of good readings is printed for a range of latencies, which
+// shows how much margin the 48 us threshold leaves. Exits with status 1 if
+// any check failed, with the jitter and latency given.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../../../Ports.cpp"
+
+#define PIN     5           // DIO2, as in dht_demo.ino
+
+volatile uint8_t ADCSRA, MCUCR, MCUSR, PORTD, WDTCSR, SREG, TCCR2A, TCCR2B,
+                 TCNT2, OCR2A, TIMSK2, TIFR2, PCICR, PCMSK0, PCMSK1, PCMSK2;
+volatile unsigned long timer0_millis;
+
+// used by RemoteNode in Ports.cpp, but PortsRF12.cpp is not needed here
+void RemoteHandler::setup (uint8_t, uint8_t, uint8_t) {}
+uint8_t RemoteHandler::poll (RemoteNode&, uint8_t) { return 0; }
+
+static uint64_t now;        // simulated time, in us
+static int jitter = 5, latency = 10;
+
+unsigned long millis () { return now / 1000; }
+unsigned long micros () { return now; }
+void delay (unsigned long ms) { now += ms * 1000; }
+void delayMicroseconds (unsigned int us) { now += us; }
+int analogRead (uint8_t) { return 0; }
+void analogWrite (uint8_t, int) {}
+unsigned long pulseIn (uint8_t, uint8_t, unsigned long) { return 0; }
+void shiftOut (uint8_t, uint8_t, uint8_t, uint8_t) {}
+
+// a random number in the range -range .. range
+static int rnd (int range) {
+    return range > 0 ? rand() % (2 * range + 1) - range : 0;
+}
+
+// the data line, with a pull-up, driven low by either side
+static struct Line {
+    bool output, value;     // pin mode and output value on the ATmega side
+    uint64_t lowSince;      // when the ATmega started pulling the line low
+    bool present;           // whether a sensor is connected
+    byte data [5];          // what the sensor will send
+    struct Edge { uint64_t at; bool level; };
+    std::vector<Edge> edges; // from the sensor, in time order
+    size_t next;            // next edge to happen
+    bool sensorLow;
+
+    bool driven () const { return output && !value; }
+    bool level () const { return !driven() && !sensorLow; }
+
+    void add (uint64_t& t, int us, bool level) {
+        t += us + rnd(jitter);
+        Edge e = { t, level };
+        edges.push_back(e);
+    }
+
+    // the sensor answers once the start pulse from the ATmega ends
+    void changed (bool wasDriven) {
+        if (!wasDriven && driven())
+            lowSince = now;
+        else if (wasDriven && !driven() && present &&
+                    now - lowSince >= 1000) {
+            edges.clear();
+            next = 0;
+            uint64_t t = now;
+            add(t, 30, false);
+            add(t, 80, true);
+            add(t, 80, false);
+            for (byte i = 0; i < 40; ++i) {
+                add(t, 50, true);
+                add(t, bitRead(data[i/8], 7 - i%8) ? 70 : 26, false);
+            }
+            add(t, 50, true);
+        }
+    }
+} line;
+
+void pinMode (uint8_t pin, uint8_t mode) {
+    if (pin == PIN) {
+        bool was = line.driven();
+        line.output = mode == OUTPUT;
+        line.changed(was);
+    }
+}
+
+void digitalWrite (uint8_t pin, uint8_t value) {
+    if (pin == PIN) {
+        bool was = line.driven();
+        line.value = value;
+        line.changed(was);
+    }
+}
+
+int digitalRead (uint8_t pin) {
+    return pin == PIN ? line.level() : 1;
+}
+
+static bool pinChangeOn () {
+    return bitRead(PCICR, digitalPinToPCICRbit(PIN)) &&
+            bitRead(*digitalPinToPCMSK(PIN), digitalPinToPCMSKbit(PIN));
+}
+
+// let time pass until "until", with the sensor's edges and interrupts
+static void advance (uint64_t until) {
+    while (line.next < line.edges.size() && line.edges[line.next].at <= until) {
+        const Line::Edge& e = line.edges[line.next++];
+        if (now < e.at)
+            now = e.at;
+        line.sensorLow = !e.level;
+        uint64_t isr = e.at + rnd(latency / 2) + latency / 2;
+        // an edge before the interrupt runs is handled by the same call
+        if (line.next < line.edges.size() && line.edges[line.next].at <= isr)
+            continue;
+        if (now < isr)
+            now = isr;
+        if (pinChangeOn())
+            DHTxx::edge();
+    }
+    if (now < until)
+        now = until;
+}
+
+// do one reading, return true if the result came out as expected
+static bool measure (DHTxx& dht, bool precise, int& t, int& h) {
+    dht.start();
+    uint64_t start = now;
+    while (!dht.ready()) {
+        advance(now + 100);
+        if (now - start > 100000) {
+            printf("ready() never returned true\n");
+            exit(1);
+        }
+    }
+    if (pinChangeOn()) {
+        printf("pin-change interrupt still enabled after ready()\n");
+        exit(1);
+    }
+    advance(now + 1000); // let the sensor finish, if it's still sending
+    line.edges.clear();
+    line.next = 0;
+    return dht.result(t, h, precise);
+}
+
+// set up a random reading, return the results expected from it
+static void encode (bool precise, int& temp, int& humi) {
+    byte* d = line.data;
+    if (precise) {
+        humi = rand() % 1001;
+        temp = rand() % 1251 - 400;
+        d[0] = humi >> 8;
+        d[1] = humi;
+        d[2] = (temp < 0 ? 0x80 : 0) | abs(temp) >> 8;
+        d[3] = abs(temp);
+    } else {
+        d[0] = rand() % 81 + 20;
+        d[1] = 0;
+        d[2] = rand() % 51;
+        d[3] = 0;
+        humi = 10 * d[0];
+        temp = 10 * d[2];
+    }
+    d[4] = d[0] + d[1] + d[2] + d[3];
+}
+
+// fraction of readings which come out right, and count of wrong ones
+static double run (DHTxx& dht, int runs, bool precise, long& wrong) {
+    long good = 0;
+    wrong = 0;
+    for (int i = 0; i < runs; ++i) {
+        int temp, humi, t, h;
+        encode(precise, temp, humi);
+        advance(now + 1000000 + rand() % 1000);
+        if (measure(dht, precise, t, h)) {
+            if (t == temp && h == humi)
+                ++good;
+            else
+                ++wrong;
+        }
+    }
+    return (double) good / runs;
+}
+
+int main (int argc, char** argv) {
+    int runs = 1000, opt;
+    while ((opt = getopt(argc, argv, "r:j:l:")) != -1)
+        switch (opt) {
+            case 'r': runs = atoi(optarg); break;
+            case 'j': jitter = atoi(optarg); break;
+            case 'l': latency = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-r runs] [-j us] [-l us]\n",
+                        argv[0]);
+                return 1;
+        }
+    if (runs < 1 || jitter < 0 || jitter > 20 || latency < 0) {
+        fprintf(stderr, "%s: need at least 1 run, jitter up to 20 us\n",
+                argv[0]);
+        return 1;
+    }
+
+    srand(1);
+    now = rand();
+    DHTxx dht (PIN);
+    line.present = true;
+    bool allOk = true;
+    long wrong;
+
+    printf("jitter %d us, latency up to %d us, %d readings per case\n\n",
+            jitter, latency, runs);
+    double ok22 = run(dht, runs, true, wrong);
+    printf("DHT22 readings decoded       %6.1f%%\n", ok22 * 100);
+    allOk = allOk && ok22 == 1 && wrong == 0;
+    double ok11 = run(dht, runs, false, wrong);
+    printf("DHT11 readings decoded       %6.1f%%\n", ok11 * 100);
+    allOk = allOk && ok11 == 1 && wrong == 0;
+
+    long accepted = 0;
+    for (int i = 0; i < runs; ++i) {
+        int temp, humi, t, h;
+        encode(true, temp, humi);
+        line.data[4] ^= 1 << rand() % 8;
+        advance(now + 1000000);
+        accepted += measure(dht, true, t, h);
+    }
+    printf("bad checksums accepted       %6ld\n", accepted);
+    allOk = allOk && accepted == 0;
+
+    line.present = false;
+    int t, h;
+    bool missing = measure(dht, true, t, h);
+    printf("missing sensor accepted      %6s\n", missing ? "yes" : "no");
+    allOk = allOk && !missing;
+    line.present = true;
+
+    printf("\nlatency  DHT22 ok  wrong\n");
+    static const int latencies[] = { 0, 10, 20, 30, 40, 50 };
+    const int given = latency;
+    for (unsigned i = 0; i < sizeof latencies / sizeof *latencies; ++i) {
+        latency = latencies[i];
+        double ok = run(dht, runs, true, wrong);
+        printf("%4d us %8.1f%% %6ld\n", latency, ok * 100, wrong);
+    }
+    latency = given;
+    return !allOk;
+}
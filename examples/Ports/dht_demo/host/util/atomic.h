@@ -0,0 +1,6 @@
+// Stand-in for the avr-libc header, there are no interrupts on the host.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define ATOMIC_BLOCK(type) \
+            for (int atomic_once = 1; atomic_once; atomic_once = 0)
+#define ATOMIC_RESTORESTATE
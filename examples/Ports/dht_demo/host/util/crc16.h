@@ -0,0 +1,9 @@
+// Portable version of the avr-libc CRC routine used in Ports.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+static inline uint16_t _crc16_update (uint16_t crc, uint8_t a) {
+    crc ^= a;
+    for (uint8_t i = 0; i < 8; ++i)
+        crc = crc & 1 ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    return crc;
+}
@@ -0,0 +1,8 @@
+// Stand-in for the avr-libc header, flash is plain memory on the host.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define PROGMEM
+#define PSTR(s)             (s)
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define pgm_read_word(p)    (*(const uint16_t*) (p))
+#define memcpy_P            memcpy
@@ -0,0 +1,12 @@
+// Stand-in for the avr-libc header, the host never sleeps.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define SLEEP_MODE_IDLE         0
+#define SLEEP_MODE_PWR_DOWN     2
+
+#define set_sleep_mode(mode)
+#define sleep_mode()
+#define sleep_enable()
+#define sleep_disable()
+#define sleep_cpu()
+#define sleep_bod_disable()
@@ -0,0 +1,332 @@
+// Check and time InfraredPlug::decoder() on a corpus of captured nibbles.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o irBench irBench.cpp
+//
+// Usage: irBench [-f file] [-r repeats]
+//        irBench -g [-s slot] [-n frames] [-j us] [-S seed] >file
+//  -f file     corpus to decode, default corpus.txt
+//  -r repeats  times to decode the whole corpus for the timing, default 1000
+//  -g          generate a corpus and write it to stdout
+//  -s slot     slot size, as passed to configure(), default 111
+//  -n frames   frames per protocol, default 100
+//  -j us       max random deviation of each edge, default 30, i.e. each
+//              mark and space is up to 60 us off
+//  -S seed     random seed, default 1
+//
+// A corpus is made by sending random frames of each protocol which decoder()
+// knows, as a list of marks and spaces with jitter on each edge, to the real
+// InfraredPlug::poll(), which is called on every edge as in ir_recv_irq.ino,
+// with the simulated receiver output on its AIO pin. Once done() reports the
+// end of the frame, the nibbles are saved. Each line of the corpus has the
+// slot size, the protocol type, the bit count, the bits sent in hex (first
+// bit in bit 7 of the first byte, as decoder() leaves them in the buffer),
+// the nibble count, and the nibbles in hex, in buffer order.
+//
+// When decoding, each captured buffer is passed to decoder(), and the type,
+// bit count, and bits must come out as sent. The results are printed for
+// each protocol, followed by the average time for one decoder() call, which
+// is for the host CPU and only useful to compare changes. The corpus.txt in
+// this directory was made with "irBench -g" and all defaults. Exits with
+// status 1 if any frame was decoded wrongly.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../../../Ports.cpp"
+
+volatile uint8_t ADCSRA, MCUCR, MCUSR, PORTD, WDTCSR, SREG, TCCR2A, TCCR2B,
+                 TCNT2, OCR2A, TIMSK2, TIFR2, PCICR, PCMSK0, PCMSK1, PCMSK2;
+volatile unsigned long timer0_millis;
+
+// used by RemoteNode in Ports.cpp, but PortsRF12.cpp is not needed here
+void RemoteHandler::setup (uint8_t, uint8_t, uint8_t) {}
+uint8_t RemoteHandler::poll (RemoteNode&, uint8_t) { return 0; }
+
+static unsigned long now;       // simulated time, in us
+static bool receiverOut = 1;    // the receiver pulls its output low on a mark
+
+unsigned long millis () { return now / 1000; }
+unsigned long micros () { return now; }
+void delay (unsigned long ms) { now += ms * 1000; }
+void delayMicroseconds (unsigned int us) { now += us; }
+void pinMode (uint8_t, uint8_t) {}
+void digitalWrite (uint8_t, uint8_t) {}
+int digitalRead (uint8_t) { return receiverOut; }
+int analogRead (uint8_t) { return 0; }
+void analogWrite (uint8_t, int) {}
+unsigned long pulseIn (uint8_t, uint8_t, unsigned long) { return 0; }
+void shiftOut (uint8_t, uint8_t, uint8_t, uint8_t) {}
+
+static const char* const names [] = {
+    "UNKNOWN", "NEC", "NEC_REP", "SAMSUNG", "SONY", "RC5", "RC6"
+};
+#define TYPES (sizeof names / sizeof *names)
+
+struct Frame {
+    byte slot, type, bits, data [8], count, nibbles [40];
+};
+
+// a frame as marks and spaces, starting with a mark, plus the bits in it
+struct Signal {
+    std::vector<word> times;
+    byte bits, data [8];
+
+    Signal () : bits (0) { memset(data, 0, sizeof data); }
+
+    void add (bool mark, word us) {
+        if ((times.size() % 2 == 0) == mark)
+            times.push_back(us);
+        else if (!times.empty())
+            times.back() += us; // same level as the previous one
+    }
+    void addBit (bool one) {
+        if (one)
+            data[bits/8] |= 0x80 >> (bits % 8);
+        ++bits;
+    }
+    // pulse distance or pulse width coding, as in the decoder's table
+    void pulses (const IrProtocol& p, byte n) {
+        if (p.hdrMark) {
+            add(true, p.hdrMark);
+            add(false, p.hdrSpace);
+        }
+        for (byte i = 0; i < n; ++i) {
+            bool one = rand() & 1;
+            addBit(one);
+            add(true, one ? p.mark1 : p.mark0);
+            add(false, one ? p.space1 : p.space0);
+        }
+        if (p.flags & IR_STOP)
+            add(true, p.mark0);
+    }
+    // biphase, with the start bits set, a leading space is not captured
+    void biphase (const IrProtocol& p) {
+        if (p.hdrMark) {
+            add(true, p.hdrMark);
+            add(false, p.hdrSpace);
+        }
+        bool markFirst = p.flags & IR_ONE_MARK_FIRST;
+        for (byte i = 0; i < p.maxBits; ++i) {
+            bool one = i == 0 || (p.type == InfraredPlug::RC5 && i == 1) ||
+                        (p.type == InfraredPlug::RC6 && i < p.wide)
+                        ? i == 0 : rand() & 1;
+            addBit(one);
+            word half = p.mark0 * (p.wide && i == p.wide ? 2 : 1);
+            bool first = one == markFirst;
+            if (!times.empty() || first)
+                add(first, half);
+            add(!first, half);
+        }
+    }
+};
+
+static Signal makeSignal (const IrProtocol& p) {
+    Signal s;
+    switch (p.coding) {
+        case IR_BIPHASE:
+            s.biphase(p);
+            break;
+        default: {
+            byte n = p.minBits + rand() % (p.maxBits - p.minBits + 1);
+            s.pulses(p, n);
+        }
+    }
+    // the final space is not part of the frame, the line stays idle
+    if (s.times.size() % 2 == 0)
+        s.times.pop_back();
+    return s;
+}
+
+// send a signal to poll(), the way the pin-change interrupt would
+static bool capture (InfraredPlug& ir, const Signal& s, int jitter,
+                        Frame& f) {
+    now += 100000 + rand() % 1000;
+    ir.done(); // releases the buffer from the previous frame
+    unsigned long t = now;
+    for (size_t i = 0; i <= s.times.size(); ++i) {
+        now = t + (jitter ? rand() % (2 * jitter + 1) - jitter : 0);
+        receiverOut = i % 2; // low during a mark
+        ir.poll();
+        if (i < s.times.size())
+            t += s.times[i];
+    }
+    byte count = 0;
+    for (int i = 0; count == 0 && i < 1000; ++i) {
+        now += 100;
+        count = ir.done();
+    }
+    f.count = count;
+    memcpy(f.nibbles, ir.buffer(), sizeof f.nibbles);
+    return count > 0;
+}
+
+static void generate (byte slot, int frames, int jitter) {
+    InfraredPlug ir (2);
+    ir.configure(slot);
+    for (byte i = 0; i < sizeof irProtocols / sizeof *irProtocols; ++i) {
+        IrProtocol p;
+        memcpy_P(&p, irProtocols + i, sizeof p);
+        for (int n = 0; n < frames; ++n) {
+            Signal s = makeSignal(p);
+            Frame f;
+            if (!capture(ir, s, jitter, f)) {
+                fprintf(stderr, "no capture for %s\n", names[p.type]);
+                exit(1);
+            }
+            printf("%d %s %d ", slot, names[p.type], s.bits);
+            for (byte j = 0; j < (s.bits + 7) / 8; ++j)
+                printf("%02X", s.data[j]);
+            printf(s.bits ? " %d " : "- %d ", f.count);
+            for (byte j = 0; j < (f.count + 1) / 2; ++j)
+                printf("%02X", f.nibbles[j]);
+            printf("\n");
+        }
+    }
+}
+
+static byte typeOf (const char* name) {
+    for (byte i = 0; i < TYPES; ++i)
+        if (strcmp(name, names[i]) == 0)
+            return i;
+    return 0xFF;
+}
+
+static bool readHex (const char* s, byte* out, size_t max) {
+    size_t n = strlen(s);
+    if (n % 2 != 0 || n / 2 > max)
+        return false;
+    for (size_t i = 0; i < n / 2; ++i) {
+        unsigned v;
+        if (sscanf(s + 2 * i, "%2x", &v) != 1)
+            return false;
+        out[i] = v;
+    }
+    return true;
+}
+
+static bool load (const char* file, std::vector<Frame>& corpus) {
+    FILE* fp = fopen(file, "r");
+    if (fp == 0)
+        return false;
+    char type [20], data [40], nibbles [100];
+    int slot, bits, count;
+    while (fscanf(fp, "%d %19s %d %39s %d %99s", &slot, type, &bits, data,
+                    &count, nibbles) == 6) {
+        Frame f;
+        memset(&f, 0, sizeof f);
+        f.slot = slot;
+        f.type = typeOf(type);
+        f.bits = bits;
+        f.count = count;
+        if (f.type == 0xFF || (strcmp(data, "-") != 0 &&
+                                !readHex(data, f.data, sizeof f.data)) ||
+                !readHex(nibbles, f.nibbles, sizeof f.nibbles)) {
+            fprintf(stderr, "%s: bad line %zu\n", file, corpus.size() + 1);
+            exit(1);
+        }
+        corpus.push_back(f);
+    }
+    fclose(fp);
+    return true;
+}
+
+// decoder() converts the buffer in place, put the captured nibbles back
+static void restore (InfraredPlug& ir, const Frame& f) {
+    memcpy((byte*) ir.buffer(), f.nibbles, sizeof f.nibbles);
+}
+
+int main (int argc, char** argv) {
+    const char* file = "corpus.txt";
+    int repeats = 1000, slot = 111, frames = 100, jitter = 30, opt;
+    bool gen = false;
+    while ((opt = getopt(argc, argv, "f:r:gs:n:j:S:")) != -1)
+        switch (opt) {
+            case 'f': file = optarg; break;
+            case 'r': repeats = atoi(optarg); break;
+            case 'g': gen = true; break;
+            case 's': slot = atoi(optarg); break;
+            case 'n': frames = atoi(optarg); break;
+            case 'j': jitter = atoi(optarg); break;
+            case 'S': srand(atoi(optarg)); break;
+            default:
+                fprintf(stderr, "Usage: %s [-f file] [-r repeats]\n"
+                                "       %s -g [-s slot] [-n frames] [-j us]"
+                                " [-S seed] >file\n", argv[0], argv[0]);
+                return 1;
+        }
+    if (gen) {
+        if (slot < 1 || slot > 255 || frames < 1 || jitter < 0) {
+            fprintf(stderr, "%s: slot must be 1..255\n", argv[0]);
+            return 1;
+        }
+        generate(slot, frames, jitter);
+        return 0;
+    }
+
+    std::vector<Frame> corpus;
+    if (!load(file, corpus) || corpus.empty()) {
+        fprintf(stderr, "%s: can't read %s\n", argv[0], file);
+        return 1;
+    }
+
+    InfraredPlug ir (2);
+    long total [TYPES], good [TYPES], unknown [TYPES], wrong [TYPES];
+    memset(total, 0, sizeof total);
+    memset(good, 0, sizeof good);
+    memset(unknown, 0, sizeof unknown);
+    memset(wrong, 0, sizeof wrong);
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        const Frame& f = corpus[i];
+        ir.configure(f.slot);
+        restore(ir, f);
+        byte type = ir.decoder(f.count);
+        ++total[f.type];
+        if (type == f.type && ir.decodedBits() == f.bits &&
+                memcmp(ir.buffer(), f.data, (f.bits + 7) / 8) == 0)
+            ++good[f.type];
+        else if (type == InfraredPlug::UNKNOWN)
+            ++unknown[f.type];
+        else
+            ++wrong[f.type];
+    }
+
+    // sink keeps the compiler from dropping the calls being timed
+    static volatile byte sink;
+    clock_t start = clock();
+    for (int r = 0; r < repeats; ++r)
+        for (size_t i = 0; i < corpus.size(); ++i) {
+            ir.configure(corpus[i].slot);
+            restore(ir, corpus[i]);
+            sink = ir.decoder(corpus[i].count);
+        }
+    double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+    // the same again without decoding, to subtract the copying
+    start = clock();
+    for (int r = 0; r < repeats; ++r)
+        for (size_t i = 0; i < corpus.size(); ++i) {
+            ir.configure(corpus[i].slot);
+            restore(ir, corpus[i]);
+            sink = ir.buffer()[0];
+        }
+    secs -= (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%s, %zu frames\n\n", file, corpus.size());
+    printf("protocol    frames    decoded  unknown    wrong\n");
+    bool allOk = true;
+    for (byte t = 1; t < TYPES; ++t)
+        if (total[t]) {
+            printf("%-8s %9ld %10ld %8ld %8ld\n", names[t], total[t], good[t],
+                    unknown[t], wrong[t]);
+            allOk = allOk && wrong[t] == 0;
+        }
+    printf("\n%.3f us per decoder() call, on this host\n",
+            secs * 1e6 / repeats / corpus.size());
+    return !allOk;
+}
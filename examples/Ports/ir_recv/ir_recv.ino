@@ -30,7 +30,8 @@ void loop () {
     if (count > 0) {
         const byte* data = ir.buffer();
         Serial.print("IR ");
-        switch (ir.decoder(count)) {
+        byte type = ir.decoder(count);
+        switch (type) {
             case InfraredPlug::NEC:
                 Serial.print("NEC");
                 for (byte i = 0; i < 4; ++i) {
@@ -41,11 +42,20 @@ void loop () {
             case InfraredPlug::NEC_REP:
                 Serial.print("NEC REPEAT");
                 break;
-            default:
+            case InfraredPlug::UNKNOWN:
                 for (byte i = 0; i < count; ++i) {
                     byte nibble = (data[i/2] >> (i % 2) * 4) & 0x0F;
                     Serial.print(nibble, HEX);
                 }
+                break;
+            default: // SAMSUNG, SONY, RC5, RC6: type, bit count, and data
+                Serial.print(type);
+                Serial.print(' ');
+                Serial.print(ir.decodedBits());
+                for (byte i = 0; i < ir.decodedBits(); i += 8) {
+                    Serial.print(' ');
+                    Serial.print(data[i/8], HEX);
+                }
         }
         Serial.println();
     }
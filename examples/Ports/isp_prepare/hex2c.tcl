@@ -8,9 +8,19 @@
 #   ./hex2c.tcl RF12demo.cpp.hex ATmegaBOOT_168_atmega328.hex >data_rf12demo.h
 #   ./hex2c.tcl Blink.cpp.hex optiboot_atmega328.hex >opti_blink.h
 #   ./hex2c.tcl RF12demo.cpp.hex optiboot_atmega328.hex >opti_rf12demo.h
+#   ./hex2c.tcl -z RF12demo.cpp.hex optiboot_atmega328.hex >opti_rf12demo.h
+#
+# With -z, each section is packed for LZunpack.h, using lzpack.tcl, and the
+# generated file defines PROGDATA_LZ. The count is still the unpacked size.
+
+set packed [expr {[lindex $argv 0] eq "-z"}]
+if {$packed} {
+  set argv [lrange $argv 1 end]
+  source [file join [file dirname [info script]] lzpack.tcl]
+}
 
 if {$argv eq ""} {
-  puts stderr "Usage: [info script] infile.hex ?...? >outfile.h"
+  puts stderr "Usage: [info script] ?-z? infile.hex ?...? >outfile.h"
   exit 1
 }
 
@@ -43,6 +53,11 @@ foreach a $argv {
     }
   }
   incr next -$first
+  if {$packed} {
+    set data [lz::pack [lrange $bytes $start end]]
+    lz::report $a $next [llength $data]
+    set bytes [concat [lrange $bytes 0 $start-1] $data]
+  }
   set f [format %-30s [file tail $a]]
   lappend sections "\"$mtime $f ${next}b @ $first\",$first,$start,$next"
   unset next
@@ -51,6 +66,10 @@ foreach a $argv {
 
 puts "// This file was generated by hex2c.tcl on [clock format [clock seconds]]"
 puts ""
+if {$packed} {
+  puts "#define PROGDATA_LZ 1 // unpack with LZUnpack, see LZunpack.h"
+  puts ""
+}
 puts "struct { const char* title; unsigned start, off, count; } sections\[] = {"
 
 foreach x $sections {
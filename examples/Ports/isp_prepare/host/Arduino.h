@@ -0,0 +1,39 @@
+// Minimal stand-ins for the Arduino API, enough to build isp_prepare on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// The pins and the time are simulated by the test program, which defines the
+// functions declared at the end.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define INPUT               0
+#define OUTPUT              1
+#define DEC                 10
+#define HEX                 16
+
+// the parts of the Arduino Serial class used by isp_prepare, output is dropped
+struct HostSerial {
+    void begin(unsigned long) {}
+    int read() { return -1; }
+    template< typename T > size_t print(T, int =DEC) { return 0; }
+    template< typename T > size_t println(T, int =DEC) { return 0; }
+    size_t println() { return 0; }
+};
+static HostSerial Serial;
+
+// the simulated time and pins, see the test program
+unsigned long micros ();
+void delay (unsigned long ms);
+void pinMode (uint8_t pin, uint8_t mode);
+void digitalWrite (uint8_t pin, uint8_t value);
+int digitalRead (uint8_t pin);
+
+#endif
@@ -0,0 +1,6 @@
+// Stand-in for the avr-libc header, flash is plain memory on the host.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define memcpy_P            memcpy
@@ -0,0 +1,341 @@
+// Round-trip check of lzpack.tcl and hex2c.tcl -z against LZunpack.h.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o lzCheck lzCheck.cpp
+//
+// Usage: lzCheck [-v]
+//  -v          list each ISP command sent to the target
+//
+// First, each combination of sketch and boot loader which isp_prepare.ino
+// can select is turned into a C include file with "hex2c.tcl -z", as tclsh
+// runs it, and which must define PROGDATA_LZ. Each of its sections is then
+// programmed with WriteData() from isp_prepare.ino, unchanged, into a
+// simulated target: the ISP pins are bit-banged as in the sketch, and the
+// target decodes each 4-byte command. Page loads go into its page buffer,
+// page writes program the buffer into flash, and polls report it busy for a
+// while after each write. Each page may only be written once, and the flash
+// must end up with exactly the bytes in the HEX files, read here separately.
+//
+// Then a set of generated data, with the edge cases of the packed format, is
+// packed with lzpack.tcl as raw binary files, and unpacked with LZUnpack, one
+// byte at a time with get(), and in blocks of various sizes with read(). Both
+// must give back exactly the original bytes, with the right size() and
+// remaining() values all along. Exits with status 1 if any check failed.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#define PROGDATA_LZ 1 // as defined by the hex2c.tcl -z output
+#include "../isp_prepare.ino"
+
+typedef std::vector<byte> Bytes;
+
+static bool verbose, allOk = true;
+static unsigned long now; // simulated time, in us
+
+unsigned long micros () { return now += 10; }
+void delay (unsigned long ms) { now += 1000 * ms; }
+void pinMode (uint8_t, uint8_t) {}
+
+// the ATmega328 at the other end of the ISP pins, only as far as WriteData()
+// uses it, i.e. loading and writing flash pages, and polling
+static struct Target {
+    enum { FLASH = 32768, PAGE = PAGE_BYTES, POLLS = 3 };
+    byte flash [FLASH], buffer [PAGE], written [FLASH / PAGE];
+    byte mosi, sck, miso, in [4], out, bits, count, busy;
+    bool ok;
+    long pages;
+
+    void erase () {
+        memset(this, 0, sizeof *this);
+        memset(flash, 0xFF, sizeof flash);
+        memset(buffer, 0xFF, sizeof buffer);
+        ok = true;
+    }
+
+    void fail (const char* msg) {
+        printf("  target: %s, command %02X %02X %02X %02X\n", msg,
+                in[0], in[1], in[2], in[3]);
+        ok = false;
+    }
+
+    // data is clocked in on the rising edge, most significant bit first
+    void clock () {
+        // the reply to a poll is its last byte, bit 0 is set while busy
+        if (bits == 0 && count == 3 && in[0] == (CMD_Poll >> 8) && busy) {
+            out = 1;
+            --busy;
+        }
+        miso = (out >> (7 - bits)) & 1;
+        in[count] = (in[count] << 1) | (mosi != 0);
+        if (++bits < 8)
+            return;
+        bits = 0;
+        if (++count < 4)
+            return;
+        count = 0;
+        out = 0;
+        command();
+    }
+
+    void command () {
+        word cmd = (in[0] << 8) | in[1];
+        word addr = (in[1] << 8) | in[2]; // word address
+        if (verbose)
+            printf("  %02X %02X %02X %02X\n", in[0], in[1], in[2], in[3]);
+        if (busy && in[0] != (CMD_Poll >> 8))
+            fail("command while busy");
+        if (in[0] == (CMD_Load_Page_Low >> 8) ||
+                in[0] == (CMD_Load_Page_High >> 8)) {
+            byte i = 2 * (in[2] % (PAGE / 2)) + (in[0] & 0x08 ? 1 : 0);
+            buffer[i] = in[3];
+        } else if ((cmd & 0xFF00) == CMD_Write_Page) {
+            long at = 2L * addr;
+            if (at % PAGE != 0 || at >= FLASH) {
+                fail("bad page address");
+                return;
+            }
+            if (written[at / PAGE]++)
+                fail("page written twice");
+            // programming can only clear bits, the flash is erased
+            for (word i = 0; i < PAGE; ++i)
+                flash[at + i] &= buffer[i];
+            memset(buffer, 0xFF, sizeof buffer);
+            busy = POLLS;
+            ++pages;
+        } else if (in[0] != (CMD_Poll >> 8))
+            fail("unexpected command");
+    }
+} target;
+
+void digitalWrite (uint8_t pin, uint8_t value) {
+    if (pin == MOSI)
+        target.mosi = value;
+    else if (pin == SCK) {
+        if (value && !target.sck)
+            target.clock();
+        target.sck = value != 0;
+    }
+}
+
+int digitalRead (uint8_t pin) {
+    return pin == MISO ? target.miso : 1;
+}
+
+// run a command, and return all its output
+static bool run (const std::string& cmd, std::string& out) {
+    out.clear();
+    FILE* fp = popen((cmd + " 2>/dev/null").c_str(), "r");
+    if (fp == 0)
+        return false;
+    char buf [4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof buf, fp)) > 0)
+        out.append(buf, n);
+    return pclose(fp) == 0;
+}
+
+// read the data records of an Intel HEX file into a flash image
+static bool readHex (const char* name, byte* flash) {
+    FILE* fp = fopen(name, "r");
+    if (fp == 0)
+        return false;
+    char line [600];
+    while (fgets(line, sizeof line, fp)) {
+        unsigned count, addr, type, value;
+        if (sscanf(line, ":%2x%4x%2x", &count, &addr, &type) != 3 ||
+                type != 0)
+            continue;
+        for (unsigned i = 0; i < count; ++i) {
+            sscanf(line + 9 + 2 * i, "%2x", &value);
+            flash[addr + i] = value;
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+// program the sections of an include file from hex2c.tcl -z, via WriteData()
+static void checkHex2c (const char* sketch, const char* boot) {
+    char what [60];
+    snprintf(what, sizeof what, "%s + %s", sketch, boot);
+
+    std::string text;
+    bool ok = run(std::string("tclsh ../hex2c.tcl -z ../") + sketch + " ../" +
+                    boot, text);
+    ok = ok && text.find("#define PROGDATA_LZ 1") != std::string::npos;
+
+    // the sections, then all the data bytes
+    struct { unsigned start, off, count; } sect [4];
+    byte nsect = 0;
+    Bytes data;
+    size_t pos = text.find("sections[] = {");
+    while (ok && nsect < 4 && (pos = text.find("\n {\"", pos)) !=
+            std::string::npos) {
+        size_t end = text.find('}', pos);
+        size_t comma = text.rfind("\",", end);
+        if (sscanf(text.c_str() + comma + 2, "%x,%u,%u", &sect[nsect].start,
+                    &sect[nsect].off, &sect[nsect].count) == 3)
+            ++nsect;
+        pos = end;
+    }
+    pos = text.find("progdata[] PROGMEM = {");
+    if (pos == std::string::npos)
+        ok = false;
+    else
+        for (const char* p = text.c_str() + pos + 22; *p && *p != '}'; ) {
+            char* end;
+            long v = strtol(p, &end, 10);
+            if (end == p)
+                ++p;
+            else {
+                data.push_back(v);
+                p = end;
+            }
+        }
+
+    static byte expect [Target::FLASH];
+    memset(expect, 0xFF, sizeof expect);
+    ok = ok && nsect == 2 &&
+            readHex((std::string("../") + sketch).c_str(), expect) &&
+            readHex((std::string("../") + boot).c_str(), expect);
+
+    target.erase();
+    long unpacked = 0;
+    for (byte i = 0; ok && i < nsect; ++i) {
+        if (sect[i].off >= data.size()) {
+            ok = false;
+            break;
+        }
+        WriteData(sect[i].start, &data[sect[i].off], sect[i].count);
+        unpacked += sect[i].count;
+    }
+    ok = ok && target.ok &&
+            memcmp(target.flash, expect, sizeof expect) == 0;
+
+    printf("%-48s %6ld %6zu %5.1f%% %4ld pages%s\n", what, unpacked,
+            data.size(), unpacked ? 100.0 * data.size() / unpacked : 0.0,
+            target.pages, ok ? "" : "  FAILED");
+    allOk = allOk && ok;
+}
+
+// pack data with lzpack.tcl, unpack it with LZUnpack, and compare
+static void checkLzpack (const char* what, const Bytes& in) {
+    char name [] = "/tmp/lzCheckXXXXXX";
+    int fd = mkstemp(name);
+    bool ok = fd >= 0 && write(fd, in.data(), in.size()) == (ssize_t) in.size();
+    if (fd >= 0)
+        close(fd);
+
+    std::string text;
+    ok = ok && run(std::string("tclsh ../lzpack.tcl ") + name, text);
+    unlink(name);
+    Bytes packed;
+    for (const char* p = text.c_str(); *p; ) {
+        char* end;
+        long v = strtol(p, &end, 16);
+        if (end == p)
+            ++p;
+        else {
+            packed.push_back(v);
+            p = end;
+        }
+    }
+
+    // one byte at a time
+    LZUnpack lz (packed.data());
+    ok = ok && lz.size() == (long) in.size();
+    for (size_t i = 0; ok && i < in.size(); ++i)
+        ok = lz.remaining() == (long) (in.size() - i) && lz.get() == in[i];
+    ok = ok && lz.remaining() == 0;
+
+    // in blocks, also with more requested than there is
+    static const word sizes [] = { 1, 7, 128, 500, 4096 };
+    for (byte s = 0; ok && s < sizeof sizes / sizeof *sizes; ++s) {
+        lz.begin(packed.data());
+        Bytes out (in.size() + sizes[s]);
+        size_t done = 0;
+        word n;
+        while ((n = lz.read(&out[done], sizes[s])) > 0)
+            done += n;
+        ok = done == in.size() && lz.remaining() == 0 &&
+                memcmp(out.data(), in.data(), in.size()) == 0;
+    }
+
+    printf("%-48s %6zu %6zu %5.1f%%%s\n", what, in.size(), packed.size(),
+            in.size() ? 100.0 * packed.size() / in.size() : 0.0,
+            ok ? "" : "  FAILED");
+    allOk = allOk && ok;
+}
+
+int main (int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1)
+        switch (opt) {
+            case 'v': verbose = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [-v]\n", argv[0]);
+                return 1;
+        }
+
+    printf("%-48s %6s %6s %6s\n", "", "bytes", "packed", "");
+    checkHex2c("Blink.cpp.hex", "optiboot_atmega328.hex");
+    checkHex2c("RF12demo.cpp.hex", "optiboot_atmega328.hex");
+    checkHex2c("Blink.cpp.hex", "ATmegaBOOT_168_atmega328.hex");
+    checkHex2c("RF12demo.cpp.hex", "ATmegaBOOT_168_atmega328.hex");
+    printf("\n");
+
+    srand(1);
+    Bytes b;
+    checkLzpack("empty", b);
+    b.assign(1, 0x55);
+    checkLzpack("one byte", b);
+    // the size is a varint, these take 1, 2, 2, and 3 bytes
+    static const word sizes [] = { 127, 128, 16383, 16384 };
+    for (byte s = 0; s < sizeof sizes / sizeof *sizes; ++s) {
+        word n = sizes[s];
+        b.resize(n);
+        for (word i = 0; i < n; ++i)
+            b[i] = rand();
+        char what [40];
+        snprintf(what, sizeof what, "random, %u bytes", n);
+        checkLzpack(what, b);
+    }
+    // runs of one byte, as overlapping matches of the max length
+    b.assign(5000, 0);
+    checkLzpack("zeros", b);
+    b.clear();
+    for (int i = 0; i < 200; ++i)
+        b.insert(b.end(), 1 + rand() % 300, rand());
+    checkLzpack("runs of random lengths", b);
+    // repeats at the edge of the window, and just beyond it
+    for (int period = 511; period <= 513; ++period) {
+        b.resize(4 * period);
+        for (int i = 0; i < period; ++i)
+            b[i] = rand();
+        for (size_t i = period; i < b.size(); ++i)
+            b[i] = b[i - period];
+        char what [40];
+        snprintf(what, sizeof what, "random, repeated every %d bytes", period);
+        checkLzpack(what, b);
+    }
+    // short repeats mixed with literals, as in code and text
+    static const char* words [] = { "the ", "data ", "is ", "packed ", "LZ ",
+                                    "with ", "a ", "window ", "\n" };
+    b.clear();
+    for (int i = 0; i < 3000; ++i) {
+        const char* w = words[rand() % 9];
+        b.insert(b.end(), w, w + strlen(w));
+        if (rand() % 4 == 0)
+            b.push_back(rand());
+    }
+    checkLzpack("words and random bytes", b);
+
+    return !allOk;
+}
@@ -12,6 +12,7 @@
 // original copyright notice: 2007 by Amplificar <mailto:amplificar@gmail.com>
 
 #include <avr/pgmspace.h>
+#include <LZunpack.h>
 
 // select the proper configuration with these three settings:
 
@@ -39,6 +40,7 @@
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // Selects appropriate data file, depending on USE_OPTI_BOOT and USE_RF12DEMO
+// (files generated with "hex2c.tcl -z" are also accepted, and get unpacked)
 
 #if USE_OPTI_BOOT
   #if USE_RF12DEMO
@@ -157,28 +159,47 @@ static word addr2page (word addr) {
     return (word)(addr & ~ (PAGE_BYTES-1)) >> 1;
 }
 
-static void LoadPage(word addr, const byte* ptr) {
+static void LoadPage(word addr, byte value) {
     word cmd = addr & 1 ? CMD_Load_Page_High : CMD_Load_Page_Low;
-    Send_ISP(cmd | (addr >> 9), addr >> 1, pgm_read_byte(ptr));
+    Send_ISP(cmd | (addr >> 9), addr >> 1, value);
 }
 
 static void WritePage (word page) {
     Send_ISP_wait(CMD_Write_Page | (page >> 8), page);
 }
 
+// fetch the data one page at a time, unpacking it if hex2c.tcl -z was used
 static void WriteData (word start, const byte* data, word count) {
-    word page = addr2page(start);
-    for (word i = 0; i < count; i += 2) {
-        if (page != addr2page(start)) {
-            WritePage(page);
+#if PROGDATA_LZ
+    LZUnpack lz (data);
+    unsigned long unpackTime = 0;
+#endif
+    byte buf [PAGE_BYTES];
+    for (word done = 0; done < count; ) {
+        word n = PAGE_BYTES - start % PAGE_BYTES;
+        if (n > count - done)
+            n = count - done;
+#if PROGDATA_LZ
+        unsigned long t = micros();
+        lz.read(buf, n);
+        unpackTime += micros() - t;
+#else
+        memcpy_P(buf, data + done, n);
+#endif
+        for (word i = 0; i < n; ++i)
+            LoadPage(start + i, buf[i]);
+        WritePage(addr2page(start));
+        start += n;
+        done += n;
+        if (done < count)
             Serial.print('.');
-            page = addr2page(start);
-        }
-        LoadPage(start++, data + i);
-        LoadPage(start++, data + i + 1);
     }
-    WritePage(page);
     Serial.println();
+#if PROGDATA_LZ
+    Serial.print("Unpacked at ");
+    Serial.print(count * 100000UL / (unpackTime / 10 + 1));
+    Serial.println(" bytes/s");
+#endif
 }
 
 static byte EnableProgramming () {
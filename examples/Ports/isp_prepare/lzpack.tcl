@@ -0,0 +1,167 @@
+#!/usr/bin/env tclsh
+
+# Pack a firmware image for LZunpack.h, as a C include file with a byte list
+# agent, 2026-10-19
+
+# Examples:
+#   ./lzpack.tcl RF12demo.cpp.hex >rf12demo_lz.h
+#   ./lzpack.tcl ../../uploadJNZ/l052-mecrisp.h >../../uploadJNZ/l052-mecrisp-lz.h
+#
+# The input can be an Intel HEX file, a C include file with a list of byte
+# values, such as l052-mecrisp.h, or anything else as raw binary data. The
+# output is a list of byte values in the same style as l052-mecrisp.h, ready to
+# be included in a PROGMEM array. Also used by hex2c.tcl for its -z option.
+
+namespace eval lz {
+  variable WINDOW 512
+  variable MINLEN 3
+  variable MAXLEN 130
+  variable TRIES 256 ;# limits the search for the longest match
+}
+
+proc lz::match {i} {
+  # returns the length and distance of the longest match for position i
+  variable data
+  variable chains
+  variable WINDOW
+  variable MINLEN
+  variable MAXLEN
+  variable TRIES
+  set max [expr {min($MAXLEN, [llength $data] - $i)}]
+  set key [lrange $data $i [expr {$i + $MINLEN - 1}]]
+  if {$max < $MINLEN || ![info exists chains($key)]} {
+    return {0 0}
+  }
+  set best 0
+  set dist 0
+  set chain $chains($key)
+  set end [expr {[llength $chain] - 1}]
+  for {set k $end} {$k >= 0 && $end - $k < $TRIES} {incr k -1} {
+    set j [lindex $chain $k]
+    if {$i - $j > $WINDOW} break
+    set len $MINLEN
+    while {$len < $max &&
+            [lindex $data $j+$len] == [lindex $data $i+$len]} {
+      incr len
+    }
+    if {$len > $best} {
+      set best $len
+      set dist [expr {$i - $j}]
+      if {$len == $max} break
+    }
+  }
+  list $best $dist
+}
+
+proc lz::insert {upto} {
+  # add all positions before upto to the hash chains, as match candidates
+  variable data
+  variable chains
+  variable inserted
+  variable MINLEN
+  for {} {$inserted < $upto} {incr inserted} {
+    set i $inserted
+    lappend chains([lrange $data $i [expr {$i + $MINLEN - 1}]]) $i
+  }
+}
+
+proc lz::pack {bytes} {
+  # returns the packed form of a list of bytes, see LZunpack.h for the format
+  variable data $bytes
+  variable chains
+  variable inserted 0
+  variable MINLEN
+  array unset chains
+  set n [llength $bytes]
+  set out {}
+  for {set v $n} {$v > 127} {set v [expr {$v >> 7}]} {
+    lappend out [expr {($v & 127) | 128}]
+  }
+  lappend out $v
+  set item 8
+  for {set i 0} {$i < $n} {} {
+    if {$item == 8} {
+      set fpos [llength $out]
+      lappend out 0
+      set item 0
+    }
+    insert $i
+    lassign [match $i] len dist
+    if {$len >= $MINLEN} {
+      # prefer a literal if the next position has a longer match
+      insert [expr {$i + 1}]
+      if {[lindex [match [expr {$i + 1}]] 0] > $len} {
+        set len 0
+      }
+    }
+    if {$len >= $MINLEN} {
+      set w [expr {($dist - 1) | (($len - $MINLEN) << 9)}]
+      lappend out [expr {$w & 255}] [expr {$w >> 8}]
+      incr i $len
+    } else {
+      lset out $fpos [expr {[lindex $out $fpos] | (1 << $item)}]
+      lappend out [lindex $bytes $i]
+      incr i
+    }
+    incr item
+  }
+  array unset chains
+  return $out
+}
+
+proc lz::report {name from to} {
+  puts stderr [format "%s: %d bytes packed to %d (%.1f%%)" \
+                $name $from $to [expr {100.0 * $to / $from}]]
+}
+
+proc lz::readFile {name} {
+  # returns the contents of a hex, C include, or binary file as a byte list
+  set fd [open $name]
+  fconfigure $fd -translation binary
+  set text [read $fd]
+  close $fd
+  set bytes {}
+  if {[string index $text 0] eq ":"} {
+    foreach line [split $text \n] {
+      if {[scan $line {:%2x%4x%2x%s} count addr type data] == 4 && $type == 0} {
+        if {![info exists first]} {
+          set first $addr
+        }
+        while {$first + [llength $bytes] < $addr} {
+          lappend bytes 255 ;# pad with unset bytes if there is a gap
+        }
+        foreach {x y} [split [string range $data 0 end-2] ""] {
+          lappend bytes [scan $x$y %x]
+        }
+      }
+    }
+  } elseif {[regexp {^[-\s,0-9a-fA-Fx]+$} $text]} {
+    foreach x [regexp -all -inline -- {-?0x[0-9a-fA-F]+|-?\d+} $text] {
+      lappend bytes [expr {$x & 255}] ;# as uint8_t, i.e. -1 is 255
+    }
+  } else {
+    binary scan $text cu* bytes
+  }
+  return $bytes
+}
+
+if {[info script] eq $argv0} {
+  if {[llength $argv] != 1} {
+    puts stderr "Usage: [info script] infile >outfile.h"
+    exit 1
+  }
+  set name [lindex $argv 0]
+  set bytes [lz::readFile $name]
+  set packed [lz::pack $bytes]
+  lz::report $name [llength $bytes] [llength $packed]
+  set out " "
+  foreach x $packed {
+    set x [format 0x%02x $x]
+    if {[string length "$out $x,"] > 76} {
+      puts $out
+      set out " "
+    }
+    append out " $x,"
+  }
+  puts $out
+}
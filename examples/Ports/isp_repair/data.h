@@ -1,158 +1,121 @@
-// This file was generated by hex2c.tcl on Mon Dec 26 16:48:32 CET 2011
+// This file was generated by hex2c.tcl on Mon Oct 19 06:01:42 UTC 2026
+
+#define PROGDATA_LZ 1 // unpack with LZUnpack, see LZunpack.h
 
 struct { const char* title; unsigned start, off, count; } sections[] = {
  {"2010-04-18 Blink.cpp.hex                  896b @ 0x0000",0x0000,0,896},
- {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,896,512},
- {"2009-08-11 ATmegaBOOT_168_atmega328.hex   1950b @ 0x7800",0x7800,1408,1950},
+ {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,672,512},
+ {"2009-08-11 ATmegaBOOT_168_atmega328.hex   1950b @ 0x7800",0x7800,1209,1950},
 };
 
 const unsigned char progdata[] PROGMEM = {
- 12,148,97,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,157,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,0,0,0,0,36,0,39,0,42,0,0,0,0,0,37,0,40,0,43,0,0,0,0,
- 0,35,0,38,0,41,0,4,4,4,4,4,4,4,4,2,2,2,2,2,2,3,3,3,3,3,3,1,2,4,8,16,32,64,128,
- 1,2,4,8,16,32,1,2,4,8,16,32,0,0,0,7,0,2,1,0,0,3,4,6,0,0,0,0,0,0,0,0,17,36,31,
- 190,207,239,216,224,222,191,205,191,17,224,160,224,177,224,238,231,243,224,2,
- 192,5,144,13,146,162,48,177,7,217,247,17,224,162,224,177,224,1,192,29,146,171,
- 48,177,7,225,247,14,148,182,1,12,148,189,1,12,148,0,0,128,145,0,1,97,224,14,
- 148,105,1,104,238,115,224,128,224,144,224,14,148,229,0,128,145,0,1,96,224,14,
- 148,105,1,104,238,115,224,128,224,144,224,14,148,229,0,8,149,128,145,0,1,97,
- 224,14,148,73,1,8,149,31,146,15,146,15,182,15,146,17,36,47,147,63,147,143,147,
- 159,147,175,147,191,147,128,145,6,1,144,145,7,1,160,145,8,1,176,145,9,1,48,145,
- 10,1,1,150,161,29,177,29,35,47,45,95,45,55,32,240,45,87,1,150,161,29,177,29,32,
- 147,10,1,128,147,6,1,144,147,7,1,160,147,8,1,176,147,9,1,128,145,2,1,144,145,3,
- 1,160,145,4,1,176,145,5,1,1,150,161,29,177,29,128,147,2,1,144,147,3,1,160,147,
- 4,1,176,147,5,1,191,145,175,145,159,145,143,145,63,145,47,145,15,144,15,190,15,
- 144,31,144,24,149,239,146,255,146,15,147,31,147,123,1,140,1,143,183,248,148,64,
- 145,6,1,80,145,7,1,96,145,8,1,112,145,9,1,143,191,47,183,248,148,128,145,6,1,
- 144,145,7,1,160,145,8,1,176,145,9,1,47,191,132,27,149,11,166,11,183,11,232,22,
- 249,6,10,7,27,7,96,247,31,145,15,145,255,144,239,144,8,149,120,148,132,181,130,
- 96,132,189,132,181,129,96,132,189,133,181,130,96,133,189,133,181,129,96,133,
- 189,238,230,240,224,128,129,129,96,128,131,225,232,240,224,128,129,130,96,128,
- 131,128,129,129,96,128,131,224,232,240,224,128,129,129,96,128,131,225,235,240,
- 224,128,129,132,96,128,131,224,235,240,224,128,129,129,96,128,131,234,231,240,
- 224,128,129,132,96,128,131,128,129,130,96,128,131,128,129,129,96,128,131,128,
- 129,128,104,128,131,16,146,193,0,8,149,40,47,48,224,201,1,134,86,159,79,252,1,
- 148,145,42,87,63,79,249,1,132,145,136,35,145,240,232,47,240,224,238,15,255,31,
- 232,89,255,79,165,145,180,145,102,35,41,244,140,145,144,149,137,35,140,147,8,
- 149,140,145,137,43,140,147,8,149,72,47,80,224,202,1,130,85,159,79,252,1,36,145,
- 202,1,134,86,159,79,252,1,148,145,74,87,95,79,250,1,52,145,51,35,209,241,34,35,
- 49,241,35,48,33,244,128,145,128,0,143,119,5,192,36,48,49,244,128,145,128,0,143,
- 125,128,147,128,0,24,192,33,48,25,244,132,181,143,119,4,192,34,48,33,244,132,
- 181,143,125,132,189,13,192,38,48,33,244,128,145,176,0,143,119,5,192,39,48,41,
- 244,128,145,176,0,143,125,128,147,176,0,227,47,240,224,238,15,255,31,238,88,
- 255,79,165,145,180,145,102,35,41,244,140,145,144,149,137,35,140,147,8,149,140,
- 145,137,43,140,147,8,149,14,148,15,1,14,148,151,0,14,148,128,0,253,207,248,148,
- 255,207,13,0,17,36,132,183,20,190,129,255,240,208,133,224,128,147,129,0,130,
- 224,128,147,192,0,136,225,128,147,193,0,134,224,128,147,194,0,128,225,128,147,
- 196,0,142,224,201,208,37,154,134,224,32,227,60,239,145,224,48,147,133,0,32,147,
- 132,0,150,187,176,155,254,207,29,154,168,149,129,80,169,247,204,36,221,36,136,
- 36,131,148,181,224,171,46,161,225,154,46,243,224,191,46,162,208,129,52,97,244,
- 159,208,8,47,175,208,2,56,17,240,1,56,17,244,132,224,1,192,131,224,141,208,137,
- 192,130,52,17,244,132,225,3,192,133,52,25,244,133,224,166,208,128,192,133,53,
- 121,244,136,208,232,46,255,36,133,208,8,47,16,224,16,47,0,39,14,41,31,41,0,15,
- 17,31,142,208,104,1,111,192,134,53,33,244,132,224,144,208,128,224,222,207,132,
- 54,9,240,64,192,112,208,111,208,8,47,109,208,128,224,200,22,128,231,216,6,24,
- 244,246,1,183,190,232,149,192,224,209,224,98,208,137,147,12,23,225,247,240,224,
- 207,22,240,231,223,6,24,240,246,1,183,190,232,149,104,208,7,182,0,252,253,207,
- 166,1,160,224,177,224,44,145,48,224,17,150,140,145,17,151,144,224,152,47,136,
- 39,130,43,147,43,18,150,250,1,12,1,135,190,232,149,17,36,78,95,95,79,241,224,
- 160,56,191,7,81,247,246,1,167,190,232,149,7,182,0,252,253,207,151,190,232,149,
- 38,192,132,55,177,244,46,208,45,208,248,46,43,208,60,208,246,1,239,44,143,1,15,
- 95,31,79,132,145,27,208,234,148,248,1,193,247,8,148,193,28,209,28,250,148,207,
- 12,209,28,14,192,133,55,57,244,40,208,142,225,12,208,133,233,10,208,143,224,
- 122,207,129,53,17,244,136,224,24,208,29,208,128,225,1,208,101,207,152,47,128,
- 145,192,0,133,255,252,207,144,147,198,0,8,149,128,145,192,0,135,255,252,207,
- 128,145,192,0,132,253,1,192,168,149,128,145,198,0,8,149,224,230,240,224,152,
- 225,144,131,128,131,8,149,237,223,128,50,25,240,136,224,245,223,255,207,132,
- 225,222,207,31,147,24,47,227,223,17,80,233,247,242,223,31,145,8,149,128,224,
- 232,223,238,39,255,39,9,148,255,255,255,255,255,255,255,255,255,255,4,4,12,148,
- 52,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,
- 81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,
- 81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,
- 81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,
- 81,60,12,148,81,60,17,36,31,190,207,239,216,224,222,191,205,191,17,224,160,224,
- 177,224,236,233,255,231,2,192,5,144,13,146,162,48,177,7,217,247,18,224,162,224,
- 177,224,1,192,29,146,173,48,177,7,225,247,14,148,45,61,12,148,204,63,12,148,0,
- 60,152,47,149,149,149,149,149,149,149,149,144,93,143,112,138,48,124,240,40,47,
- 41,90,128,145,192,0,133,255,252,207,144,147,198,0,128,145,192,0,133,255,252,
- 207,32,147,198,0,8,149,40,47,32,93,240,207,152,47,128,145,192,0,133,255,252,
- 207,144,147,198,0,8,149,239,146,255,146,15,147,31,147,238,36,255,36,135,1,128,
- 145,192,0,135,253,23,192,8,148,225,28,241,28,1,29,17,29,129,228,232,22,130,228,
- 248,6,143,224,8,7,128,224,24,7,112,243,224,145,4,1,240,145,5,1,9,149,128,145,
- 192,0,135,255,233,207,128,145,198,0,31,145,15,145,255,144,239,144,8,149,14,148,
- 118,60,152,47,128,145,192,0,133,255,252,207,144,147,198,0,145,54,44,244,144,51,
- 12,240,144,83,137,47,8,149,151,85,137,47,8,149,31,147,14,148,159,60,24,47,14,
- 148,159,60,18,149,16,127,129,15,31,145,8,149,31,147,24,47,136,35,33,240,14,148,
- 118,60,17,80,225,247,31,145,8,149,31,147,24,47,14,148,118,60,128,50,73,240,128,
- 145,3,1,143,95,128,147,3,1,133,48,193,240,31,145,8,149,128,145,192,0,133,255,
- 252,207,132,225,128,147,198,0,128,145,192,0,133,255,252,207,16,147,198,0,128,
- 145,192,0,133,255,252,207,128,225,128,147,198,0,31,145,8,149,224,145,4,1,240,
- 145,5,1,9,149,31,145,8,149,14,148,118,60,128,50,65,240,128,145,3,1,143,95,128,
- 147,3,1,133,48,129,240,8,149,128,145,192,0,133,255,252,207,132,225,128,147,198,
- 0,128,145,192,0,133,255,252,207,128,225,128,147,198,0,8,149,224,145,4,1,240,
- 145,5,1,9,149,8,149,64,233,81,224,136,35,161,240,45,154,40,238,51,224,250,1,49,
- 151,241,247,33,80,48,64,209,247,45,152,40,238,51,224,250,1,49,151,241,247,33,
- 80,48,64,209,247,129,80,97,247,8,149,63,146,79,146,95,146,111,146,127,146,143,
- 146,159,146,175,146,191,146,207,146,223,146,239,146,255,146,15,147,31,147,207,
- 147,223,147,0,0,128,225,128,147,196,0,16,146,197,0,136,225,128,147,193,0,134,
- 224,128,147,194,0,80,152,88,154,37,154,129,224,14,148,20,61,36,225,242,46,158,
- 225,233,46,133,233,216,46,15,224,192,46,16,225,177,46,170,36,163,148,177,228,
- 155,46,166,229,138,46,242,229,127,46,224,226,110,46,121,228,87,46,99,229,70,46,
- 80,229,53,46,14,148,118,60,128,51,177,241,129,51,185,241,128,52,9,244,111,192,
- 129,52,9,244,118,192,130,52,9,244,133,192,133,52,9,244,136,192,128,53,49,241,
- 130,53,33,241,129,53,17,241,133,53,9,244,133,192,134,53,9,244,141,192,132,54,9,
- 244,150,192,132,55,9,244,3,193,133,55,9,244,114,193,134,55,9,244,102,192,128,
- 145,3,1,143,95,128,147,3,1,133,48,121,246,224,145,4,1,240,145,5,1,9,149,14,148,
- 118,60,128,51,81,246,14,148,243,60,195,207,14,148,118,60,128,50,73,247,128,145,
- 192,0,133,255,252,207,240,146,198,0,128,145,192,0,133,255,252,207,144,146,198,
- 0,128,145,192,0,133,255,252,207,128,146,198,0,128,145,192,0,133,255,252,207,
- 112,146,198,0,128,145,192,0,133,255,252,207,96,146,198,0,128,145,192,0,133,255,
- 252,207,80,146,198,0,128,145,192,0,133,255,252,207,64,146,198,0,128,145,192,0,
- 133,255,252,207,48,146,198,0,128,145,192,0,133,255,252,207,176,146,198,0,136,
- 207,14,148,118,60,134,56,8,244,189,207,14,148,118,60,14,148,243,60,126,207,14,
- 148,118,60,128,56,9,244,156,192,129,56,9,244,11,193,130,56,9,244,60,193,136,57,
- 9,244,143,192,128,224,14,148,199,60,108,207,132,225,14,148,189,60,14,148,243,
- 60,102,207,133,224,14,148,189,60,14,148,243,60,96,207,14,148,118,60,128,147,6,
- 1,14,148,118,60,128,147,7,1,14,148,243,60,85,207,14,148,118,60,128,51,9,244,29,
- 193,131,224,14,148,189,60,128,224,14,148,199,60,73,207,14,148,118,60,128,147,9,
- 2,14,148,118,60,128,147,8,2,128,145,12,2,142,127,128,147,12,2,14,148,118,60,
- 133,52,9,244,21,193,128,145,8,2,144,145,9,2,137,43,137,240,0,224,16,224,14,148,
- 118,60,248,1,232,95,254,79,128,131,15,95,31,79,128,145,8,2,144,145,9,2,8,23,25,
- 7,136,243,14,148,118,60,128,50,9,240,69,207,128,145,12,2,128,255,1,193,96,145,
- 6,1,112,145,7,1,102,15,119,31,112,147,7,1,96,147,6,1,160,145,8,2,176,145,9,2,
- 16,151,201,240,232,224,241,224,155,1,173,1,78,15,95,31,249,153,254,207,50,189,
- 33,189,129,145,128,189,250,154,249,154,47,95,63,79,228,23,245,7,153,247,106,15,
- 123,31,112,147,7,1,96,147,6,1,128,145,192,0,133,255,252,207,240,146,198,0,128,
- 145,192,0,133,255,252,207,176,146,198,0,225,206,131,224,14,148,199,60,221,206,
- 130,224,14,148,199,60,217,206,14,148,118,60,128,147,9,2,14,148,118,60,128,147,
- 8,2,128,145,6,1,144,145,7,1,136,15,153,31,144,147,7,1,128,147,6,1,14,148,118,
- 60,133,52,9,244,166,192,128,145,12,2,142,127,128,147,12,2,14,148,118,60,128,50,
- 9,240,184,206,128,145,192,0,133,255,252,207,240,146,198,0,96,145,8,2,112,145,9,
- 2,97,21,113,5,185,241,64,224,80,224,128,145,12,2,168,47,161,112,184,47,178,112,
- 17,192,187,35,9,244,92,192,224,145,6,1,240,145,7,1,49,150,240,147,7,1,224,147,
- 6,1,79,95,95,79,70,23,87,7,232,244,170,35,105,243,249,153,254,207,32,145,6,1,
- 48,145,7,1,50,189,33,189,248,154,144,181,128,145,192,0,133,255,252,207,144,147,
- 198,0,47,95,63,79,48,147,7,1,32,147,6,1,79,95,95,79,70,23,87,7,24,243,128,145,
- 192,0,133,253,229,206,128,145,192,0,133,255,248,207,224,206,129,224,14,148,199,
- 60,103,206,14,148,118,60,128,50,9,240,140,206,128,145,192,0,133,255,252,207,
- 240,146,198,0,128,145,192,0,133,255,252,207,224,146,198,0,128,145,192,0,133,
- 255,252,207,208,146,198,0,128,145,192,0,133,255,252,207,192,146,198,0,128,145,
- 192,0,133,255,252,207,176,146,198,0,67,206,224,145,6,1,240,145,7,1,148,145,128,
- 145,192,0,133,255,252,207,144,147,198,0,156,207,128,225,14,148,199,60,51,206,
- 14,148,118,60,14,148,118,60,24,47,14,148,118,60,17,35,9,244,131,192,17,48,9,
- 244,132,192,143,224,14,148,199,60,34,206,128,145,12,2,129,96,128,147,12,2,229,
- 206,128,145,12,2,129,96,128,147,12,2,89,207,128,145,7,1,136,35,136,15,136,11,
- 138,33,128,147,11,2,128,145,6,1,144,145,7,1,136,15,153,31,144,147,7,1,128,147,
- 6,1,128,145,8,2,128,255,9,192,128,145,8,2,144,145,9,2,1,150,144,147,9,2,128,
- 147,8,2,248,148,249,153,254,207,17,39,224,145,6,1,240,145,7,1,200,224,209,224,
- 128,145,8,2,144,145,9,2,16,48,145,244,0,145,87,0,1,112,1,48,217,243,3,224,0,
- 147,87,0,232,149,0,145,87,0,1,112,1,48,217,243,1,225,0,147,87,0,232,149,9,144,
- 25,144,0,145,87,0,1,112,1,48,217,243,1,224,0,147,87,0,232,149,19,149,16,52,152,
- 240,17,39,0,145,87,0,1,112,1,48,217,243,5,224,0,147,87,0,232,149,0,145,87,0,1,
- 112,1,48,217,243,1,225,0,147,87,0,232,149,50,150,2,151,9,240,199,207,16,48,17,
- 240,2,150,229,207,17,36,128,145,192,0,133,255,185,206,188,206,142,225,14,148,
- 199,60,162,205,133,233,14,148,199,60,158,205,248,148,255,207,128,0,
+ 128,7,127,12,148,97,0,12,148,126,3,112,249,157,39,68,0,2,36,0,39,0,42,190,9,4,
+ 37,0,40,0,43,9,4,35,191,0,38,0,41,0,4,0,8,2,250,0,4,3,0,4,1,2,4,8,16,199,32,64,
+ 128,7,6,5,6,48,0,7,0,255,2,1,0,0,3,4,6,0,254,0,8,17,36,31,190,207,239,216,255,
+ 224,222,191,205,191,17,224,160,255,224,177,224,238,231,243,224,2,255,192,5,144,
+ 13,146,162,48,177,191,7,217,247,17,224,162,21,0,1,239,192,29,146,171,15,0,225,
+ 247,14,191,148,182,1,12,148,189,3,0,0,255,0,128,145,0,1,97,224,14,255,148,105,
+ 1,104,238,115,224,128,171,224,144,11,0,229,21,4,96,21,28,8,253,149,45,10,73,1,
+ 8,149,31,146,255,15,146,15,182,15,146,17,36,255,47,147,63,147,143,147,159,147,
+ 255,175,147,191,147,128,145,6,1,255,144,145,7,1,160,145,8,1,255,176,145,9,1,48,
+ 145,10,1,255,1,150,161,29,177,29,35,47,255,45,95,45,55,32,240,45,87,126,15,6,
+ 32,147,10,1,128,147,45,0,245,147,45,0,147,45,0,147,9,1,128,171,145,2,61,0,3,61,
+ 0,4,61,0,5,86,57,8,128,147,21,0,147,21,0,147,21,0,255,147,5,1,191,145,175,145,
+ 159,255,145,143,145,63,145,47,145,15,255,144,15,190,15,144,31,144,24,255,149,
+ 239,146,255,146,15,147,31,255,147,123,1,140,1,143,183,248,171,148,64,137,0,80,
+ 137,0,96,137,0,112,206,137,0,143,191,47,21,0,159,26,47,191,255,132,27,149,11,
+ 166,11,183,11,255,232,22,249,6,10,7,27,7,255,96,247,31,145,15,145,255,144,255,
+ 239,144,8,149,120,148,132,181,127,130,96,132,189,132,181,129,5,0,213,133,11,0,
+ 133,5,0,129,5,0,238,230,255,240,224,128,129,129,96,128,131,203,225,232,9,2,130,
+ 9,0,15,6,224,232,170,25,12,235,9,2,132,19,2,235,19,10,234,249,231,19,10,51,18,
+ 128,129,128,104,128,239,131,16,146,193,99,1,40,47,48,255,224,201,1,134,86,159,
+ 79,252,255,1,148,145,42,87,63,79,249,255,1,132,145,136,35,145,240,232,255,47,
+ 240,224,238,15,255,31,232,255,89,255,79,165,145,180,145,102,255,35,41,244,140,
+ 145,144,149,137,255,35,140,147,8,149,140,145,137,253,43,7,2,72,47,80,224,202,1,
+ 187,130,85,63,2,36,145,202,73,12,74,255,87,95,79,250,1,52,145,51,255,35,209,
+ 241,34,35,49,241,35,255,48,33,244,128,145,128,0,143,191,119,5,192,36,48,49,11,
+ 6,125,255,128,147,128,0,24,192,33,48,255,25,244,132,181,143,119,4,192,249,34,
+ 37,0,9,0,125,132,189,13,192,117,38,49,4,176,49,4,39,48,41,11,6,110,49,0,176,0,
+ 227,153,8,238,88,153,50,255,14,148,15,1,14,148,151,0,255,14,148,128,0,253,207,
+ 248,148,15,255,207,13,0,128,4,255,17,36,132,183,20,190,129,255,255,240,208,133,
+ 224,128,147,129,0,253,130,5,0,192,0,136,225,128,147,119,193,0,134,11,0,194,0,
+ 128,11,0,255,196,0,142,224,201,208,37,154,255,134,224,32,227,60,239,145,224,
+ 255,48,147,133,0,32,147,132,0,255,150,187,176,155,254,207,29,154,255,168,149,
+ 129,80,169,247,204,36,255,221,36,136,36,131,148,181,224,255,171,46,161,225,154,
+ 46,243,224,255,191,46,162,208,129,52,97,244,255,159,208,8,47,175,208,2,56,255,
+ 17,240,1,56,17,244,132,224,255,1,192,131,224,141,208,137,192,251,130,52,13,0,
+ 225,3,192,133,52,255,25,244,133,224,166,208,128,192,255,133,53,121,244,136,208,
+ 232,46,247,255,36,133,51,0,16,224,16,47,255,0,39,14,41,31,41,0,15,255,17,31,
+ 142,208,104,1,111,192,247,134,53,33,65,0,144,208,128,224,255,222,207,132,54,9,
+ 240,64,192,215,112,208,111,43,0,109,17,0,200,22,255,128,231,216,6,24,244,246,1,
+ 255,183,190,232,149,192,224,209,224,255,98,208,137,147,12,23,225,247,255,240,
+ 224,207,22,240,231,223,6,251,24,240,27,6,104,208,7,182,0,255,252,253,207,166,1,
+ 160,224,177,255,224,44,145,48,224,17,150,140,255,145,17,151,144,224,152,47,136,
+ 255,39,130,43,147,43,18,150,250,239,1,12,1,135,43,0,17,36,78,255,95,95,79,241,
+ 224,160,56,191,63,7,81,247,246,1,167,19,0,61,6,253,151,9,0,38,192,132,55,177,
+ 244,255,46,208,45,208,248,46,43,208,255,60,208,246,1,239,44,143,1,255,15,95,31,
+ 79,132,145,27,208,255,234,148,248,1,193,247,8,148,255,193,28,209,28,250,148,
+ 207,12,255,209,28,14,192,133,55,57,244,255,40,208,142,225,12,208,133,233,255,
+ 10,208,143,224,122,207,129,53,255,17,244,136,224,24,208,29,208,255,128,225,1,
+ 208,101,207,152,47,255,128,145,192,0,133,255,252,207,191,144,147,198,0,8,149,
+ 13,2,135,124,13,0,7,2,132,253,1,192,168,17,0,254,23,2,224,230,240,224,152,225,
+ 144,255,131,128,131,8,149,237,223,128,255,50,25,240,136,224,245,223,255,255,
+ 207,132,225,222,207,31,147,24,255,47,227,223,17,80,233,247,242,247,223,31,145,
+ 67,0,224,232,223,238,191,39,255,39,9,148,255,0,12,4,1,4,158,15,127,12,148,52,
+ 60,12,148,81,3,188,255,17,36,31,190,207,239,216,224,255,222,191,205,191,17,224,
+ 160,224,255,177,224,236,233,255,231,2,192,255,5,144,13,146,162,48,177,7,223,
+ 217,247,18,224,162,21,0,1,192,247,29,146,173,15,0,225,247,14,148,255,45,61,12,
+ 148,204,63,12,148,223,0,60,152,47,149,0,8,144,93,255,143,112,138,48,124,240,40,
+ 47,255,41,90,128,145,192,0,133,255,191,252,207,144,147,198,0,11,10,32,254,11,0,
+ 8,149,40,47,32,93,240,247,207,152,47,33,18,8,149,239,146,255,255,146,15,147,31,
+ 147,238,36,239,255,36,135,1,27,2,135,253,23,255,192,8,148,225,28,241,28,1,255,
+ 29,17,29,129,228,232,22,130,255,228,248,6,143,224,8,7,128,255,224,24,7,112,243,
+ 224,145,4,127,1,240,145,5,1,9,149,45,4,255,255,233,207,128,145,198,0,31,255,
+ 145,15,145,255,144,239,144,8,223,149,14,148,118,60,101,22,145,54,255,44,244,
+ 144,51,12,240,144,83,191,137,47,8,149,151,85,5,2,31,127,147,14,148,159,60,24,
+ 47,5,2,255,18,149,16,127,129,15,31,145,126,21,2,24,47,136,35,33,240,67,2,207,
+ 17,80,225,247,19,10,15,2,128,50,255,73,240,128,145,3,1,143,95,255,128,147,3,1,
+ 133,48,193,240,92,29,2,103,10,132,225,128,241,16,16,11,16,65,128,25,4,43,2,185,
+ 14,13,2,83,6,65,83,20,227,129,240,81,42,69,6,67,18,8,149,64,255,233,81,224,136,
+ 35,161,240,45,255,154,40,238,51,224,250,1,49,255,151,241,247,33,80,48,64,209,
+ 247,247,45,152,17,26,129,80,97,247,255,8,149,63,146,79,146,95,146,255,111,146,
+ 127,146,143,146,159,146,255,175,146,191,146,207,146,223,146,126,131,11,207,147,
+ 223,147,0,0,105,2,127,196,0,16,146,197,0,136,9,0,255,193,0,134,224,128,147,194,
+ 0,255,80,152,88,154,37,154,129,224,255,14,148,20,61,36,225,242,46,255,158,225,
+ 233,46,133,233,216,46,255,15,224,192,46,16,225,177,46,255,170,36,163,148,177,
+ 228,155,46,255,166,229,138,46,242,229,127,46,255,224,226,110,46,121,228,87,46,
+ 255,99,229,70,46,80,229,53,46,254,237,4,51,177,241,129,51,185,241,127,128,52,9,
+ 244,111,192,129,5,0,119,118,192,130,5,0,133,192,133,5,0,255,136,192,128,53,49,
+ 241,130,53,255,33,241,129,53,17,241,133,53,250,23,2,134,5,0,141,192,132,54,9,
+ 255,244,150,192,132,55,9,244,3,187,193,133,5,0,114,193,134,5,0,102,205,192,57,
+ 19,121,246,25,15,107,6,81,246,191,14,148,243,60,195,207,187,9,247,86,73,11,240,
+ 146,85,15,144,11,16,128,11,16,85,112,11,16,96,11,16,80,11,16,64,11,16,213,48,
+ 11,16,176,11,0,136,117,4,134,56,167,8,244,189,9,4,137,2,126,137,6,56,223,9,244,
+ 156,192,129,5,0,11,193,253,130,5,0,60,193,136,57,9,244,119,143,192,128,89,1,
+ 199,60,108,245,1,247,14,148,189,47,4,102,207,133,224,186,11,10,96,59,6,147,6,1,
+ 7,6,7,245,1,21,2,85,21,6,51,9,244,29,211,193,131,43,4,69,6,73,45,8,9,2,254,7,6,
+ 8,2,128,145,12,2,142,207,127,128,147,12,17,4,109,3,21,193,255,128,145,8,2,144,
+ 145,9,2,255,137,43,137,240,0,224,16,224,254,25,2,248,1,232,95,254,79,128,223,
+ 131,15,95,31,79,31,10,8,23,239,25,7,136,243,69,7,9,240,69,253,207,75,2,128,255,
+ 1,193,96,145,255,6,1,112,145,7,1,102,15,87,119,31,112,145,0,96,157,0,160,51,0,
+ 253,176,51,0,16,151,201,240,232,224,127,241,224,155,1,173,1,78,76,0,255,249,
+ 153,254,207,50,189,33,189,255,129,145,128,189,250,154,249,154,255,47,95,63,79,
+ 228,23,245,7,31,153,247,106,15,123,61,12,161,35,77,3,119,225,206,131,215,4,221,
+ 206,130,7,4,187,217,206,223,30,6,1,144,139,0,136,143,15,153,31,144,77,0,41,11,
+ 233,2,166,89,192,253,22,197,2,184,206,107,18,96,181,0,253,112,181,0,97,21,113,
+ 5,185,241,239,64,224,80,224,49,2,168,47,161,255,112,184,47,178,112,17,192,187,
+ 191,35,9,244,92,192,224,99,0,240,174,99,0,49,150,240,97,0,224,97,0,79,255,95,
+ 95,79,70,23,87,7,232,95,244,170,35,105,243,227,2,32,35,0,121,48,35,0,235,2,248,
+ 154,144,181,101,10,175,144,147,198,0,243,2,48,57,0,32,182,57,16,24,243,33,4,
+ 253,229,143,8,248,111,207,224,206,129,227,4,103,206,171,10,171,140,206,23,35,
+ 224,11,16,208,11,16,192,182,59,25,67,206,183,10,148,145,141,18,156,151,207,128,
+ 225,103,2,51,103,4,3,2,24,245,47,5,2,17,235,0,131,192,17,48,223,9,244,132,192,
+ 143,137,4,34,206,214,13,3,129,96,63,3,229,11,16,89,207,253,128,113,3,35,136,15,
+ 136,11,138,175,33,128,147,11,133,37,128,91,1,128,215,255,9,192,7,2,144,99,1,1,
+ 150,217,144,183,1,179,3,248,148,49,3,17,39,222,159,10,200,224,209,224,37,10,16,
+ 48,255,145,244,0,145,87,0,1,112,255,1,48,217,243,3,224,0,147,111,87,0,232,149,
+ 17,14,1,225,17,6,207,9,144,25,144,21,16,39,8,19,149,191,16,52,152,240,17,39,25,
+ 14,5,254,65,44,50,150,2,151,9,240,199,255,207,16,48,17,240,2,150,229,247,207,
+ 17,36,37,7,185,206,188,206,189,142,33,5,162,205,133,233,7,2,158,127,205,248,
+ 148,255,207,128,0,
 };
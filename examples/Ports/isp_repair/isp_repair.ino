@@ -34,6 +34,7 @@
 // original copyright notice: 2007 by Amplificar <mailto:amplificar@gmail.com>
 
 #include <avr/pgmspace.h>
+#include <LZunpack.h>
 #include <avr/sleep.h>
 #include <JeeLib.h>
 
@@ -59,8 +60,11 @@
 
 /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
    Include data from a file generated in isp_prepare/ dir with this cmd:
-        ./hex2c.tcl Blink.cpp.hex optiboot_atmega328.hex \
+        ./hex2c.tcl -z Blink.cpp.hex optiboot_atmega328.hex \
                     ATmegaBOOT_168_atmega328.hex >../isp_repair/data.h
+
+   The -z option packs the data to about 3/4 of its size, leave it out to
+   generate a plain copy instead: this code will handle either one.
 */
 
 #include "data.h"
@@ -155,28 +159,47 @@ static word addr2page (word addr) {
     return (word)(addr & ~ (PAGE_BYTES-1)) >> 1;
 }
 
-static void LoadPage(word addr, const byte* ptr) {
+static void LoadPage(word addr, byte value) {
     word cmd = addr & 1 ? CMD_Load_Page_High : CMD_Load_Page_Low;
-    Send_ISP(cmd | (addr >> 9), addr >> 1, pgm_read_byte(ptr));
+    Send_ISP(cmd | (addr >> 9), addr >> 1, value);
 }
 
 static void WritePage (word page) {
     Send_ISP_wait(CMD_Write_Page | (page >> 8), page);
 }
 
+// fetch the data one page at a time, unpacking it if hex2c.tcl -z was used
 static void WriteData (word start, const byte* data, word count) {
-    word page = addr2page(start);
-    for (word i = 0; i < count; i += 2) {
-        if (page != addr2page(start)) {
-            WritePage(page);
+#if PROGDATA_LZ
+    LZUnpack lz (data);
+    unsigned long unpackTime = 0;
+#endif
+    byte buf [PAGE_BYTES];
+    for (word done = 0; done < count; ) {
+        word n = PAGE_BYTES - start % PAGE_BYTES;
+        if (n > count - done)
+            n = count - done;
+#if PROGDATA_LZ
+        unsigned long t = micros();
+        lz.read(buf, n);
+        unpackTime += micros() - t;
+#else
+        memcpy_P(buf, data + done, n);
+#endif
+        for (word i = 0; i < n; ++i)
+            LoadPage(start + i, buf[i]);
+        WritePage(addr2page(start));
+        start += n;
+        done += n;
+        if (done < count)
             Serial.print('.');
-            page = addr2page(start);
-        }
-        LoadPage(start++, data + i);
-        LoadPage(start++, data + i + 1);
     }
-    WritePage(page);
     Serial.println();
+#if PROGDATA_LZ
+    Serial.print("Unpacked at ");
+    Serial.print(count * 100000UL / (unpackTime / 10 + 1));
+    Serial.println(" bytes/s");
+#endif
 }
 
 static byte EnableProgramming () {
@@ -1,734 +1,542 @@
-// This file was generated by hex2c.tcl on Wed Dec 28 11:46:44 CET 2011
+// This file was generated by hex2c.tcl on Mon Oct 19 06:01:42 UTC 2026
+
+#define PROGDATA_LZ 1 // unpack with LZUnpack, see LZunpack.h
 
 struct { const char* title; unsigned start, off, count; } sections[] = {
  {"2010-04-18 Blink.cpp.hex                  896b @ 0x0000",0x0000,0,896},
- {"2011-12-26 RF12demo.cpp.hex               11706b @ 0x0000",0x0000,896,11706},
- {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,12602,512},
- {"2009-08-11 ATmegaBOOT_168_atmega328.hex   1950b @ 0x7800",0x7800,13114,1950},
- {"2011-05-25 optiboot_atmega328_1s.hex      492b @ 0x7E00",0x7E00,15064,492},
- {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,15556,512},
+ {"2011-12-26 RF12demo.cpp.hex               11706b @ 0x0000",0x0000,672,11706},
+ {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,9199,512},
+ {"2009-08-11 ATmegaBOOT_168_atmega328.hex   1950b @ 0x7800",0x7800,9736,1950},
+ {"2011-05-25 optiboot_atmega328_1s.hex      492b @ 0x7E00",0x7E00,11021,492},
+ {"2011-11-29 optiboot_atmega328.hex         512b @ 0x7E00",0x7E00,11511,512},
 };
 
 const unsigned char progdata[] PROGMEM = {
- 12,148,97,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,157,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,12,148,126,0,
- 12,148,126,0,12,148,126,0,0,0,0,0,36,0,39,0,42,0,0,0,0,0,37,0,40,0,43,0,0,0,0,
- 0,35,0,38,0,41,0,4,4,4,4,4,4,4,4,2,2,2,2,2,2,3,3,3,3,3,3,1,2,4,8,16,32,64,128,
- 1,2,4,8,16,32,1,2,4,8,16,32,0,0,0,7,0,2,1,0,0,3,4,6,0,0,0,0,0,0,0,0,17,36,31,
- 190,207,239,216,224,222,191,205,191,17,224,160,224,177,224,238,231,243,224,2,
- 192,5,144,13,146,162,48,177,7,217,247,17,224,162,224,177,224,1,192,29,146,171,
- 48,177,7,225,247,14,148,182,1,12,148,189,1,12,148,0,0,128,145,0,1,97,224,14,
- 148,105,1,104,238,115,224,128,224,144,224,14,148,229,0,128,145,0,1,96,224,14,
- 148,105,1,104,238,115,224,128,224,144,224,14,148,229,0,8,149,128,145,0,1,97,
- 224,14,148,73,1,8,149,31,146,15,146,15,182,15,146,17,36,47,147,63,147,143,147,
- 159,147,175,147,191,147,128,145,6,1,144,145,7,1,160,145,8,1,176,145,9,1,48,145,
- 10,1,1,150,161,29,177,29,35,47,45,95,45,55,32,240,45,87,1,150,161,29,177,29,32,
- 147,10,1,128,147,6,1,144,147,7,1,160,147,8,1,176,147,9,1,128,145,2,1,144,145,3,
- 1,160,145,4,1,176,145,5,1,1,150,161,29,177,29,128,147,2,1,144,147,3,1,160,147,
- 4,1,176,147,5,1,191,145,175,145,159,145,143,145,63,145,47,145,15,144,15,190,15,
- 144,31,144,24,149,239,146,255,146,15,147,31,147,123,1,140,1,143,183,248,148,64,
- 145,6,1,80,145,7,1,96,145,8,1,112,145,9,1,143,191,47,183,248,148,128,145,6,1,
- 144,145,7,1,160,145,8,1,176,145,9,1,47,191,132,27,149,11,166,11,183,11,232,22,
- 249,6,10,7,27,7,96,247,31,145,15,145,255,144,239,144,8,149,120,148,132,181,130,
- 96,132,189,132,181,129,96,132,189,133,181,130,96,133,189,133,181,129,96,133,
- 189,238,230,240,224,128,129,129,96,128,131,225,232,240,224,128,129,130,96,128,
- 131,128,129,129,96,128,131,224,232,240,224,128,129,129,96,128,131,225,235,240,
- 224,128,129,132,96,128,131,224,235,240,224,128,129,129,96,128,131,234,231,240,
- 224,128,129,132,96,128,131,128,129,130,96,128,131,128,129,129,96,128,131,128,
- 129,128,104,128,131,16,146,193,0,8,149,40,47,48,224,201,1,134,86,159,79,252,1,
- 148,145,42,87,63,79,249,1,132,145,136,35,145,240,232,47,240,224,238,15,255,31,
- 232,89,255,79,165,145,180,145,102,35,41,244,140,145,144,149,137,35,140,147,8,
- 149,140,145,137,43,140,147,8,149,72,47,80,224,202,1,130,85,159,79,252,1,36,145,
- 202,1,134,86,159,79,252,1,148,145,74,87,95,79,250,1,52,145,51,35,209,241,34,35,
- 49,241,35,48,33,244,128,145,128,0,143,119,5,192,36,48,49,244,128,145,128,0,143,
- 125,128,147,128,0,24,192,33,48,25,244,132,181,143,119,4,192,34,48,33,244,132,
- 181,143,125,132,189,13,192,38,48,33,244,128,145,176,0,143,119,5,192,39,48,41,
- 244,128,145,176,0,143,125,128,147,176,0,227,47,240,224,238,15,255,31,238,88,
- 255,79,165,145,180,145,102,35,41,244,140,145,144,149,137,35,140,147,8,149,140,
- 145,137,43,140,147,8,149,14,148,15,1,14,148,151,0,14,148,128,0,253,207,248,148,
- 255,207,13,0,12,148,88,2,12,148,2,16,12,148,47,16,12,148,128,2,12,148,128,2,12,
- 148,128,2,12,148,128,2,12,148,128,2,12,148,128,2,12,148,128,2,12,148,128,2,12,
- 148,128,2,12,148,128,2,12,148,128,2,12,148,128,2,12,148,128,2,12,148,92,16,12,
- 148,128,2,12,148,30,18,12,148,101,18,12,148,128,2,12,148,128,2,12,148,128,2,12,
- 148,128,2,12,148,128,2,12,148,128,2,10,65,118,97,105,108,97,98,108,101,32,99,
- 111,109,109,97,110,100,115,58,10,32,32,60,110,110,62,32,105,32,32,32,32,32,45,
- 32,115,101,116,32,110,111,100,101,32,73,68,32,40,115,116,97,110,100,97,114,100,
- 32,110,111,100,101,32,105,100,115,32,97,114,101,32,49,46,46,50,54,41,10,32,32,
- 32,32,32,32,32,32,32,32,32,32,32,32,32,40,111,114,32,101,110,116,101,114,32,97,
- 110,32,117,112,112,101,114,99,97,115,101,32,39,65,39,46,46,39,90,39,32,116,111,
- 32,115,101,116,32,105,100,41,10,32,32,60,110,62,32,98,32,32,32,32,32,32,45,32,
- 115,101,116,32,77,72,122,32,98,97,110,100,32,40,52,32,61,32,52,51,51,44,32,56,
- 32,61,32,56,54,56,44,32,57,32,61,32,57,49,53,41,10,32,32,60,110,110,110,62,32,
- 103,32,32,32,32,45,32,115,101,116,32,110,101,116,119,111,114,107,32,103,114,
- 111,117,112,32,40,82,70,77,49,50,32,111,110,108,121,32,97,108,108,111,119,115,
- 32,50,49,50,44,32,48,32,61,32,97,110,121,41,10,32,32,60,110,62,32,99,32,32,32,
- 32,32,32,45,32,115,101,116,32,99,111,108,108,101,99,116,32,109,111,100,101,32,
- 40,97,100,118,97,110,99,101,100,44,32,110,111,114,109,97,108,108,121,32,48,41,
- 10,32,32,116,32,32,32,32,32,32,32,32,32,32,45,32,98,114,111,97,100,99,97,115,
- 116,32,109,97,120,45,115,105,122,101,32,116,101,115,116,32,112,97,99,107,101,
- 116,44,32,119,105,116,104,32,97,99,107,10,32,32,46,46,46,44,60,110,110,62,32,
- 97,32,45,32,115,101,110,100,32,100,97,116,97,32,112,97,99,107,101,116,32,116,
- 111,32,110,111,100,101,32,60,110,110,62,44,32,119,105,116,104,32,97,99,107,10,
- 32,32,46,46,46,44,60,110,110,62,32,115,32,45,32,115,101,110,100,32,100,97,116,
- 97,32,112,97,99,107,101,116,32,116,111,32,110,111,100,101,32,60,110,110,62,44,
- 32,110,111,32,97,99,107,10,32,32,60,110,62,32,108,32,32,32,32,32,32,45,32,116,
- 117,114,110,32,97,99,116,105,118,105,116,121,32,76,69,68,32,111,110,32,80,66,
- 49,32,111,110,32,111,114,32,111,102,102,10,32,32,60,110,62,32,113,32,32,32,32,
- 32,32,45,32,115,101,116,32,113,117,105,101,116,32,109,111,100,101,32,40,49,32,
- 61,32,100,111,110,39,116,32,114,101,112,111,114,116,32,98,97,100,32,112,97,99,
- 107,101,116,115,41,10,82,101,109,111,116,101,32,99,111,110,116,114,111,108,32,
- 99,111,109,109,97,110,100,115,58,10,32,32,60,104,99,104,105,62,44,60,104,99,
- 108,111,62,44,60,97,100,100,114,62,44,60,99,109,100,62,32,102,32,32,32,32,32,
- 45,32,70,83,50,48,32,99,111,109,109,97,110,100,32,40,56,54,56,32,77,72,122,41,
- 10,32,32,60,97,100,100,114,62,44,60,100,101,118,62,44,60,111,110,62,32,107,32,
- 32,32,32,32,32,32,32,32,32,32,32,32,32,45,32,75,65,75,85,32,99,111,109,109,97,
- 110,100,32,40,52,51,51,32,77,72,122,41,10,0,70,108,97,115,104,32,115,116,111,
- 114,97,103,101,32,40,74,101,101,76,105,110,107,32,111,110,108,121,41,58,10,32,
- 32,100,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
- 32,32,32,32,32,32,32,32,45,32,100,117,109,112,32,97,108,108,32,108,111,103,32,
- 109,97,114,107,101,114,115,10,32,32,60,115,104,62,44,60,115,108,62,44,60,116,
- 51,62,44,60,116,50,62,44,60,116,49,62,44,60,116,48,62,32,114,32,32,45,32,114,
- 101,112,108,97,121,32,102,114,111,109,32,115,112,101,99,105,102,105,101,100,32,
- 109,97,114,107,101,114,10,32,32,49,50,51,44,60,98,104,105,62,44,60,98,108,111,
- 62,32,101,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,45,32,101,114,97,115,
- 101,32,52,75,32,98,108,111,99,107,10,32,32,49,50,44,51,52,32,119,32,32,32,32,
- 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,45,32,119,
- 105,112,101,32,101,110,116,105,114,101,32,102,108,97,115,104,32,109,101,109,
- 111,114,121,10,0,0,0,0,0,36,0,39,0,42,0,0,0,0,0,37,0,40,0,43,0,0,0,0,0,35,0,38,
- 0,41,0,4,4,4,4,4,4,4,4,2,2,2,2,2,2,3,3,3,3,3,3,1,2,4,8,16,32,64,128,1,2,4,8,16,
- 32,1,2,4,8,16,32,0,0,0,7,0,2,1,0,0,3,4,6,0,0,0,0,0,0,0,0,0,220,19,17,36,31,190,
- 207,239,216,224,222,191,205,191,17,224,160,224,177,224,228,239,252,226,2,192,5,
- 144,13,146,166,60,177,7,217,247,20,224,166,236,177,224,1,192,29,146,171,55,177,
- 7,225,247,20,224,192,235,212,224,4,192,34,151,254,1,14,148,116,22,206,58,209,7,
- 201,247,14,148,44,20,12,148,120,22,12,148,0,0,251,1,220,1,2,192,1,144,13,146,
- 65,80,80,64,216,247,8,149,251,1,220,1,13,144,0,32,233,247,17,151,1,144,13,146,
- 0,32,225,247,8,149,251,1,220,1,1,144,13,146,0,32,225,247,8,149,37,224,248,148,
- 40,152,46,189,13,180,7,254,253,207,158,181,30,188,13,180,7,254,253,207,158,181,
- 40,154,120,148,159,63,17,240,144,253,238,207,248,148,40,152,142,189,13,180,7,
- 254,253,207,142,181,8,149,31,147,24,47,134,224,14,148,157,2,40,154,120,148,129,
- 47,14,148,157,2,31,145,8,149,223,146,239,146,255,146,15,147,31,147,207,147,223,
- 147,140,1,214,46,122,1,233,1,131,224,14,148,157,2,30,189,13,180,7,254,253,207,
- 142,181,14,189,13,180,7,254,253,207,142,181,222,188,13,180,7,254,253,207,142,
- 181,32,224,48,224,11,192,30,188,13,180,7,254,253,207,142,181,247,1,226,15,241,
- 29,128,131,47,95,63,79,44,23,61,7,144,243,40,154,120,148,223,145,207,145,31,
- 145,15,145,255,144,239,144,223,144,8,149,15,147,31,147,207,147,223,147,140,1,
- 235,1,130,224,14,148,184,2,30,189,13,180,7,254,253,207,142,181,14,189,13,180,7,
- 254,253,207,142,181,30,188,13,180,7,254,253,207,142,181,32,224,48,224,254,1,
- 226,15,241,29,128,129,142,189,13,180,7,254,253,207,142,181,47,95,63,79,129,224,
- 32,48,56,7,137,247,40,154,120,148,223,145,207,145,31,145,15,145,8,149,128,224,
- 144,224,96,224,112,224,64,224,80,224,32,224,48,224,14,148,196,2,8,149,31,147,
- 207,147,223,147,236,1,254,1,33,150,20,145,17,35,105,240,26,48,41,244,140,229,
- 148,224,109,224,14,148,101,20,140,229,148,224,97,47,14,148,101,20,238,207,223,
- 145,207,145,31,145,8,149,136,230,144,224,14,148,55,3,128,145,113,2,144,145,114,
- 2,137,43,33,240,134,228,147,224,14,148,55,3,140,229,148,224,96,224,113,224,14,
- 148,247,21,129,224,14,148,97,15,8,149,239,146,255,146,15,147,31,147,140,1,123,
- 1,129,224,14,148,230,13,200,1,138,86,159,79,14,148,11,17,128,224,14,148,230,13,
- 199,1,136,92,144,64,14,148,11,17,31,145,15,145,255,144,239,144,8,149,15,147,31,
- 147,207,147,223,147,236,1,104,48,161,244,156,1,34,15,51,31,8,46,130,149,128,37,
- 8,46,134,149,134,149,128,37,200,47,208,224,33,150,213,149,199,149,193,112,208,
- 112,194,43,211,43,105,224,38,47,48,224,33,80,48,64,129,224,144,224,160,224,176,
- 224,4,192,136,15,153,31,170,31,187,31,42,149,210,247,140,1,15,192,200,1,140,35,
- 157,35,137,43,25,244,96,233,113,224,2,192,104,229,114,224,203,1,14,148,105,3,
- 22,149,7,149,1,21,17,5,113,247,223,145,207,145,31,145,15,145,8,149,15,147,31,
- 147,140,1,140,229,148,224,103,225,113,224,14,148,244,21,140,229,148,224,184,1,
- 74,224,80,224,14,148,81,21,136,237,14,148,184,2,30,189,13,180,7,254,253,207,
- 142,181,14,189,13,180,7,254,253,207,142,181,30,188,13,180,7,254,253,207,142,
- 181,40,154,120,148,14,148,44,3,31,145,15,145,8,149,96,145,115,3,102,35,9,244,
- 152,192,32,145,113,2,48,145,114,2,47,95,63,79,143,225,32,48,56,7,16,240,32,224,
- 50,224,48,147,114,2,32,147,113,2,130,224,32,48,56,7,73,244,128,145,107,3,144,
- 145,108,3,1,150,144,147,108,3,128,147,107,3,143,239,159,239,144,147,114,3,128,
- 147,113,3,227,231,242,224,144,224,79,239,95,239,127,239,150,23,24,240,152,63,8,
- 244,112,131,129,145,72,39,132,47,130,149,132,39,8,46,134,149,134,149,128,37,8,
- 46,134,149,128,37,135,112,4,46,69,47,134,149,7,148,135,149,80,45,72,39,6,148,
- 135,149,80,37,72,39,159,95,158,63,1,247,80,147,114,3,64,147,113,3,201,1,99,231,
- 114,224,14,148,252,2,16,146,115,3,14,148,44,3,140,229,148,224,109,225,113,224,
- 14,148,244,21,96,145,113,2,112,145,114,2,140,229,148,224,74,224,80,224,14,148,
- 64,21,140,229,148,224,96,226,14,148,101,20,96,145,107,3,112,145,108,3,140,229,
- 148,224,74,224,80,224,14,148,64,21,140,229,148,224,96,226,14,148,101,20,64,145,
- 109,3,80,145,110,3,96,145,111,3,112,145,112,3,140,229,148,224,42,224,48,224,14,
- 148,174,21,128,145,113,2,144,145,114,2,136,35,81,244,128,80,159,79,47,225,128,
- 48,146,7,16,240,128,224,146,224,14,148,199,3,8,149,14,148,164,16,40,238,51,224,
- 64,224,80,224,14,148,80,22,202,1,185,1,8,149,15,147,31,147,207,147,223,147,236,
- 1,139,1,106,48,113,5,64,240,203,1,106,224,112,224,14,148,41,22,206,1,14,148,
- 153,4,222,1,13,144,0,32,233,247,17,151,172,27,202,15,209,29,200,1,106,224,112,
- 224,14,148,41,22,128,93,136,131,223,145,207,145,31,145,15,145,8,149,31,147,207,
- 147,223,147,201,236,209,224,140,225,254,1,17,146,138,149,233,247,206,1,99,226,
- 113,224,14,148,150,2,16,145,199,1,31,113,254,1,1,144,0,32,233,247,234,92,241,
- 64,240,224,236,15,253,31,16,92,16,131,16,84,206,1,101,226,113,224,14,148,139,2,
- 206,1,97,47,112,224,14,148,153,4,128,145,199,1,133,255,11,192,254,1,1,144,0,32,
- 233,247,234,92,241,64,240,224,236,15,253,31,138,226,128,131,137,236,145,224,
- 104,226,113,224,14,148,139,2,96,145,200,1,137,236,145,224,112,224,14,148,153,4,
- 137,236,145,224,107,226,113,224,14,148,139,2,224,145,199,1,240,224,102,224,245,
- 149,231,149,106,149,225,247,238,15,255,31,227,85,254,79,96,129,113,129,137,236,
- 145,224,14,148,153,4,137,236,145,224,111,226,113,224,14,148,139,2,143,239,159,
- 239,144,147,230,1,128,147,229,1,231,236,241,224,33,145,128,145,229,1,144,145,
- 230,1,130,39,40,47,34,149,40,39,2,46,38,149,38,149,32,37,2,46,38,149,32,37,39,
- 112,8,46,137,47,38,149,7,148,39,149,144,45,130,39,6,148,39,149,144,37,130,39,
- 144,147,230,1,128,147,229,1,129,224,229,62,248,7,225,246,128,226,144,224,252,1,
- 233,85,254,79,224,129,249,153,254,207,31,186,146,189,129,189,224,189,15,182,
- 248,148,250,154,249,154,15,190,1,150,128,52,145,5,105,247,129,224,14,148,97,15,
- 136,35,49,244,140,229,148,224,101,227,113,224,14,148,247,21,223,145,207,145,31,
- 145,8,149,31,147,24,47,137,224,97,224,14,148,80,17,96,224,17,35,9,244,97,224,
- 137,224,14,148,118,17,31,145,8,149,47,146,63,146,79,146,95,146,111,146,127,146,
- 143,146,159,146,175,146,191,146,207,146,223,146,239,146,255,146,15,147,31,147,
- 223,147,207,147,205,183,222,183,100,151,15,182,248,148,222,191,15,190,205,191,
- 140,229,148,224,14,148,52,19,137,43,9,244,54,196,140,229,148,224,14,148,101,19,
- 24,47,128,83,138,48,88,244,128,145,44,2,42,224,130,159,192,1,17,36,128,83,129,
- 15,128,147,44,2,35,196,28,50,137,244,144,145,45,2,146,52,80,244,233,47,240,224,
- 226,93,253,79,128,145,44,2,128,131,159,95,144,147,45,2,16,146,44,2,16,196,129,
- 47,129,86,138,49,8,240,249,195,140,229,148,224,104,228,113,224,14,148,244,21,
- 96,145,44,2,140,229,148,224,112,224,74,224,80,224,14,148,194,21,140,229,148,
- 224,97,47,14,148,141,20,25,54,137,241,26,54,180,244,20,54,9,244,73,193,21,54,
- 68,244,18,54,121,241,19,54,12,240,75,192,17,54,1,245,125,192,22,54,9,244,147,
- 192,22,54,12,244,135,195,23,54,185,244,58,192,18,55,9,244,153,193,19,55,76,244,
- 28,54,9,244,128,192,17,55,9,244,176,195,27,54,73,244,198,192,20,55,233,241,20,
- 55,12,244,97,192,23,55,9,244,131,195,14,148,81,3,166,195,144,145,44,2,159,113,
- 128,145,199,1,128,126,20,192,128,145,44,2,136,48,17,244,146,224,5,192,137,48,
- 17,240,145,224,1,192,147,224,144,147,44,2,146,149,153,15,153,15,144,124,128,
- 145,199,1,143,115,152,15,144,147,199,1,14,148,190,4,133,195,128,145,44,2,128,
- 147,200,1,248,207,128,145,44,2,136,35,33,240,128,145,199,1,128,98,3,192,128,
- 145,199,1,143,125,128,147,199,1,234,207,129,230,128,147,231,1,130,228,128,147,
- 232,1,16,146,233,1,234,238,241,224,144,224,128,145,112,2,137,15,129,147,159,95,
- 146,52,201,247,140,229,148,224,107,228,113,224,14,148,244,21,96,145,112,2,140,
- 229,148,224,112,224,74,224,80,224,14,148,213,21,128,145,112,2,143,95,128,147,
- 112,2,75,195,16,147,231,1,64,145,45,2,64,147,232,1,128,145,44,2,128,147,233,1,
- 42,238,49,224,238,226,242,224,201,1,191,1,80,224,14,148,130,2,55,195,128,145,
- 44,2,14,148,112,5,50,195,128,224,98,224,68,237,14,148,46,14,129,224,14,148,112,
- 5,144,145,46,2,128,224,32,145,47,2,124,1,226,14,241,28,176,144,48,2,192,144,44,
- 2,223,44,27,45,28,13,26,95,30,13,31,13,0,224,129,224,144,224,109,224,14,148,
- 132,3,141,45,144,224,104,224,14,148,132,3,199,1,104,224,14,148,132,3,139,45,
- 144,224,104,224,14,148,132,3,140,45,144,224,104,224,14,148,132,3,129,47,144,
- 224,104,224,14,148,132,3,128,224,144,224,97,224,14,148,132,3,106,224,112,224,
- 128,224,144,224,14,148,178,16,15,95,3,48,169,246,91,192,128,224,97,224,68,237,
- 14,148,46,14,129,224,14,148,112,5,128,145,47,2,8,47,16,224,1,80,16,64,36,224,0,
- 15,17,31,42,149,225,247,22,96,128,145,46,2,153,39,135,253,144,149,1,151,143,
- 112,144,112,8,43,25,43,128,145,44,2,129,17,24,96,221,36,156,237,169,46,149,224,
- 185,46,48,192,135,231,145,224,101,230,116,224,14,148,105,3,200,1,14,44,2,192,
- 149,149,135,149,10,148,226,247,128,253,3,192,135,231,145,224,2,192,133,230,148,
- 224,181,1,104,27,121,11,14,148,105,3,8,148,225,28,241,28,44,224,226,22,241,4,1,
- 247,135,231,145,224,103,231,113,224,14,148,105,3,107,224,112,224,128,224,144,
- 224,14,148,178,16,211,148,132,224,216,22,25,240,238,36,255,36,205,207,128,224,
- 14,148,112,5,129,224,14,148,97,15,137,194,128,145,113,2,144,145,114,2,137,43,9,
- 244,130,194,140,229,148,224,14,148,101,19,151,255,250,207,0,224,18,224,141,224,
- 232,46,241,44,236,14,253,30,140,229,148,224,14,148,101,19,151,255,111,194,200,
- 1,104,239,112,224,167,1,40,224,48,224,14,148,196,2,141,133,158,133,143,95,159,
- 79,185,241,140,229,148,224,97,229,113,224,14,148,244,21,140,229,148,224,184,1,
- 74,224,80,224,14,148,64,21,140,229,148,224,103,229,113,224,14,148,244,21,109,
- 133,126,133,140,229,148,224,74,224,80,224,14,148,64,21,140,229,148,224,96,226,
- 14,148,101,20,79,133,88,137,105,137,122,137,140,229,148,224,42,224,48,224,14,
- 148,110,21,140,229,148,224,96,226,14,148,101,20,107,137,124,137,140,229,148,
- 224,74,224,80,224,14,148,81,21,15,95,31,79,191,225,0,48,27,7,9,240,175,207,35,
- 194,128,145,113,2,144,145,114,2,137,43,9,244,28,194,144,145,46,2,128,224,137,
- 43,25,244,128,145,47,2,129,17,129,224,40,46,51,36,144,145,48,2,128,224,137,43,
- 17,240,49,224,5,192,128,145,49,2,129,17,129,224,56,47,144,145,50,2,128,224,137,
- 43,17,240,33,224,5,192,128,145,44,2,129,17,129,224,40,47,131,47,144,224,160,
- 224,176,224,220,1,153,39,136,39,226,46,255,36,0,224,16,224,232,42,249,42,10,43,
- 27,43,193,44,162,224,218,46,170,36,170,148,186,44,136,36,153,36,247,224,111,46,
- 113,44,108,14,125,30,46,1,8,148,65,28,81,28,198,1,104,239,112,224,163,1,38,224,
- 48,224,14,148,196,2,47,129,56,133,239,239,47,63,62,7,233,240,34,21,51,5,104,
- 240,42,21,59,5,80,244,210,1,243,1,134,224,1,144,13,146,129,80,225,247,169,128,
- 186,128,70,1,42,21,59,5,81,244,137,133,154,133,171,133,188,133,232,22,249,6,10,
- 7,27,7,12,240,70,1,8,148,193,28,209,28,240,224,207,22,255,225,223,6,105,246,
- 140,229,148,224,107,229,113,224,14,148,244,21,140,229,148,224,180,1,74,224,80,
- 224,14,148,64,21,140,229,148,224,96,226,14,148,101,20,96,145,113,2,112,145,114,
- 2,140,229,148,224,74,224,80,224,14,148,81,21,140,229,148,224,14,148,101,19,151,
- 255,250,207,192,144,107,3,208,144,108,3,4,193,140,229,148,224,14,148,101,19,
- 151,255,6,193,8,148,129,28,145,28,32,224,130,22,47,225,146,6,24,240,129,44,226,
- 224,158,46,196,1,96,224,112,224,67,231,82,224,32,224,49,224,14,148,196,2,128,
- 145,107,3,144,145,108,3,143,95,159,79,9,244,226,192,227,231,242,224,15,239,31,
- 239,129,145,8,39,128,47,130,149,128,39,8,46,134,149,134,149,128,37,8,46,134,
- 149,128,37,135,112,0,46,1,47,134,149,7,148,135,149,16,45,8,39,6,148,135,149,16,
- 37,8,39,179,224,227,55,251,7,33,247,1,21,17,5,17,244,16,224,131,192,140,229,
- 148,224,100,230,113,224,14,148,244,21,140,229,148,224,180,1,74,224,80,224,14,
- 148,64,21,140,229,148,224,96,226,14,148,101,20,140,229,148,224,184,1,74,224,80,
- 224,14,148,81,21,163,192,140,229,148,224,14,148,52,19,137,43,9,240,109,192,140,
- 229,148,224,107,230,113,224,14,148,244,21,96,145,107,3,112,145,108,3,140,229,
- 148,224,74,224,80,224,14,148,64,21,140,229,148,224,96,226,14,148,101,20,1,47,
- 15,95,247,1,128,129,64,145,109,3,80,145,110,3,96,145,111,3,112,145,112,3,72,15,
- 81,29,97,29,113,29,140,229,148,224,42,224,48,224,14,148,110,21,140,229,148,224,
- 96,226,14,148,101,20,30,95,224,47,240,224,237,88,253,79,96,129,140,229,148,224,
- 112,224,74,224,80,224,14,148,194,21,225,47,240,224,237,88,253,79,224,128,31,95,
- 241,46,14,45,19,192,140,229,148,224,96,226,14,148,101,20,239,45,240,224,237,88,
- 253,79,96,129,243,148,140,229,148,224,112,224,74,224,80,224,14,148,194,21,1,80,
- 0,35,89,247,30,13,140,229,148,224,14,148,109,20,24,63,88,244,225,46,255,36,131,
- 231,146,224,232,14,249,30,215,1,140,145,143,63,9,240,140,207,140,229,148,224,
- 110,230,113,224,14,148,244,21,140,229,148,224,180,1,74,224,80,224,14,148,64,21,
- 140,229,148,224,96,226,14,148,101,20,96,145,107,3,112,145,108,3,140,229,148,
- 224,74,224,80,224,14,148,64,21,140,229,148,224,96,226,14,148,101,20,64,145,109,
- 3,80,145,110,3,96,145,111,3,112,145,112,3,140,229,148,224,42,224,48,224,14,148,
- 174,21,128,145,113,2,144,145,114,2,136,22,153,6,9,240,244,206,16,146,115,3,8,
- 148,193,28,209,28,208,146,108,3,192,146,107,3,140,229,148,224,103,225,113,224,
- 14,148,244,21,96,145,113,2,112,145,114,2,140,229,148,224,74,224,80,224,14,148,
- 64,21,140,229,148,224,96,226,14,148,101,20,96,145,107,3,112,145,108,3,140,229,
- 148,224,74,224,80,224,14,148,64,21,140,229,148,224,96,226,14,148,101,20,14,148,
- 164,16,171,1,188,1,140,229,148,224,42,224,48,224,14,148,44,21,59,192,128,145,
- 113,2,144,145,114,2,137,43,169,241,128,145,46,2,139,55,137,245,144,145,47,2,
- 128,224,32,145,44,2,48,224,130,43,147,43,14,148,199,3,38,192,128,145,113,2,144,
- 145,114,2,137,43,1,241,128,145,46,2,140,48,225,244,128,145,44,2,130,50,193,244,
- 140,229,148,224,100,231,113,224,14,148,247,21,135,236,14,148,184,2,40,154,120,
- 148,14,148,44,3,140,229,148,224,105,231,113,224,14,148,247,21,4,192,128,145,44,
- 2,128,147,198,1,16,146,45,2,16,146,44,2,130,228,238,226,242,224,223,1,29,146,
- 138,149,233,247,18,192,129,47,129,84,138,49,80,244,31,113,128,145,199,1,128,
- 126,129,15,128,147,199,1,14,148,190,4,4,192,17,50,20,240,14,148,81,3,14,148,
- 218,12,136,35,9,244,233,192,240,144,120,3,128,145,116,3,144,145,117,3,137,43,
- 57,244,140,229,148,224,96,232,113,224,14,148,244,21,16,192,128,145,198,1,136,
- 35,9,240,13,193,140,229,148,224,99,232,113,224,14,148,244,21,180,225,191,21,16,
- 244,116,225,247,46,128,145,200,1,136,35,121,244,140,229,148,224,102,232,113,
- 224,14,148,244,21,96,145,118,3,140,229,148,224,112,224,74,224,80,224,14,148,
- 194,21,140,229,148,224,96,226,14,148,101,20,96,145,119,3,140,229,148,224,112,
- 224,74,224,80,224,14,148,194,21,0,224,16,224,18,192,140,229,148,224,96,226,14,
- 148,101,20,248,1,231,88,252,79,96,129,140,229,148,224,112,224,74,224,80,224,14,
- 148,194,21,15,95,31,79,15,21,96,243,140,229,148,224,14,148,109,20,128,145,116,
- 3,144,145,117,3,137,43,9,240,135,192,129,224,14,148,112,5,128,145,113,2,144,
- 145,114,2,137,43,9,244,89,192,16,145,120,3,30,95,128,145,115,3,136,35,81,244,
- 14,148,142,4,96,147,109,3,112,147,110,3,128,147,111,3,144,147,112,3,14,148,142,
- 4,171,1,188,1,128,145,109,3,144,145,110,3,160,145,111,3,176,145,112,3,72,27,89,
- 11,106,11,123,11,79,63,81,5,97,5,113,5,76,244,128,145,115,3,144,224,1,150,129,
- 15,145,29,137,63,145,5,128,240,14,148,240,3,14,148,142,4,96,147,109,3,112,147,
- 110,3,128,147,111,3,144,147,112,3,64,224,80,224,96,224,112,224,32,145,115,3,
- 226,47,240,224,237,88,253,79,64,131,47,95,32,147,115,3,48,224,45,88,61,79,71,
- 231,83,224,201,1,186,1,65,47,80,224,14,148,130,2,128,145,115,3,129,15,128,147,
- 115,3,128,145,119,3,133,255,29,192,128,145,119,3,135,253,25,192,128,145,199,1,
- 133,253,21,192,140,229,148,224,105,232,113,224,14,148,247,21,128,145,119,3,134,
- 255,2,192,128,232,4,192,128,145,119,3,143,113,128,108,96,224,112,224,64,224,14,
- 148,251,13,128,224,14,148,112,5,128,145,231,1,136,35,161,241,14,148,115,13,136,
- 35,129,241,129,224,14,148,112,5,140,229,148,224,97,233,113,224,14,148,244,21,
- 96,145,232,1,140,229,148,224,112,224,74,224,80,224,14,148,194,21,140,229,148,
- 224,102,233,113,224,14,148,247,21,128,145,231,1,129,54,17,240,128,224,1,192,
- 128,226,144,145,233,1,153,35,17,240,144,100,137,43,106,238,113,224,64,145,232,
- 1,14,148,251,13,16,146,231,1,128,224,14,148,112,5,100,150,15,182,248,148,222,
- 191,15,190,205,191,207,145,223,145,31,145,15,145,255,144,239,144,223,144,207,
- 144,191,144,175,144,159,144,143,144,127,144,111,144,95,144,79,144,63,144,47,
- 144,8,149,207,146,223,146,239,146,255,146,15,147,31,147,223,147,207,147,0,208,
- 205,183,222,183,140,229,148,224,64,224,81,238,96,224,112,224,14,148,174,18,140,
- 229,148,224,105,233,113,224,14,148,244,21,129,224,14,148,97,15,136,35,169,240,
- 249,153,254,207,128,226,144,224,146,189,129,189,248,154,128,181,128,147,199,1,
- 249,153,254,207,129,226,144,224,146,189,129,189,248,154,128,181,128,147,200,1,
- 8,192,129,228,128,147,199,1,132,237,128,147,200,1,14,148,190,4,40,154,136,224,
- 97,224,14,148,80,17,143,233,14,148,157,2,30,188,13,180,7,254,253,207,62,181,30,
- 188,13,180,7,254,253,207,46,181,147,47,128,224,40,154,120,148,48,224,130,43,
- 147,43,128,82,144,66,9,240,99,192,129,224,14,148,184,2,30,188,13,180,7,254,253,
- 207,142,181,40,154,120,148,16,146,108,3,16,146,107,3,143,239,158,225,144,147,
- 114,2,128,147,113,2,0,224,18,224,63,239,227,46,62,225,243,46,110,1,8,148,193,
- 28,209,28,200,1,104,239,112,224,166,1,34,224,48,224,14,148,196,2,137,129,154,
- 129,47,239,143,63,146,7,57,240,1,150,144,147,108,3,128,147,107,3,120,1,5,192,
- 200,1,1,151,232,22,249,6,49,240,15,95,31,79,143,225,0,48,24,7,1,247,240,146,
- 114,2,224,146,113,2,140,229,148,224,103,234,113,224,14,148,244,21,96,145,113,2,
- 112,145,114,2,140,229,148,224,74,224,80,224,14,148,64,21,140,229,148,224,96,
- 226,14,148,101,20,96,145,107,3,112,145,108,3,140,229,148,224,74,224,80,224,14,
- 148,81,21,14,148,240,3,14,148,81,3,15,144,15,144,207,145,223,145,31,145,15,145,
- 255,144,239,144,223,144,207,144,8,149,42,152,30,188,13,180,7,254,253,207,142,
- 181,30,188,13,180,7,254,253,207,142,181,42,154,128,145,196,3,133,48,9,240,110,
- 192,140,181,129,96,140,189,42,152,128,235,142,189,13,180,7,254,253,207,46,181,
- 30,188,13,180,7,254,253,207,62,181,128,224,42,154,44,181,46,127,44,189,56,43,
- 128,145,198,3,136,35,113,244,144,145,197,3,153,35,81,240,128,145,198,3,232,47,
- 240,224,234,88,252,79,144,131,143,95,128,147,198,3,128,145,198,3,232,47,240,
- 224,234,88,252,79,48,131,143,95,128,147,198,3,128,145,116,3,144,145,117,3,131,
- 39,40,47,34,149,40,39,2,46,38,149,38,149,32,37,2,46,38,149,32,37,39,112,8,46,
- 137,47,38,149,7,148,39,149,144,45,130,39,6,148,39,149,144,37,130,39,144,147,
- 117,3,128,147,116,3,128,145,120,3,32,145,198,3,144,224,4,150,48,224,130,23,147,
- 7,44,240,128,145,198,3,135,52,8,244,140,192,42,152,130,232,142,189,13,180,7,
- 254,253,207,142,181,141,224,142,189,13,180,7,254,253,207,142,181,42,154,8,149,
- 128,145,196,3,135,255,46,192,224,145,120,3,128,145,196,3,143,95,128,147,196,3,
- 129,80,237,95,232,15,240,224,234,88,252,79,224,129,128,145,116,3,144,145,117,3,
- 142,39,40,47,34,149,40,39,2,46,38,149,38,149,32,37,2,46,38,149,32,37,39,112,8,
- 46,137,47,38,149,7,148,39,149,144,45,130,39,6,148,39,149,144,37,130,39,144,147,
- 117,3,128,147,116,3,58,192,128,145,196,3,143,95,128,147,196,3,129,80,131,48,25,
- 241,132,48,44,244,136,35,153,240,129,48,89,245,22,192,137,48,25,240,138,48,49,
- 245,2,192,237,226,36,192,224,145,118,3,144,145,120,3,142,239,137,27,128,147,
- 196,3,27,192,128,145,116,3,144,145,117,3,232,47,21,192,128,145,116,3,144,145,
- 117,3,233,47,15,192,42,152,130,232,142,189,13,180,7,254,253,207,142,181,141,
- 224,142,189,13,180,7,254,253,207,142,181,42,154,234,234,42,152,136,235,142,189,
- 13,180,7,254,253,207,142,181,142,47,144,224,128,80,152,68,142,189,13,180,7,254,
- 253,207,142,181,42,154,8,149,128,145,196,3,133,48,9,240,66,192,128,145,120,3,
- 32,145,198,3,144,224,4,150,48,224,130,23,147,7,36,240,128,145,198,3,135,52,160,
- 241,132,224,128,147,196,3,128,145,120,3,131,52,48,240,129,224,144,224,144,147,
- 117,3,128,147,116,3,128,145,119,3,134,255,18,192,128,145,195,3,40,47,48,224,
- 201,1,143,113,144,112,79,151,73,240,128,145,119,3,144,224,130,39,147,39,143,
- 113,144,112,137,43,137,244,128,145,116,3,144,145,117,3,137,43,9,240,78,192,224,
- 145,193,3,240,145,194,3,48,151,9,244,71,192,128,224,9,149,80,192,128,145,196,3,
- 132,48,17,240,128,224,8,149,16,146,120,3,128,145,120,3,128,147,198,3,143,239,
- 159,239,144,147,117,3,128,147,116,3,32,145,197,3,34,35,217,240,130,39,40,47,34,
- 149,40,39,2,46,38,149,38,149,32,37,2,46,38,149,32,37,39,112,8,46,137,47,38,149,
- 7,148,39,149,144,45,130,39,6,148,39,149,144,37,130,39,144,147,117,3,128,147,
- 116,3,133,224,128,147,196,3,42,152,130,232,142,189,13,180,7,254,253,207,142,
- 181,141,237,142,189,13,180,7,254,253,207,142,181,42,154,128,224,8,149,143,239,
- 159,239,175,239,191,239,128,147,189,3,144,147,190,3,160,147,191,3,176,147,192,
- 3,129,224,8,149,128,145,196,3,133,48,17,245,128,145,198,3,136,35,241,244,30,
- 188,13,180,7,254,253,207,14,180,0,252,23,192,42,152,130,232,142,189,13,180,7,
- 254,253,207,142,181,141,224,142,189,13,180,7,254,253,207,142,181,42,154,132,
- 224,128,147,196,3,128,145,197,3,128,147,118,3,129,224,8,149,128,224,8,149,152,
- 47,134,253,5,192,144,126,128,145,195,3,143,113,152,15,144,147,119,3,224,145,
- 193,3,240,145,194,3,48,151,17,240,129,224,9,149,143,239,159,239,144,147,117,3,
- 128,147,116,3,128,145,116,3,144,145,117,3,32,145,118,3,130,39,40,47,34,149,40,
- 39,2,46,38,149,38,149,32,37,2,46,38,149,32,37,39,112,8,46,137,47,38,149,7,148,
- 39,149,144,45,130,39,6,148,39,149,144,37,130,39,144,147,117,3,128,147,116,3,
- 134,224,128,147,196,3,42,152,130,232,142,189,13,180,7,254,253,207,142,181,141,
- 227,142,189,13,180,7,254,253,207,142,181,42,154,8,149,136,35,25,244,45,224,50,
- 232,2,192,45,227,50,232,42,152,130,232,142,189,13,180,7,254,253,207,142,181,46,
- 189,13,180,7,254,253,207,142,181,42,154,8,149,31,147,24,47,64,147,120,3,41,231,
- 51,224,201,1,80,224,14,148,130,2,129,47,14,148,155,13,31,145,8,149,42,154,34,
- 154,138,224,97,224,14,148,118,17,138,224,97,224,14,148,80,17,139,224,97,224,14,
- 148,80,17,140,224,96,224,14,148,80,17,141,224,97,224,14,148,80,17,128,229,140,
- 189,141,181,129,96,141,189,130,224,96,224,14,148,80,17,130,224,97,224,14,148,
- 118,17,8,149,31,147,22,47,128,147,195,3,64,147,197,3,14,148,10,14,42,152,30,
- 188,13,180,7,254,253,207,142,181,30,188,13,180,7,254,253,207,142,181,42,154,42,
- 152,130,232,142,189,13,180,7,254,253,207,142,181,133,224,142,189,13,180,7,254,
- 253,207,142,181,42,154,42,152,136,235,142,189,13,180,7,254,253,207,142,181,30,
- 188,13,180,7,254,253,207,10,192,42,152,30,188,13,180,7,254,253,207,142,181,30,
- 188,13,180,7,254,253,207,142,181,42,154,130,224,14,148,202,17,137,43,121,243,
- 97,47,112,224,228,224,102,15,119,31,234,149,225,247,103,108,112,104,42,152,126,
- 189,13,180,7,254,253,207,142,181,110,189,13,180,7,254,253,207,142,181,42,154,
- 42,152,134,234,142,189,13,180,7,254,253,207,142,181,128,228,142,189,13,180,7,
- 254,253,207,142,181,42,154,42,152,134,236,142,189,13,180,7,254,253,207,142,181,
- 134,224,142,189,13,180,7,254,253,207,142,181,42,154,42,152,132,233,142,189,13,
- 180,7,254,253,207,142,181,130,234,142,189,13,180,7,254,253,207,142,181,42,154,
- 42,152,130,236,142,189,13,180,7,254,253,207,142,181,140,234,142,189,13,180,7,
- 254,253,207,142,181,42,154,144,145,197,3,153,35,225,240,42,152,138,236,142,189,
- 13,180,7,254,253,207,142,181,131,232,142,189,13,180,7,254,253,207,142,181,42,
- 154,137,47,144,224,158,108,42,152,158,189,13,180,7,254,253,207,46,181,142,189,
- 13,180,7,254,253,207,26,192,42,152,138,236,142,189,13,180,7,254,253,207,142,
- 181,139,232,142,189,13,180,7,254,253,207,142,181,42,154,42,152,142,236,142,189,
- 13,180,7,254,253,207,142,181,141,226,142,189,13,180,7,254,253,207,142,181,42,
- 154,42,152,132,236,142,189,13,180,7,254,253,207,142,181,131,232,142,189,13,180,
- 7,254,253,207,142,181,42,154,42,152,136,233,142,189,13,180,7,254,253,207,142,
- 181,128,229,142,189,13,180,7,254,253,207,142,181,42,154,42,152,140,236,142,189,
- 13,180,7,254,253,207,142,181,135,231,142,189,13,180,7,254,253,207,142,181,42,
- 154,42,152,128,238,142,189,13,180,7,254,253,207,142,181,30,188,13,180,7,254,
- 253,207,142,181,42,154,42,152,136,236,142,189,13,180,7,254,253,207,142,181,30,
- 188,13,180,7,254,253,207,142,181,42,154,42,152,128,236,142,189,13,180,7,254,
- 253,207,142,181,137,228,142,189,13,180,7,254,253,207,142,181,42,154,132,224,
- 128,147,196,3,128,145,195,3,144,224,143,113,144,112,137,43,65,240,128,224,109,
- 237,123,224,64,224,80,224,14,148,204,15,3,192,128,224,14,148,239,15,128,145,
- 195,3,31,145,8,149,239,146,255,146,15,147,31,147,207,147,223,147,232,46,79,239,
- 95,239,32,226,48,224,249,153,254,207,50,189,33,189,248,154,128,181,72,39,132,
- 47,130,149,132,39,8,46,134,149,134,149,128,37,8,46,134,149,128,37,135,112,4,46,
- 69,47,134,149,7,148,135,149,80,45,72,39,6,148,135,149,80,37,72,39,47,95,63,79,
- 32,52,49,5,9,240,221,207,69,43,17,240,128,224,50,192,0,224,255,36,16,224,192,
- 226,208,224,249,153,254,207,210,189,193,189,248,154,96,181,17,35,17,244,6,47,
- 12,192,17,48,17,244,246,46,8,192,102,35,81,240,238,32,33,240,140,229,148,224,
- 14,148,101,20,31,95,33,150,30,49,49,247,238,32,33,240,140,229,148,224,14,148,
- 109,20,96,47,112,224,246,224,117,149,103,149,250,149,225,247,128,47,79,45,14,
- 148,46,14,128,47,143,113,223,145,207,145,31,145,15,145,255,144,239,144,8,149,
- 130,48,0,245,232,47,240,224,238,15,255,31,233,83,252,79,113,131,96,131,136,35,
- 25,240,129,48,161,244,8,192,128,145,105,0,140,127,132,43,128,147,105,0,232,154,
- 8,149,128,145,105,0,68,15,85,31,68,15,85,31,131,127,132,43,128,147,105,0,233,
- 154,8,149,130,48,128,244,136,35,25,240,129,48,33,244,2,192,232,152,1,192,233,
- 152,232,47,240,224,238,15,255,31,233,83,252,79,17,130,16,130,8,149,31,146,15,
- 146,15,182,15,146,17,36,47,147,63,147,79,147,95,147,111,147,127,147,143,147,
- 159,147,175,147,191,147,239,147,255,147,128,145,199,3,144,145,200,3,137,43,41,
- 240,224,145,199,3,240,145,200,3,9,149,255,145,239,145,191,145,175,145,159,145,
- 143,145,127,145,111,145,95,145,79,145,63,145,47,145,15,144,15,190,15,144,31,
- 144,24,149,31,146,15,146,15,182,15,146,17,36,47,147,63,147,79,147,95,147,111,
- 147,127,147,143,147,159,147,175,147,191,147,239,147,255,147,128,145,201,3,144,
- 145,202,3,137,43,41,240,224,145,201,3,240,145,202,3,9,149,255,145,239,145,191,
- 145,175,145,159,145,143,145,127,145,111,145,95,145,79,145,63,145,47,145,15,144,
- 15,190,15,144,31,144,24,149,31,146,15,146,15,182,15,146,17,36,47,147,63,147,
- 143,147,159,147,175,147,191,147,128,145,207,3,144,145,208,3,160,145,209,3,176,
- 145,210,3,48,145,211,3,1,150,161,29,177,29,35,47,45,95,45,55,32,240,45,87,1,
- 150,161,29,177,29,32,147,211,3,128,147,207,3,144,147,208,3,160,147,209,3,176,
- 147,210,3,128,145,203,3,144,145,204,3,160,145,205,3,176,145,206,3,1,150,161,29,
- 177,29,128,147,203,3,144,147,204,3,160,147,205,3,176,147,206,3,191,145,175,145,
- 159,145,143,145,63,145,47,145,15,144,15,190,15,144,31,144,24,149,143,183,248,
- 148,32,145,207,3,48,145,208,3,64,145,209,3,80,145,210,3,143,191,185,1,202,1,8,
- 149,155,1,172,1,127,183,248,148,128,145,203,3,144,145,204,3,160,145,205,3,176,
- 145,206,3,102,181,168,155,5,192,111,63,25,240,1,150,161,29,177,29,127,191,186,
- 47,169,47,152,47,136,39,134,15,145,29,161,29,177,29,98,224,136,15,153,31,170,
- 31,187,31,106,149,209,247,188,1,45,192,255,183,248,148,128,145,203,3,144,145,
- 204,3,160,145,205,3,176,145,206,3,230,181,168,155,5,192,239,63,25,240,1,150,
- 161,29,177,29,255,191,186,47,169,47,152,47,136,39,142,15,145,29,161,29,177,29,
- 226,224,136,15,153,31,170,31,187,31,234,149,209,247,134,27,151,11,136,94,147,
- 64,200,242,33,80,48,64,64,64,80,64,104,81,124,79,33,21,49,5,65,5,81,5,113,246,
- 8,149,1,151,57,240,136,15,153,31,136,15,153,31,2,151,1,151,241,247,8,149,120,
- 148,132,181,130,96,132,189,132,181,129,96,132,189,133,181,130,96,133,189,133,
- 181,129,96,133,189,238,230,240,224,128,129,129,96,128,131,225,232,240,224,16,
- 130,128,129,130,96,128,131,128,129,129,96,128,131,224,232,240,224,128,129,129,
- 96,128,131,225,235,240,224,128,129,132,96,128,131,224,235,240,224,128,129,129,
- 96,128,131,234,231,240,224,128,129,132,96,128,131,128,129,130,96,128,131,128,
- 129,129,96,128,131,128,129,128,104,128,131,16,146,193,0,8,149,72,47,80,224,202,
- 1,139,87,155,79,252,1,36,145,79,88,91,79,250,1,132,145,136,35,193,240,232,47,
- 240,224,238,15,255,31,237,90,251,79,165,145,180,145,102,35,65,244,159,183,248,
- 148,140,145,32,149,130,35,140,147,159,191,8,149,159,183,248,148,140,145,130,43,
- 140,147,159,191,8,149,72,47,80,224,202,1,135,86,155,79,252,1,36,145,202,1,139,
- 87,155,79,252,1,148,145,79,88,91,79,250,1,52,145,51,35,9,244,64,192,34,35,81,
- 241,35,48,113,240,36,48,40,244,33,48,161,240,34,48,17,245,20,192,38,48,177,240,
- 39,48,193,240,36,48,217,244,4,192,128,145,128,0,143,119,3,192,128,145,128,0,
- 143,125,128,147,128,0,16,192,132,181,143,119,2,192,132,181,143,125,132,189,9,
- 192,128,145,176,0,143,119,3,192,128,145,176,0,143,125,128,147,176,0,227,47,240,
- 224,238,15,255,31,227,90,251,79,165,145,180,145,47,183,248,148,102,35,33,244,
- 140,145,144,149,137,35,2,192,140,145,137,43,140,147,47,191,8,149,104,47,112,
- 224,203,1,135,86,155,79,252,1,36,145,203,1,139,87,155,79,252,1,68,145,111,88,
- 123,79,251,1,148,145,153,35,25,244,32,224,48,224,60,192,34,35,81,241,35,48,113,
- 240,36,48,40,244,33,48,161,240,34,48,17,245,20,192,38,48,177,240,39,48,193,240,
- 36,48,217,244,4,192,128,145,128,0,143,119,3,192,128,145,128,0,143,125,128,147,
- 128,0,16,192,132,181,143,119,2,192,132,181,143,125,132,189,9,192,128,145,176,0,
- 143,119,3,192,128,145,176,0,143,125,128,147,176,0,137,47,144,224,136,15,153,31,
- 137,89,155,79,252,1,165,145,180,145,140,145,32,224,48,224,132,35,17,240,33,224,
- 48,224,201,1,8,149,8,149,31,146,15,146,15,182,15,146,17,36,47,147,63,147,79,
- 147,143,147,159,147,239,147,255,147,64,145,198,0,32,145,20,4,48,145,21,4,47,95,
- 63,79,47,115,48,112,128,145,22,4,144,145,23,4,40,23,57,7,89,240,224,145,20,4,
- 240,145,21,4,236,82,252,79,64,131,48,147,21,4,32,147,20,4,255,145,239,145,159,
- 145,143,145,79,145,63,145,47,145,15,144,15,190,15,144,31,144,24,149,224,145,
- 104,4,240,145,105,4,224,92,255,79,129,145,145,145,32,129,49,129,130,27,147,11,
- 143,115,144,112,137,43,17,240,14,148,29,18,8,149,31,146,15,146,15,182,15,146,
- 17,36,47,147,63,147,79,147,95,147,111,147,127,147,143,147,159,147,175,147,191,
- 147,239,147,255,147,32,145,88,4,48,145,89,4,128,145,90,4,144,145,91,4,40,23,57,
- 7,49,244,128,145,193,0,143,125,128,147,193,0,22,192,224,145,90,4,240,145,91,4,
- 232,94,251,79,64,129,128,145,90,4,144,145,91,4,1,150,96,228,112,224,14,148,61,
- 22,144,147,91,4,128,147,90,4,64,147,198,0,255,145,239,145,191,145,175,145,159,
- 145,143,145,127,145,111,145,95,145,79,145,63,145,47,145,15,144,15,190,15,144,
- 31,144,24,149,175,146,191,146,223,146,239,146,255,146,15,147,31,147,207,147,
- 223,147,236,1,122,1,139,1,221,36,64,48,129,238,88,7,128,224,104,7,128,224,120,
- 7,17,240,221,36,211,148,145,224,169,46,177,44,236,137,253,137,221,32,105,240,
- 197,1,14,140,2,192,136,15,153,31,10,148,226,247,128,131,96,224,121,224,141,227,
- 144,224,5,192,16,130,96,232,116,232,142,225,144,224,168,1,151,1,14,148,80,22,
- 33,80,48,64,64,64,80,64,86,149,71,149,55,149,39,149,128,225,32,48,56,7,32,240,
- 221,32,17,240,221,36,214,207,232,137,249,137,48,131,234,137,251,137,32,131,238,
- 137,255,137,64,129,33,224,48,224,201,1,10,140,2,192,136,15,153,31,10,148,226,
- 247,72,43,64,131,238,137,255,137,64,129,201,1,11,140,2,192,136,15,153,31,10,
- 148,226,247,72,43,64,131,238,137,255,137,64,129,201,1,12,140,2,192,136,15,153,
- 31,10,148,226,247,72,43,64,131,238,137,255,137,128,129,13,140,2,192,34,15,51,
- 31,10,148,226,247,32,149,40,35,32,131,223,145,207,145,31,145,15,145,255,144,
- 239,144,223,144,191,144,175,144,8,149,220,1,28,150,237,145,252,145,29,151,224,
- 92,255,79,33,145,49,145,128,129,145,129,40,27,57,11,47,115,48,112,201,1,8,149,
- 220,1,28,150,237,145,252,145,29,151,224,92,255,79,32,129,49,129,224,84,240,64,
- 223,1,174,91,191,79,141,145,156,145,17,151,40,23,57,7,25,244,47,239,63,239,7,
- 192,141,145,156,145,232,15,249,31,128,129,40,47,48,224,201,1,8,149,220,1,28,
- 150,237,145,252,145,29,151,224,92,255,79,32,129,49,129,224,84,240,64,223,1,174,
- 91,191,79,141,145,156,145,17,151,40,23,57,7,25,244,47,239,63,239,16,192,141,
- 145,156,145,17,151,232,15,249,31,32,129,141,145,156,145,17,151,1,150,143,115,
- 144,112,17,150,156,147,142,147,48,224,201,1,8,149,252,1,134,133,151,133,220,1,
- 160,92,191,79,252,1,238,91,255,79,45,145,60,145,17,151,128,129,145,129,40,23,
- 57,7,193,247,8,149,207,147,223,147,236,1,70,47,238,133,255,133,224,92,255,79,
- 128,129,145,129,224,84,240,64,1,150,96,228,112,224,14,148,61,22,156,1,223,1,
- 174,91,191,79,141,145,156,145,17,151,40,23,57,7,209,243,224,92,255,79,128,129,
- 145,129,224,84,240,64,232,15,249,31,64,131,238,133,255,133,224,92,255,79,49,
- 131,32,131,238,137,255,137,32,129,129,224,144,224,13,140,2,192,136,15,153,31,
- 10,148,226,247,40,43,32,131,129,224,144,224,223,145,207,145,8,149,16,146,95,4,
- 16,146,94,4,136,238,147,224,160,224,176,224,128,147,96,4,144,147,97,4,160,147,
- 98,4,176,147,99,4,137,235,145,224,144,147,93,4,128,147,92,4,132,237,147,224,
- 144,147,105,4,128,147,104,4,136,225,148,224,144,147,107,4,128,147,106,4,133,
- 236,144,224,144,147,109,4,128,147,108,4,132,236,144,224,144,147,111,4,128,147,
- 110,4,128,236,144,224,144,147,113,4,128,147,112,4,129,236,144,224,144,147,115,
- 4,128,147,114,4,134,236,144,224,144,147,117,4,128,147,116,4,132,224,128,147,
- 118,4,131,224,128,147,119,4,135,224,128,147,120,4,133,224,128,147,121,4,129,
- 224,128,147,122,4,8,149,207,147,223,147,14,148,21,17,14,148,21,11,194,229,210,
- 225,14,148,127,5,32,151,225,243,14,148,82,18,249,207,207,146,223,146,239,146,
- 255,146,15,147,31,147,207,147,223,147,124,1,107,1,138,1,192,224,208,224,15,192,
- 214,1,109,145,109,1,215,1,237,145,252,145,1,144,240,129,224,45,199,1,9,149,200,
- 15,217,31,1,80,16,64,1,21,17,5,113,247,206,1,223,145,207,145,31,145,15,145,255,
- 144,239,144,223,144,207,144,8,149,220,1,237,145,252,145,1,144,240,129,224,45,9,
- 149,8,149,239,146,255,146,15,147,31,147,140,1,220,1,237,145,252,145,1,144,240,
- 129,224,45,109,224,9,149,124,1,216,1,237,145,252,145,1,144,240,129,224,45,200,
- 1,106,224,9,149,156,1,46,13,63,29,201,1,31,145,15,145,255,144,239,144,8,149,
- 239,146,255,146,15,147,31,147,124,1,220,1,237,145,252,145,1,144,240,129,224,45,
- 9,149,140,1,199,1,14,148,109,20,8,15,25,31,200,1,31,145,15,145,255,144,239,144,
- 8,149,207,147,223,147,219,1,13,144,0,32,233,247,17,151,166,27,183,11,236,1,232,
- 129,249,129,2,128,243,129,224,45,173,1,9,149,223,145,207,145,8,149,79,146,95,
- 146,127,146,143,146,159,146,175,146,191,146,207,146,223,146,239,146,255,146,15,
- 147,31,147,223,147,207,147,205,183,222,183,161,151,15,182,248,148,222,191,15,
- 190,205,191,44,1,116,46,203,1,34,48,8,244,42,224,25,162,49,226,195,46,209,44,
- 204,14,221,30,130,46,153,36,170,36,187,36,103,45,117,47,165,1,148,1,14,148,80,
- 22,121,1,138,1,200,1,183,1,165,1,148,1,14,148,10,22,71,45,70,27,8,148,193,8,
- 209,8,74,48,20,244,64,93,1,192,73,92,246,1,64,131,225,20,241,4,1,5,17,5,33,240,
- 126,44,95,45,200,1,221,207,194,1,182,1,14,148,165,20,161,150,15,182,248,148,
- 222,191,15,190,205,191,207,145,223,145,31,145,15,145,255,144,239,144,223,144,
- 207,144,191,144,175,144,159,144,143,144,127,144,95,144,79,144,8,149,220,1,33,
- 21,49,5,65,244,237,145,252,145,1,144,240,129,224,45,100,47,9,149,8,149,14,148,
- 185,20,8,149,239,146,255,146,15,147,31,147,124,1,14,148,29,21,140,1,199,1,14,
- 148,109,20,156,1,32,15,49,31,201,1,31,145,15,145,255,144,239,144,8,149,239,146,
- 255,146,15,147,31,147,154,1,123,1,0,224,16,224,184,1,167,1,14,148,29,21,31,145,
- 15,145,255,144,239,144,8,149,207,146,223,146,239,146,255,146,15,147,31,147,108,
- 1,123,1,154,1,0,224,16,224,184,1,167,1,14,148,29,21,140,1,198,1,14,148,109,20,
- 8,15,25,31,200,1,31,145,15,145,255,144,239,144,223,144,207,144,8,149,207,146,
- 223,146,239,146,255,146,15,147,31,147,207,147,223,147,236,1,106,1,123,1,33,21,
- 49,5,65,244,232,129,249,129,1,144,240,129,224,45,100,47,9,149,31,192,42,48,49,
- 5,209,244,119,255,23,192,232,129,249,129,1,144,240,129,224,45,109,226,9,149,
- 140,1,68,39,85,39,186,1,76,25,93,9,110,9,127,9,206,1,42,224,14,148,185,20,152,
- 1,40,15,57,31,4,192,42,224,14,148,185,20,156,1,201,1,223,145,207,145,31,145,15,
- 145,255,144,239,144,223,144,207,144,8,149,239,146,255,146,15,147,31,147,124,1,
- 14,148,110,21,140,1,199,1,14,148,109,20,156,1,32,15,49,31,201,1,31,145,15,145,
- 255,144,239,144,8,149,239,146,255,146,15,147,31,147,123,1,154,1,0,39,247,252,0,
- 149,16,47,184,1,167,1,14,148,110,21,31,145,15,145,255,144,239,144,8,149,207,
- 146,223,146,239,146,255,146,15,147,31,147,108,1,123,1,154,1,0,39,247,252,0,149,
- 16,47,184,1,167,1,14,148,110,21,140,1,198,1,14,148,109,20,8,15,25,31,200,1,31,
- 145,15,145,255,144,239,144,223,144,207,144,8,149,14,148,165,20,8,149,239,146,
- 255,146,15,147,31,147,124,1,14,148,165,20,140,1,199,1,14,148,109,20,8,15,25,31,
- 200,1,31,145,15,145,255,144,239,144,8,149,98,159,208,1,115,159,240,1,130,159,
- 224,13,241,29,100,159,224,13,241,29,146,159,240,13,131,159,240,13,116,159,240,
- 13,101,159,240,13,153,39,114,159,176,13,225,29,249,31,99,159,176,13,225,29,249,
- 31,189,1,207,1,17,36,8,149,170,27,187,27,81,225,7,192,170,31,187,31,166,23,183,
- 7,16,240,166,27,183,11,136,31,153,31,90,149,169,247,128,149,144,149,188,1,205,
- 1,8,149,151,251,9,46,7,38,10,208,119,253,4,208,229,223,6,208,0,32,26,244,112,
- 149,97,149,127,79,8,149,246,247,144,149,129,149,159,79,8,149,161,226,26,46,170,
- 27,187,27,253,1,13,192,170,31,187,31,238,31,255,31,162,23,179,7,228,7,245,7,32,
- 240,162,27,179,11,228,11,245,11,102,31,119,31,136,31,153,31,26,148,105,247,96,
- 149,112,149,128,149,144,149,155,1,172,1,189,1,207,1,8,149,238,15,255,31,5,144,
- 244,145,224,45,9,148,248,148,255,207,67,117,114,114,101,110,116,32,99,111,110,
- 102,105,103,117,114,97,116,105,111,110,58,0,68,70,32,69,32,0,68,70,32,83,32,0,
- 32,0,32,105,0,32,103,0,32,64,32,0,32,77,72,122,32,0,99,111,110,102,105,103,32,
- 115,97,118,101,32,102,97,105,108,101,100,0,62,32,0,116,101,115,116,32,0,32,100,
- 102,35,32,0,32,58,32,0,114,58,32,112,97,103,101,32,0,68,70,32,67,63,32,0,82,32,
- 0,68,70,32,82,32,0,68,70,32,87,0,101,114,97,115,101,100,0,79,75,0,32,63,0,71,
- 32,0,32,45,62,32,97,99,107,0,32,45,62,32,0,32,98,0,10,91,82,70,49,50,100,101,
- 109,111,46,56,93,0,68,70,32,73,32,0,59,1,177,1,100,3,147,3,0,0,0,0,160,19,59,
- 20,52,19,101,19,69,19,142,19,0,17,36,132,183,20,190,129,255,240,208,133,224,
- 128,147,129,0,130,224,128,147,192,0,136,225,128,147,193,0,134,224,128,147,194,
- 0,128,225,128,147,196,0,142,224,201,208,37,154,134,224,32,227,60,239,145,224,
- 48,147,133,0,32,147,132,0,150,187,176,155,254,207,29,154,168,149,129,80,169,
- 247,204,36,221,36,136,36,131,148,181,224,171,46,161,225,154,46,243,224,191,46,
- 162,208,129,52,97,244,159,208,8,47,175,208,2,56,17,240,1,56,17,244,132,224,1,
- 192,131,224,141,208,137,192,130,52,17,244,132,225,3,192,133,52,25,244,133,224,
- 166,208,128,192,133,53,121,244,136,208,232,46,255,36,133,208,8,47,16,224,16,47,
- 0,39,14,41,31,41,0,15,17,31,142,208,104,1,111,192,134,53,33,244,132,224,144,
- 208,128,224,222,207,132,54,9,240,64,192,112,208,111,208,8,47,109,208,128,224,
- 200,22,128,231,216,6,24,244,246,1,183,190,232,149,192,224,209,224,98,208,137,
- 147,12,23,225,247,240,224,207,22,240,231,223,6,24,240,246,1,183,190,232,149,
- 104,208,7,182,0,252,253,207,166,1,160,224,177,224,44,145,48,224,17,150,140,145,
- 17,151,144,224,152,47,136,39,130,43,147,43,18,150,250,1,12,1,135,190,232,149,
- 17,36,78,95,95,79,241,224,160,56,191,7,81,247,246,1,167,190,232,149,7,182,0,
- 252,253,207,151,190,232,149,38,192,132,55,177,244,46,208,45,208,248,46,43,208,
- 60,208,246,1,239,44,143,1,15,95,31,79,132,145,27,208,234,148,248,1,193,247,8,
- 148,193,28,209,28,250,148,207,12,209,28,14,192,133,55,57,244,40,208,142,225,12,
- 208,133,233,10,208,143,224,122,207,129,53,17,244,136,224,24,208,29,208,128,225,
- 1,208,101,207,152,47,128,145,192,0,133,255,252,207,144,147,198,0,8,149,128,145,
- 192,0,135,255,252,207,128,145,192,0,132,253,1,192,168,149,128,145,198,0,8,149,
- 224,230,240,224,152,225,144,131,128,131,8,149,237,223,128,50,25,240,136,224,
- 245,223,255,207,132,225,222,207,31,147,24,47,227,223,17,80,233,247,242,223,31,
- 145,8,149,128,224,232,223,238,39,255,39,9,148,255,255,255,255,255,255,255,255,
- 255,255,4,4,12,148,52,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,
- 12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,
- 12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,
- 12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,12,148,81,60,
- 12,148,81,60,12,148,81,60,12,148,81,60,17,36,31,190,207,239,216,224,222,191,
- 205,191,17,224,160,224,177,224,236,233,255,231,2,192,5,144,13,146,162,48,177,7,
- 217,247,18,224,162,224,177,224,1,192,29,146,173,48,177,7,225,247,14,148,45,61,
- 12,148,204,63,12,148,0,60,152,47,149,149,149,149,149,149,149,149,144,93,143,
- 112,138,48,124,240,40,47,41,90,128,145,192,0,133,255,252,207,144,147,198,0,128,
- 145,192,0,133,255,252,207,32,147,198,0,8,149,40,47,32,93,240,207,152,47,128,
- 145,192,0,133,255,252,207,144,147,198,0,8,149,239,146,255,146,15,147,31,147,
- 238,36,255,36,135,1,128,145,192,0,135,253,23,192,8,148,225,28,241,28,1,29,17,
- 29,129,228,232,22,130,228,248,6,143,224,8,7,128,224,24,7,112,243,224,145,4,1,
- 240,145,5,1,9,149,128,145,192,0,135,255,233,207,128,145,198,0,31,145,15,145,
- 255,144,239,144,8,149,14,148,118,60,152,47,128,145,192,0,133,255,252,207,144,
- 147,198,0,145,54,44,244,144,51,12,240,144,83,137,47,8,149,151,85,137,47,8,149,
- 31,147,14,148,159,60,24,47,14,148,159,60,18,149,16,127,129,15,31,145,8,149,31,
- 147,24,47,136,35,33,240,14,148,118,60,17,80,225,247,31,145,8,149,31,147,24,47,
- 14,148,118,60,128,50,73,240,128,145,3,1,143,95,128,147,3,1,133,48,193,240,31,
- 145,8,149,128,145,192,0,133,255,252,207,132,225,128,147,198,0,128,145,192,0,
- 133,255,252,207,16,147,198,0,128,145,192,0,133,255,252,207,128,225,128,147,198,
- 0,31,145,8,149,224,145,4,1,240,145,5,1,9,149,31,145,8,149,14,148,118,60,128,50,
- 65,240,128,145,3,1,143,95,128,147,3,1,133,48,129,240,8,149,128,145,192,0,133,
- 255,252,207,132,225,128,147,198,0,128,145,192,0,133,255,252,207,128,225,128,
- 147,198,0,8,149,224,145,4,1,240,145,5,1,9,149,8,149,64,233,81,224,136,35,161,
- 240,45,154,40,238,51,224,250,1,49,151,241,247,33,80,48,64,209,247,45,152,40,
- 238,51,224,250,1,49,151,241,247,33,80,48,64,209,247,129,80,97,247,8,149,63,146,
- 79,146,95,146,111,146,127,146,143,146,159,146,175,146,191,146,207,146,223,146,
- 239,146,255,146,15,147,31,147,207,147,223,147,0,0,128,225,128,147,196,0,16,146,
- 197,0,136,225,128,147,193,0,134,224,128,147,194,0,80,152,88,154,37,154,129,224,
- 14,148,20,61,36,225,242,46,158,225,233,46,133,233,216,46,15,224,192,46,16,225,
- 177,46,170,36,163,148,177,228,155,46,166,229,138,46,242,229,127,46,224,226,110,
- 46,121,228,87,46,99,229,70,46,80,229,53,46,14,148,118,60,128,51,177,241,129,51,
- 185,241,128,52,9,244,111,192,129,52,9,244,118,192,130,52,9,244,133,192,133,52,
- 9,244,136,192,128,53,49,241,130,53,33,241,129,53,17,241,133,53,9,244,133,192,
- 134,53,9,244,141,192,132,54,9,244,150,192,132,55,9,244,3,193,133,55,9,244,114,
- 193,134,55,9,244,102,192,128,145,3,1,143,95,128,147,3,1,133,48,121,246,224,145,
- 4,1,240,145,5,1,9,149,14,148,118,60,128,51,81,246,14,148,243,60,195,207,14,148,
- 118,60,128,50,73,247,128,145,192,0,133,255,252,207,240,146,198,0,128,145,192,0,
- 133,255,252,207,144,146,198,0,128,145,192,0,133,255,252,207,128,146,198,0,128,
- 145,192,0,133,255,252,207,112,146,198,0,128,145,192,0,133,255,252,207,96,146,
- 198,0,128,145,192,0,133,255,252,207,80,146,198,0,128,145,192,0,133,255,252,207,
- 64,146,198,0,128,145,192,0,133,255,252,207,48,146,198,0,128,145,192,0,133,255,
- 252,207,176,146,198,0,136,207,14,148,118,60,134,56,8,244,189,207,14,148,118,60,
- 14,148,243,60,126,207,14,148,118,60,128,56,9,244,156,192,129,56,9,244,11,193,
- 130,56,9,244,60,193,136,57,9,244,143,192,128,224,14,148,199,60,108,207,132,225,
- 14,148,189,60,14,148,243,60,102,207,133,224,14,148,189,60,14,148,243,60,96,207,
- 14,148,118,60,128,147,6,1,14,148,118,60,128,147,7,1,14,148,243,60,85,207,14,
- 148,118,60,128,51,9,244,29,193,131,224,14,148,189,60,128,224,14,148,199,60,73,
- 207,14,148,118,60,128,147,9,2,14,148,118,60,128,147,8,2,128,145,12,2,142,127,
- 128,147,12,2,14,148,118,60,133,52,9,244,21,193,128,145,8,2,144,145,9,2,137,43,
- 137,240,0,224,16,224,14,148,118,60,248,1,232,95,254,79,128,131,15,95,31,79,128,
- 145,8,2,144,145,9,2,8,23,25,7,136,243,14,148,118,60,128,50,9,240,69,207,128,
- 145,12,2,128,255,1,193,96,145,6,1,112,145,7,1,102,15,119,31,112,147,7,1,96,147,
- 6,1,160,145,8,2,176,145,9,2,16,151,201,240,232,224,241,224,155,1,173,1,78,15,
- 95,31,249,153,254,207,50,189,33,189,129,145,128,189,250,154,249,154,47,95,63,
- 79,228,23,245,7,153,247,106,15,123,31,112,147,7,1,96,147,6,1,128,145,192,0,133,
- 255,252,207,240,146,198,0,128,145,192,0,133,255,252,207,176,146,198,0,225,206,
- 131,224,14,148,199,60,221,206,130,224,14,148,199,60,217,206,14,148,118,60,128,
- 147,9,2,14,148,118,60,128,147,8,2,128,145,6,1,144,145,7,1,136,15,153,31,144,
- 147,7,1,128,147,6,1,14,148,118,60,133,52,9,244,166,192,128,145,12,2,142,127,
- 128,147,12,2,14,148,118,60,128,50,9,240,184,206,128,145,192,0,133,255,252,207,
- 240,146,198,0,96,145,8,2,112,145,9,2,97,21,113,5,185,241,64,224,80,224,128,145,
- 12,2,168,47,161,112,184,47,178,112,17,192,187,35,9,244,92,192,224,145,6,1,240,
- 145,7,1,49,150,240,147,7,1,224,147,6,1,79,95,95,79,70,23,87,7,232,244,170,35,
- 105,243,249,153,254,207,32,145,6,1,48,145,7,1,50,189,33,189,248,154,144,181,
- 128,145,192,0,133,255,252,207,144,147,198,0,47,95,63,79,48,147,7,1,32,147,6,1,
- 79,95,95,79,70,23,87,7,24,243,128,145,192,0,133,253,229,206,128,145,192,0,133,
- 255,248,207,224,206,129,224,14,148,199,60,103,206,14,148,118,60,128,50,9,240,
- 140,206,128,145,192,0,133,255,252,207,240,146,198,0,128,145,192,0,133,255,252,
- 207,224,146,198,0,128,145,192,0,133,255,252,207,208,146,198,0,128,145,192,0,
- 133,255,252,207,192,146,198,0,128,145,192,0,133,255,252,207,176,146,198,0,67,
- 206,224,145,6,1,240,145,7,1,148,145,128,145,192,0,133,255,252,207,144,147,198,
- 0,156,207,128,225,14,148,199,60,51,206,14,148,118,60,14,148,118,60,24,47,14,
- 148,118,60,17,35,9,244,131,192,17,48,9,244,132,192,143,224,14,148,199,60,34,
- 206,128,145,12,2,129,96,128,147,12,2,229,206,128,145,12,2,129,96,128,147,12,2,
- 89,207,128,145,7,1,136,35,136,15,136,11,138,33,128,147,11,2,128,145,6,1,144,
- 145,7,1,136,15,153,31,144,147,7,1,128,147,6,1,128,145,8,2,128,255,9,192,128,
- 145,8,2,144,145,9,2,1,150,144,147,9,2,128,147,8,2,248,148,249,153,254,207,17,
- 39,224,145,6,1,240,145,7,1,200,224,209,224,128,145,8,2,144,145,9,2,16,48,145,
- 244,0,145,87,0,1,112,1,48,217,243,3,224,0,147,87,0,232,149,0,145,87,0,1,112,1,
- 48,217,243,1,225,0,147,87,0,232,149,9,144,25,144,0,145,87,0,1,112,1,48,217,243,
- 1,224,0,147,87,0,232,149,19,149,16,52,152,240,17,39,0,145,87,0,1,112,1,48,217,
- 243,5,224,0,147,87,0,232,149,0,145,87,0,1,112,1,48,217,243,1,225,0,147,87,0,
- 232,149,50,150,2,151,9,240,199,207,16,48,17,240,2,150,229,207,17,36,128,145,
- 192,0,133,255,185,206,188,206,142,225,14,148,199,60,162,205,133,233,14,148,199,
- 60,158,205,248,148,255,207,128,0,133,224,128,147,129,0,130,224,128,147,192,0,
- 136,225,128,147,193,0,134,224,128,147,194,0,128,225,128,147,196,0,132,183,20,
- 190,129,255,208,208,142,224,200,208,37,154,134,224,32,227,60,239,145,224,48,
- 147,133,0,32,147,132,0,150,187,176,155,254,207,29,154,168,149,129,80,169,247,
- 221,36,211,148,165,224,234,46,241,225,255,46,164,208,129,52,33,244,129,224,190,
- 208,131,224,36,192,130,52,17,244,132,225,3,192,133,52,25,244,133,224,180,208,
- 138,192,133,53,161,244,146,208,8,47,16,224,16,147,1,2,0,147,0,2,139,208,144,
- 224,152,47,136,39,128,43,145,43,136,15,153,31,144,147,1,2,128,147,0,2,115,192,
- 134,53,41,244,132,224,153,208,128,224,113,208,109,192,132,54,9,240,67,192,124,
- 208,224,145,0,2,240,145,1,2,131,224,128,147,87,0,232,149,192,224,209,224,105,
- 208,137,147,128,145,2,2,129,80,128,147,2,2,136,35,185,247,120,208,7,182,0,252,
- 253,207,64,145,0,2,80,145,1,2,160,224,177,224,44,145,48,224,17,150,140,145,17,
- 151,144,224,152,47,136,39,130,43,147,43,18,150,250,1,12,1,208,146,87,0,232,149,
- 17,36,78,95,95,79,241,224,160,56,191,7,73,247,224,145,0,2,240,145,1,2,224,146,
- 87,0,232,149,7,182,0,252,253,207,240,146,87,0,232,149,39,192,132,55,185,244,55,
- 208,70,208,224,145,0,2,240,145,1,2,49,150,240,147,1,2,224,147,0,2,49,151,228,
- 145,142,47,25,208,128,145,2,2,129,80,128,147,2,2,136,35,97,247,14,192,133,55,
- 57,244,46,208,142,225,12,208,133,233,10,208,143,224,150,207,129,53,17,244,136,
- 224,25,208,35,208,128,225,1,208,99,207,152,47,128,145,192,0,133,255,252,207,
- 144,147,198,0,8,149,168,149,128,145,192,0,135,255,252,207,128,145,198,0,8,149,
- 247,223,246,223,128,147,2,2,243,207,224,230,240,224,152,225,144,131,128,131,8,
- 149,128,224,248,223,238,39,255,39,9,148,231,223,128,50,9,240,247,223,132,225,
- 218,207,31,147,24,47,223,223,17,80,233,247,244,223,31,145,8,149,17,36,132,183,
- 20,190,129,255,240,208,133,224,128,147,129,0,130,224,128,147,192,0,136,225,128,
- 147,193,0,134,224,128,147,194,0,128,225,128,147,196,0,142,224,201,208,37,154,
- 134,224,32,227,60,239,145,224,48,147,133,0,32,147,132,0,150,187,176,155,254,
- 207,29,154,168,149,129,80,169,247,204,36,221,36,136,36,131,148,181,224,171,46,
- 161,225,154,46,243,224,191,46,162,208,129,52,97,244,159,208,8,47,175,208,2,56,
- 17,240,1,56,17,244,132,224,1,192,131,224,141,208,137,192,130,52,17,244,132,225,
- 3,192,133,52,25,244,133,224,166,208,128,192,133,53,121,244,136,208,232,46,255,
- 36,133,208,8,47,16,224,16,47,0,39,14,41,31,41,0,15,17,31,142,208,104,1,111,192,
- 134,53,33,244,132,224,144,208,128,224,222,207,132,54,9,240,64,192,112,208,111,
- 208,8,47,109,208,128,224,200,22,128,231,216,6,24,244,246,1,183,190,232,149,192,
- 224,209,224,98,208,137,147,12,23,225,247,240,224,207,22,240,231,223,6,24,240,
- 246,1,183,190,232,149,104,208,7,182,0,252,253,207,166,1,160,224,177,224,44,145,
- 48,224,17,150,140,145,17,151,144,224,152,47,136,39,130,43,147,43,18,150,250,1,
- 12,1,135,190,232,149,17,36,78,95,95,79,241,224,160,56,191,7,81,247,246,1,167,
- 190,232,149,7,182,0,252,253,207,151,190,232,149,38,192,132,55,177,244,46,208,
- 45,208,248,46,43,208,60,208,246,1,239,44,143,1,15,95,31,79,132,145,27,208,234,
- 148,248,1,193,247,8,148,193,28,209,28,250,148,207,12,209,28,14,192,133,55,57,
- 244,40,208,142,225,12,208,133,233,10,208,143,224,122,207,129,53,17,244,136,224,
- 24,208,29,208,128,225,1,208,101,207,152,47,128,145,192,0,133,255,252,207,144,
- 147,198,0,8,149,128,145,192,0,135,255,252,207,128,145,192,0,132,253,1,192,168,
- 149,128,145,198,0,8,149,224,230,240,224,152,225,144,131,128,131,8,149,237,223,
- 128,50,25,240,136,224,245,223,255,207,132,225,222,207,31,147,24,47,227,223,17,
- 80,233,247,242,223,31,145,8,149,128,224,232,223,238,39,255,39,9,148,255,255,
- 255,255,255,255,255,255,255,255,4,4,
+ 128,7,127,12,148,97,0,12,148,126,3,112,249,157,39,68,0,2,36,0,39,0,42,190,9,4,
+ 37,0,40,0,43,9,4,35,191,0,38,0,41,0,4,0,8,2,250,0,4,3,0,4,1,2,4,8,16,199,32,64,
+ 128,7,6,5,6,48,0,7,0,255,2,1,0,0,3,4,6,0,254,0,8,17,36,31,190,207,239,216,255,
+ 224,222,191,205,191,17,224,160,255,224,177,224,238,231,243,224,2,255,192,5,144,
+ 13,146,162,48,177,191,7,217,247,17,224,162,21,0,1,239,192,29,146,171,15,0,225,
+ 247,14,191,148,182,1,12,148,189,3,0,0,255,0,128,145,0,1,97,224,14,255,148,105,
+ 1,104,238,115,224,128,171,224,144,11,0,229,21,4,96,21,28,8,253,149,45,10,73,1,
+ 8,149,31,146,255,15,146,15,182,15,146,17,36,255,47,147,63,147,143,147,159,147,
+ 255,175,147,191,147,128,145,6,1,255,144,145,7,1,160,145,8,1,255,176,145,9,1,48,
+ 145,10,1,255,1,150,161,29,177,29,35,47,255,45,95,45,55,32,240,45,87,126,15,6,
+ 32,147,10,1,128,147,45,0,245,147,45,0,147,45,0,147,9,1,128,171,145,2,61,0,3,61,
+ 0,4,61,0,5,86,57,8,128,147,21,0,147,21,0,147,21,0,255,147,5,1,191,145,175,145,
+ 159,255,145,143,145,63,145,47,145,15,255,144,15,190,15,144,31,144,24,255,149,
+ 239,146,255,146,15,147,31,255,147,123,1,140,1,143,183,248,171,148,64,137,0,80,
+ 137,0,96,137,0,112,206,137,0,143,191,47,21,0,159,26,47,191,255,132,27,149,11,
+ 166,11,183,11,255,232,22,249,6,10,7,27,7,255,96,247,31,145,15,145,255,144,255,
+ 239,144,8,149,120,148,132,181,127,130,96,132,189,132,181,129,5,0,213,133,11,0,
+ 133,5,0,129,5,0,238,230,255,240,224,128,129,129,96,128,131,203,225,232,9,2,130,
+ 9,0,15,6,224,232,170,25,12,235,9,2,132,19,2,235,19,10,234,249,231,19,10,51,18,
+ 128,129,128,104,128,239,131,16,146,193,99,1,40,47,48,255,224,201,1,134,86,159,
+ 79,252,255,1,148,145,42,87,63,79,249,255,1,132,145,136,35,145,240,232,255,47,
+ 240,224,238,15,255,31,232,255,89,255,79,165,145,180,145,102,255,35,41,244,140,
+ 145,144,149,137,255,35,140,147,8,149,140,145,137,253,43,7,2,72,47,80,224,202,1,
+ 187,130,85,63,2,36,145,202,73,12,74,255,87,95,79,250,1,52,145,51,255,35,209,
+ 241,34,35,49,241,35,255,48,33,244,128,145,128,0,143,191,119,5,192,36,48,49,11,
+ 6,125,255,128,147,128,0,24,192,33,48,255,25,244,132,181,143,119,4,192,249,34,
+ 37,0,9,0,125,132,189,13,192,117,38,49,4,176,49,4,39,48,41,11,6,110,49,0,176,0,
+ 227,153,8,238,88,153,50,255,14,148,15,1,14,148,151,0,255,14,148,128,0,253,207,
+ 248,148,15,255,207,13,0,186,91,255,12,148,88,2,12,148,2,16,183,12,148,47,3,0,
+ 128,2,3,94,92,126,55,8,30,18,12,148,101,18,39,42,255,10,65,118,97,105,108,97,
+ 98,255,108,101,32,99,111,109,109,97,255,110,100,115,58,10,32,32,60,191,110,110,
+ 62,32,105,32,0,2,45,255,32,115,101,116,32,110,111,100,255,101,32,73,68,32,40,
+ 115,116,238,35,0,97,114,100,17,6,105,100,115,255,32,97,114,101,32,49,46,46,223,
+ 50,54,41,10,32,0,22,40,111,255,114,32,101,110,116,101,114,32,255,97,110,32,117,
+ 112,112,101,114,255,99,97,115,101,32,39,65,39,255,46,46,39,90,39,32,116,111,
+ 238,91,4,105,100,41,114,4,62,32,98,125,32,114,16,77,72,122,32,98,108,0,255,32,
+ 40,52,32,61,32,52,51,239,51,44,32,56,8,0,56,54,56,119,44,32,57,8,0,57,49,53,55,
+ 6,250,171,2,103,170,16,101,116,119,111,114,255,107,32,103,114,111,117,112,32,
+ 255,40,82,70,77,49,50,32,111,255,110,108,121,32,97,108,108,111,255,119,115,32,
+ 50,49,50,44,32,93,48,65,0,97,110,121,121,10,99,121,18,255,99,111,108,108,101,
+ 99,116,32,253,109,226,2,40,97,100,118,97,110,111,99,101,100,44,242,0,114,109,
+ 67,0,215,121,32,48,54,2,116,232,14,45,32,159,98,114,111,97,100,221,0,52,0,97,
+ 255,120,45,115,105,122,101,32,116,253,101,13,0,112,97,99,107,101,116,127,44,32,
+ 119,105,116,104,32,11,0,94,55,0,46,46,46,44,95,5,97,110,4,30,224,0,100,97,116,
+ 97,41,8,19,3,89,5,52,33,2,54,38,115,54,62,110,111,52,8,218,2,189,108,163,10,
+ 116,117,114,110,23,0,116,255,105,118,105,116,121,32,76,69,61,68,21,1,32,80,66,
+ 49,6,2,169,1,215,111,102,102,49,8,113,12,19,113,117,235,105,101,10,11,49,52,1,
+ 100,111,110,255,39,116,32,114,101,112,111,114,245,116,159,1,100,129,8,115,41,
+ 10,82,223,101,109,111,116,101,61,1,110,116,183,114,111,108,7,0,109,109,190,1,
+ 115,253,58,85,2,104,99,104,105,62,44,246,6,0,108,111,6,0,97,100,100,114,126,6,
+ 0,99,109,100,62,32,102,107,8,111,70,83,50,48,51,10,32,40,229,1,207,32,77,72,
+ 122,158,5,45,8,100,101,181,118,5,0,111,159,0,107,32,0,20,45,223,32,75,65,75,85,
+ 59,14,52,51,253,51,59,6,0,70,108,97,115,104,127,32,115,116,111,114,97,103,190,
+ 0,127,74,101,101,76,105,110,107,239,0,183,108,121,41,150,2,100,32,0,56,45,191,
+ 32,100,117,109,112,32,244,1,32,247,108,111,103,219,1,114,107,101,114,109,115,
+ 148,2,115,104,140,0,115,108,4,0,171,116,51,4,2,50,4,2,49,4,2,48,231,62,32,114,
+ 57,2,34,1,108,97,121,255,32,102,114,111,109,32,115,112,127,101,99,105,102,105,
+ 101,100,66,8,126,65,0,49,50,51,44,60,98,21,5,237,98,20,1,32,101,123,30,101,114,
+ 97,63,115,101,32,52,75,32,32,0,206,5,127,49,50,44,51,52,32,119,175,50,255,119,
+ 105,112,101,32,101,110,116,95,105,114,101,32,102,254,4,109,150,1,239,114,121,
+ 10,0,0,2,36,0,39,251,0,42,9,4,37,0,40,0,43,254,9,4,35,0,38,0,41,0,4,234,0,8,2,
+ 0,4,3,0,4,1,2,4,31,8,16,32,64,128,7,6,5,6,48,0,255,7,0,2,1,0,0,3,4,251,6,0,0,
+ 10,220,19,17,36,31,255,190,207,239,216,224,222,191,205,255,191,17,224,160,224,
+ 177,224,228,255,239,252,226,2,192,5,144,13,255,146,166,60,177,7,217,247,20,255,
+ 224,166,236,177,224,1,192,29,191,146,171,55,177,7,225,15,0,192,255,235,212,224,
+ 4,192,34,151,254,255,1,14,148,116,22,206,58,209,255,7,201,247,14,148,44,20,12,
+ 255,148,120,22,12,148,0,0,251,191,1,220,1,2,192,1,65,0,65,127,80,80,64,216,247,
+ 8,149,17,2,255,13,144,0,32,233,247,17,151,206,23,2,0,32,225,21,8,13,14,37,224,
+ 255,248,148,40,152,46,189,13,180,255,7,254,253,207,158,181,30,188,254,9,10,40,
+ 154,120,148,159,63,17,95,240,144,253,238,207,35,2,142,35,8,255,142,181,8,149,
+ 31,147,24,47,191,134,224,14,148,157,2,37,2,129,253,47,9,2,31,145,8,149,223,146,
+ 255,239,146,255,146,15,147,31,147,255,207,147,223,147,140,1,214,46,95,122,1,
+ 233,1,131,41,4,30,63,12,237,14,9,12,222,188,9,10,32,224,48,239,224,11,192,30,
+ 15,12,247,1,226,255,15,241,29,128,131,47,95,63,127,79,44,23,61,7,144,243,105,2,
+ 255,223,145,207,145,31,145,15,145,255,255,144,239,144,223,144,8,149,174,105,14,
+ 235,1,130,101,0,184,101,36,30,202,101,20,254,89,6,129,207,14,99,2,129,224,191,
+ 32,48,56,7,137,247,101,18,8,255,149,128,224,144,224,96,224,112,223,224,64,224,
+ 80,224,59,2,14,148,243,196,2,253,2,115,2,236,1,254,1,255,33,150,20,145,17,35,
+ 105,240,255,26,48,41,244,140,229,148,224,109,109,33,0,101,20,9,2,97,47,9,2,251,
+ 238,207,75,6,8,149,136,230,144,254,27,0,55,3,128,145,113,2,144,255,145,114,2,
+ 137,43,33,240,134,115,228,147,19,4,47,2,96,224,113,11,0,247,247,21,129,5,0,97,
+ 15,8,149,222,71,11,140,1,123,1,19,2,230,13,255,200,1,138,86,159,79,14,148,247,
+ 11,17,128,15,4,199,1,136,92,227,144,64,15,2,17,11,15,15,236,1,104,255,48,161,
+ 244,156,1,34,15,51,255,31,8,46,130,149,128,37,8,239,46,134,149,134,7,0,200,47,
+ 208,255,224,33,150,213,149,199,149,193,255,112,208,112,194,43,211,43,105,255,
+ 224,38,47,48,224,33,80,48,251,64,129,237,0,160,224,176,224,4,255,192,136,15,
+ 153,31,170,31,187,255,31,42,149,210,247,140,1,15,255,192,200,1,140,35,157,35,
+ 137,255,43,25,244,96,233,113,224,2,255,192,104,229,114,224,203,1,14,255,148,
+ 105,3,22,149,7,149,1,31,21,17,5,113,247,53,15,183,6,213,2,219,103,225,213,2,
+ 244,21,11,2,184,1,253,74,69,1,14,148,81,21,136,237,188,169,63,135,3,14,148,44,
+ 3,81,6,96,255,145,115,3,102,35,9,244,152,203,192,32,63,1,48,63,1,179,3,143,225,
+ 254,179,3,16,240,32,224,50,224,48,255,147,114,2,32,147,113,2,130,254,199,5,73,
+ 244,128,145,107,3,144,255,145,108,3,1,150,144,147,108,255,3,128,147,107,3,143,
+ 239,159,239,239,144,147,114,11,0,113,3,227,251,231,242,235,0,79,239,95,239,127,
+ 255,239,150,23,24,240,152,63,8,255,244,112,131,129,145,72,39,132,159,47,130,
+ 149,132,39,45,11,7,2,128,255,37,135,112,4,46,69,47,134,255,149,7,148,135,149,
+ 80,45,72,251,39,6,7,2,37,72,39,159,95,95,158,63,1,247,80,83,0,64,83,0,223,201,
+ 1,99,231,114,223,0,252,2,79,16,146,115,3,187,2,245,2,109,1,9,69,96,183,0,112,
+ 183,0,19,2,7,7,64,21,5,127,96,226,14,148,101,20,96,173,0,249,112,173,0,29,38,
+ 64,145,109,3,80,191,145,110,3,96,145,111,37,0,112,238,37,4,42,224,48,37,0,174,
+ 21,128,250,87,0,144,87,0,136,35,81,244,128,255,80,159,79,47,225,128,48,146,238,
+ 19,1,128,224,146,31,0,199,3,8,255,149,14,148,164,16,40,238,51,251,224,64,87,4,
+ 80,22,202,1,185,253,1,163,7,207,147,223,147,236,1,255,139,1,106,48,113,5,64,
+ 240,223,203,1,106,224,112,33,0,41,22,253,206,217,1,153,4,222,1,13,144,255,0,32,
+ 233,247,17,151,172,27,223,202,15,209,29,200,31,12,128,93,243,136,131,237,15,71,
+ 6,201,236,209,224,255,140,225,254,1,17,146,138,149,191,233,247,206,1,99,226,
+ 247,2,150,255,2,16,145,199,1,31,113,254,251,1,1,75,4,234,92,241,64,240,255,224,
+ 236,15,253,31,16,92,16,191,131,16,84,206,1,101,39,4,139,223,2,206,1,97,47,93,2,
+ 153,4,189,128,49,0,133,255,11,192,51,30,138,255,226,128,131,137,236,145,224,
+ 104,30,51,8,96,145,200,1,15,2,55,6,9,2,245,107,25,8,224,67,0,240,224,102,224,
+ 255,245,149,231,149,106,149,225,247,255,238,15,255,31,227,85,254,79,79,96,129,
+ 113,129,39,2,47,10,111,47,8,255,143,239,159,239,144,147,230,1,255,128,147,229,
+ 1,231,236,241,224,255,33,145,128,145,229,1,144,145,255,230,1,130,39,40,47,34,
+ 149,255,40,39,2,46,38,149,38,149,251,32,37,7,2,32,37,39,112,8,255,46,137,47,38,
+ 149,7,148,39,191,149,144,45,130,39,6,7,2,37,251,130,39,67,10,129,224,229,62,
+ 248,255,7,225,246,128,226,144,224,252,251,1,233,121,0,224,129,249,153,254,255,
+ 207,31,186,146,189,129,189,224,255,189,15,182,248,148,250,154,249,255,154,15,
+ 190,1,150,128,52,145,239,5,105,247,129,135,0,97,15,136,183,35,49,244,221,3,101,
+ 227,151,2,247,249,21,101,7,99,3,24,47,137,224,97,254,191,3,17,96,224,17,35,9,
+ 244,183,97,224,137,13,0,118,17,29,2,47,255,146,63,146,79,146,95,146,111,255,
+ 146,127,146,143,146,159,146,175,255,146,191,146,207,146,223,146,239,215,146,
+ 255,146,231,3,223,161,1,205,183,239,222,183,100,151,119,2,222,191,15,247,190,
+ 205,191,101,2,14,148,52,19,191,137,43,9,244,54,196,13,6,101,255,19,24,47,128,
+ 83,138,48,88,255,244,128,145,44,2,42,224,130,255,159,192,1,17,36,128,83,129,
+ 255,15,128,147,44,2,35,196,28,255,50,137,244,144,145,45,2,146,255,52,80,244,
+ 233,47,240,224,226,247,93,253,79,41,2,128,131,159,95,255,144,147,45,2,16,146,
+ 44,2,255,16,196,129,47,129,86,138,49,111,8,240,249,195,85,2,104,228,201,2,231,
+ 244,21,96,39,0,15,2,112,224,74,219,224,80,17,0,194,21,13,2,97,47,255,14,148,
+ 141,20,25,54,137,241,255,26,54,180,244,20,54,9,244,255,73,193,21,54,68,244,18,
+ 54,255,121,241,19,54,12,240,75,192,127,17,54,1,245,125,192,22,25,0,253,147,5,0,
+ 12,244,135,195,23,54,255,185,244,58,192,18,55,9,244,127,153,193,19,55,76,244,
+ 28,27,0,247,128,192,17,15,0,176,195,27,54,255,73,244,198,192,20,55,233,241,127,
+ 20,55,12,244,97,192,23,21,0,255,131,195,14,148,81,3,166,195,253,144,129,0,159,
+ 113,128,145,199,1,239,128,126,20,192,183,2,136,48,17,255,244,146,224,5,192,137,
+ 48,17,255,240,145,224,1,192,147,224,144,254,231,0,146,149,153,15,153,15,144,
+ 253,124,41,2,143,115,152,15,144,147,255,199,1,14,148,190,4,133,195,190,235,4,
+ 147,200,1,248,207,61,4,35,187,33,240,77,4,98,3,192,43,4,125,253,128,41,0,234,
+ 207,129,230,128,147,255,231,1,130,228,128,147,232,1,255,16,146,233,1,234,238,
+ 241,224,255,144,224,128,145,112,2,137,15,255,129,147,159,95,146,52,201,247,106,
+ 251,2,107,25,13,112,25,21,213,21,43,2,255,143,95,128,147,112,2,75,195,149,16,
+ 75,0,64,115,1,64,77,0,127,6,233,255,1,42,238,49,224,238,226,242,223,224,201,1,
+ 191,1,49,2,130,2,253,55,155,4,14,148,112,5,50,195,255,128,224,98,224,68,237,14,
+ 148,239,46,14,129,224,17,2,144,145,46,255,2,128,224,32,145,47,2,124,255,1,226,
+ 14,241,28,176,144,48,255,2,192,144,44,2,223,44,27,255,45,28,13,26,95,30,13,31,
+ 175,13,0,224,129,163,0,109,47,0,132,191,3,141,45,144,224,104,9,4,199,213,1,7,6,
+ 139,17,12,140,9,12,129,47,42,9,10,128,57,0,97,9,4,106,195,0,13,2,255,14,148,
+ 178,16,15,95,3,48,159,169,246,91,192,128,27,0,141,18,128,254,135,0,8,47,16,224,
+ 1,80,16,255,64,36,224,0,15,17,31,42,191,149,225,247,22,96,128,165,0,153,255,39,
+ 135,253,144,149,1,151,143,127,112,144,112,8,43,25,43,211,2,255,129,17,24,96,
+ 221,36,156,237,255,169,46,149,224,185,46,48,192,127,135,231,145,224,101,230,
+ 116,75,0,255,105,3,200,1,14,44,2,192,255,149,149,135,149,10,148,226,247,247,
+ 128,253,3,29,4,2,192,133,230,255,148,224,181,1,104,27,121,11,254,37,2,8,148,
+ 225,28,241,28,44,127,224,226,22,241,4,1,247,33,2,215,103,231,113,63,4,107,175,
+ 16,211,148,255,132,224,216,22,25,240,238,36,159,255,36,205,207,128,171,4,177,2,
+ 97,255,15,137,194,128,145,113,2,144,255,145,114,2,137,43,9,244,130,253,194,171,
+ 3,14,148,101,19,151,255,255,250,207,0,224,18,224,141,224,255,232,46,241,44,236,
+ 14,253,30,254,25,14,111,194,200,1,104,239,112,191,224,167,1,40,224,48,19,0,196,
+ 255,2,141,133,158,133,143,95,159,55,79,185,241,37,2,97,229,251,7,11,2,171,184,
+ 1,247,7,64,13,4,103,25,8,109,103,133,126,133,15,2,27,18,96,226,93,0,255,20,79,
+ 133,88,137,105,137,122,213,137,17,2,42,93,4,110,29,16,107,137,251,124,137,55,
+ 14,81,21,15,95,31,255,79,191,225,0,48,27,7,9,239,240,175,207,35,203,20,28,194,
+ 144,126,117,1,128,224,137,43,25,244,151,3,255,129,17,129,224,40,46,51,36,247,
+ 144,145,48,21,4,17,240,49,224,223,5,192,128,145,49,25,4,56,47,87,144,145,50,23,
+ 8,33,23,4,44,49,6,255,47,131,47,144,224,160,224,176,255,224,220,1,153,39,136,
+ 39,226,255,46,255,36,0,224,16,224,232,255,42,249,42,10,43,27,43,193,255,44,162,
+ 224,218,46,170,36,170,255,148,186,44,136,36,153,36,247,255,224,111,46,113,44,
+ 108,14,125,255,30,46,1,8,148,65,28,81,187,28,198,43,5,163,1,38,43,9,47,255,129,
+ 56,133,239,239,47,63,62,255,7,233,240,34,21,51,5,104,255,240,42,21,59,5,80,244,
+ 210,255,1,243,1,134,224,1,144,13,255,146,129,80,225,247,169,128,186,247,128,70,
+ 1,25,2,81,244,137,133,255,154,133,171,133,188,133,232,22,255,249,6,10,7,27,7,
+ 12,240,253,70,91,0,193,28,209,28,240,224,255,207,22,255,225,223,6,105,246,90,
+ 21,3,107,119,17,180,1,91,31,96,29,1,241,112,29,1,65,19,239,19,192,144,107,3,
+ 191,208,144,108,3,4,193,21,14,6,255,193,8,148,129,28,145,28,32,255,224,130,22,
+ 47,225,146,6,24,255,240,129,44,226,224,158,46,196,255,1,96,224,112,224,67,231,
+ 82,239,224,32,224,49,215,4,128,145,107,255,3,144,145,108,3,143,95,159,255,79,9,
+ 244,226,192,227,231,242,255,224,15,239,31,239,129,145,8,255,39,128,47,130,149,
+ 128,39,8,127,46,134,149,134,149,128,37,7,2,255,128,37,135,112,0,46,1,47,255,
+ 134,149,7,148,135,149,16,45,247,8,39,6,7,2,37,8,39,179,255,224,227,55,251,7,33,
+ 247,1,255,21,17,5,17,244,16,224,131,205,192,141,2,100,230,219,54,9,2,184,1,246,
+ 213,10,163,192,193,6,52,19,137,43,87,9,240,109,13,4,107,65,8,96,167,0,241,112,
+ 167,0,5,15,71,18,1,47,15,95,255,247,1,128,129,64,145,109,3,127,80,145,110,3,96,
+ 145,111,45,0,255,112,3,72,15,81,29,97,29,171,113,29,41,2,42,201,5,110,53,16,30,
+ 255,95,224,47,240,224,237,88,253,215,79,96,129,21,2,112,89,8,194,21,253,225,23,
+ 8,224,128,31,95,241,46,111,14,45,19,192,53,14,239,45,51,10,251,243,148,53,22,1,
+ 80,0,35,89,247,247,30,13,197,6,109,20,24,63,255,88,244,225,46,255,36,131,231,
+ 255,146,224,232,14,249,30,215,1,255,140,145,143,63,9,240,140,207,134,33,2,110,
+ 230,247,59,241,50,233,26,225,14,174,255,21,128,145,113,2,144,145,114,255,2,136,
+ 22,153,6,9,240,244,255,206,16,146,115,3,8,148,193,255,28,209,28,208,146,108,3,
+ 192,219,146,107,45,4,103,225,89,11,113,2,241,112,45,0,103,38,133,54,14,148,164,
+ 16,239,171,1,188,1,125,14,44,21,59,253,192,127,10,137,43,169,241,128,145,255,
+ 46,2,139,55,137,245,144,145,255,47,2,128,224,32,145,44,2,255,48,224,130,43,147,
+ 43,14,148,215,199,3,38,41,16,1,41,4,140,48,247,225,244,128,35,0,130,50,193,244,
+ 246,83,2,100,231,163,2,247,21,135,236,255,14,148,184,2,40,154,120,148,180,97,0,
+ 139,4,105,25,8,4,192,47,2,128,255,147,198,1,16,146,45,2,16,253,146,59,0,228,
+ 238,226,242,224,223,255,1,29,146,138,149,233,247,18,255,192,129,47,129,84,138,
+ 49,80,255,244,31,113,128,145,199,1,128,255,126,129,15,128,147,199,1,14,255,148,
+ 190,4,4,192,17,50,20,255,240,14,148,81,3,14,148,218,255,12,136,35,9,244,233,
+ 192,240,255,144,120,3,128,145,116,3,144,191,145,117,3,137,43,57,133,4,96,181,
+ 232,41,7,16,107,0,198,1,39,0,240,235,13,193,23,2,99,23,8,180,225,191,255,21,16,
+ 244,116,225,247,46,128,107,145,200,31,0,121,53,4,102,232,95,11,85,118,177,4,
+ 112,63,9,194,93,21,119,27,24,191,0,224,16,224,18,192,33,14,248,127,1,231,88,
+ 252,79,96,129,37,22,255,15,95,31,79,15,21,96,243,222,21,2,14,148,109,20,177,14,
+ 9,240,183,135,192,129,19,0,112,5,91,15,9,255,244,89,192,16,145,120,3,30,255,95,
+ 128,145,115,3,136,35,81,255,244,14,148,142,4,96,147,109,255,3,112,147,110,3,
+ 128,147,111,159,3,144,147,112,3,19,2,203,3,128,251,145,109,75,0,110,3,160,145,
+ 111,255,3,176,145,112,3,72,27,89,255,11,106,11,123,11,79,63,81,127,5,97,5,113,
+ 5,76,244,69,2,255,144,224,1,150,129,15,145,29,223,137,63,145,5,128,67,1,240,3,
+ 170,83,34,64,175,0,96,183,0,32,49,0,226,255,47,240,224,237,88,253,79,64,255,
+ 131,47,95,32,147,115,3,48,255,224,45,88,61,79,71,231,83,127,224,201,1,186,1,65,
+ 47,217,2,211,130,2,91,2,161,3,115,133,1,119,3,239,133,255,29,192,7,2,135,253,
+ 25,221,192,189,3,133,253,21,27,5,105,232,252,253,7,27,2,134,255,2,192,128,232,
+ 189,4,39,4,143,113,128,108,111,2,64,174,29,0,251,13,128,7,9,231,147,1,161,255,
+ 241,14,148,115,13,136,35,129,217,241,29,7,69,2,97,233,161,11,232,1,246,161,31,
+ 102,233,99,10,231,1,129,54,255,17,240,128,224,1,192,128,226,255,144,145,233,1,
+ 153,35,17,240,255,144,100,137,43,106,238,113,224,121,64,59,0,107,2,16,146,231,
+ 1,111,6,255,100,150,15,182,248,148,222,191,255,15,190,205,191,207,145,223,145,
+ 255,31,145,15,145,255,144,239,144,255,223,144,207,144,191,144,175,144,255,159,
+ 144,143,144,127,144,111,144,255,95,144,79,144,63,144,47,144,255,8,149,207,146,
+ 223,146,239,146,255,255,146,15,147,31,147,223,147,255,207,147,0,208,205,183,
+ 222,183,222,131,2,64,224,81,238,207,2,14,148,227,174,18,247,4,177,8,195,2,97,
+ 15,136,127,35,169,240,249,153,254,207,149,0,255,224,146,189,129,189,248,154,
+ 128,95,181,128,147,199,1,19,2,129,19,20,191,200,1,8,192,129,228,27,2,132,253,
+ 237,13,2,14,148,190,4,40,154,247,136,224,97,71,0,80,17,143,233,255,14,148,157,
+ 2,30,188,13,180,191,7,254,253,207,62,181,9,10,46,255,181,147,47,128,224,40,154,
+ 120,255,148,48,224,130,43,147,43,128,127,82,144,66,9,240,99,192,125,2,237,184,
+ 47,12,142,181,33,2,16,146,108,255,3,16,146,107,3,143,239,158,255,225,144,147,
+ 114,2,128,147,113,255,2,0,224,18,224,63,239,227,255,46,62,225,243,46,110,1,8,
+ 255,148,193,28,209,28,200,1,104,255,239,112,224,166,1,34,224,48,254,69,0,196,2,
+ 137,129,154,129,47,255,239,143,63,146,7,57,240,1,255,150,144,147,108,3,128,147,
+ 107,255,3,120,1,5,192,200,1,1,255,151,232,22,249,6,49,240,15,255,95,31,79,143,
+ 225,0,48,24,255,7,1,247,240,146,114,2,224,183,146,113,2,13,3,103,234,191,11,
+ 113,79,2,112,145,114,19,4,193,7,64,193,5,255,96,226,14,148,101,20,96,145,191,
+ 107,3,112,145,108,3,29,14,81,223,21,14,148,240,3,7,0,3,15,247,144,15,144,163,
+ 27,8,149,42,152,252,219,14,9,14,42,154,128,145,196,3,255,133,48,9,240,110,192,
+ 140,181,255,129,96,140,189,42,152,128,235,243,142,189,43,11,63,15,128,224,42,
+ 154,255,44,181,46,127,44,189,56,43,255,128,145,198,3,136,35,113,244,255,144,
+ 145,197,3,153,35,81,240,254,15,2,232,47,240,224,234,88,252,255,79,144,131,143,
+ 95,128,147,198,245,3,19,18,48,19,12,116,3,144,145,255,117,3,131,39,40,47,34,
+ 149,255,40,39,2,46,38,149,38,149,251,32,37,7,2,32,37,39,112,8,255,46,137,47,38,
+ 149,7,148,39,191,149,144,45,130,39,6,7,2,37,95,130,39,144,147,117,63,1,116,61,
+ 0,247,120,3,32,85,0,144,224,4,150,222,187,1,23,147,7,44,121,4,135,52,255,8,244,
+ 140,192,42,152,130,232,222,183,10,142,181,141,224,11,14,42,154,251,8,149,229,2,
+ 135,255,46,192,224,248,67,0,11,2,143,2,196,3,129,80,237,183,95,232,15,163,6,
+ 224,129,157,10,142,246,157,100,58,192,87,18,131,48,25,241,255,132,48,44,244,
+ 136,35,153,240,255,129,48,89,245,22,192,137,48,255,25,240,138,48,49,245,2,192,
+ 215,237,226,36,135,0,118,107,0,120,3,111,142,239,137,27,49,2,27,192,125,10,119,
+ 232,47,21,11,12,233,47,15,215,52,191,234,234,42,152,136,235,17,14,142,127,47,
+ 144,224,128,80,152,68,251,30,214,225,3,66,192,65,31,36,65,9,160,241,243,132,
+ 224,135,2,33,2,131,52,48,240,239,129,224,144,224,119,15,119,3,134,251,255,18,
+ 61,0,195,3,40,47,48,255,224,201,1,143,113,144,112,79,247,151,73,240,25,2,144,
+ 224,130,39,123,147,39,17,2,137,43,137,244,185,10,223,137,43,9,240,78,229,0,193,
+ 3,255,240,145,194,3,48,151,9,244,127,71,192,128,224,9,149,80,37,5,255,132,48,
+ 17,240,128,224,8,149,247,16,146,120,113,4,128,147,198,3,239,143,239,159,239,
+ 113,10,32,145,197,191,3,34,35,217,240,130,137,101,133,196,201,4,55,25,237,19,
+ 19,123,2,111,2,175,239,255,191,239,128,147,189,3,144,147,255,190,3,160,147,191,
+ 3,176,147,111,192,3,129,224,49,11,17,245,27,3,191,136,35,241,244,30,188,59,6,
+ 14,79,180,0,252,23,145,53,69,11,197,137,0,249,118,75,6,3,0,152,47,134,253,5,
+ 247,192,144,126,65,3,143,113,152,15,175,144,147,119,3,27,15,17,109,1,9,121,149,
+ 255,18,69,11,32,145,118,3,3,103,245,134,3,35,227,169,18,8,149,136,35,255,25,
+ 244,45,224,50,232,2,192,175,45,227,50,232,43,22,46,41,20,31,255,147,24,47,64,
+ 147,120,3,41,251,231,51,253,1,80,224,14,148,130,255,2,129,47,14,148,155,13,31,
+ 255,145,8,149,42,154,34,154,138,219,224,97,21,0,118,17,7,6,80,17,93,139,7,8,
+ 140,224,96,7,4,141,15,8,255,128,229,140,189,141,181,129,96,151,141,189,130,25,
+ 8,130,57,8,101,2,22,255,47,128,147,195,3,64,147,197,127,3,14,148,10,14,42,152,
+ 119,11,91,142,181,9,14,42,154,169,22,133,127,21,207,42,152,136,235,15,14,53,10,
+ 10,192,250,75,42,130,123,0,202,17,137,43,121,255,243,97,47,112,224,228,224,102,
+ 255,15,119,31,234,149,225,247,103,191,108,112,104,42,152,126,73,12,110,182,99,
+ 20,134,234,99,14,128,228,127,22,134,181,236,15,14,134,155,24,132,233,15,14,130,
+ 213,234,27,22,130,55,16,140,27,20,144,145,255,197,3,153,35,225,240,42,152,237,
+ 138,35,16,131,232,35,18,137,47,144,191,224,158,108,42,152,158,19,8,46,109,181,
+ 29,10,26,192,55,22,139,232,119,22,13,142,27,16,141,226,175,24,111,44,103,1,203,
+ 16,107,128,229,27,22,140,55,16,135,231,27,22,83,128,238,159,31,81,8,236,25,42,
+ 128,25,16,253,137,111,21,132,224,128,147,196,3,255,128,145,195,3,144,224,143,
+ 113,255,144,112,137,43,65,240,128,224,127,109,237,123,224,64,224,80,219,1,223,
+ 204,15,3,192,128,7,0,239,15,254,35,2,31,145,8,149,239,146,255,255,146,15,147,
+ 31,147,207,147,223,255,147,232,46,79,239,95,239,32,255,226,48,224,249,153,254,
+ 207,50,255,189,33,189,248,154,128,181,72,255,39,132,47,130,149,132,39,8,127,46,
+ 134,149,134,149,128,37,7,2,255,128,37,135,112,4,46,69,47,255,134,149,7,148,135,
+ 149,80,45,247,72,39,6,7,2,37,72,39,47,255,95,63,79,32,52,49,5,9,191,240,221,
+ 207,69,43,17,125,0,50,255,192,0,224,255,36,16,224,192,187,226,208,87,4,210,189,
+ 193,87,0,96,255,181,17,35,17,244,6,47,12,255,192,17,48,17,244,246,46,8,255,192,
+ 102,35,81,240,238,32,33,239,240,140,229,148,161,0,101,20,31,127,95,33,150,30,
+ 49,49,247,19,14,255,109,20,96,47,112,224,246,224,255,117,149,103,149,250,149,
+ 225,247,255,128,47,79,45,14,148,46,14,255,128,47,143,113,223,145,207,145,255,
+ 31,145,15,145,255,144,239,144,255,8,149,130,48,0,245,232,47,255,240,224,238,15,
+ 255,31,233,83,255,252,79,113,131,96,131,136,35,255,25,240,129,48,161,244,8,192,
+ 255,128,145,105,0,140,127,132,43,255,128,147,105,0,232,154,8,149,94,15,2,68,15,
+ 85,31,3,2,131,23,8,219,233,154,69,2,128,244,53,6,33,244,255,2,192,232,152,1,
+ 192,233,152,254,85,18,17,130,16,130,8,149,31,255,146,15,146,15,182,15,146,17,
+ 255,36,47,147,63,147,79,147,95,255,147,111,147,127,147,143,147,159,255,147,175,
+ 147,191,147,239,147,255,255,147,128,145,199,3,144,145,200,191,3,137,43,41,240,
+ 224,11,0,240,254,11,0,9,149,255,145,239,145,191,255,145,175,145,159,145,143,
+ 145,127,255,145,111,145,95,145,79,145,63,255,145,47,145,15,144,15,190,15,175,
+ 144,31,144,24,89,68,201,89,0,202,202,89,8,201,89,0,202,89,96,81,10,128,145,253,
+ 207,77,0,208,3,160,145,209,3,255,176,145,210,3,48,145,211,3,255,1,150,161,29,
+ 177,29,35,47,255,45,95,45,55,32,240,45,87,126,15,6,32,147,211,3,128,147,45,0,
+ 245,147,45,0,147,45,0,147,210,3,128,171,145,203,61,0,204,61,0,205,61,0,206,86,
+ 57,8,128,147,21,0,147,21,0,147,21,0,231,147,206,3,151,10,143,22,143,183,248,
+ 171,148,32,125,0,48,125,0,64,125,0,80,254,125,0,143,191,185,1,202,1,8,63,149,
+ 155,1,172,1,127,31,0,95,26,255,102,181,168,155,5,192,111,63,251,25,240,105,6,
+ 127,191,186,47,169,255,47,152,47,136,39,134,15,145,253,29,17,2,98,224,136,15,
+ 153,31,255,170,31,187,31,106,149,209,247,95,188,1,45,192,255,71,32,230,71,4,85,
+ 239,71,12,255,71,12,142,71,8,226,71,12,253,234,71,0,134,27,151,11,136,94,255,
+ 147,64,200,242,33,80,48,64,255,64,64,80,64,104,81,124,79,255,33,21,49,5,65,5,
+ 81,5,255,113,246,8,149,1,151,57,240,252,49,2,3,2,2,151,1,151,241,247,255,8,149,
+ 120,148,132,181,130,96,95,132,189,132,181,129,5,0,133,11,0,245,133,5,0,129,5,0,
+ 238,230,240,224,255,128,129,129,96,128,131,225,232,127,240,224,16,130,128,129,
+ 130,11,0,86,17,6,224,232,27,12,235,9,2,132,19,2,205,235,19,10,234,231,19,10,51,
+ 18,128,129,255,128,104,128,131,16,146,193,0,255,8,149,72,47,80,224,202,1,255,
+ 139,87,155,79,252,1,36,145,255,79,88,91,79,250,1,132,145,255,136,35,193,240,
+ 232,47,240,224,255,238,15,255,31,237,90,251,79,255,165,145,180,145,102,35,65,
+ 244,253,159,29,1,140,145,32,149,130,35,191,140,147,159,191,8,149,15,6,130,153,
+ 43,13,6,75,6,135,86,75,6,85,10,148,254,85,8,52,145,51,35,9,244,64,255,192,34,
+ 35,81,241,35,48,113,255,240,36,48,40,244,33,48,161,255,240,34,48,17,245,20,192,
+ 38,191,48,177,240,39,48,193,21,0,217,255,244,4,192,128,145,128,0,143,251,119,3,
+ 7,6,125,128,147,128,0,127,16,192,132,181,143,119,2,5,2,175,125,132,189,9,25,0,
+ 176,33,8,176,174,33,4,176,0,227,175,8,227,175,8,47,254,155,0,102,35,33,244,140,
+ 145,144,255,149,137,35,2,192,140,145,137,250,167,0,47,167,0,104,47,112,224,203,
+ 250,167,12,203,167,8,68,145,111,88,123,251,79,251,175,0,153,35,25,244,32,239,
+ 224,48,224,60,171,172,137,47,144,13,224,251,3,137,89,121,2,173,2,85,1,113,0,
+ 223,132,35,17,240,33,7,0,201,1,255,8,149,8,149,31,146,15,146,255,15,182,15,146,
+ 17,36,47,147,255,63,147,79,147,143,147,159,147,255,239,147,255,147,64,145,198,
+ 0,255,32,145,20,4,48,145,21,4,255,47,95,63,79,47,115,48,112,255,128,145,22,4,
+ 144,145,23,4,127,40,23,57,7,89,240,224,29,0,253,240,29,0,236,82,252,79,64,131,
+ 255,48,147,21,4,32,147,20,4,255,255,145,239,145,159,145,143,145,255,79,145,63,
+ 145,47,145,15,144,255,15,190,15,144,31,144,24,149,247,224,145,104,45,0,105,4,
+ 224,92,255,255,79,129,145,145,145,32,129,255,49,129,130,27,147,11,143,115,255,
+ 144,112,137,43,17,240,14,148,251,29,18,141,30,95,147,111,147,127,238,147,4,175,
+ 147,191,151,4,32,145,88,190,147,0,89,4,128,145,90,139,0,91,190,139,4,49,244,
+ 128,145,193,245,4,193,175,0,22,192,224,25,0,240,25,0,232,223,94,251,79,64,129,
+ 39,10,1,150,255,96,228,112,224,14,148,61,22,255,144,147,91,4,128,147,90,4,239,
+ 64,147,198,0,173,2,191,145,175,190,177,4,127,145,111,145,95,183,28,175,255,146,
+ 191,146,223,146,239,146,255,255,146,15,147,31,147,207,147,223,255,147,236,1,
+ 122,1,139,1,221,255,36,64,48,129,238,88,7,128,251,224,104,3,0,120,7,17,240,221,
+ 255,36,211,148,145,224,169,46,177,255,44,236,137,253,137,221,32,105,127,240,
+ 197,1,14,140,2,192,131,3,255,10,148,226,247,128,131,96,224,255,121,224,141,227,
+ 144,224,5,192,255,16,130,96,232,116,232,142,225,255,144,224,168,1,151,1,14,148,
+ 255,80,22,33,80,48,64,64,64,255,80,64,86,149,71,149,55,149,255,39,149,128,225,
+ 32,48,56,7,239,32,240,221,32,89,2,214,207,232,255,137,249,137,48,131,234,137,
+ 251,255,137,32,131,238,137,255,137,64,117,129,195,7,10,97,16,72,43,64,27,8,215,
+ 201,1,11,23,40,12,23,32,128,129,221,13,21,0,34,15,51,21,4,32,149,255,40,35,32,
+ 131,223,145,207,145,255,31,145,15,145,255,144,239,144,255,223,144,191,144,175,
+ 144,8,149,255,220,1,28,150,237,145,252,145,251,29,151,197,3,33,145,49,145,128,
+ 255,129,145,129,40,27,57,11,47,159,115,48,112,201,1,33,26,227,3,224,255,84,240,
+ 64,223,1,174,91,191,127,79,141,145,156,145,17,151,175,3,255,25,244,47,239,63,
+ 239,7,192,254,17,2,232,15,249,31,128,129,40,153,47,203,2,63,86,16,192,17,6,65,
+ 2,32,253,129,11,6,1,150,143,115,144,112,191,17,150,156,147,142,147,81,6,252,
+ 255,1,134,133,151,133,220,1,160,255,92,191,79,252,1,238,91,255,143,79,45,145,
+ 60,41,0,185,4,75,0,193,247,247,8,149,213,7,70,47,238,133,227,255,133,119,2,27,
+ 2,119,2,1,150,96,255,228,112,224,14,148,61,22,156,13,1,131,26,209,243,41,18,
+ 131,2,75,1,63,8,251,49,131,163,7,32,129,129,224,144,123,224,13,113,17,40,43,32,
+ 131,19,2,254,93,3,8,149,16,146,95,4,16,255,146,94,4,136,238,147,224,160,255,
+ 224,176,224,128,147,96,4,144,255,147,97,4,160,147,98,4,176,255,147,99,4,137,
+ 235,145,224,144,255,147,93,4,128,147,92,4,132,235,237,147,11,0,105,11,0,104,4,
+ 136,235,225,148,11,0,107,11,0,106,4,133,235,236,144,11,0,109,11,0,108,4,132,
+ 186,11,4,111,11,0,110,4,128,11,4,113,174,11,0,112,4,129,11,4,115,11,0,114,235,
+ 4,134,11,4,117,11,0,116,4,132,238,113,0,118,4,131,5,0,119,4,135,238,5,0,120,4,
+ 133,5,0,121,4,129,246,5,0,122,4,23,7,14,148,21,17,254,3,0,11,194,229,210,225,
+ 14,148,255,127,5,32,151,225,243,14,148,255,82,18,249,207,207,146,223,146,255,
+ 239,146,255,146,15,147,31,147,254,41,2,124,1,107,1,138,1,192,255,224,208,224,
+ 15,192,214,1,109,223,145,109,1,215,1,203,3,1,144,255,240,129,224,45,199,1,9,
+ 149,255,200,15,217,31,1,80,16,64,255,1,21,17,5,113,247,206,1,254,5,3,31,145,15,
+ 145,255,144,239,159,144,223,144,207,144,255,3,49,14,9,183,149,8,149,95,10,140,
+ 1,25,18,109,191,224,9,149,124,1,216,17,16,200,251,1,106,19,0,156,1,46,13,63,
+ 103,29,201,1,83,10,63,14,124,1,89,22,255,140,1,199,1,14,148,109,20,159,8,15,25,
+ 31,200,47,16,199,2,219,255,1,13,144,0,32,233,247,17,255,151,166,27,183,11,236,
+ 1,232,191,129,249,129,2,128,243,55,0,173,252,195,0,185,7,79,146,95,146,127,146,
+ 255,143,146,159,146,175,146,191,146,250,9,19,223,11,1,205,183,222,183,161,255,
+ 151,15,182,248,148,222,191,15,255,190,205,191,44,1,116,46,203,255,1,34,48,8,
+ 244,42,224,25,255,162,49,226,195,46,209,44,204,255,14,221,30,130,46,153,36,170,
+ 255,36,187,36,103,45,117,47,165,187,1,148,145,0,80,22,121,67,1,200,247,1,183,1,
+ 15,6,10,22,71,45,255,70,27,8,148,193,8,209,8,255,74,48,20,244,64,93,1,192,255,
+ 73,92,246,1,64,131,225,20,255,241,4,1,5,17,5,33,240,247,126,44,95,255,0,221,
+ 207,194,1,189,182,49,0,165,20,161,150,121,14,207,251,145,223,97,21,191,144,175,
+ 144,159,255,144,143,144,127,144,95,144,79,126,111,5,33,21,49,5,65,244,27,15,
+ 123,100,47,119,3,14,148,185,20,61,19,239,14,148,29,21,51,11,156,1,32,247,15,49,
+ 31,101,35,154,1,123,1,127,0,224,16,224,184,1,167,49,4,212,87,17,33,17,108,37,0,
+ 154,39,20,140,1,225,198,141,33,175,2,57,22,157,3,236,1,106,240,63,0,181,6,153,
+ 3,181,14,31,192,42,48,255,49,5,209,244,119,255,23,192,246,25,14,109,226,237,3,
+ 68,39,85,39,255,186,1,76,25,93,9,110,9,191,127,9,206,1,42,224,225,2,152,127,1,
+ 40,15,57,31,4,192,13,6,143,156,1,201,1,221,3,127,22,3,19,110,252,3,65,219,4,39,
+ 247,252,0,149,16,5,47,223,6,110,7,55,43,24,11,51,221,3,145,22,243,165,20,145,
+ 10,47,22,8,149,98,159,255,208,1,115,159,240,1,130,159,223,224,13,241,29,100,5,
+ 4,146,159,87,240,13,131,3,0,116,3,0,101,3,0,255,153,39,114,159,176,13,225,29,
+ 247,249,31,99,7,8,189,1,207,1,255,17,36,8,149,170,27,187,27,255,81,225,7,192,
+ 170,31,187,31,255,166,23,183,7,16,240,166,27,255,183,11,136,31,153,31,90,149,
+ 255,169,247,128,149,144,149,188,1,255,205,1,8,149,151,251,9,46,255,7,38,10,208,
+ 119,253,4,208,255,229,223,6,208,0,32,26,244,255,112,149,97,149,127,79,8,149,
+ 127,246,247,144,149,129,149,159,9,0,239,161,226,26,46,81,2,253,1,13,254,81,4,
+ 238,31,255,31,162,23,179,255,7,228,7,245,7,32,240,162,255,27,179,11,228,11,245,
+ 11,102,247,31,119,31,97,2,26,148,105,247,239,96,149,112,149,101,2,155,1,172,
+ 253,1,147,2,8,149,238,15,255,31,255,5,144,244,145,224,45,9,148,255,248,148,255,
+ 207,67,117,114,114,255,101,110,116,32,99,111,110,102,255,105,103,117,114,97,
+ 116,105,111,255,110,58,0,68,70,32,69,32,238,5,2,83,32,0,1,0,105,0,32,239,103,0,
+ 32,64,9,0,77,72,122,251,32,0,44,6,32,115,97,118,101,255,32,102,97,105,108,101,
+ 100,0,127,62,32,0,116,101,115,116,33,0,247,100,102,35,5,0,58,32,0,114,191,58,
+ 32,112,97,103,101,70,4,67,207,63,32,0,82,9,4,5,6,87,0,239,101,114,97,115,55,0,
+ 79,75,0,239,32,63,0,71,49,0,45,62,32,247,97,99,107,7,4,0,32,98,0,255,10,91,82,
+ 70,49,50,100,101,223,109,111,46,56,93,50,2,73,32,255,0,59,1,177,1,100,3,147,
+ 251,3,0,0,0,160,19,59,20,52,255,19,101,19,69,19,142,19,0,128,4,255,17,36,132,
+ 183,20,190,129,255,255,240,208,133,224,128,147,129,0,253,130,5,0,192,0,136,225,
+ 128,147,119,193,0,134,11,0,194,0,128,11,0,255,196,0,142,224,201,208,37,154,255,
+ 134,224,32,227,60,239,145,224,255,48,147,133,0,32,147,132,0,255,150,187,176,
+ 155,254,207,29,154,255,168,149,129,80,169,247,204,36,255,221,36,136,36,131,148,
+ 181,224,255,171,46,161,225,154,46,243,224,255,191,46,162,208,129,52,97,244,255,
+ 159,208,8,47,175,208,2,56,255,17,240,1,56,17,244,132,224,255,1,192,131,224,141,
+ 208,137,192,251,130,52,13,0,225,3,192,133,52,255,25,244,133,224,166,208,128,
+ 192,255,133,53,121,244,136,208,232,46,247,255,36,133,51,0,16,224,16,47,255,0,
+ 39,14,41,31,41,0,15,255,17,31,142,208,104,1,111,192,247,134,53,33,65,0,144,208,
+ 128,224,255,222,207,132,54,9,240,64,192,215,112,208,111,43,0,109,17,0,200,22,
+ 255,128,231,216,6,24,244,246,1,255,183,190,232,149,192,224,209,224,255,98,208,
+ 137,147,12,23,225,247,255,240,224,207,22,240,231,223,6,251,24,240,27,6,104,208,
+ 7,182,0,255,252,253,207,166,1,160,224,177,255,224,44,145,48,224,17,150,140,255,
+ 145,17,151,144,224,152,47,136,255,39,130,43,147,43,18,150,250,239,1,12,1,135,
+ 43,0,17,36,78,255,95,95,79,241,224,160,56,191,63,7,81,247,246,1,167,19,0,61,6,
+ 253,151,9,0,38,192,132,55,177,244,255,46,208,45,208,248,46,43,208,255,60,208,
+ 246,1,239,44,143,1,255,15,95,31,79,132,145,27,208,255,234,148,248,1,193,247,8,
+ 148,255,193,28,209,28,250,148,207,12,255,209,28,14,192,133,55,57,244,255,40,
+ 208,142,225,12,208,133,233,255,10,208,143,224,122,207,129,53,255,17,244,136,
+ 224,24,208,29,208,255,128,225,1,208,101,207,152,47,255,128,145,192,0,133,255,
+ 252,207,191,144,147,198,0,8,149,13,2,135,124,13,0,7,2,132,253,1,192,168,17,0,
+ 254,23,2,224,230,240,224,152,225,144,255,131,128,131,8,149,237,223,128,255,50,
+ 25,240,136,224,245,223,255,255,207,132,225,222,207,31,147,24,255,47,227,223,17,
+ 80,233,247,242,247,223,31,145,67,0,224,232,223,238,191,39,255,39,9,148,255,0,
+ 12,4,1,4,158,15,127,12,148,52,60,12,148,81,3,188,255,17,36,31,190,207,239,216,
+ 224,255,222,191,205,191,17,224,160,224,255,177,224,236,233,255,231,2,192,255,5,
+ 144,13,146,162,48,177,7,223,217,247,18,224,162,21,0,1,192,247,29,146,173,15,0,
+ 225,247,14,148,255,45,61,12,148,204,63,12,148,223,0,60,152,47,149,0,8,144,93,
+ 255,143,112,138,48,124,240,40,47,255,41,90,128,145,192,0,133,255,191,252,207,
+ 144,147,198,0,11,10,32,254,11,0,8,149,40,47,32,93,240,247,207,152,47,33,18,8,
+ 149,239,146,255,255,146,15,147,31,147,238,36,239,255,36,135,1,27,2,135,253,23,
+ 255,192,8,148,225,28,241,28,1,255,29,17,29,129,228,232,22,130,255,228,248,6,
+ 143,224,8,7,128,255,224,24,7,112,243,224,145,4,127,1,240,145,5,1,9,149,45,4,
+ 255,255,233,207,128,145,198,0,31,255,145,15,145,255,144,239,144,8,223,149,14,
+ 148,118,60,101,22,145,54,255,44,244,144,51,12,240,144,83,191,137,47,8,149,151,
+ 85,5,2,31,127,147,14,148,159,60,24,47,5,2,255,18,149,16,127,129,15,31,145,126,
+ 21,2,24,47,136,35,33,240,67,2,207,17,80,225,247,19,10,15,2,128,50,255,73,240,
+ 128,145,3,1,143,95,255,128,147,3,1,133,48,193,240,92,29,2,103,10,132,225,128,
+ 241,16,16,11,16,65,128,25,4,43,2,185,14,13,2,83,6,65,83,20,227,129,240,81,42,
+ 69,6,67,18,8,149,64,255,233,81,224,136,35,161,240,45,255,154,40,238,51,224,250,
+ 1,49,255,151,241,247,33,80,48,64,209,247,247,45,152,17,26,129,80,97,247,255,8,
+ 149,63,146,79,146,95,146,255,111,146,127,146,143,146,159,146,255,175,146,191,
+ 146,207,146,223,146,126,131,11,207,147,223,147,0,0,105,2,127,196,0,16,146,197,
+ 0,136,9,0,255,193,0,134,224,128,147,194,0,255,80,152,88,154,37,154,129,224,255,
+ 14,148,20,61,36,225,242,46,255,158,225,233,46,133,233,216,46,255,15,224,192,46,
+ 16,225,177,46,255,170,36,163,148,177,228,155,46,255,166,229,138,46,242,229,127,
+ 46,255,224,226,110,46,121,228,87,46,255,99,229,70,46,80,229,53,46,254,237,4,51,
+ 177,241,129,51,185,241,127,128,52,9,244,111,192,129,5,0,119,118,192,130,5,0,
+ 133,192,133,5,0,255,136,192,128,53,49,241,130,53,255,33,241,129,53,17,241,133,
+ 53,250,23,2,134,5,0,141,192,132,54,9,255,244,150,192,132,55,9,244,3,187,193,
+ 133,5,0,114,193,134,5,0,102,205,192,57,19,121,246,25,15,107,6,81,246,191,14,
+ 148,243,60,195,207,187,9,247,86,73,11,240,146,85,15,144,11,16,128,11,16,85,112,
+ 11,16,96,11,16,80,11,16,64,11,16,213,48,11,16,176,11,0,136,117,4,134,56,167,8,
+ 244,189,9,4,137,2,126,137,6,56,223,9,244,156,192,129,5,0,11,193,253,130,5,0,60,
+ 193,136,57,9,244,119,143,192,128,89,1,199,60,108,245,1,247,14,148,189,47,4,102,
+ 207,133,224,186,11,10,96,59,6,147,6,1,7,6,7,245,1,21,2,85,21,6,51,9,244,29,211,
+ 193,131,43,4,69,6,73,45,8,9,2,254,7,6,8,2,128,145,12,2,142,207,127,128,147,12,
+ 17,4,109,3,21,193,255,128,145,8,2,144,145,9,2,255,137,43,137,240,0,224,16,224,
+ 254,25,2,248,1,232,95,254,79,128,223,131,15,95,31,79,31,10,8,23,239,25,7,136,
+ 243,69,7,9,240,69,253,207,75,2,128,255,1,193,96,145,255,6,1,112,145,7,1,102,15,
+ 87,119,31,112,145,0,96,157,0,160,51,0,253,176,51,0,16,151,201,240,232,224,127,
+ 241,224,155,1,173,1,78,76,0,255,249,153,254,207,50,189,33,189,255,129,145,128,
+ 189,250,154,249,154,255,47,95,63,79,228,23,245,7,31,153,247,106,15,123,61,12,
+ 161,35,77,3,119,225,206,131,215,4,221,206,130,7,4,187,217,206,223,30,6,1,144,
+ 139,0,136,143,15,153,31,144,77,0,41,11,233,2,166,89,192,253,22,197,2,184,206,
+ 107,18,96,181,0,253,112,181,0,97,21,113,5,185,241,239,64,224,80,224,49,2,168,
+ 47,161,255,112,184,47,178,112,17,192,187,191,35,9,244,92,192,224,99,0,240,174,
+ 99,0,49,150,240,97,0,224,97,0,79,255,95,95,79,70,23,87,7,232,95,244,170,35,105,
+ 243,227,2,32,35,0,121,48,35,0,235,2,248,154,144,181,101,10,175,144,147,198,0,
+ 243,2,48,57,0,32,182,57,16,24,243,33,4,253,229,143,8,248,111,207,224,206,129,
+ 227,4,103,206,171,10,171,140,206,23,35,224,11,16,208,11,16,192,182,59,25,67,
+ 206,183,10,148,145,141,18,156,151,207,128,225,103,2,51,103,4,3,2,24,245,47,5,2,
+ 17,235,0,131,192,17,48,223,9,244,132,192,143,137,4,34,206,214,13,3,129,96,63,3,
+ 229,11,16,89,207,253,128,113,3,35,136,15,136,11,138,175,33,128,147,11,133,37,
+ 128,91,1,128,215,255,9,192,7,2,144,99,1,1,150,217,144,183,1,179,3,248,148,49,3,
+ 17,39,222,159,10,200,224,209,224,37,10,16,48,255,145,244,0,145,87,0,1,112,255,
+ 1,48,217,243,3,224,0,147,111,87,0,232,149,17,14,1,225,17,6,207,9,144,25,144,21,
+ 16,39,8,19,149,191,16,52,152,240,17,39,25,14,5,254,65,44,50,150,2,151,9,240,
+ 199,255,207,16,48,17,240,2,150,229,247,207,17,36,37,7,185,206,188,206,189,142,
+ 33,5,162,205,133,233,7,2,158,127,205,248,148,255,207,128,0,236,3,127,133,224,
+ 128,147,129,0,130,5,0,255,192,0,136,225,128,147,193,0,221,134,11,0,194,0,128,
+ 11,0,196,0,255,132,183,20,190,129,255,208,208,255,142,224,200,208,37,154,134,
+ 224,255,32,227,60,239,145,224,48,147,255,133,0,32,147,132,0,150,187,255,176,
+ 155,254,207,29,154,168,149,255,129,80,169,247,221,36,211,148,255,165,224,234,
+ 46,241,225,255,46,255,164,208,129,52,33,244,129,224,255,190,208,131,224,36,192,
+ 130,52,255,17,244,132,225,3,192,133,52,255,25,244,133,224,180,208,138,192,255,
+ 133,53,161,244,146,208,8,47,255,16,224,16,147,1,2,0,147,255,0,2,139,208,144,
+ 224,152,47,255,136,39,128,43,145,43,136,15,215,153,31,144,23,0,128,23,0,115,
+ 192,255,134,53,41,244,132,224,153,208,255,128,224,113,208,109,192,132,54,255,9,
+ 240,67,192,124,208,224,145,127,0,2,240,145,1,2,131,173,0,255,87,0,232,149,192,
+ 224,209,224,255,105,208,137,147,128,145,2,2,255,129,80,128,147,2,2,136,35,255,
+ 185,247,120,208,7,182,0,252,215,253,207,64,45,0,80,45,0,160,224,255,177,224,44,
+ 145,48,224,17,150,239,140,145,17,151,113,6,130,43,147,255,43,18,150,250,1,12,1,
+ 208,253,146,73,2,17,36,78,95,95,79,255,241,224,160,56,191,7,73,247,210,103,10,
+ 224,27,4,77,6,240,11,4,39,192,127,132,55,185,244,55,208,70,139,12,215,49,150,
+ 240,181,0,224,181,0,49,151,191,228,145,142,47,25,208,141,18,97,255,247,14,192,
+ 133,55,57,244,46,255,208,142,225,12,208,133,233,10,255,208,143,224,150,207,129,
+ 53,17,255,244,136,224,25,208,35,208,128,255,225,1,208,99,207,152,47,128,255,
+ 145,192,0,133,255,252,207,144,127,147,198,0,8,149,168,149,15,2,237,135,15,0,
+ 128,145,15,2,247,223,246,253,223,79,2,243,207,224,230,240,224,255,152,225,144,
+ 131,128,131,8,149,255,128,224,248,223,238,39,255,39,255,9,148,231,223,128,50,9,
+ 240,255,247,223,132,225,218,207,31,147,255,24,47,223,223,17,80,233,247,63,244,
+ 223,31,145,8,149,128,4,255,17,36,132,183,20,190,129,255,255,240,208,133,224,
+ 128,147,129,0,253,130,5,0,192,0,136,225,128,147,119,193,0,134,11,0,194,0,128,
+ 11,0,255,196,0,142,224,201,208,37,154,255,134,224,32,227,60,239,145,224,255,48,
+ 147,133,0,32,147,132,0,255,150,187,176,155,254,207,29,154,255,168,149,129,80,
+ 169,247,204,36,255,221,36,136,36,131,148,181,224,255,171,46,161,225,154,46,243,
+ 224,255,191,46,162,208,129,52,97,244,255,159,208,8,47,175,208,2,56,255,17,240,
+ 1,56,17,244,132,224,255,1,192,131,224,141,208,137,192,251,130,52,13,0,225,3,
+ 192,133,52,255,25,244,133,224,166,208,128,192,255,133,53,121,244,136,208,232,
+ 46,247,255,36,133,51,0,16,224,16,47,255,0,39,14,41,31,41,0,15,255,17,31,142,
+ 208,104,1,111,192,247,134,53,33,65,0,144,208,128,224,255,222,207,132,54,9,240,
+ 64,192,215,112,208,111,43,0,109,17,0,200,22,255,128,231,216,6,24,244,246,1,255,
+ 183,190,232,149,192,224,209,224,255,98,208,137,147,12,23,225,247,255,240,224,
+ 207,22,240,231,223,6,251,24,240,27,6,104,208,7,182,0,255,252,253,207,166,1,160,
+ 224,177,255,224,44,145,48,224,17,150,140,255,145,17,151,144,224,152,47,136,255,
+ 39,130,43,147,43,18,150,250,239,1,12,1,135,43,0,17,36,78,255,95,95,79,241,224,
+ 160,56,191,63,7,81,247,246,1,167,19,0,61,6,253,151,9,0,38,192,132,55,177,244,
+ 255,46,208,45,208,248,46,43,208,255,60,208,246,1,239,44,143,1,255,15,95,31,79,
+ 132,145,27,208,255,234,148,248,1,193,247,8,148,255,193,28,209,28,250,148,207,
+ 12,255,209,28,14,192,133,55,57,244,255,40,208,142,225,12,208,133,233,255,10,
+ 208,143,224,122,207,129,53,255,17,244,136,224,24,208,29,208,255,128,225,1,208,
+ 101,207,152,47,255,128,145,192,0,133,255,252,207,191,144,147,198,0,8,149,13,2,
+ 135,124,13,0,7,2,132,253,1,192,168,17,0,254,23,2,224,230,240,224,152,225,144,
+ 255,131,128,131,8,149,237,223,128,255,50,25,240,136,224,245,223,255,255,207,
+ 132,225,222,207,31,147,24,255,47,227,223,17,80,233,247,242,247,223,31,145,67,0,
+ 224,232,223,238,191,39,255,39,9,148,255,0,12,4,1,4,
 };
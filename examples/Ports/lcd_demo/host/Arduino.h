@@ -0,0 +1,29 @@
+// Minimal stand-ins for the Arduino API, enough to build PortsLCD.cpp on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define LOW                 0
+#define HIGH                1
+#define INPUT               0
+#define OUTPUT              1
+
+#define bit(b)              (1UL << (b))
+#define bitRead(v, b)       (((v) >> (b)) & 1)
+#define bitSet(v, b)        ((v) |= bit(b))
+#define bitClear(v, b)      ((v) &= ~bit(b))
+
+// nothing is connected to the pins, and there is no need to wait on the host
+static inline void pinMode (uint8_t, uint8_t) {}
+static inline void digitalWrite (uint8_t, uint8_t) {}
+static inline void delayMicroseconds (unsigned) {}
+
+#endif
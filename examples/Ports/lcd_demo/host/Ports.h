@@ -0,0 +1,33 @@
+// Stand-in for the I2C part of Ports.h, the bus is the mock in lcdBytes.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Ports_h
+#define Ports_h
+
+#include <Arduino.h>
+
+#define WRITE_RESULT size_t
+
+class PortI2C {
+public:
+    PortI2C (uint8_t) {}
+    uint8_t start(uint8_t addr) const;
+    void stop() const;
+    uint8_t write(uint8_t data) const;
+};
+
+// same as in Ports.h, without the reads
+class DeviceI2C {
+    const PortI2C& port;
+    uint8_t addr;
+public:
+    DeviceI2C(const PortI2C& p, uint8_t me) : port (p), addr (me << 1) {}
+    uint8_t send() const
+        { return port.start(addr); }
+    void stop() const
+        { port.stop(); }
+    uint8_t write(uint8_t data) const
+        { return port.write(data); }
+};
+
+#endif
@@ -0,0 +1,21 @@
+// The parts of the Arduino Print class used by PortsLCD.cpp and lcdBytes.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Print_h
+#define Print_h
+
+#include <Arduino.h>
+
+class Print {
+public:
+    virtual size_t write(uint8_t) = 0;
+    size_t print(const char* str) {
+        size_t n = 0;
+        while (*str)
+            n += write(*str++);
+        return n;
+    }
+    virtual void flush() {}
+};
+
+#endif
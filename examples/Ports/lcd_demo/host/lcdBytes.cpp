@@ -0,0 +1,243 @@
+// Count the I2C bytes LiquidCrystalI2C sends, with and without a frame buffer.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o lcdBytes lcdBytes.cpp
+//
+// Usage: lcdBytes [-n updates]
+//  -n updates  number of screen updates in the workload, default 1000
+//
+// The I2C bus is a mock of the MCP23008 on the LCD Plug, which counts every
+// byte on the bus, including the address byte of each transfer. The GPIO
+// pins it drives go to a model of the HD44780 display controller, which
+// latches a nibble on each falling edge of the enable pin and keeps the
+// characters written to its display RAM.
+//
+// First, the exact number of bus bytes for some flush() cases is checked,
+// using 10 bytes for each command or unbuffered character, i.e. 2 nibbles of
+// 5 bytes each, and 2 + 6 bytes per character for each run of changes. Then
+// a status screen with a clock and two readings is updated the given number
+// of times, by printing both rows in full, and by printing them into the
+// frame buffer and calling flush(). The bytes for both are printed. After
+// each step, the display must show exactly what was printed. Exits with
+// status 1 if any check failed.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../../../../PortsLCD.cpp"
+
+#define COLS    16
+#define ROWS    2
+
+// the HD44780, only what the LCD classes use for writing text
+struct Display {
+    bool eightBit;          // true until switched to 4-bit mode
+    bool haveHigh;          // the upper nibble is in, waiting for the lower
+    bool cgram;             // data goes to the character generator RAM
+    byte high, addr;
+    char ram [128];         // display RAM, rows start at 0x00, 0x40, etc
+
+    Display () : eightBit (true), haveHigh (false), cgram (false), addr (0) {
+        memset(ram, ' ', sizeof ram);
+    }
+
+    void execute (byte value, bool data) {
+        if (data) {
+            if (!cgram)
+                ram[addr] = value;
+            addr = (addr + 1) & 0x7F;
+        } else if (value & LCD_SETDDRAMADDR) {
+            addr = value & 0x7F;
+            cgram = false;
+        } else if (value & LCD_SETCGRAMADDR)
+            cgram = true;
+        else if (value & LCD_FUNCTIONSET)
+            eightBit = value & LCD_8BITMODE;
+        else if (value == LCD_CLEARDISPLAY) {
+            memset(ram, ' ', sizeof ram);
+            addr = 0;
+        } else if ((value & ~1) == LCD_RETURNHOME)
+            addr = 0;
+    }
+
+    // called on each falling edge of the enable pin
+    void latch (byte nibble, bool data) {
+        if (eightBit)
+            execute(nibble << 4, data);
+        else if (!haveHigh) {
+            high = nibble;
+            haveHigh = true;
+        } else {
+            execute(high << 4 | nibble, data);
+            haveHigh = false;
+        }
+    }
+
+    bool shows (const char* text) const {
+        static const byte offsets[] = { 0x00, 0x40, 0x14, 0x54 };
+        for (byte r = 0; r < ROWS; ++r)
+            if (memcmp(ram + offsets[r], text + r * COLS, COLS) != 0)
+                return false;
+        return true;
+    }
+};
+
+// the MCP23008, with its GPIO pins wired to the display as on the LCD Plug
+static struct Expander {
+    Display lcd;
+    long bytes;             // bytes on the bus, including address bytes
+    byte reg, iocon, gpio;
+    bool first;             // the next byte written is the register address
+
+    void start () { ++bytes; first = true; }
+
+    void write (byte value) {
+        ++bytes;
+        if (first) {
+            reg = value;
+            first = false;
+            return;
+        }
+        if (reg == MCP_IOCON)
+            iocon = value;
+        else if (reg == MCP_GPIO) {
+            if ((gpio & MCP_ENABLE) && !(value & MCP_ENABLE))
+                lcd.latch(value & 0x0F, value & MCP_REGSEL);
+            gpio = value;
+        }
+        if (!(iocon & 0x20)) // SEQOP clear, i.e. sequential mode
+            ++reg;
+    }
+} mcp;
+
+uint8_t PortI2C::start (uint8_t addr) const {
+    mcp.start();
+    return addr == 0x24 << 1;
+}
+
+void PortI2C::stop () const {}
+
+uint8_t PortI2C::write (uint8_t data) const {
+    mcp.write(data);
+    return 1;
+}
+
+static PortI2C port (4);
+static LiquidCrystalI2C lcd (port);
+static bool allOk = true;
+
+// print the two rows of text, each COLS characters long
+static void show (const char* text) {
+    for (byte r = 0; r < ROWS; ++r) {
+        char row [COLS+1];
+        memcpy(row, text + r * COLS, COLS);
+        row[COLS] = 0;
+        lcd.setCursor(0, r);
+        lcd.print(row);
+    }
+}
+
+static void check (const char* what, const char* text, long bytes,
+                    long expected) {
+    bool ok = mcp.lcd.shows(text) && bytes == expected;
+    printf("%-32s %5ld bytes%s\n", what, bytes, ok ? "" : "  FAILED");
+    allOk = allOk && ok;
+}
+
+int main (int argc, char** argv) {
+    int updates = 1000, opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+        switch (opt) {
+            case 'n': updates = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n updates]\n", argv[0]);
+                return 1;
+        }
+
+    char text [80];
+    lcd.begin(COLS, ROWS);
+
+    memset(text, ' ', COLS*ROWS);
+    text[COLS*ROWS] = 0;
+    text[0] = 'H';
+    mcp.bytes = 0;
+    lcd.setCursor(0, 0);
+    lcd.print("H");
+    check("unbuffered, one character", text, mcp.bytes, 10 + 10);
+
+    strcpy(text, "Hello, world!   second row      ");
+    static byte buf [LCD_BUFSIZE(COLS, ROWS)];
+    lcd.useBuffer(buf);
+    show(text);
+    mcp.bytes = 0;
+    lcd.flush();
+    check("first flush, all cells", text, mcp.bytes,
+            ROWS * (10 + 2 + 6 * COLS));
+
+    show(text);
+    mcp.bytes = 0;
+    lcd.flush();
+    check("same text again", text, mcp.bytes, 0);
+
+    text[4] = '0';
+    show(text);
+    mcp.bytes = 0;
+    lcd.flush();
+    check("one cell changed", text, mcp.bytes, 10 + 2 + 6);
+
+    text[7] = text[8] = text[9] = '_';
+    show(text);
+    mcp.bytes = 0;
+    lcd.flush();
+    check("run of three cells", text, mcp.bytes, 10 + 2 + 6 * 3);
+
+    text[0] = text[2] = text[COLS] = 'x';
+    show(text);
+    mcp.bytes = 0;
+    // the first call leaves one run for the second, the third has nothing
+    bool more = lcd.flush(2) && !lcd.flush(1) && !lcd.flush(1);
+    check("three runs, flush(2) + flush(1)", text, mcp.bytes,
+            3 * (10 + 2 + 6));
+    if (!more) {
+        printf("flush() did not report the changes left\n");
+        allOk = false;
+    }
+
+    // a status screen: a clock which changes every update, readings which
+    // change now and then, and a counter
+    long plain = 0, buffered = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+        lcd.useBuffer(pass ? buf : 0);
+        lcd.clear();
+        long start = mcp.bytes;
+        srand(1);
+        int temp = 215, hum = 45;
+        for (int i = 0; i < updates; ++i) {
+            if (rand() % 10 == 0)
+                temp += rand() % 3 - 1;
+            if (rand() % 20 == 0)
+                hum += rand() % 3 - 1;
+            int secs = 12 * 3600 + 34 * 60 + i;
+            snprintf(text, sizeof text, "%02d:%02d:%02d  #%-5d"
+                    "T %2d.%dC  H %2d%%  ",
+                    secs / 3600 % 24, secs / 60 % 60, secs % 60, i % 100000,
+                    temp / 10, temp % 10, hum);
+            show(text);
+            lcd.flush();
+            if (strlen(text) != COLS*ROWS || !mcp.lcd.shows(text)) {
+                printf("display differs after update %d\n", i);
+                allOk = false;
+                break;
+            }
+        }
+        (pass ? buffered : plain) = mcp.bytes - start;
+    }
+    printf("\n%d updates, unbuffered %ld bytes, buffered %ld bytes, "
+            "%.1fx less\n", updates, plain, buffered,
+            buffered ? (double) plain / buffered : 0);
+    return !allOk;
+}
@@ -0,0 +1,52 @@
+/// @dir sensor_demo
+/// Ports demo, reads out several sensors at once, overlapping their waits.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+// Each sensor is started, then collected as soon as its own conversion is
+// done, so each cycle takes as long as the slowest sensor (the Lux Plug, in
+// this case), not the sum of all of them. Time is spent in power-down mode.
+
+#include <JeeLib.h>
+#include <PortsBMP085.h>
+#include <PortsSHT11.h>
+
+PortI2C one (1);
+BMP085 psensor (one, 3); // ultra high resolution
+SHT11 hsensor (2);
+PortI2C three (3);
+LuxPlug lsensor (three, 0x39);
+
+Sensor* const sensors[] = { &psensor, &hsensor, &lsensor };
+
+ISR(WDT_vect) { Sleepy::watchdogEvent(); }
+
+void setup () {
+    Serial.begin(57600);
+    Serial.println("\n[sensor_demo]");
+    psensor.getCalibData();
+}
+
+void loop () {
+    Sensor::run(sensors, sizeof sensors / sizeof *sensors,
+                    Sleepy::loseSomeTime);
+
+    int16_t temp;
+    int32_t pres;
+    psensor.calculate(temp, pres);
+    int humi, temp2;
+    hsensor.calculateInt(humi, temp2);
+
+    Serial.print("BMP ");
+    Serial.print(temp);
+    Serial.print(' ');
+    Serial.print(pres);
+    Serial.print(" SHT ");
+    Serial.print(humi);
+    Serial.print(' ');
+    Serial.print(temp2);
+    Serial.print(" LUX ");
+    Serial.println(lsensor.calcLux());
+    Serial.flush();
+
+    Sleepy::loseSomeTime(5000);
+}
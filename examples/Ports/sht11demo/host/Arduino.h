@@ -0,0 +1,25 @@
+// Minimal stand-ins for the Arduino API, enough to build PortsSHT11.cpp on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define LOW                 0
+#define HIGH                1
+#define INPUT               0
+#define OUTPUT              1
+
+// no sensor is connected, and there is no need to wait on the host
+static inline unsigned long millis () { return 0; }
+static inline void delay (unsigned long) {}
+static inline void delayMicroseconds (unsigned) {}
+
+#endif
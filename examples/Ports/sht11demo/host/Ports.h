@@ -0,0 +1,30 @@
+// Stand-in for the Port and Sensor parts of Ports.h, with nothing connected.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Ports_h
+#define Ports_h
+
+#include <Arduino.h>
+
+class Port {
+public:
+    Port (uint8_t) {}
+    void mode(uint8_t) const {}
+    uint8_t digiRead() const { return 1; }
+    void digiWrite(uint8_t) const {}
+    void mode2(uint8_t) const {}
+    void digiWrite2(uint8_t) const {}
+};
+
+// same as in Ports.h, without run()
+class Sensor {
+protected:
+    word due;
+    void waitFor(word ms) { due = millis() + ms; }
+public:
+    virtual void start() =0;
+    word readyAt() const { return due; }
+    virtual bool collect() =0;
+};
+
+#endif
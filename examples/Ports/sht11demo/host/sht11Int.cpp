@@ -0,0 +1,86 @@
+// Compare the integer SHT11 calculations against the float versions.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o sht11Int sht11Int.cpp
+//
+// Usage: sht11Int [-b tenths]
+//  -b tenths   largest difference allowed, in tenths, default 1
+//
+// For every raw temperature reading (14 bits) and every raw humidity reading
+// (12 bits), calculateInt() is compared against calculate(), which uses
+// float as on the ATmega (where double is float too, unlike on the host,
+// which makes the float results differ by far less than a tenth). Then
+// dewpointInt() is compared against dewpoint() for every humidity from 0.1
+// to 100% and every temperature from -40 to 124 degrees, in steps of 0.1.
+// Humidities which the float version clamps to 100% are counted apart,
+// since the two versions apply the 99% limit to slightly different values.
+// For each, the largest difference and the number of results off by more
+// than the bound are printed. Exits with status 1 if any result is off by
+// more than the bound.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../../../../PortsSHT11.cpp"
+
+// difference between an integer result in tenths and a float result in units
+static double diff (int tenths, float units) {
+    return fabs(tenths - units * 10);
+}
+
+int main (int argc, char** argv) {
+    double bound = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "b:")) != -1)
+        switch (opt) {
+            case 'b': bound = atof(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-b tenths]\n", argv[0]);
+                return 1;
+        }
+
+    SHT11 sht (1);
+    double maxT = 0, maxH = 0, maxD = 0;
+    long badT = 0, badH = 0, badD = 0, clamped = 0;
+
+    for (long t = 0; t < 1L << 14; ++t)
+        for (long h = 0; h < 1L << 12; ++h) {
+            sht.meas[SHT11::TEMP] = t;
+            sht.meas[SHT11::HUMI] = h;
+            int hi, ti;
+            float hf, tf;
+            sht.calculateInt(hi, ti);
+            sht.calculate(hf, tf);
+            double dt = diff(ti, tf), dh = diff(hi, hf);
+            if (h == 0) { // the temperature does not depend on the humidity
+                if (dt > maxT) maxT = dt;
+                badT += dt > bound;
+            }
+            if (hf >= 100 || hi >= 1000) {
+                clamped += dh > bound;
+                continue;
+            }
+            if (dh > maxH) maxH = dh;
+            badH += dh > bound;
+        }
+
+    for (int h = 1; h <= 1000; ++h)
+        for (int t = -400; t <= 1240; ++t) {
+            double dd = diff(SHT11::dewpointInt(h, t),
+                                SHT11::dewpoint(h / 10.0f, t / 10.0f));
+            if (dd > maxD) maxD = dd;
+            badD += dd > bound;
+        }
+
+    printf("bound %.2f tenths\n\n", bound);
+    printf("               max diff   over bound\n");
+    printf("temperature    %8.3f %12ld\n", maxT, badT);
+    printf("humidity       %8.3f %12ld\n", maxH, badH);
+    printf("dewpoint       %8.3f %12ld\n", maxD, badD);
+    printf("\nhumidity near the 99%% limit, over bound: %ld\n", clamped);
+    return badT != 0 || badH != 0 || badD != 0;
+}
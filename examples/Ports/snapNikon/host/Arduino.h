@@ -0,0 +1,103 @@
+// Minimal stand-ins for the Arduino API, enough to build Ports.cpp on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// The pins and the time are simulated by the test program, which defines the
+// functions declared at the end. The AVR registers are plain variables, and
+// each ISR() becomes a function the test can call. TCCR2A is also defined as
+// a macro, so that Ports.cpp includes its Timer2 code, and the port output
+// registers are in hostPorts[], also defined by the test program.
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdarg.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define LOW                 0
+#define HIGH                1
+#define INPUT               0
+#define OUTPUT              1
+#define LSBFIRST            0
+#define MSBFIRST            1
+#define DEC                 10
+#define HEX                 16
+
+#define bit(b)              (1UL << (b))
+#define bitRead(v, b)       (((v) >> (b)) & 1)
+#define bitSet(v, b)        ((v) |= bit(b))
+#define bitClear(v, b)      ((v) &= ~bit(b))
+#define bitWrite(v, b, x)   ((x) ? bitSet(v, b) : bitClear(v, b))
+#define _BV(b)              (1 << (b))
+#define degrees(rad)        ((rad) * 57.295779513082320876798)
+
+#define F_CPU               16000000L
+
+// the registers used by Ports.cpp, all as plain variables
+#define REG(r)              extern volatile uint8_t r;
+REG(ADCSRA) REG(MCUCR) REG(MCUSR) REG(PORTD) REG(WDTCSR) REG(SREG)
+REG(TCCR2A) REG(TCCR2B) REG(TCNT2) REG(OCR2A) REG(TIMSK2) REG(TIFR2)
+REG(PCICR) REG(PCMSK0) REG(PCMSK1) REG(PCMSK2)
+#undef REG
+#define WDTCSR              WDTCSR
+#define TCCR2A              TCCR2A
+
+// pins 0..7 are on the first port, 8..15 on the second, and so on
+extern volatile uint8_t hostPorts [3];
+#define digitalPinToPort(p)     ((p) / 8)
+#define digitalPinToBitMask(p)  (1 << (p) % 8)
+#define portOutputRegister(x)   (hostPorts + (x))
+
+enum {
+    ADEN = 7, BODS = 6, BODSE = 5, WDRF = 3, WDCE = 4, WDE = 3, WDIE = 6,
+    WDP3 = 5, WGM21 = 1, CS20 = 0, CS21 = 1, CS22 = 2, COM2B0 = 4,
+    OCIE2A = 1, OCF2A = 1,
+};
+
+// pins 0..7 are on PCMSK2, 8..13 on PCMSK0, 14..19 on PCMSK1
+#define digitalPinToPCICR(p)    ((p) <= 19 ? &PCICR : 0)
+#define digitalPinToPCICRbit(p) ((p) <= 7 ? 2 : (p) <= 13 ? 0 : 1)
+#define digitalPinToPCMSK(p)    ((p) <= 7 ? &PCMSK2 : (p) <= 13 ? &PCMSK0 : \
+                                (p) <= 19 ? &PCMSK1 : 0)
+#define digitalPinToPCMSKbit(p) ((p) <= 7 ? (p) : (p) <= 13 ? (p) - 8 : (p) - 14)
+
+#define ISR(vector)         extern "C" void vector ()
+#define cli()
+#define sei()
+
+// the parts of the Arduino Print class used by Ports.cpp, output is dropped
+class Print {
+public:
+    virtual size_t write(uint8_t) = 0;
+    template< typename T > size_t print(T, int =DEC) { return 0; }
+    template< typename T > size_t println(T, int =DEC) { return 0; }
+    size_t println() { return 0; }
+    virtual void flush() {}
+};
+
+struct HostSerial : Print {
+    virtual size_t write(uint8_t) { return 1; }
+};
+static HostSerial Serial;
+
+// the simulated time and pins, see the test program
+unsigned long millis ();
+unsigned long micros ();
+void delay (unsigned long ms);
+void delayMicroseconds (unsigned int us);
+void pinMode (uint8_t pin, uint8_t mode);
+void digitalWrite (uint8_t pin, uint8_t value);
+int digitalRead (uint8_t pin);
+int analogRead (uint8_t pin);
+void analogWrite (uint8_t pin, int value);
+unsigned long pulseIn (uint8_t pin, uint8_t state, unsigned long timeout);
+void shiftOut (uint8_t data, uint8_t clock, uint8_t order, uint8_t value);
+
+#endif
@@ -0,0 +1,270 @@
+// Replay the Timer2 ticks of the InfraredPlug transmitter and check its timing.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o irTxReplay irTxReplay.cpp
+//
+// Usage: irTxReplay [-v]
+//  -v          print each mark and space, as sent and as requested
+//
+// Transmissions are queued with sendTimes() and sendBits(), as a sketch
+// would. Then, for as long as the compare match interrupt is enabled, the
+// timer ticks are replayed at the rate Timer2 is set up for, each calling
+// the same ISR(TIMER2_COMPA_vect) as in snapNikon.ino. All changes of the
+// LED pin are recorded, and turned back into marks and spaces: a mark is
+// from the first rising edge of a burst until its last falling edge, with at
+// most one tick between edges, and a space is the rest. These are compared
+// against the requested times, after merging adjacent equal levels, as the
+// LED cannot show those apart.
+//
+// Each requested time is rounded to whole ticks, and a mark can end up to
+// one tick early when the carrier is in its off half, so each merged time
+// must be within half a tick per part, plus one carrier cycle. The carrier
+// frequency is measured over all marks and must be within 1% of the one
+// set. Without carrier, the LED must stay on for the whole mark. A fifth
+// entry must be refused while four are queued, and all must be sent back to
+// back. After each replay, the interrupt must be off, sending() must be 0,
+// and the LED must be off. The largest timing error is printed for each
+// case. Exits with status 1 if any check failed.
+
+#define ARDUINO 105
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../../../Ports.cpp"
+
+volatile uint8_t ADCSRA, MCUCR, MCUSR, PORTD, WDTCSR, SREG, TCCR2A, TCCR2B,
+                 TCNT2, OCR2A, TIMSK2, TIFR2, PCICR, PCMSK0, PCMSK1, PCMSK2;
+volatile uint8_t hostPorts [3];
+volatile unsigned long timer0_millis;
+
+// used by RemoteNode in Ports.cpp, but PortsRF12.cpp is not needed here
+void RemoteHandler::setup (uint8_t, uint8_t, uint8_t) {}
+uint8_t RemoteHandler::poll (RemoteNode&, uint8_t) { return 0; }
+
+unsigned long millis () { return 0; }
+unsigned long micros () { return 0; }
+void delay (unsigned long) {}
+void delayMicroseconds (unsigned int) {}
+void pinMode (uint8_t, uint8_t) {}
+void digitalWrite (uint8_t, uint8_t) {}
+int digitalRead (uint8_t) { return 1; }
+int analogRead (uint8_t) { return 0; }
+void analogWrite (uint8_t, int) {}
+unsigned long pulseIn (uint8_t, uint8_t, unsigned long) { return 0; }
+void shiftOut (uint8_t, uint8_t, uint8_t, uint8_t) {}
+
+ISR(TIMER2_COMPA_vect) { InfraredPlug::timerEvent(); }
+
+#define LED_PIN 4           // DIO1, as in snapNikon.ino
+
+static InfraredPlug ir (LED_PIN - 3);
+static bool verbose, allOk = true;
+
+// a mark or space, with the number of requested times merged into it
+struct Period { bool mark; double us; int parts; };
+
+// append a requested time, merging it with the previous one if same level
+static void expect (std::vector<Period>& v, bool mark, double us) {
+    // an empty space between entries doesn't show, i.e. marks do merge
+    if (us > 0 && !v.empty() && v.back().us == 0 && v.back().mark != mark)
+        v.pop_back();
+    if (!v.empty() && v.back().mark == mark) {
+        v.back().us += us;
+        v.back().parts += us > 0;
+    } else {
+        Period p = { mark, us, 1 };
+        v.push_back(p);
+    }
+}
+
+static void expectTimes (std::vector<Period>& v, const word* t, byte n) {
+    for (byte i = 0; i < n; ++i)
+        expect(v, i % 2 == 0, t[i]);
+    expect(v, false, 0); // the LED is turned off at the end of an entry
+}
+
+static void expectBits (std::vector<Period>& v, const byte* d, word n,
+                        byte slot) {
+    for (word i = 0; i < n; ++i)
+        expect(v, bitRead(d[i/8], i%8), 4 * slot);
+    expect(v, false, 0);
+}
+
+// run the timer until all is sent, then compare with what was requested
+static void replay (const char* what, const std::vector<Period>& want,
+                    word hz) {
+    const byte mask = digitalPinToBitMask(LED_PIN);
+    volatile byte& pin = hostPorts[digitalPinToPort(LED_PIN)];
+    const double tick = (OCR2A + 1) * (TCCR2B == bit(CS21) ? 8 : 1) *
+                            1e6 / F_CPU;
+    const double cycle = hz ? 1e6 / hz : 2 * tick;
+
+    // the first level is set when the entry is queued, i.e. at time 0
+    std::vector<double> edges;
+    bool level = pin & mask;
+    if (level)
+        edges.push_back(0);
+    double t = 0;
+    while (bitRead(TIMSK2, OCIE2A)) {
+        t += tick;
+        TIMER2_COMPA_vect();
+        if (((pin & mask) != 0) != level) {
+            level = !level;
+            edges.push_back(t);
+        }
+        if (t > 10e6) {
+            printf("%s: still sending after 10 s\n", what);
+            exit(1);
+        }
+    }
+    const double end = t;
+
+    // edges alternate rising and falling, starting with a rising one
+    std::vector<Period> got;
+    long toggles = 0;
+    double carrierUs = 0;
+    for (size_t i = 0; i < edges.size(); i += 2) {
+        size_t j = i + 1; // the falling edge which ends this burst
+        while (j + 2 < edges.size() && edges[j+1] - edges[j] < 1.5 * tick)
+            j += 2;
+        if (j >= edges.size())
+            break;
+        if (i == 0 && edges[0] > 0)
+            expect(got, false, edges[0]);
+        expect(got, true, edges[j] - edges[i]);
+        expect(got, false, (j + 1 < edges.size() ? edges[j+1] : end) -
+                            edges[j]);
+        if (j > i + 1) {
+            toggles += j - i - 1;
+            carrierUs += edges[j-1] - edges[i];
+        }
+        i = j - 1;
+    }
+    // the LED is turned off at the end of an entry, i.e. the space after a
+    // final mark is empty, or only as long as the carrier's last off half
+    std::vector<Period> exp (want);
+    if (!exp.empty() && !exp.back().mark && exp.back().us == 0)
+        exp.pop_back();
+    if (!exp.empty() && exp.back().mark && !got.empty() &&
+            !got.back().mark && got.back().us <= tick)
+        got.pop_back();
+
+    bool ok = got.size() == exp.size();
+    double maxErr = 0;
+    for (size_t i = 0; ok && i < got.size(); ++i) {
+        double err = got[i].us - exp[i].us;
+        double bound = exp[i].parts * tick / 2 + cycle;
+        if (verbose)
+            printf("  %s %8.1f %8.1f\n", exp[i].mark ? "mark " : "space",
+                    got[i].us, exp[i].us);
+        ok = got[i].mark == exp[i].mark && fabs(err) <= bound;
+        if (fabs(err) > maxErr)
+            maxErr = fabs(err);
+    }
+    // the carrier toggles every tick, i.e. two toggles per cycle
+    double measured = toggles ? 1e6 * toggles / 2 / carrierUs : 0;
+    if (hz)
+        ok = ok && fabs(measured - hz) <= hz / 100.0;
+    else
+        ok = ok && toggles == 0;
+    ok = ok && !bitRead(TIMSK2, OCIE2A) && InfraredPlug::sending() == 0 &&
+            (pin & mask) == 0;
+
+    printf("%-28s %5.0f Hz %4zu periods %6.1f us max error%s\n", what,
+            measured, got.size(), maxErr, ok ? "" : "  FAILED");
+    if (got.size() != exp.size())
+        printf("  got %zu marks and spaces, expected %zu\n", got.size(),
+                exp.size());
+    allOk = allOk && ok;
+}
+
+int main (int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1)
+        switch (opt) {
+            case 'v': verbose = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [-v]\n", argv[0]);
+                return 1;
+        }
+
+    // the snapshot command from snapNikon.ino
+    static const word snapshot [] = {
+        2000, 28000, 400, 1600, 400, 3600, 400, 63000,
+        2000, 28000, 400, 1600, 400, 3600, 400,
+    };
+    const byte snapCount = sizeof snapshot / sizeof *snapshot;
+
+    // an NEC frame: header, 32 bits, and the final mark
+    word nec [2 + 64 + 1];
+    nec[0] = 9000;
+    nec[1] = 4500;
+    const uint32_t code = 0x10EF08F7;
+    for (byte i = 0; i < 32; ++i) {
+        nec[2 + 2*i] = 560;
+        nec[3 + 2*i] = bitRead(code, 31 - i) ? 1690 : 560;
+    }
+    nec[66] = 560;
+    const byte necCount = sizeof nec / sizeof *nec;
+
+    // a bit pattern, with runs of various lengths
+    static const byte bits [] = { 0xFF, 0x00, 0xA5, 0x3C, 0x01, 0xF0 };
+    const word bitCount = 8 * sizeof bits;
+
+    static const word carriers [] = { 38000, 36000, 40000, 56000, 0 };
+    for (byte c = 0; c < sizeof carriers / sizeof *carriers; ++c) {
+        word hz = carriers[c];
+        InfraredPlug::setCarrier(hz);
+        char what [40];
+        std::vector<Period> want;
+
+        snprintf(what, sizeof what, "%5u Hz, snapshot", hz);
+        ir.sendTimes(snapshot, snapCount);
+        expectTimes(want, snapshot, snapCount);
+        replay(what, want, hz);
+
+        want.clear();
+        snprintf(what, sizeof what, "%5u Hz, NEC frame", hz);
+        ir.sendTimes(nec, necCount);
+        expectTimes(want, nec, necCount);
+        replay(what, want, hz);
+
+        want.clear();
+        snprintf(what, sizeof what, "%5u Hz, bits, slot 140", hz);
+        ir.configure(140);
+        ir.sendBits(bits, bitCount);
+        expectBits(want, bits, bitCount, 140);
+        replay(what, want, hz);
+
+        want.clear();
+        snprintf(what, sizeof what, "%5u Hz, bits, slot 111", hz);
+        ir.configure(111);
+        ir.sendBits(bits, bitCount);
+        expectBits(want, bits, bitCount, 111);
+        replay(what, want, hz);
+    }
+
+    // a full queue, sent back to back
+    InfraredPlug::setCarrier(38000);
+    ir.configure(140);
+    std::vector<Period> want;
+    bool queued = ir.sendTimes(nec, necCount) && ir.sendBits(bits, bitCount) &&
+                    ir.sendTimes(snapshot, snapCount) &&
+                    ir.sendBits(bits, bitCount);
+    bool refused = !ir.sendTimes(nec, necCount);
+    expectTimes(want, nec, necCount);
+    expectBits(want, bits, bitCount, 140);
+    expectTimes(want, snapshot, snapCount);
+    expectBits(want, bits, bitCount, 140);
+    if (!queued || !refused || InfraredPlug::sending() != 4) {
+        printf("the queue did not take exactly four entries\n");
+        allOk = false;
+    }
+    replay("38000 Hz, four queued", want, 38000);
+
+    return !allOk;
+}
@@ -0,0 +1,1321 @@
+  0x94, 0xa0, 0x01, 0xff, 0x8c, 0x03, 0x00, 0x20, 0x29, 0x4d, 0x00, 0x00,
+  0xb3, 0x6d, 0x49, 0x03, 0x06, 0x00, 0x32, 0x97, 0x49, 0x0b, 0x16, 0x4b,
+  0xa9, 0x49, 0x07, 0x06, 0x03, 0x02, 0xb7, 0x0b, 0x10, 0xdb, 0x03, 0x00,
+  0xff, 0xbe, 0x03, 0x00, 0x25, 0x4a, 0x00, 0x00, 0x49, 0x03, 0x00, 0x6d,
+  0xaa, 0x03, 0x00, 0x93, 0x03, 0x00, 0xb7, 0x03, 0x00, 0xd7, 0x03, 0x00,
+  0xfb, 0x6d, 0x4a, 0x27, 0x06, 0x1d, 0x4b, 0x07, 0x06, 0x3f, 0x4b, 0x3b,
+  0x0e, 0xd5, 0xa5, 0x0b, 0x08, 0xc9, 0x07, 0x00, 0xed, 0x03, 0x00, 0x11,
+  0x4c, 0x57, 0x00, 0x00, 0x35, 0x03, 0x00, 0x59, 0x03, 0x00, 0x7f, 0x03,
+  0x00, 0x55, 0xa3, 0x03, 0x00, 0xc3, 0x03, 0x00, 0xe3, 0x03, 0x00, 0x03,
+  0xb7, 0x00, 0xfb, 0x14, 0x05, 0x8d, 0x02, 0x1e, 0x2d, 0x2d, 0x2d, 0x20,
+  0xff, 0x4d, 0x65, 0x63, 0x72, 0x69, 0x73, 0x70, 0x2d, 0xbf, 0x53, 0x74,
+  0x65, 0x6c, 0x6c, 0x61, 0x0a, 0x00, 0x20, 0xdf, 0x43, 0x6f, 0x72, 0x65,
+  0x20, 0x1a, 0x00, 0x00, 0x07, 0xff, 0xb5, 0x90, 0x48, 0x00, 0x2b, 0x09,
+  0xd0, 0x00, 0xbf, 0xf0, 0x3b, 0xf8, 0x00, 0xf0, 0x41, 0x03, 0x00, 0x27,
+  0xff, 0xf8, 0x42, 0x60, 0x28, 0x21, 0x01, 0x60, 0xf3, 0xff, 0xe7, 0x07,
+  0xbd, 0x00, 0xb5, 0x89, 0x48, 0x00, 0xff, 0x23, 0x01, 0x68, 0x28, 0x29,
+  0x05, 0xd1, 0x42, 0xef, 0x68, 0x00, 0xf0, 0x04, 0x1f, 0x00, 0x4c, 0xf8,
+  0xf6, 0xff, 0xe7, 0x00, 0xbd, 0x03, 0xb5, 0x04, 0x3f, 0x3e, 0xf7, 0x60,
+  0x16, 0x00, 0x05, 0x02, 0x1e, 0x00, 0x08, 0xb4, 0xff, 0x00, 0xf0, 0xcf,
+  0xff, 0x08, 0xbc, 0x01, 0x33, 0xf6, 0x0f, 0x02, 0x7d, 0x4e, 0x05, 0x02,
+  0x7c, 0x4e, 0x04, 0xf0, 0xb7, 0x42, 0xfa, 0x03, 0x29, 0x00, 0x01, 0x3b,
+  0x25, 0x0e, 0xa6, 0xaa, 0x25, 0x00, 0x32, 0x35, 0x04, 0x75, 0x1f, 0x00,
+  0x32, 0x1f, 0x04, 0x74, 0xbf, 0x48, 0x01, 0x68, 0x1e, 0x29, 0x01, 0x83,
+  0x00, 0x34, 0xff, 0xf8, 0x03, 0xbd, 0x81, 0x69, 0x01, 0x62, 0x01, 0xff,
+  0x69, 0x81, 0x61, 0x81, 0x68, 0x01, 0x61, 0x01, 0xff, 0x68, 0x81, 0x60,
+  0xc1, 0x69, 0x41, 0x62, 0x41, 0xff, 0x69, 0xc1, 0x61, 0xc1, 0x68, 0x41,
+  0x61, 0x41, 0xef, 0x68, 0xc1, 0x60, 0x1e, 0x9b, 0x00, 0x70, 0x47, 0x0f,
+  0xfb, 0xb5, 0x62, 0x35, 0x04, 0x03, 0xd0, 0xff, 0xf7, 0xde, 0xff, 0xff,
+  0xff, 0xf7, 0xe4, 0xff, 0x0f, 0xbd, 0x02, 0xf5, 0xb5, 0x33, 0x00, 0x60,
+  0x27, 0x00, 0x60, 0x00, 0xe0, 0x02, 0x55, 0xb5, 0x43, 0x00, 0x60, 0x37,
+  0x00, 0x60, 0x4f, 0x00, 0x61, 0x43, 0x00, 0xff, 0x61, 0x01, 0x6a, 0x81,
+  0x61, 0x41, 0x6a, 0xc1, 0x7d, 0x61, 0x3f, 0x00, 0x62, 0x02, 0xbd, 0x08,
+  0xb5, 0x3d, 0x00, 0xff, 0x22, 0x02, 0x60, 0x08, 0x29, 0x01, 0xd2, 0x0b,
+  0xff, 0x00, 0x04, 0xe0, 0x28, 0x29, 0x0d, 0xd1, 0x43, 0xf6, 0xe1, 0x00,
+  0x5d, 0xf8, 0x9b, 0x02, 0x50, 0x4e, 0x03, 0xf0, 0xfd, 0x80, 0x09, 0x04,
+  0x4f, 0x4e, 0x1e, 0x43, 0x03, 0xf0, 0x77, 0x7a, 0xf8, 0x08, 0x0b, 0x01,
+  0x00, 0xf0, 0x09, 0xff, 0x00, 0xd5, 0x0c, 0x03, 0x00, 0x0f, 0x03, 0x00,
+  0x12, 0x03, 0x00, 0x15, 0xf8, 0xff, 0x00, 0xbd, 0x0f, 0xb5, 0x44, 0x48,
+  0xff, 0xf7, 0xa9, 0xd7, 0x7f, 0x00, 0x09, 0x06, 0xd2, 0x09, 0x04, 0x43,
+  0x09, 0x00, 0xcd, 0xaa, 0x09, 0x04, 0x41, 0x09, 0x00, 0xc8, 0x09, 0x04,
+  0x36, 0xb1, 0x00, 0x06, 0xd2, 0x73, 0x00, 0x1e, 0x4d, 0x01, 0x5b, 0x02,
+  0x3c, 0x65, 0x00, 0x4d, 0xf8, 0xc5, 0x14, 0x7b, 0x00, 0x09, 0x7b, 0x00,
+  0x23, 0x07, 0x05, 0x02, 0x06, 0x26, 0xff, 0x02, 0xf0, 0x9c, 0xfc, 0x08,
+  0xe0, 0x06, 0x29, 0xfb, 0x06, 0xd0, 0x0f, 0x02, 0x33, 0x4e, 0xc9, 0x00,
+  0x0e, 0xfa, 0x85, 0x00, 0x37, 0x71, 0x00, 0x01, 0xf8, 0x0f, 0xbd, 0x24,
+  0xbd, 0x48, 0xc3, 0x02, 0x81, 0x61, 0x01, 0x61, 0x1d, 0x01, 0x62, 0xfd,
+  0x06, 0x0f, 0x01, 0x00, 0x21, 0x81, 0x62, 0x70, 0x47, 0x7b, 0x07, 0xb5,
+  0x43, 0x06, 0x00, 0xf0, 0x4f, 0xf8, 0x09, 0x06, 0xff, 0x02, 0xf0, 0x78,
+  0xfc, 0x07, 0xbd, 0x07, 0xb5, 0xff, 0xc1, 0x6a, 0x28, 0x29, 0x04, 0xd1,
+  0x01, 0x6b, 0xff, 0x99, 0x42, 0x01, 0xd1, 0x00, 0x23, 0x07, 0xbd, 0x7f,
+  0x01, 0x68, 0x00, 0x29, 0x18, 0xd0, 0x81, 0x05, 0x00, 0xff, 0x15, 0xd0,
+  0x01, 0x69, 0x00, 0x29, 0x12, 0xd0, 0xfd, 0x81, 0x05, 0x00, 0x0f, 0xd0,
+  0x01, 0x6a, 0x00, 0x29, 0xaf, 0x0c, 0xd0, 0x03, 0x63, 0x8b, 0x0e, 0x00,
+  0x8b, 0x00, 0x56, 0x9f, 0xfc, 0x28, 0x21, 0xc1, 0x62, 0x37, 0x02, 0x5f,
+  0x0a, 0x1f, 0xfa, 0x5f, 0x0c, 0x48, 0x5f, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x00, 0xff, 0x20, 0x54, 0x0e, 0x00, 0x00, 0x61, 0x82, 0x00, 0xbf, 0x00,
+  0x00, 0xa0, 0x00, 0x00, 0x48, 0x0f, 0x00, 0x04, 0xff, 0x3f, 0x00, 0x00,
+  0x38, 0x60, 0x00, 0x00, 0x40, 0xea, 0x0b, 0x00, 0x38, 0x03, 0x00, 0x30,
+  0x03, 0x00, 0x40, 0xcf, 0x00, 0xbf, 0x00, 0x06, 0x46, 0x00, 0x00, 0x37,
+  0x0b, 0x05, 0x82, 0xff, 0x68, 0x03, 0x69, 0x84, 0x69, 0x05, 0x6a, 0x06,
+  0xbf, 0x20, 0x00, 0xf0, 0x0e, 0xf8, 0x03, 0x05, 0x00, 0x0b, 0xbb, 0xf8,
+  0x02, 0x05, 0x00, 0x08, 0xf8, 0x01, 0x05, 0x00, 0x05, 0xef, 0xf8, 0x00,
+  0x23, 0x2c, 0xe9, 0x00, 0xc1, 0x62, 0x37, 0xff, 0xbd, 0x81, 0x42, 0x09,
+  0xd0, 0x82, 0x42, 0x07, 0xff, 0xd0, 0x83, 0x42, 0x05, 0xd0, 0x84, 0x42,
+  0x03, 0xff, 0xd0, 0x85, 0x42, 0x01, 0xd0, 0x03, 0x00, 0x37, 0xf7, 0xbd,
+  0x70, 0x47, 0x87, 0x02, 0x24, 0x4e, 0x00, 0xb5, 0xf3, 0x81, 0x58, 0x55,
+  0x03, 0x7d, 0x03, 0x83, 0x50, 0x01, 0x21, 0x1f, 0x99, 0x40, 0x0e, 0x43,
+  0x00, 0xb1, 0x01, 0xe3, 0x01, 0xf7, 0x00, 0xff, 0x00, 0x22, 0xff, 0xf7,
+  0xeb, 0xff, 0x02, 0xf0, 0xeb, 0x97, 0xff, 0x13, 0x02, 0x81, 0x13, 0x00,
+  0x07, 0xd1, 0x08, 0xee, 0x13, 0x00, 0xe1, 0xff, 0x00, 0x05, 0x04, 0x02,
+  0xf0, 0x8a, 0xfe, 0x19, 0x04, 0x01, 0x69, 0x1e, 0x29, 0x0a, 0xd1, 0x10,
+  0x4e, 0x13, 0x00, 0xd4, 0xff, 0x08, 0x05, 0x04, 0x1f, 0x02, 0xd1, 0x1f,
+  0x00, 0xb9, 0x7a, 0x39, 0x06, 0x1f, 0x00, 0x0d, 0xd1, 0x18, 0x13, 0x00,
+  0xc4, 0x53, 0xff, 0x10, 0x05, 0x04, 0x25, 0x02, 0xc1, 0x25, 0x04, 0xbe,
+  0x25, 0x00, 0x89, 0x67, 0x25, 0x02, 0x0b, 0x05, 0x00, 0xe7, 0x00, 0x7d,
+  0x02, 0x75, 0x03, 0x43, 0xff, 0x68, 0xff, 0xf7, 0x32, 0xff, 0x03, 0x60,
+  0x19, 0xe9, 0x00, 0x7d, 0x06, 0x13, 0x02, 0xc3, 0x13, 0x00, 0x28, 0xff,
+  0x83, 0xf6, 0x13, 0x08, 0x01, 0x69, 0x27, 0x04, 0x69, 0xff, 0xf7, 0x1e,
+  0xb7, 0xff, 0x03, 0x61, 0x13, 0x02, 0x3e, 0xb5, 0x1b, 0x0b, 0x9a, 0xfa,
+  0xed, 0x00, 0xa2, 0xed, 0x00, 0xaa, 0x42, 0x0a, 0xd1, 0x07, 0xf7, 0x2a,
+  0x08, 0xd8, 0xef, 0x02, 0xd6, 0x00, 0xff, 0xf7, 0xff, 0x5e, 0xff, 0x1e,
+  0x43, 0x83, 0x60, 0x02, 0xf0, 0xe7, 0x2d, 0xff, 0x3e, 0x2d, 0x00, 0x4b,
+  0x0f, 0x91, 0x42, 0x06, 0xff, 0xd0, 0x99, 0x42, 0x04, 0xd0, 0xa1, 0x42,
+  0x02, 0xbf, 0xd0, 0xa9, 0x42, 0x00, 0xd0, 0x3e, 0xb3, 0x05, 0xce, 0xaa,
+  0x31, 0x00, 0x45, 0x31, 0x00, 0x03, 0x31, 0x00, 0x14, 0x31, 0x00, 0x00,
+  0xff, 0xb5, 0xff, 0xf7, 0x68, 0xfe, 0xff, 0xf7, 0x5c, 0xfa, 0x03, 0x00,
+  0x39, 0x9b, 0x00, 0x00, 0xbd, 0x01, 0xb5, 0x06, 0xff, 0x48, 0x03, 0x68,
+  0x01, 0x33, 0x07, 0xd0, 0x00, 0xf3, 0x23, 0xdb, 0x27, 0x00, 0x35, 0x02,
+  0x03, 0x4e, 0x02, 0xf0, 0xb7, 0xfd, 0xfe, 0x01, 0xd3, 0x00, 0xd8, 0x1f,
+  0xd3, 0x00, 0xb5, 0xfe, 0xcf, 0x01, 0x05, 0x00, 0x00, 0x42, 0x82, 0x04,
+  0x32, 0xbf, 0x64, 0x75, 0x70, 0x00, 0x38, 0x68, 0x23, 0x02, 0x04, 0xdf,
+  0x3f, 0x38, 0x60, 0x70, 0x47, 0x1b, 0x00, 0xf0, 0xe3, 0xff, 0xfc, 0x00,
+  0xf0, 0xe1, 0xfc, 0x00, 0xbd, 0x58, 0xfe, 0x23, 0x00, 0x62, 0x82, 0x05,
+  0x32, 0x64, 0x72, 0x6f, 0x5f, 0x70, 0x04, 0x37, 0x40, 0xcf, 0x1d, 0x06,
+  0x84, 0x1d, 0x00, 0x5d, 0x82, 0x1d, 0x00, 0xc0, 0x46, 0xa0, 0x1f, 0x00,
+  0x44, 0x1f, 0x00, 0x3f, 0x73, 0x77, 0x61, 0x70, 0x07, 0xcf, 0x3f, 0x02,
+  0x47, 0x06, 0xef, 0x3a, 0x60, 0x0e, 0x00, 0x2b, 0x02, 0xff, 0xf7, 0x4a,
+  0xf3, 0xff, 0x02, 0xcd, 0x00, 0xab, 0x00, 0x61, 0x42, 0x68, 0x43, 0xff,
+  0x69, 0x43, 0x60, 0x42, 0x61, 0x82, 0x68, 0x83, 0xff, 0x69, 0x83, 0x60,
+  0x82, 0x61, 0xc2, 0x68, 0xc3, 0x5f, 0x69, 0xc3, 0x60, 0xc2, 0x61, 0x47,
+  0x02, 0xc8, 0x67, 0x04, 0x3f, 0x04, 0x32, 0x6e, 0x69, 0x70, 0x00, 0x47,
+  0x06, 0x3d, 0x06, 0xdf, 0x2b, 0xff, 0xff, 0xf7, 0xdc, 0x03, 0x00, 0xf8,
+  0xfd, 0x7f, 0xff, 0xf7, 0xf6, 0xfd, 0x00, 0xbd, 0xe4, 0x6f, 0x02, 0xff,
+  0x80, 0x05, 0x32, 0x6f, 0x76, 0x65, 0x72, 0xb8, 0xfe, 0xb3, 0x0c, 0xfe,
+  0x68, 0x70, 0x47, 0xc0, 0x46, 0x08, 0xbd, 0x06, 0x1b, 0x06, 0x74, 0x75,
+  0x63, 0x6b, 0x8b, 0x16, 0x04, 0xeb, 0x3f, 0x39, 0xdb, 0x08, 0x2c, 0x23,
+  0x00, 0x46, 0x80, 0x04, 0xef, 0x32, 0x72, 0x6f, 0x74, 0xf3, 0x00, 0xb9,
+  0x68, 0x3a, 0xff, 0x69, 0xb8, 0x60, 0x39, 0x61, 0x3a, 0x60, 0x79, 0x5b,
+  0x68, 0x7e, 0x45, 0x00, 0xf9, 0x60, 0x47, 0x02, 0x50, 0x23, 0x04, 0xe7,
+  0x05, 0x32, 0x2d, 0x24, 0x00, 0x23, 0x06, 0x38, 0x61, 0x39, 0xff, 0x60,
+  0xba, 0x60, 0xf9, 0x68, 0xfe, 0x60, 0x7e, 0xeb, 0x68, 0x79, 0x23, 0x04,
+  0x78, 0x23, 0x00, 0x20, 0x82, 0x03, 0xff, 0x32, 0x3e, 0x72, 0x01, 0xcf,
+  0x01, 0xb4, 0x40, 0xfd, 0xb4, 0x19, 0x07, 0xff, 0xf7, 0x42, 0xff, 0x00,
+  0xf0, 0x55, 0x19, 0x1d, 0x01, 0xbb, 0x03, 0x00, 0xb9, 0x21, 0x01, 0xa4,
+  0x27, 0x08, 0x7b, 0x72, 0x3e, 0x8b, 0x02, 0x40, 0xbc, 0x01, 0xbc, 0xdb,
+  0x0e, 0xd5, 0x2c, 0x2b, 0x00, 0xc2, 0x27, 0x00, 0xc0, 0x03, 0x00, 0xff,
+  0xfb, 0xd7, 0x00, 0xbd, 0xd4, 0x2b, 0x0a, 0x40, 0x2b, 0x02, 0x01, 0x9e,
+  0xb6, 0x05, 0x02, 0x00, 0x9e, 0x2b, 0x06, 0x16, 0xff, 0x0d, 0x02, 0x0c,
+  0xff, 0x4e, 0x03, 0xf0, 0x31, 0xfb, 0x03, 0xf0, 0x2c, 0xed, 0xfb, 0x33,
+  0x03, 0x00, 0x07, 0x2f, 0x02, 0x06, 0x32, 0x72, 0xae, 0x9c, 0x03, 0x00,
+  0x02, 0xb0, 0x29, 0x06, 0x01, 0x29, 0x04, 0x02, 0xfe, 0xed, 0x01, 0x06,
+  0xfe, 0x00, 0xbd, 0x01, 0x98, 0x00, 0xee, 0x19, 0x00, 0x00, 0x00, 0x18,
+  0x2b, 0x00, 0x42, 0x80, 0x03, 0xff, 0x64, 0x32, 0x2f, 0x38, 0x68, 0xf1,
+  0x07, 0x76, 0xdf, 0x10, 0x40, 0x08, 0x08, 0x43, 0x87, 0x02, 0x30, 0x07,
+  0xfc, 0x77, 0x03, 0x17, 0x00, 0x2a, 0x38, 0x68, 0x00, 0x18, 0x76, 0x7d,
+  0x41, 0x13, 0x02, 0x19, 0xe0, 0xc0, 0x46, 0x4c, 0x2f, 0x04, 0xbf, 0x04,
+  0x64, 0x73, 0x68, 0x72, 0x00, 0x31, 0x04, 0x08, 0xce, 0x31, 0x0a, 0xc0,
+  0x46, 0x98, 0x33, 0x04, 0x1b, 0x02, 0x6c, 0x00, 0x7c, 0x35, 0x0e, 0x7b,
+  0x02, 0x37, 0xfe, 0xff, 0xf7, 0x6a, 0x03, 0x00, 0xff, 0x9d, 0xfe, 0x00,
+  0xf0, 0x96, 0xfb, 0xff, 0xf7, 0xed, 0x64, 0x0b, 0x00, 0x97, 0xfe, 0xf9,
+  0x04, 0x26, 0x01, 0xf0, 0xed, 0xf9, 0xe7, 0x00, 0x8b, 0xfb, 0x0d, 0x04,
+  0x4e, 0x01, 0xf0, 0xeb, 0xf2, 0xfc, 0xc3, 0x02, 0xac, 0x67, 0x08, 0x61,
+  0x62, 0x73, 0x5f, 0x00, 0x00, 0x2e, 0x08, 0xd4, 0x5f, 0x02, 0xcc, 0x13,
+  0x04, 0xff, 0x07, 0x64, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0xfe, 0x61,
+  0x00, 0x21, 0xc0, 0x43, 0xf6, 0x43, 0x01, 0x30, 0xfb, 0x4e, 0x41, 0x7f,
+  0x06, 0x1c, 0x08, 0x00, 0x00, 0x64, 0xff, 0x82, 0x02, 0x64, 0x2d, 0x00,
+  0x07, 0xcf, 0x12, 0x9f, 0x1a, 0xb1, 0x41, 0x0e, 0x00, 0xe3, 0x03, 0x81,
+  0x06, 0x13, 0xaa, 0x79, 0x00, 0xae, 0x79, 0x00, 0x27, 0x79, 0x00, 0x5a,
+  0x0b, 0x00, 0x53, 0xea, 0x0b, 0x00, 0x21, 0x0b, 0x00, 0x54, 0x03, 0x00,
+  0xb8, 0xfe, 0x01, 0xf3, 0xf0, 0x42, 0x9b, 0x03, 0x83, 0x04, 0x20, 0x4e,
+  0x00, 0xf0, 0xab, 0x3f, 0xfd, 0x83, 0x02, 0x68, 0x4f, 0x08, 0x2b, 0x4f,
+  0x02, 0x18, 0xfb, 0x4e, 0x41, 0x4d, 0x0e, 0xec, 0xfd, 0x00, 0xf0, 0x87,
+  0xaa, 0x41, 0x00, 0x00, 0x3d, 0x00, 0x33, 0x4d, 0x00, 0x2c, 0x0b, 0x00,
+  0xfa, 0xaf, 0xfd, 0xff, 0xf7, 0x2d, 0x0f, 0x00, 0x91, 0x4d, 0x00, 0x05,
+  0xaa, 0x4d, 0x00, 0x94, 0x4d, 0x04, 0x0b, 0x4d, 0x00, 0x1c, 0x4d, 0x00,
+  0x9c, 0x7e, 0x4b, 0x00, 0x61, 0x82, 0x03, 0x73, 0x3e, 0x64, 0x15, 0x02,
+  0x7b, 0xf6, 0x17, 0x47, 0x02, 0x00, 0xf0, 0xda, 0xfa, 0x99, 0x02, 0xea,
+  0x11, 0x02, 0x03, 0xf9, 0x00, 0x75, 0xf9, 0x00, 0x40, 0x41, 0x00, 0xfb,
+  0x00, 0x80, 0x03, 0x00, 0xc0, 0x17, 0x00, 0x00, 0xc8, 0xed, 0x08, 0x9b,
+  0x05, 0x75, 0x6d, 0x83, 0x01, 0x03, 0x00, 0x73, 0xff, 0x43, 0x3b, 0x60,
+  0x01, 0x0c, 0x32, 0x0c, 0x0b, 0xff, 0x00, 0x53, 0x43, 0xb6, 0xb2, 0x80,
+  0xb2, 0x4e, 0xff, 0x43, 0x50, 0x43, 0x36, 0x18, 0x36, 0x0c, 0xf6, 0x75,
+  0x18, 0xfb, 0x02, 0xf8, 0x2b, 0x04, 0x02, 0x6d, 0x2a, 0x79, 0x01, 0xff,
+  0xc1, 0x17, 0x05, 0xd0, 0x40, 0x42, 0x38, 0x60, 0xff, 0xf0, 0x17, 0x04,
+  0xd0, 0x76, 0x42, 0xe0, 0xe7, 0xe7, 0xf0, 0x17, 0xde, 0x07, 0x00, 0xb7,
+  0x02, 0xdb, 0xff, 0xff, 0xf7, 0xf7, 0x63, 0xff, 0xdb, 0x02, 0x38, 0x09,
+  0x00, 0x00, 0xfd, 0x44, 0x5b, 0x00, 0x64, 0x2a, 0x07, 0xcf, 0x56, 0x43,
+  0xff, 0x41, 0x43, 0x76, 0x18, 0x01, 0x0c, 0x13, 0x0c, 0xfd, 0x59, 0x07,
+  0x04, 0x80, 0xb2, 0x92, 0xb2, 0x51, 0x43, 0xfd, 0x43, 0x5f, 0x00, 0x00,
+  0x22, 0xc9, 0x18, 0x52, 0x41, 0xff, 0x12, 0x04, 0xb6, 0x18, 0x0a, 0x04,
+  0x09, 0x0c, 0xe9, 0x80, 0x03, 0x05, 0x6b, 0x07, 0xcc, 0x3f, 0x04, 0x04,
+  0x75, 0x64, 0xde, 0x71, 0x00, 0x10, 0xb5, 0x00, 0x24, 0xc3, 0x02, 0x7e,
+  0x68, 0xfe, 0x05, 0x02, 0x3e, 0x69, 0xff, 0xf7, 0xa7, 0xff, 0x31, 0x8f,
+  0x00, 0x40, 0xcf, 0x30, 0x03, 0x00, 0x11, 0x04, 0x17, 0x04, 0xfe, 0xff,
+  0x68, 0x03, 0xb4, 0xff, 0xf7, 0x9a, 0xff, 0x03, 0xeb, 0xbc, 0x33, 0x17,
+  0x00, 0x32, 0x1b, 0x14, 0x3e, 0x69, 0x0f, 0xfe, 0x1b, 0x00, 0x8c, 0xff,
+  0x0f, 0xbc, 0x92, 0x19, 0x63, 0x7f, 0x41, 0x40, 0xcf, 0x89, 0x19, 0x62,
+  0x41, 0x07, 0x02, 0xd6, 0x55, 0x0e, 0xfe, 0x68, 0x21, 0x02, 0x7b, 0x21,
+  0x1c, 0x1e, 0x00, 0x7f, 0x3a, 0x60, 0x79, 0x60, 0xb8, 0x60, 0x10, 0xd3,
+  0x00, 0xfd, 0xf0, 0x93, 0x00, 0x43, 0x80, 0x02, 0x2a, 0x2f, 0x00, 0xff,
+  0x00, 0xb5, 0x40, 0xb4, 0x40, 0xcf, 0xff, 0xf7, 0xfb, 0x79, 0xff, 0x3b,
+  0x02, 0x40, 0xbc, 0x00, 0xf0, 0x4f, 0xb7, 0xf8, 0x04, 0x37, 0xf7, 0x02,
+  0x14, 0x0a, 0x23, 0x02, 0x05, 0x5f, 0x2a, 0x2f, 0x6d, 0x6f, 0x64, 0x25,
+  0x0a, 0x66, 0x25, 0x0c, 0x33, 0x3c, 0xf8, 0x1b, 0x05, 0x23, 0x04, 0x03,
+  0x75, 0x48, 0x00, 0x21, 0x08, 0xd5, 0x3f, 0x21, 0x0c, 0x1c, 0x47, 0x08,
+  0x5c, 0x23, 0x04, 0x06, 0x75, 0x54, 0x48, 0x06, 0x27, 0x0a, 0x2b, 0x27,
+  0x0c, 0x08, 0x49, 0x00, 0x7c, 0x23, 0x08, 0xf9, 0x6d, 0x23, 0x08, 0x1b,
+  0x02, 0x00, 0x26, 0x00, 0xf0, 0x1a, 0x89, 0xf8, 0xd9, 0x00, 0x45, 0x00,
+  0x9c, 0x8b, 0x06, 0x1e, 0x06, 0x1d, 0x04, 0xf6, 0x4f, 0x17, 0x00, 0xf0,
+  0x34, 0x1d, 0x08, 0xcf, 0x00, 0x0a, 0x63, 0x03, 0xf7, 0x06, 0x75, 0x64,
+  0x20, 0x04, 0x30, 0xb4, 0x00, 0x23, 0xff, 0x00, 0x22, 0x79, 0x68, 0xb8,
+  0x68, 0x35, 0x00, 0xff, 0x3c, 0x68, 0x40, 0x26, 0x40, 0x00, 0x49, 0x41,
+  0xff, 0x52, 0x41, 0x5b, 0x41, 0xab, 0x42, 0x02, 0xd8, 0xff, 0x04, 0xd3,
+  0xa2, 0x42, 0x02, 0xd3, 0x12, 0x1b, 0xff, 0xab, 0x41, 0x01, 0x30, 0x01,
+  0x3e, 0xf1, 0xd1, 0xff, 0x0e, 0x00, 0x38, 0x60, 0x7b, 0x60, 0xba, 0x60,
+  0xef, 0x30, 0xbc, 0x70, 0x47, 0x37, 0x02, 0x7a, 0x68, 0xb9, 0xff, 0x68,
+  0x00, 0x20, 0xe2, 0xe7, 0xc0, 0x46, 0x68, 0xf5, 0x0b, 0x53, 0x02, 0x05,
+  0x52, 0x06, 0xb5, 0xf0, 0x17, 0x19, 0xff, 0xd0, 0xff, 0xf7, 0x5a, 0xfe,
+  0xff, 0xf7, 0x2d, 0xaf, 0xfd, 0xf0, 0x17, 0x0c, 0x0b, 0x00, 0x54, 0x0b,
+  0x00, 0x27, 0xff, 0xfd, 0xff, 0xf7, 0xc8, 0xff, 0xff, 0xf7, 0x23, 0xfa,
+  0x07, 0x00, 0x4c, 0x0f, 0x00, 0x1f, 0xfd, 0x00, 0xbd, 0xff, 0x6b, 0xf7,
+  0x1c, 0x0d, 0x00, 0xbd, 0x15, 0x00, 0x43, 0xfe, 0x0d, 0x02, 0x55, 0x15,
+  0x2f, 0x00, 0x0e, 0x2f, 0x00, 0x3c, 0x1f, 0x00, 0x0f, 0x19, 0x00, 0x55,
+  0xb0, 0x19, 0x00, 0x36, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x32, 0x07, 0x00,
+  0xb5, 0x05, 0x33, 0x04, 0x02, 0x0d, 0x00, 0xa3, 0xff, 0xcb, 0x02, 0x80,
+  0x76, 0x77, 0x04, 0x02, 0x64, 0x9b, 0x03, 0xff, 0xf7, 0xc2, 0x2d, 0x00,
+  0xeb, 0x18, 0xfd, 0x17, 0x02, 0xc8, 0x17, 0x06, 0x66, 0x2a, 0x00, 0x6a,
+  0x8d, 0x02, 0x0d, 0x51, 0x00, 0x13, 0x3d, 0x00, 0xe6, 0xfc, 0x0b, 0x06,
+  0xfd, 0x0d, 0x0b, 0x00, 0xd0, 0xfe, 0x40, 0xcf, 0x01, 0xcf, 0xab, 0x38,
+  0x60, 0x4f, 0x02, 0xda, 0x17, 0x00, 0xf5, 0x17, 0x00, 0x01, 0xba, 0x17,
+  0x00, 0xc4, 0x17, 0x08, 0xff, 0xf7, 0xfa, 0x49, 0x00, 0x14, 0xa5, 0x0c,
+  0x47, 0x06, 0x2f, 0x47, 0x04, 0x99, 0x02, 0xef, 0x7b, 0x00, 0xc2, 0xf5,
+  0xfc, 0x0b, 0x06, 0xe9, 0x0b, 0x00, 0xbc, 0xfc, 0xff, 0xf7, 0xad, 0x79,
+  0x77, 0x00, 0xdc, 0xfc, 0x49, 0x02, 0xb5, 0x19, 0x00, 0xf4, 0xaa, 0x19,
+  0x00, 0xdc, 0x19, 0x00, 0xaf, 0x19, 0x00, 0x6c, 0x19, 0x00, 0xd6, 0xea,
+  0x0b, 0x00, 0xcd, 0x1d, 0x00, 0x5c, 0x4b, 0x00, 0x20, 0x82, 0x02, 0xff,
+  0x32, 0x21, 0x00, 0x06, 0xcf, 0x31, 0x60, 0x72, 0xdf, 0x60, 0x40, 0xcf,
+  0x70, 0x47, 0xb5, 0x02, 0xe1, 0xfb, 0xff, 0x01, 0x68, 0x42, 0x68, 0x06,
+  0xb4, 0x00, 0xf0, 0xfd, 0xd2, 0x29, 0x00, 0xb1, 0xfa, 0x06, 0xbc, 0x01,
+  0x60, 0xef, 0x28, 0x29, 0x05, 0xd0, 0xb9, 0x03, 0x61, 0x4e, 0x00, 0xfb,
+  0xf0, 0xca, 0x87, 0x00, 0x04, 0x32, 0x42, 0x60, 0x00, 0xeb, 0xf0, 0xc2,
+  0xdb, 0x04, 0xa4, 0x47, 0x08, 0x40, 0x00, 0x04, 0x7f, 0x3f, 0x70, 0x68,
+  0x38, 0x60, 0x36, 0x68, 0x47, 0x02, 0xff, 0x00, 0xf0, 0xdf, 0xf8, 0x01,
+  0x68, 0x28, 0x29, 0xf5, 0x09, 0x37, 0x04, 0x54, 0x37, 0x00, 0x8c, 0xfd,
+  0x00, 0xf0, 0xdf, 0x0b, 0xf9, 0x00, 0xf0, 0x85, 0x35, 0x00, 0x41, 0x68,
+  0x57, 0x04, 0x31, 0x41, 0x41, 0x00, 0x7f, 0x13, 0x00, 0x01, 0x13, 0x00,
+  0xf5, 0x7b, 0x13, 0x00, 0xc4, 0xdb, 0x04, 0x03, 0x64, 0x75, 0x3c, 0xff,
+  0x07, 0xcf, 0x8e, 0x42, 0x04, 0xd8, 0x01, 0xd1, 0xbf, 0x90, 0x42, 0x01,
+  0xd8, 0x00, 0x26, 0x4d, 0x00, 0x26, 0xdf, 0xf6, 0x43, 0x70, 0x47, 0xe4,
+  0x1f, 0x0a, 0x3e, 0x07, 0x6b, 0xcf, 0xb1, 0x1f, 0x04, 0x82, 0x1f, 0x14,
+  0x04, 0x0d, 0x7b, 0x07, 0xab, 0x3c, 0x00, 0x3f, 0x04, 0xdc, 0x3f, 0x04,
+  0xdc, 0x1f, 0x0e, 0x24, 0x96, 0x1f, 0x08, 0x3e, 0x00, 0x3f, 0x04, 0xdc,
+  0x3f, 0x04, 0x1f, 0x10, 0x40, 0xfe, 0x1f, 0x00, 0x62, 0x82, 0x03, 0x64,
+  0x30, 0x3c, 0x04, 0xf7, 0x37, 0xf6, 0x17, 0xc3, 0x06, 0xc6, 0xf8, 0x00,
+  0xf0, 0xdf, 0x10, 0xfb, 0x00, 0xbd, 0x68, 0x1b, 0x0a, 0x3d, 0x01, 0x7f,
+  0xcf, 0x06, 0x43, 0x01, 0x3e, 0xb6, 0x41, 0x1f, 0x02, 0xfa, 0xd9, 0x02,
+  0x1f, 0xd9, 0x00, 0x9f, 0xfa, 0x00, 0xf0, 0xd8, 0xa5, 0xfa, 0x0b, 0x03,
+  0x90, 0x63, 0x02, 0x27, 0x00, 0x3c, 0xa3, 0x00, 0x50, 0x47, 0x40, 0x4e,
+  0x40, 0x2b, 0x06, 0x5d, 0x02, 0x4d, 0x02, 0x16, 0x4d, 0x00, 0xf5, 0xd7,
+  0x27, 0x04, 0xdc, 0x27, 0x04, 0x02, 0x64, 0x3d, 0x00, 0x94, 0x27, 0x12,
+  0x25, 0x06, 0x03, 0x25, 0x00, 0xb1, 0x25, 0x00, 0x8b, 0x03, 0x2b, 0xed,
+  0xfb, 0x83, 0x06, 0xcf, 0xf9, 0x4f, 0x03, 0x00, 0xf0, 0xcb, 0xfe, 0x07,
+  0x00, 0xbd, 0xf9, 0x00, 0xbd, 0x40, 0x60, 0x00, 0xff, 0x00, 0x40, 0x68,
+  0x00, 0x00, 0x00, 0x43, 0x00, 0xfb, 0x00, 0xf0, 0x4b, 0x00, 0x20, 0x80,
+  0x03, 0x73, 0x70, 0xfd, 0x40, 0x8f, 0x02, 0x3e, 0x00, 0x70, 0x47, 0xc0,
+  0x46, 0xbb, 0x00, 0x0e, 0x13, 0x08, 0x21, 0x37, 0x00, 0xd7, 0x03, 0x14,
+  0x5a, 0x0f, 0x06, 0x72, 0x23, 0x06, 0x6e, 0x46, 0x23, 0x02, 0x24, 0x13,
+  0x0a, 0x57, 0x21, 0xb5, 0x46, 0x23, 0x02, 0x48, 0x0f, 0x00, 0x61, 0xbb,
+  0x00, 0xbb, 0x75, 0x70, 0x23, 0x02, 0x70, 0x47, 0x06, 0x7f, 0x00, 0xc4,
+  0xff, 0xfa, 0x01, 0x68, 0x42, 0x68, 0xff, 0xf7, 0xae, 0xff, 0xf9, 0x01,
+  0x60, 0x42, 0x60, 0x06, 0xbd, 0x74, 0xbe, 0x23, 0x04, 0x04, 0x64, 0x72,
+  0x6f, 0x70, 0x57, 0x04, 0x00, 0x7f, 0xb5, 0x01, 0x68, 0x1e, 0x29, 0x05,
+  0xd1, 0x31, 0x02, 0xdf, 0xa1, 0x4e, 0x02, 0xf0, 0x4c, 0xb7, 0x00, 0xff,
+  0xf7, 0xeb, 0xa1, 0xf9, 0xe3, 0x02, 0x8c, 0x2b, 0x02, 0x80, 0x04, 0x3f,
+  0xbe, 0x50, 0x00, 0x00, 0x00, 0x2e, 0x01, 0xd0, 0x55, 0x06, 0xc0, 0xf7,
+  0x46, 0xb8, 0x0e, 0x4b, 0x03, 0x04, 0x73, 0x77, 0x61, 0x7f, 0x70, 0x00,
+  0x39, 0x68, 0x3e, 0x60, 0x0e, 0xb1, 0x00, 0xfd, 0x0c, 0x6b, 0x00, 0x98,
+  0xfa, 0x02, 0x68, 0x83, 0x68, 0xff, 0x03, 0x60, 0x82, 0x60, 0x42, 0x68,
+  0xc3, 0x68, 0x7f, 0x43, 0x60, 0xc2, 0x60, 0x0c, 0xbd, 0xe4, 0x2b, 0x04,
+  0xbf, 0x03, 0x6e, 0x69, 0x70, 0x04, 0x37, 0x6d, 0x02, 0xff, 0xef, 0xf7,
+  0x7b, 0xfa, 0x81, 0x71, 0x00, 0x02, 0xd0, 0xff, 0x53, 0xf7, 0x74, 0x65,
+  0x00, 0x53, 0x02, 0x83, 0x77, 0x00, 0x10, 0x77, 0x00, 0xfb, 0x0c, 0x0f,
+  0x57, 0x04, 0x6f, 0x76, 0x65, 0x72, 0x00, 0x56, 0x17, 0x02, 0x7e, 0x68,
+  0x31, 0x06, 0x6c, 0x31, 0x00, 0xc2, 0xc3, 0x00, 0xdd, 0x4c, 0xc3, 0x04,
+  0x00, 0xbd, 0x34, 0x27, 0x06, 0x74, 0x75, 0xff, 0x63, 0x6b, 0x00, 0x01,
+  0xcf, 0x08, 0x3f, 0x7e, 0xf7, 0x60, 0x38, 0x60, 0x29, 0x06, 0x57, 0xfa,
+  0xff, 0xf7, 0xbf, 0x84, 0xff, 0x00, 0xf0, 0x2a, 0xf8, 0xbf, 0x02, 0x6c,
+  0xfe, 0x27, 0x00, 0x63, 0x82, 0x03, 0x72, 0x6f, 0x74, 0x03, 0x56, 0x25,
+  0x00, 0x78, 0x60, 0xa9, 0x06, 0x0e, 0x27, 0x00, 0x50, 0x15, 0x01, 0xff,
+  0x82, 0x68, 0x03, 0x69, 0x81, 0x60, 0x02, 0x61, 0xf7, 0x03, 0x60, 0x41,
+  0x5d, 0x00, 0x43, 0x69, 0xc1, 0x60, 0x5f, 0x42, 0x61, 0x43, 0x60, 0x0e,
+  0x37, 0x00, 0x90, 0x37, 0x04, 0xdb, 0x04, 0x2d, 0x38, 0x00, 0x00, 0x03,
+  0x5f, 0x04, 0x39, 0x60, 0xfb, 0x06, 0x00, 0x61, 0x06, 0xe0, 0xff, 0xff,
+  0xf7, 0xde, 0xdf, 0xff, 0x00, 0xbd, 0xa4, 0x0f, 0x7b, 0x03, 0x04, 0x70,
+  0xbd, 0x69, 0x83, 0x00, 0xb0, 0x00, 0x3e, 0x58, 0x17, 0x03, 0xbc, 0xfe,
+  0x13, 0x00, 0x00, 0x80, 0x05, 0x64, 0x65, 0x70, 0x74, 0xdf, 0x68, 0x4f,
+  0x49, 0xc9, 0x1b, 0xc3, 0x02, 0x8e, 0x08, 0xb7, 0x70, 0x47, 0xd8, 0x17,
+  0x04, 0x06, 0x72, 0x18, 0x04, 0x00, 0xde, 0xbf, 0x07, 0x48, 0x49, 0x89,
+  0x1b, 0x1b, 0x02, 0x0c, 0x10, 0xfe, 0x47, 0x00, 0x82, 0x02, 0x3e, 0x72,
+  0x00, 0x40, 0xb4, 0xee, 0x8f, 0x07, 0xff, 0xf7, 0x80, 0xc5, 0x00, 0xe8,
+  0xf9, 0xff, 0xf7, 0xf7, 0x25, 0xfa, 0x2b, 0x02, 0x3f, 0x4e, 0x01, 0x22,
+  0x7f, 0x8a, 0x40, 0x16, 0x43, 0x02, 0xf0, 0x7e, 0x13, 0x00, 0xb5, 0xd4,
+  0xd9, 0x00, 0x40, 0x33, 0x06, 0x72, 0x3e, 0x4b, 0x04, 0x40, 0xb5, 0xbc,
+  0x35, 0x06, 0x65, 0x35, 0x00, 0xbb, 0xf8, 0x85, 0x01, 0xf9, 0xab, 0x03,
+  0x60, 0x17, 0x02, 0x32, 0x37, 0x00, 0x9a, 0x37, 0x04, 0x62, 0x6a, 0x67,
+  0x01, 0x60, 0x33, 0x08, 0x40, 0x33, 0x04, 0x00, 0x9e, 0x33, 0x06, 0xbf,
+  0x4b, 0xfa, 0x02, 0xf0, 0x66, 0xfe, 0x2b, 0x03, 0x84, 0xfe, 0x1f, 0x04,
+  0x05, 0x72, 0x64, 0x72, 0x6f, 0x70, 0x01, 0xd5, 0xb0, 0x1d, 0x06, 0x3c,
+  0x7f, 0x04, 0x21, 0x9d, 0x01, 0x41, 0xf9, 0xba, 0x23, 0x02, 0x98, 0x23,
+  0x02, 0x80, 0x05, 0x72, 0xf4, 0x02, 0xb6, 0x6f, 0x00, 0x6e, 0x44, 0x36,
+  0x9f, 0x01, 0xc4, 0x10, 0xdb, 0x02, 0xff, 0x04, 0x72, 0x6f, 0x6c, 0x6c,
+  0x00, 0x00, 0x2e, 0xfb, 0x01, 0xd1, 0xc3, 0x02, 0xb0, 0x00, 0x39, 0x58,
+  0xc0, 0xff, 0x19, 0x03, 0x1f, 0x1a, 0x68, 0x02, 0x60, 0x04, 0x7f, 0x38,
+  0x01, 0x3e, 0xf9, 0xd1, 0x04, 0x37, 0x79, 0x03, 0xcb, 0x04, 0x11, 0x1f,
+  0x05, 0x2d, 0x2c, 0x04, 0x2b, 0x08, 0x38, 0x68, 0xff, 0x39, 0x46, 0x4a,
+  0x68, 0x0a, 0x60, 0x04, 0x31, 0xbf, 0x01, 0x3e, 0xfa, 0xd1, 0x08, 0x60,
+  0x13, 0x02, 0x04, 0xff, 0x37, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x20, 0x8c,
+  0xdf, 0x03, 0x00, 0x20, 0x00, 0xb4, 0x33, 0x00, 0xbc, 0x00, 0x7f, 0x00,
+  0x01, 0xb0, 0x00, 0x00, 0x1c, 0x11, 0xf7, 0x03, 0xff, 0x03, 0x61, 0x6e,
+  0x64, 0x01, 0xcf, 0x06, 0x40, 0x7c, 0x27, 0x00, 0x9d, 0x00, 0x6f, 0x4e,
+  0xc0, 0xe0, 0x38, 0x17, 0x06, 0x7f, 0x62, 0x69, 0x63, 0x01, 0xcf, 0xb0,
+  0x43, 0xa9, 0x03, 0xfe, 0x19, 0x02, 0x6a, 0x4e, 0xaf, 0xe0, 0xc0, 0x46,
+  0x50, 0x5e, 0x1b, 0x04, 0x02, 0x6f, 0x72, 0x00, 0x33, 0x00, 0x43, 0x19,
+  0x06, 0xdf, 0x64, 0x4e, 0xa6, 0xe0, 0x68, 0x33, 0x06, 0x78, 0x6f, 0xef,
+  0x72, 0x01, 0xcf, 0x46, 0x4b, 0x08, 0x5f, 0x4e, 0x9a, 0x9b, 0xe0, 0x80,
+  0x17, 0x04, 0x01, 0x2a, 0x15, 0x00, 0x2d, 0x08, 0x5b, 0xeb, 0x4e, 0x8f,
+  0x47, 0x00, 0xa0, 0x17, 0x00, 0x41, 0x80, 0x03, 0xff, 0x63, 0x6c, 0x7a,
+  0x30, 0x00, 0x06, 0xd0, 0x00, 0xff, 0x26, 0x40, 0x00, 0x02, 0xd0, 0x01,
+  0xd2, 0x01, 0x7f, 0x36, 0xfa, 0xe7, 0x70, 0x47, 0x20, 0x26, 0xf3, 0x00,
+  0xde, 0x1f, 0x00, 0x61, 0x80, 0x03, 0x72, 0x4f, 0x00, 0x20, 0xc6, 0xf9,
+  0x41, 0x17, 0x01, 0x0f, 0x0a, 0x6c, 0x00, 0x20, 0xb6, 0x19, 0xdd, 0x46,
+  0x11, 0x00, 0xc0, 0x46, 0xf8, 0x5b, 0x04, 0x07, 0x61, 0xff, 0x72, 0x73,
+  0x68, 0x69, 0x66, 0x74, 0x01, 0xcf, 0xdb, 0x30, 0x41, 0xab, 0x02, 0x00,
+  0xb5, 0x65, 0x02, 0x42, 0x4e, 0xfe, 0x05, 0x06, 0xff, 0xf7, 0xf5, 0xf8,
+  0x41, 0x68, 0x1f, 0xff, 0x29, 0x28, 0xd9, 0x1f, 0x21, 0x41, 0x60, 0x25,
+  0x97, 0xe0, 0x20, 0x12, 0x33, 0x02, 0x06, 0x32, 0x06, 0xc3, 0x00, 0xf0,
+  0xad, 0x40, 0x33, 0x0e, 0x37, 0x4e, 0x05, 0x06, 0x12, 0x9f, 0x00, 0x04,
+  0x55, 0x13, 0x27, 0x04, 0x6c, 0x27, 0x0a, 0xb0, 0x27, 0x10, 0x2f, 0x27,
+  0x04, 0xff, 0x00, 0x26, 0xff, 0xf7, 0xc7, 0xf8, 0x01, 0x68, 0xff, 0x28,
+  0x29, 0x03, 0xd0, 0x40, 0xcf, 0x00, 0xf0, 0xff, 0x21, 0xf8, 0x00, 0xbd,
+  0x04, 0x37, 0x41, 0x68, 0xbf, 0xfe, 0xf7, 0xaa, 0xff, 0x00, 0x29, 0x8d,
+  0x03, 0x00, 0xff, 0xbd, 0x1f, 0x29, 0x0a, 0xd8, 0x89, 0x01, 0x0e, 0xff,
+  0x43, 0x02, 0x68, 0xd2, 0x00, 0x16, 0x43, 0xff, 0xff, 0xf7, 0x32, 0xf9,
+  0x1e, 0x43, 0x02, 0xf0, 0x42, 0x7e, 0x29, 0x00, 0x40, 0xcf, 0xff, 0xf7,
+  0x2b, 0xf9, 0x47, 0x02, 0xaf, 0x1d, 0x4e, 0x1b, 0x02, 0x15, 0x02, 0x37,
+  0x15, 0x00, 0x0f, 0x7f, 0xb5, 0xff, 0xf7, 0x9d, 0xf8, 0x0c, 0xe0, 0x07,
+  0x02, 0xf5, 0x99, 0x5b, 0x00, 0x06, 0x47, 0x00, 0xff, 0xf7, 0xf9, 0xfd,
+  0xef, 0x82, 0x68, 0x28, 0x2a, 0x09, 0x02, 0xf4, 0xfd, 0xff, 0xbf, 0xf7,
+  0xcc, 0xf8, 0xff, 0xf7, 0xde, 0x03, 0x00, 0xbe, 0xff, 0xf8, 0xc9, 0x00,
+  0x82, 0x68, 0x0e, 0x43, 0x16, 0xfe, 0x3b, 0x00, 0x19, 0xf8, 0xfe, 0xf7,
+  0x6f, 0xff, 0x0f, 0x7d, 0xbd, 0xdb, 0x01, 0x40, 0x00, 0x00, 0x80, 0x43,
+  0x07, 0x00, 0xaa, 0x03, 0x00, 0x40, 0x0b, 0x00, 0x40, 0x0b, 0x02, 0x41,
+  0x03, 0x00, 0x10, 0x37, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x08, 0x1f,
+  0x00, 0x07, 0x02, 0xef, 0x20, 0x00, 0x00, 0x28, 0xe3, 0x00, 0x61, 0x82,
+  0x02, 0x7f, 0x30, 0x3d, 0x00, 0x01, 0x3e, 0xb6, 0x41, 0xdd, 0x02, 0xff,
+  0x00, 0xf0, 0x03, 0xf9, 0x00, 0xf0, 0xec, 0xfe, 0xff, 0xfe, 0xf7, 0x48,
+  0xff, 0x73, 0x49, 0x81, 0x62, 0xf7, 0x00, 0xbd, 0x50, 0x23, 0x04, 0x03,
+  0x30, 0x3c, 0x3e, 0xf6, 0x23, 0x02, 0xf6, 0x43, 0x25, 0x06, 0xf0, 0xf8,
+  0x00, 0xf0, 0xdd, 0xd9, 0x25, 0x00, 0x35, 0xff, 0x6a, 0x25, 0x04, 0xc0,
+  0x46, 0xbd, 0x74, 0x4b, 0x08, 0x3c, 0x00, 0xf6, 0x17, 0x23, 0x06, 0xde,
+  0xfd, 0xf8, 0xdd, 0x02, 0x63, 0x4e, 0x00, 0xf0, 0x05, 0xff, 0xf5, 0x63,
+  0x25, 0x04, 0x8c, 0x23, 0x00, 0x60, 0x80, 0x04, 0x74, 0xcf, 0x72, 0x75,
+  0x65, 0x00, 0x41, 0x07, 0x4f, 0x02, 0xc0, 0x46, 0xfd, 0xa0, 0x17, 0x04,
+  0x05, 0x66, 0x61, 0x6c, 0x73, 0x65, 0xf8, 0x17, 0x06, 0xef, 0x01, 0x13,
+  0x00, 0x42, 0x82, 0x02, 0x3e, 0x3d, 0xce, 0x7b, 0x03, 0x42, 0xe9, 0xda,
+  0x13, 0x02, 0x1b, 0x02, 0x51, 0x4e, 0xaa, 0x05, 0x06, 0xba, 0xa3, 0x01,
+  0xe8, 0x23, 0x06, 0x3c, 0x23, 0x06, 0xd7, 0xad, 0xdd, 0x23, 0x0a, 0x4a,
+  0x4e, 0x05, 0x06, 0xa8, 0x23, 0x00, 0x08, 0x6d, 0x14, 0x23, 0x02, 0x01,
+  0x3c, 0x21, 0x02, 0xc6, 0xdb, 0x21, 0x0a, 0x7d, 0x41, 0x21, 0x04, 0x3e,
+  0x4e, 0x97, 0xe0, 0x28, 0x1f, 0x06, 0xad, 0x3e, 0x1f, 0x02, 0xb6, 0xdc,
+  0x1f, 0x0a, 0x3b, 0x1f, 0x04, 0x38, 0xef, 0x4e, 0x87, 0xe0, 0x4c, 0x1f,
+  0x00, 0x62, 0x82, 0x03, 0x7f, 0x75, 0x3e, 0x3d, 0x01, 0xcf, 0x86, 0x1b,
+  0x01, 0x07, 0xba, 0x1b, 0x02, 0x2c, 0x21, 0x04, 0x2a, 0x4e, 0x76, 0x63,
+  0x00, 0x70, 0x5a, 0x23, 0x08, 0x3c, 0x23, 0x00, 0x36, 0x1a, 0x23, 0x0e,
+  0x2a, 0x23, 0x08, 0xf5, 0x64, 0x23, 0x00, 0x90, 0x23, 0x04, 0x02, 0x75,
+  0x3c, 0x00, 0xf4, 0x47, 0x06, 0x21, 0x06, 0x1a, 0x21, 0x04, 0x19, 0x4e,
+  0x53, 0xe0, 0x4d, 0xb0, 0x1f, 0x08, 0x3e, 0x00, 0x43, 0x06, 0x1f, 0x06,
+  0x1b, 0x1f, 0x04, 0x5f, 0x18, 0x4e, 0x43, 0xe0, 0xd0, 0x1f, 0x06, 0x3c,
+  0x1f, 0x02, 0x5f, 0x81, 0x1b, 0x36, 0x1a, 0x0e, 0x63, 0x08, 0x13, 0x21,
+  0x04, 0x2f, 0x33, 0xe0, 0x2c, 0x16, 0x1f, 0x02, 0x01, 0x81, 0x04, 0xcd,
+  0x07, 0x5a, 0x17, 0x02, 0x0d, 0x1d, 0x04, 0x24, 0xe0, 0xef, 0x01, 0xd2,
+  0x03, 0x00, 0x5f, 0xd3, 0x00, 0x00, 0xc0, 0x17, 0x07, 0x00, 0xd5, 0x03,
+  0x00, 0x55, 0xdb, 0x03, 0x00, 0xda, 0x03, 0x00, 0xdc, 0x03, 0x00, 0xdd,
+  0x03, 0x00, 0x55, 0xd8, 0x03, 0x00, 0xd9, 0x03, 0x00, 0xd0, 0x03, 0x00,
+  0xd1, 0x03, 0x00, 0xff, 0xb5, 0xfe, 0xf7, 0x4e, 0xff, 0xfe, 0xf7, 0x7f,
+  0xea, 0xe5, 0x01, 0x82, 0x03, 0x00, 0x85, 0x03, 0x00, 0x8f, 0xff, 0x00,
+  0x55, 0xbd, 0x17, 0x02, 0x4c, 0x17, 0x00, 0x73, 0x0f, 0x00, 0x76, 0x13,
+  0x04, 0xff, 0x82, 0x68, 0x28, 0x2a, 0x04, 0xd1, 0xff, 0xf7, 0xff, 0xa6,
+  0xfc, 0x39, 0x68, 0x3e, 0x60, 0x0e, 0x46, 0xff, 0x40, 0xcf, 0x01, 0x68,
+  0x28, 0x29, 0x09, 0xd1, 0xbf, 0x41, 0x68, 0xff, 0x29, 0x06, 0xd8, 0x7f,
+  0x02, 0x63, 0xff, 0x4e, 0x0e, 0x43, 0x81, 0x68, 0x09, 0x02, 0x06, 0xdf,
+  0xe0, 0xfe, 0xf7, 0x63, 0xff, 0x11, 0x02, 0x60, 0x4e, 0xff, 0xc9, 0x00,
+  0x16, 0x43, 0x0e, 0x43, 0x01, 0xf0, 0xf5, 0xbc, 0x43, 0x00, 0x12, 0x03,
+  0x00, 0x10, 0xfe, 0x86, 0x62, 0xff, 0x40, 0xcf, 0x00, 0xbd, 0x0f, 0xb5,
+  0x5a, 0x48, 0xbf, 0x81, 0x6a, 0x00, 0x29, 0x30, 0xd0, 0x27, 0x02, 0x86,
+  0xff, 0x6a, 0x00, 0x21, 0x81, 0x62, 0x31, 0x0a, 0xd5, 0xff, 0x29, 0x01,
+  0xd1, 0x40, 0xcf, 0x0f, 0xbd, 0xfe, 0xff, 0xf7, 0xf2, 0xfd, 0xfe, 0xf7,
+  0xcf, 0xfe, 0x03, 0xff, 0x60, 0xd2, 0x29, 0x03, 0xd1, 0x50, 0x4e, 0x00,
+  0xff, 0xf0, 0xd7, 0xfd, 0x0f, 0xbd, 0xd3, 0x29, 0x05, 0xfb, 0xd1, 0x4d,
+  0x0b, 0x00, 0xd1, 0xfd, 0x00, 0xf0, 0xe2, 0x7e, 0x0f, 0x00, 0x02, 0x36,
+  0x01, 0xf0, 0x90, 0xfe, 0x3f, 0x02, 0xcd, 0x49, 0x15, 0x00, 0x0d, 0xf8,
+  0x25, 0x02, 0x0d, 0x02, 0x46, 0x4e, 0xd7, 0x01, 0xf0, 0x84, 0x17, 0x04,
+  0x43, 0x17, 0x00, 0x01, 0xf8, 0x75, 0x0f, 0xcd, 0x04, 0xdb, 0x7d, 0x00,
+  0x4d, 0xff, 0x01, 0x9f, 0x00, 0x76, 0x8f, 0x02, 0x74, 0xfe, 0xe3, 0x02,
+  0x81, 0x6a, 0x09, 0x73, 0x04, 0x7f, 0xfe, 0xf7, 0xc4, 0xfd, 0x00, 0xbd,
+  0x48, 0x5b, 0x05, 0xff, 0x03, 0x6d, 0x69, 0x6e, 0x01, 0xcf, 0xb0, 0x42,
+  0xef, 0x00, 0xdc, 0x06, 0x00, 0x5d, 0x07, 0x33, 0x4e, 0x2b, 0x5b, 0xe0,
+  0x64, 0x1b, 0x08, 0x61, 0x78, 0x1b, 0x04, 0xdb, 0x1b, 0x0a, 0xdf, 0x2d,
+  0x4e, 0x1d, 0xe0, 0x84, 0x1b, 0x04, 0x04, 0x75, 0xea, 0x1c, 0x00, 0x00,
+  0x1d, 0x04, 0xd3, 0x1d, 0x0a, 0x27, 0x4e, 0x0e, 0xdf, 0xe0, 0xc0, 0x46,
+  0x28, 0x17, 0x1f, 0x08, 0x69, 0x6e, 0xda, 0x1f, 0x06, 0xd8, 0x1f, 0x0a,
+  0x20, 0x4e, 0x99, 0x02, 0x98, 0xfe, 0x7f, 0x01, 0x68, 0x82, 0x68, 0x91,
+  0x42, 0x03, 0xfb, 0x00, 0xdc, 0x81, 0x01, 0x89, 0x00, 0x06, 0x2a, 0x01,
+  0x69, 0x01, 0xf1, 0xfb, 0x7c, 0x61, 0x03, 0x09, 0x02, 0xec, 0xfb, 0xfe,
+  0xf7, 0xef, 0xbf, 0x00, 0xbf, 0xc2, 0xfe, 0xc9, 0x00, 0x02, 0x68, 0x39,
+  0x02, 0x09, 0xfa, 0x6b, 0x01, 0x16, 0xc7, 0x00, 0x10, 0xfe, 0x01, 0xf0,
+  0x0e, 0x2a, 0xeb, 0x04, 0x0e, 0x11, 0x08, 0x07, 0x27, 0x00, 0x63, 0x43,
+  0x00, 0xdb, 0x01, 0xdf, 0x28, 0x00, 0x00, 0x80, 0x42, 0x06, 0x04, 0x20,
+  0x80, 0x55, 0x41, 0x0f, 0x00, 0x20, 0x03, 0x00, 0xe0, 0x03, 0x00, 0xdb,
+  0x03, 0x00, 0xd5, 0xdc, 0x03, 0x00, 0xd8, 0x03, 0x00, 0xd3, 0x03, 0x00,
+  0x46, 0x00, 0xfb, 0x00, 0x68, 0xa3, 0x00, 0x00, 0x80, 0x04, 0x6d, 0x6f,
+  0xff, 0x76, 0x65, 0x00, 0x07, 0xb5, 0x31, 0x00, 0x40, 0xfb, 0xcf, 0x32,
+  0x03, 0x00, 0x00, 0x29, 0x0f, 0xd0, 0xb2, 0xff, 0x42, 0x0d, 0xd0, 0x06,
+  0xd3, 0x01, 0x3e, 0x01, 0xff, 0x3a, 0x70, 0x5c, 0x50, 0x54, 0x01, 0x39,
+  0xfb, 0xff, 0xd1, 0x05, 0xe0, 0x30, 0x78, 0x10, 0x70, 0x01, 0xbf, 0x36,
+  0x01, 0x32, 0x01, 0x39, 0xf9, 0xb3, 0x00, 0x07, 0xef, 0xbd, 0xc0, 0x46,
+  0x8c, 0x3f, 0x06, 0x66, 0x69, 0x6c, 0xd7, 0x6c, 0x00, 0x30, 0x39, 0x00,
+  0x31, 0x3d, 0x04, 0x02, 0xd0, 0xdf, 0x01, 0x39, 0x70, 0x54, 0xfc, 0x23,
+  0x00, 0x70, 0x47, 0xf7, 0xc0, 0x46, 0xcc, 0x23, 0x00, 0x20, 0x82, 0x01,
+  0x40, 0xeb, 0x36, 0x68, 0xfd, 0x06, 0x99, 0xfd, 0x04, 0x0f, 0xfe, 0x03,
+  0xff, 0x68, 0x28, 0x2b, 0x08, 0xd1, 0x43, 0x68, 0x7c, 0xff, 0x21, 0x19,
+  0x40, 0x09, 0x01, 0x0e, 0x43, 0x7c, 0xff, 0x21, 0x8b, 0x43, 0xfe, 0xf7,
+  0x87, 0xfd, 0xdb, 0xbb, 0x00, 0x1e, 0x07, 0x00, 0x8c, 0xfe, 0x1e, 0xd5,
+  0x00, 0x9c, 0xf6, 0xd1, 0x00, 0x24, 0x18, 0x3f, 0x04, 0x21, 0x03, 0xcf,
+  0x30, 0x6b, 0x60, 0x0e, 0x41, 0x09, 0x89, 0x43, 0x04, 0xf7, 0xfd, 0x43,
+  0x02, 0xbd, 0x09, 0x43, 0x1c, 0x65, 0xfd, 0x03, 0x60, 0x45, 0x02, 0x83,
+  0xfe, 0x1d, 0x00, 0x02, 0xd1, 0xc3, 0x68, 0xfe, 0xf7, 0x50, 0xfd, 0xfd,
+  0x4d, 0x02, 0x75, 0xfd, 0xfe, 0xf7, 0xcb, 0xfc, 0x5f, 0xfe, 0xf7, 0xc9,
+  0xfc, 0x00, 0xbb, 0x00, 0x5c, 0x57, 0x04, 0xff, 0x02, 0x2b, 0x21, 0x00,
+  0x03, 0xcf, 0x32, 0x68, 0xe7, 0x12, 0x18, 0x32, 0x5d, 0x04, 0x57, 0x02,
+  0xcb, 0xfd, 0xff, 0xff, 0xf7, 0xf8, 0xfa, 0xff, 0xf7, 0xa8, 0xff, 0xff,
+  0xff, 0xf7, 0x7f, 0xfb, 0x00, 0xf0, 0x09, 0xfc, 0xff, 0x7f, 0xf7, 0x26,
+  0xfb, 0xff, 0xf7, 0xc2, 0xff, 0x37, 0x02, 0x7d, 0xa0, 0x37, 0x06, 0x68,
+  0x40, 0x00, 0x36, 0x88, 0x2f, 0x06, 0x5b, 0xa9, 0xfd, 0x93, 0x02, 0x65,
+  0x4e, 0xd1, 0x0a, 0x3e, 0x8d, 0x00, 0x55, 0x49, 0x8d, 0x00, 0x3e, 0x8d,
+  0x04, 0x1e, 0xd1, 0x08, 0x23, 0xd1, 0x04, 0xcb, 0x33, 0xfd, 0x43, 0x02,
+  0xf8, 0x43, 0x08, 0x7b, 0x02, 0x30, 0x80, 0x9a, 0x77, 0x0a, 0x8f, 0x47,
+  0x04, 0x54, 0x4e, 0xd5, 0x0a, 0x47, 0x16, 0xfa, 0xad, 0xfc, 0xd5, 0x1a,
+  0xe5, 0xfc, 0x51, 0x02, 0x0a, 0xd5, 0x00, 0x60, 0xda, 0xd5, 0x00, 0x5e,
+  0xd5, 0x00, 0x30, 0x19, 0x57, 0x02, 0x03, 0x68, 0x4d, 0x2b, 0x2d, 0x01,
+  0x32, 0x88, 0xd3, 0x00, 0x5b, 0x0c, 0x61, 0xd3, 0x00, 0x55, 0x8e, 0xd3,
+  0x00, 0xa7, 0xd3, 0x00, 0x15, 0xd3, 0x00, 0x9f, 0xcf, 0x00, 0xd5, 0xbc,
+  0x0f, 0x00, 0xc3, 0xd3, 0x04, 0x74, 0x37, 0x04, 0x02, 0x63, 0xaa, 0xd3,
+  0x00, 0x78, 0x2f, 0x06, 0x3f, 0x8b, 0x04, 0x32, 0xd3, 0x0c, 0x1f, 0x6a,
+  0x8b, 0x00, 0x89, 0x8b, 0x00, 0x1f, 0x8b, 0x04, 0xb4, 0xfc, 0xd3, 0x06,
+  0x49, 0xb9, 0x57, 0x05, 0x4f, 0x07, 0xcc, 0x43, 0x08, 0xd3, 0x04, 0x70,
+  0x77, 0x0a, 0xa5, 0x25, 0x47, 0x04, 0x21, 0xd3, 0x0c, 0x47, 0x16, 0x90,
+  0xd3, 0x1c, 0x7b, 0xfa, 0xd3, 0x04, 0xa0, 0xcf, 0x00, 0xf6, 0xfb, 0xfe,
+  0xf7, 0xf4, 0x5f, 0xfb, 0x00, 0xbd, 0x1c, 0x1a, 0xd3, 0x04, 0x63, 0xd3,
+  0x04, 0xa9, 0x78, 0xd3, 0x00, 0x5b, 0x0c, 0xf7, 0x97, 0x01, 0x24, 0xd3,
+  0x08, 0xab, 0xaf, 0xfa, 0x00, 0xf0, 0x35, 0xd3, 0x00, 0x52, 0xd3, 0x08,
+  0x00, 0x57, 0x00, 0x00, 0x68, 0x03, 0x00, 0x60, 0x03, 0x00, 0x88, 0x03,
+  0x00, 0xf5, 0x80, 0x03, 0x00, 0x78, 0x03, 0x00, 0x70, 0x00, 0x00, 0x5c,
+  0xde, 0x4f, 0x04, 0x04, 0x62, 0x69, 0x73, 0xf9, 0x07, 0x02, 0x43, 0xda,
+  0xf9, 0x0f, 0xce, 0x51, 0x00, 0xfb, 0xf9, 0x4d, 0x00, 0xfe, 0xff, 0xf7,
+  0xf7, 0x82, 0xfa, 0xb9, 0x02, 0xab, 0x4e, 0xff, 0xf7, 0x59, 0x27, 0xff,
+  0x03, 0x57, 0x00, 0xc2, 0xfe, 0xe7, 0x02, 0x9c, 0x3f, 0x0a, 0x55, 0x63,
+  0x3f, 0x06, 0x82, 0x3f, 0x10, 0xae, 0x29, 0x00, 0xdb, 0x3f, 0x00, 0x55,
+  0x8b, 0x3f, 0x00, 0x62, 0x3f, 0x04, 0x9c, 0x3f, 0x00, 0x03, 0x15, 0x00,
+  0xd5, 0x06, 0x3f, 0x00, 0xa2, 0x3f, 0x04, 0xdc, 0x3f, 0x06, 0x78, 0x6f,
+  0xad, 0x72, 0x3f, 0x06, 0x42, 0x40, 0x3f, 0x0e, 0x8e, 0x29, 0x00, 0xbb,
+  0xaa, 0x3f, 0x00, 0x6b, 0x3f, 0x00, 0x42, 0x3f, 0x04, 0x8d, 0x3f, 0x00,
+  0xe7, 0x6a, 0xd7, 0x00, 0xe6, 0x15, 0x00, 0x82, 0x3f, 0x04, 0x10, 0x1b,
+  0x7f, 0x08, 0xff, 0x74, 0x40, 0x00, 0x01, 0xcf, 0x36, 0x68, 0x06, 0x7f,
+  0x40, 0x01, 0x3e, 0xb6, 0x41, 0xf6, 0x43, 0x41, 0x06, 0xad, 0x6d, 0x41,
+  0x00, 0x4c, 0xfe, 0x39, 0x02, 0x7f, 0x39, 0x00, 0xca, 0x6a, 0x39, 0x00,
+  0x16, 0x9d, 0x01, 0x50, 0x33, 0x04, 0x05, 0x68, 0xf4, 0x02, 0xaa, 0x73,
+  0x00, 0x88, 0xf3, 0x00, 0x80, 0x73, 0x0a, 0x54, 0x31, 0x00, 0x81, 0xaa,
+  0x5d, 0x00, 0x9a, 0x73, 0x00, 0x08, 0x73, 0x04, 0x6e, 0x39, 0x00, 0xad,
+  0xaa, 0x39, 0x00, 0xac, 0x15, 0x00, 0xb3, 0x73, 0x04, 0x90, 0x3f, 0x0c,
+  0x63, 0xaa, 0x3f, 0x04, 0x82, 0x3f, 0x10, 0x34, 0x3f, 0x00, 0x61, 0x29,
+  0x00, 0x7a, 0x56, 0x3f, 0x00, 0xe8, 0xf9, 0x3f, 0x02, 0x5f, 0x3f, 0x00,
+  0x89, 0x3f, 0x00, 0x15, 0x8c, 0x15, 0x00, 0x93, 0x3f, 0x04, 0xd0, 0x3f,
+  0x08, 0xf4, 0x02, 0x3f, 0x02, 0x54, 0xf3, 0x00, 0x3f, 0x0c, 0x14, 0x3f,
+  0x00, 0x41, 0x29, 0x00, 0x5a, 0x3f, 0x00, 0x55, 0xc8, 0x3f, 0x04, 0x50,
+  0x3f, 0x00, 0x6d, 0x3f, 0x00, 0x6c, 0x15, 0x00, 0x6d, 0x73, 0x3f, 0x04,
+  0x04, 0x1c, 0x7f, 0x0a, 0x74, 0x40, 0xf3, 0x00, 0x55, 0x88, 0xf3, 0x16,
+  0xf3, 0x2b, 0x00, 0x3b, 0xf3, 0x04, 0x42, 0x39, 0x00, 0x7d, 0x50, 0x0d,
+  0x00, 0x9c, 0xfb, 0x00, 0xbd, 0x44, 0x33, 0x06, 0x55, 0x63, 0xf3, 0x08,
+  0x78, 0xf3, 0x00, 0x70, 0x73, 0x0a, 0xda, 0x23, 0x00, 0x55, 0x07, 0x5d,
+  0x00, 0x8a, 0x73, 0x00, 0x8e, 0x73, 0x04, 0x31, 0x39, 0x00, 0x55, 0x33,
+  0x15, 0x00, 0x32, 0x15, 0x00, 0xa3, 0x73, 0x04, 0x84, 0x3f, 0x0c, 0xd6,
+  0xf3, 0x04, 0x78, 0x82, 0x3f, 0x10, 0xba, 0x29, 0x00, 0xe7, 0xf8, 0x57,
+  0xff, 0xf7, 0x6a, 0x3f, 0x00, 0x6e, 0x3f, 0x04, 0x22, 0x3f, 0x00, 0x55,
+  0x0f, 0x15, 0x00, 0x12, 0x3f, 0x00, 0x83, 0x3f, 0x04, 0xc4, 0x3f, 0x08,
+  0x52, 0xf3, 0x08, 0x78, 0xf3, 0x00, 0x3f, 0x0c, 0x9a, 0x29, 0x00, 0xc7,
+  0x3f, 0x00, 0xd5, 0x4a, 0x3f, 0x00, 0x4e, 0x3f, 0x04, 0x13, 0x3f, 0x00,
+  0xf3, 0xfa, 0xd7, 0xff, 0xf7, 0xf2, 0x15, 0x00, 0x63, 0x3f, 0x04, 0x08,
+  0x1d, 0x54, 0x7f, 0x0a, 0xf3, 0x04, 0x78, 0xf3, 0x16, 0x79, 0x41, 0x00,
+  0x2b, 0xf3, 0x04, 0xd5, 0x05, 0x39, 0x00, 0xd6, 0x39, 0x00, 0x22, 0xf3,
+  0x00, 0x00, 0x43, 0x77, 0x00, 0x00, 0x80, 0x03, 0x00, 0x40, 0x40, 0x00,
+  0x04, 0x00, 0xf7, 0x00, 0x00, 0xf0, 0x43, 0x00, 0x00, 0x80, 0x06, 0x66,
+  0xff, 0x6c, 0x61, 0x73, 0x68, 0x21, 0x00, 0x30, 0x00, 0xf7, 0x40, 0xcf,
+  0x31, 0x03, 0x00, 0x79, 0x4b, 0x98, 0x42, 0xff, 0x53, 0xd3, 0x03, 0x22,
+  0x02, 0x40, 0x1a, 0xd1, 0xff, 0x00, 0x29, 0x17, 0xd0, 0x02, 0x68, 0x00,
+  0x2a, 0xff, 0x32, 0xd1, 0x74, 0x4a, 0x80, 0x18, 0x74, 0x4a, 0x4f, 0x75,
+  0x4b, 0x13, 0x60, 0x03, 0x04, 0x09, 0x0c, 0x01, 0x0b, 0x00, 0xff, 0x13,
+  0x68, 0x01, 0x21, 0x0b, 0x40, 0xfb, 0xd1, 0xbf, 0x73, 0x4a, 0x07, 0x23,
+  0x13, 0x60, 0x81, 0x00, 0xf0, 0xff, 0xdc, 0xfd, 0x30, 0x41, 0x64, 0x64,
+  0x72, 0x65, 0xff, 0x73, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0xff,
+  0x6f, 0x20, 0x62, 0x65, 0x20, 0x34, 0x2d, 0x61, 0xff, 0x6c, 0x69, 0x67,
+  0x6e, 0x65, 0x64, 0x20, 0x66, 0xff, 0x6f, 0x72, 0x20, 0x77, 0x72, 0x69,
+  0x74, 0x69, 0xf7, 0x6e, 0x67, 0x20, 0x7d, 0x04, 0x20, 0x21, 0x0a, 0x00,
+  0xff, 0x02, 0xf0, 0x27, 0xfd, 0x00, 0xf0, 0xbf, 0xfd, 0xfb, 0x29, 0x46,
+  0x11, 0x04, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0xff, 0x69, 0x6f, 0x6e, 0x20,
+  0x63, 0x61, 0x6e, 0x6e, 0xf3, 0x6f, 0x74, 0x40, 0x02, 0x32, 0x02, 0x74,
+  0x65, 0x6e, 0x20, 0xdf, 0x74, 0x77, 0x69, 0x63, 0x65, 0x32, 0x00, 0x02,
+  0xf0, 0x3d, 0x0e, 0x31, 0x00, 0xa6, 0xfd, 0x19, 0x43, 0x22, 0x06, 0x1f,
+  0x02, 0xef, 0x65, 0x20, 0x69, 0x6e, 0x6e, 0x00, 0x63, 0x6f, 0x72, 0x7e,
+  0x21, 0x06, 0xfd, 0xfc, 0xc0, 0x46, 0x68, 0x1e, 0xe7, 0x02, 0xfd, 0x0e,
+  0x69, 0x04, 0x70, 0x61, 0x67, 0x65, 0x65, 0x72, 0xbf, 0x61, 0x73, 0x65,
+  0x00, 0x0f, 0xb5, 0xf1, 0x02, 0x3d, 0xee, 0xed, 0x00, 0x1b, 0xd3, 0x3d,
+  0xdd, 0x00, 0x3d, 0x4a, 0x3d, 0xcc, 0xcf, 0x00, 0x03, 0x04, 0x4a, 0x3e,
+  0x05, 0x00, 0x03, 0x02, 0x3f, 0x4a, 0xfd, 0x3f, 0x05, 0x00, 0x7f, 0x21,
+  0x88, 0x43, 0x00, 0x22, 0xd7, 0x02, 0x60, 0x3a, 0xe9, 0x0c, 0x39, 0xe9,
+  0x04, 0x0f, 0xbd, 0x1f, 0x00, 0xf0, 0x67, 0xfd, 0x14, 0x7d, 0x08, 0x55,
+  0x04, 0x78, 0x0a, 0x2e, 0xcd, 0x00, 0xc0, 0xfc, 0xe4, 0x77, 0x04, 0x0a,
+  0x18, 0x04, 0x7c, 0x04, 0xff, 0x00, 0x22, 0x48, 0x72, 0xb6, 0x2c, 0x49,
+  0x03, 0xdf, 0x88, 0x00, 0x2b, 0x1c, 0xd0, 0x9d, 0x03, 0x06, 0x00, 0x7e,
+  0x05, 0x02, 0x00, 0xf0, 0x44, 0xfd, 0x10, 0x45, 0x3e, 0x04, 0xfd, 0x62,
+  0xf6, 0x00, 0x6b, 0x20, 0x61, 0x74, 0x20, 0x20, 0xfa, 0x9e, 0x01, 0xb1,
+  0xdd, 0x00, 0x37, 0xfd, 0x0c, 0x20, 0x66, 0xef, 0x72, 0x6f, 0x6d, 0x20,
+  0x15, 0x05, 0x0a, 0x00, 0xff, 0xff, 0xf7, 0xa3, 0xff, 0x02, 0x30, 0x88,
+  0x42, 0xdc, 0xff, 0xd1, 0x00, 0xf0, 0x29, 0xfd, 0x12, 0x46, 0x69, 0xff,
+  0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x2e, 0x20, 0xdf, 0x52, 0x65, 0x73,
+  0x65, 0x74, 0x79, 0x06, 0x21, 0xfd, 0x8f, 0xc0, 0x46, 0x7c, 0x1f, 0xf3,
+  0x04, 0x7b, 0x0e, 0x44, 0x02, 0x00, 0xdb, 0x72, 0xb6, 0xf3, 0x02, 0xbc,
+  0xe7, 0x1b, 0x00, 0x50, 0x00, 0xfe, 0x00, 0x02, 0x08, 0x0c, 0x20, 0x02,
+  0x40, 0xef, 0xcd, 0x7f, 0xab, 0x89, 0x05, 0x04, 0x03, 0x02, 0x10, 0x0b,
+  0x00, 0xff, 0xbf, 0xae, 0x9d, 0x8c, 0x16, 0x15, 0x14, 0x13, 0xb5, 0x18,
+  0x0b, 0x00, 0x04, 0x03, 0x00, 0x08, 0x02, 0x26, 0x02, 0x01, 0xdf, 0x00,
+  0x46, 0x48, 0x60, 0x21, 0x03, 0x01, 0x80, 0x02, 0xff, 0x30, 0x01, 0x39,
+  0xfb, 0xd1, 0x70, 0x47, 0x42, 0xfe, 0x0f, 0x00, 0x02, 0x88, 0x00, 0x2a,
+  0x12, 0xd0, 0x00, 0xff, 0xf0, 0xe5, 0xfc, 0x1d, 0x55, 0x6e, 0x70, 0x61,
+  0xfb, 0x69, 0x72, 0xda, 0x01, 0x31, 0x36, 0x2d, 0x62, 0x69, 0x69, 0x74,
+  0xad, 0x06, 0x90, 0x07, 0x2e, 0x85, 0x01, 0x3a, 0xfc, 0x37, 0x02, 0x6d,
+  0xe6, 0x37, 0x00, 0x54, 0x20, 0x97, 0x02, 0x07, 0x68, 0x93, 0x04, 0xef,
+  0x21, 0x30, 0xb5, 0x32, 0x8f, 0x00, 0x50, 0x08, 0x13, 0xbf, 0xd3, 0x00,
+  0xf0, 0xc2, 0xfc, 0x1e, 0x15, 0x08, 0x20, 0xff, 0x6e, 0x65, 0x65, 0x64,
+  0x73, 0x20, 0x65, 0x76, 0xfe, 0xeb, 0x01, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0xf7, 0x65, 0x73, 0x2e, 0xd9, 0x02, 0x16, 0xfc, 0x02, 0x23,
+  0xff, 0x53, 0x40, 0x23, 0x48, 0x20, 0x21, 0x04, 0x88, 0xff, 0x45, 0x88,
+  0x2d, 0x04, 0x2c, 0x43, 0x9c, 0x42, 0x77, 0x2a, 0xd0, 0x06, 0x5b, 0x00,
+  0xf6, 0xd1, 0x1e, 0x15, 0x10, 0xf5, 0x1a, 0x13, 0x04, 0xf7, 0x23, 0x01,
+  0x97, 0xfc, 0x27, 0x54, 0xff, 0x6f, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79,
+  0x20, 0xf5, 0x75, 0xa4, 0x2e, 0x73, 0xa5, 0x02, 0xe7, 0xfb, 0x02, 0x80,
+  0xff, 0x12, 0x0c, 0x42, 0x80, 0x86, 0x80, 0x40, 0xcf, 0xff, 0x30, 0xbd,
+  0x02, 0x21, 0x11, 0x40, 0x03, 0xd0, 0xff, 0x02, 0x3a, 0x81, 0x88, 0x36,
+  0x04, 0x01, 0xe0, 0xbf, 0x81, 0x88, 0x09, 0x04, 0x0e, 0x43, 0xad, 0x03,
+  0x16, 0xff, 0x00, 0x00, 0x21, 0x01, 0x80, 0x41, 0x80, 0x81, 0xff, 0x80,
+  0xff, 0xf7, 0x65, 0xfe, 0x30, 0xbd, 0x00, 0xbf, 0x00, 0x8c, 0x03, 0x00,
+  0x20, 0x80, 0xd7, 0x00, 0x62, 0xff, 0x82, 0x01, 0x2b, 0x01, 0xcf, 0x36,
+  0x18, 0x70, 0x7f, 0x47, 0x00, 0xb5, 0xfe, 0xf7, 0xb7, 0xf9, 0x2d, 0x02,
+  0xfb, 0xce, 0x4e, 0x05, 0x06, 0x81, 0x68, 0x28, 0x29, 0x12, 0xff, 0xd1,
+  0xfe, 0xf7, 0x11, 0xff, 0x0f, 0xe0, 0xe8, 0xbe, 0x2b, 0x06, 0x2d, 0x01,
+  0xcf, 0x86, 0x1b, 0x2b, 0x06, 0xa1, 0xf6, 0x2b, 0x04, 0xc5, 0x4e, 0x05,
+  0x06, 0xfe, 0xf7, 0xd8, 0xf9, 0xfd, 0x01, 0x2f, 0x00, 0x0e, 0xd1, 0x41,
+  0x68, 0xff, 0x29, 0xff, 0x0b, 0xd8, 0x40, 0xcf, 0xfe, 0xf7, 0xe3, 0xf9,
+  0xff, 0x0e, 0x43, 0x81, 0x68, 0x09, 0x02, 0x0e, 0x43, 0xff, 0x01, 0xf0,
+  0x20, 0xf9, 0xfe, 0xf7, 0x76, 0xf8, 0xff, 0x00, 0xbd, 0x04, 0x37, 0xfe,
+  0xf7, 0xb9, 0xf9, 0xff, 0x89, 0x01, 0x82, 0x68, 0xd2, 0x00, 0x0e, 0x43,
+  0xff, 0x16, 0x43, 0xfe, 0xf7, 0x6b, 0xf8, 0xfe, 0xf7, 0xf7, 0xfe, 0xf9,
+  0x1e, 0x23, 0x00, 0x0e, 0xf9, 0x00, 0xbd, 0xff, 0x00, 0x21, 0x00, 0x00,
+  0x61, 0x82, 0x02, 0x31, 0xbf, 0x2d, 0x00, 0x01, 0x3e, 0x70, 0x47, 0x5b,
+  0x02, 0xaf, 0xbf, 0x4e, 0x3c, 0xe0, 0xc0, 0x46, 0x18, 0x17, 0x08, 0x2b,
+  0x77, 0x00, 0x01, 0x36, 0x17, 0x06, 0xaa, 0x4e, 0x30, 0x17, 0x00, 0xbd,
+  0x30, 0x17, 0x06, 0x32, 0x2d, 0x00, 0x02, 0x2f, 0x08, 0xa5, 0xeb, 0x4e,
+  0x24, 0x17, 0x00, 0x48, 0x17, 0x08, 0x2b, 0x00, 0x02, 0xae, 0x2f, 0x08,
+  0xa0, 0x4e, 0x18, 0x17, 0x00, 0x60, 0x17, 0x04, 0x05, 0xbf, 0x63, 0x65,
+  0x6c, 0x6c, 0x2b, 0x04, 0x19, 0x08, 0x9a, 0xef, 0x4e, 0x0b, 0xe0, 0x90,
+  0x17, 0x04, 0x06, 0x6e, 0x65, 0x7f, 0x67, 0x61, 0x74, 0x65, 0x00, 0x76,
+  0x42, 0x19, 0x06, 0xab, 0x95, 0x4e, 0xe9, 0x02, 0x22, 0xd9, 0x00, 0xc9,
+  0xad, 0x00, 0xfe, 0xab, 0xf7, 0xaa, 0xa7, 0x04, 0xba, 0xc7, 0x00, 0xa8,
+  0x2f, 0x04, 0x03, 0xdf, 0x6e, 0x6f, 0x74, 0xf6, 0x43, 0x2b, 0x06, 0x8b,
+  0x4e, 0xdf, 0xe8, 0xe7, 0xc0, 0x46, 0xc0, 0x17, 0x06, 0x73, 0x68, 0x77,
+  0x72, 0x76, 0x08, 0x17, 0x06, 0x86, 0x4e, 0xdc, 0x17, 0x00, 0xfd, 0xd0,
+  0x17, 0x0a, 0x6c, 0x76, 0x00, 0x70, 0x47, 0x06, 0x9b, 0xe0, 0xe8, 0x9f,
+  0x08, 0x2a, 0x00, 0x0f, 0x02, 0x27, 0x02, 0x40, 0xdb, 0x26, 0xc8, 0x27,
+  0x00, 0x00, 0x22, 0x9f, 0x0c, 0x73, 0xb6, 0x7e, 0x19, 0x08, 0x80, 0x26,
+  0xbb, 0xe7, 0x18, 0x22, 0x2f, 0x06, 0xef, 0x2f, 0x00, 0x76, 0x10, 0x15,
+  0x06, 0x71, 0x4e, 0xb0, 0xfa, 0x2f, 0x00, 0x58, 0x17, 0x04, 0x03, 0x61,
+  0x62, 0x73, 0xf0, 0xdf, 0x17, 0x36, 0x18, 0x46, 0x40, 0x9b, 0x07, 0xc9,
+  0xf8, 0x56, 0x21, 0x02, 0x00, 0x26, 0xb7, 0x0a, 0x4e, 0xb7, 0x04, 0x5e,
+  0x15, 0x04, 0xff, 0x64, 0x4e, 0x01, 0xf0, 0x59, 0xf8, 0xff, 0xf7, 0x7f,
+  0x8f, 0xff, 0x00, 0xbd, 0xc0, 0x46, 0xa0, 0x3f, 0x00, 0xff, 0x42, 0x80,
+  0x05, 0x75, 0x2f, 0x6d, 0x6f, 0x64, 0xff, 0x31, 0x00, 0x40, 0xcf, 0x00,
+  0x29, 0x03, 0xd1, 0xfe, 0x3b, 0x06, 0x70, 0x47, 0x01, 0x22, 0x00, 0x23,
+  0x8e, 0xff, 0x42, 0x06, 0xd9, 0x00, 0x31, 0x04, 0xd4, 0x52, 0xff, 0x00,
+  0x49, 0x00, 0x01, 0xd4, 0x8e, 0x42, 0xfa, 0xff, 0xd8, 0x8e, 0x42, 0x01,
+  0xd3, 0x76, 0x1a, 0x13, 0xbf, 0x43, 0x49, 0x08, 0x52, 0x08, 0xf8, 0x2b,
+  0x04, 0x1e, 0xd6, 0xa7, 0x00, 0x10, 0x23, 0x47, 0x02, 0x04, 0x46, 0x02,
+  0x00, 0x00, 0xfb, 0xb5, 0x30, 0x49, 0x02, 0x2e, 0x1c, 0xda, 0x76, 0x42,
+  0xbf, 0x00, 0x28, 0x0c, 0xda, 0x40, 0x42, 0x25, 0x02, 0x06, 0x5f, 0x00,
+  0xff, 0xf7, 0xce, 0xff, 0x19, 0x02, 0x76, 0x0f, 0x08, 0x6b, 0x00, 0xbd,
+  0x17, 0x0a, 0xc2, 0x17, 0x04, 0x40, 0x42, 0x19, 0x0e, 0x37, 0x00, 0x28,
+  0x07, 0x37, 0x10, 0xb2, 0xff, 0x49, 0x00, 0x2d, 0x0c, 0xd5, 0xab, 0xb9,
+  0x00, 0x24, 0x6f, 0x04, 0x03, 0x6e, 0x02, 0xb5, 0xff, 0xb7, 0xf7, 0xc6,
+  0xff, 0x6f, 0x00, 0xbd, 0x38, 0x13, 0x04, 0x01, 0xbd, 0x2f, 0x11, 0x02,
+  0xbd, 0xff, 0x04, 0x37, 0xdf, 0x02, 0x4c, 0xfe, 0x13, 0x00, 0x61, 0x80,
+  0x04, 0x65, 0x76, 0x65, 0x6e, 0xff, 0x00, 0x01, 0x20, 0x30, 0x40, 0x36,
+  0x18, 0x70, 0xfb, 0x47, 0x64, 0x13, 0x00, 0x81, 0x80, 0x04, 0x62, 0x61,
+  0xf7, 0x73, 0x65, 0x00, 0x53, 0x02, 0x20, 0x4e, 0x70, 0x47, 0xdf, 0x0a,
+  0x00, 0x00, 0x00, 0x7c, 0x17, 0x00, 0x00, 0x80, 0xff, 0x06, 0x62, 0x69,
+  0x6e, 0x61, 0x72, 0x79, 0x00, 0xff, 0x1b, 0x48, 0x02, 0x21, 0x01, 0x60,
+  0x70, 0x47, 0xf7, 0xc0, 0x46, 0x94, 0x17, 0x04, 0x07, 0x64, 0x65, 0x63,
+  0x7f, 0x69, 0x6d, 0x61, 0x6c, 0x15, 0x48, 0x0a, 0x17, 0x08, 0xfb, 0x24,
+  0x24, 0x17, 0x02, 0x03, 0x68, 0x65, 0x78, 0x10, 0x53, 0x48, 0x10, 0x13,
+  0x04, 0x0f, 0x00, 0x30, 0x03, 0x00, 0x18, 0x03, 0x00, 0x7d, 0x38, 0x03,
+  0x00, 0x1a, 0x00, 0x00, 0x40, 0x1e, 0x03, 0x00, 0x69, 0x1c, 0x26, 0x00,
+  0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x1d, 0x0f, 0x00, 0x5f, 0x42, 0x00,
+  0x00, 0xc0, 0x43, 0x07, 0x00, 0x08, 0x03, 0x00, 0xfd, 0x10, 0x13, 0x00,
+  0xd5, 0x00, 0x00, 0xfc, 0x1f, 0x00, 0xff, 0x20, 0x93, 0x49, 0x94, 0x48,
+  0x08, 0x60, 0x94, 0xff, 0x49, 0x01, 0x20, 0x08, 0x60, 0x08, 0x68, 0x04,
+  0xbf, 0x22, 0x10, 0x40, 0xfb, 0xd0, 0x91, 0x0d, 0x04, 0x91, 0x57, 0x49,
+  0x91, 0x48, 0x05, 0x02, 0x92, 0x05, 0x00, 0x92, 0x05, 0x08, 0xbd, 0x93,
+  0x05, 0x00, 0x93, 0x49, 0x8b, 0x20, 0x0b, 0x0a, 0x70, 0xfb, 0x47, 0x88,
+  0x8f, 0x04, 0x04, 0x69, 0x6e, 0x69, 0x74, 0xfd, 0x00, 0x03, 0x03, 0xd7,
+  0xff, 0x00, 0xf0, 0x71, 0xfa, 0xff, 0x49, 0x4d, 0x65, 0x63, 0x72, 0x69,
+  0x73, 0x70, 0x7f, 0x2d, 0x53, 0x74, 0x65, 0x6c, 0x6c, 0x61, 0x0a, 0x00,
+  0xff, 0x20, 0x52, 0x41, 0x20, 0x32, 0x2e, 0x33, 0x2e, 0xff, 0x33, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x4d, 0xff, 0x30, 0x20, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x66, 0xff, 0x6f, 0x72, 0x20, 0x53, 0x54, 0x4d, 0x33, 0x32,
+  0xff, 0x4c, 0x30, 0x35, 0x33, 0x43, 0x38, 0x20, 0x62, 0xff, 0x79, 0x20,
+  0x4d, 0x61, 0x74, 0x74, 0x68, 0x69, 0xff, 0x61, 0x73, 0x20, 0x4b, 0x6f,
+  0x63, 0x68, 0x0a, 0xf6, 0x4f, 0x03, 0xa4, 0x24, 0x3b, 0x03, 0x09, 0x68,
+  0x6f, 0x6f, 0xbf, 0x6b, 0x2d, 0x65, 0x6d, 0x69, 0x74, 0x3f, 0x03, 0x74,
+  0xa6, 0x3f, 0x01, 0x9a, 0x25, 0xd3, 0x00, 0x1b, 0x04, 0x08, 0x1b, 0x04,
+  0x6b, 0xab, 0x65, 0x79, 0x5b, 0x05, 0x6e, 0x1b, 0x00, 0xc2, 0x1b, 0x00,
+  0xe0, 0xaa, 0x1b, 0x04, 0x0a, 0x37, 0x0c, 0x3f, 0x1d, 0x04, 0x68, 0x1d,
+  0x00, 0xec, 0xa6, 0x39, 0x02, 0x46, 0xfc, 0x57, 0x10, 0x3b, 0x00, 0x3f,
+  0x1d, 0x02, 0x61, 0x7e, 0x1d, 0x00, 0x1a, 0x26, 0x00, 0x00, 0x1c, 0x25,
+  0x3b, 0x0e, 0xd7, 0x70, 0x61, 0x75, 0xb5, 0x09, 0x5b, 0x1d, 0x00, 0xd2,
+  0x48, 0xe6, 0x3b, 0x02, 0x34, 0x25, 0xf7, 0x04, 0x56, 0x02, 0x00, 0x0f,
+  0xb5, 0x7f, 0x51, 0x48, 0x00, 0xf0, 0x29, 0xf8, 0x0f, 0xab, 0x00, 0x75,
+  0x48, 0x17, 0x04, 0x03, 0x4e, 0x00, 0x0f, 0xb5, 0x4c, 0x15, 0x00, 0xd5,
+  0x1e, 0x15, 0x00, 0x5c, 0x13, 0x04, 0x05, 0x82, 0x04, 0x48, 0x48, 0x7f,
+  0x00, 0x68, 0x87, 0x46, 0xc0, 0x46, 0x70, 0x3f, 0x06, 0x96, 0x76, 0x02,
+  0x00, 0x44, 0x13, 0x08, 0x88, 0x27, 0x06, 0x6e, 0x04, 0x40, 0xf4, 0x13,
+  0x04, 0x17, 0x06, 0xb0, 0x17, 0x04, 0x0b, 0x73, 0x65, 0x72, 0xf7, 0x69,
+  0x61, 0x6c, 0xc9, 0x04, 0x00, 0xb5, 0x00, 0xf0, 0xff, 0x26, 0xf8, 0x00,
+  0x2e, 0x40, 0xcf, 0xfa, 0xd0, 0xbf, 0x37, 0x4a, 0x16, 0x70, 0x40, 0xcf,
+  0x27, 0x03, 0xd8, 0x22, 0x27, 0x04, 0x0a, 0x27, 0x08, 0x0d, 0x03, 0x27,
+  0x02, 0x29, 0x27, 0x08, 0xbf, 0x02, 0xff, 0x2d, 0x4a, 0x16, 0x78, 0x00,
+  0xbd, 0x08, 0x26, 0x6a, 0x27, 0x02, 0x0c, 0x4f, 0x10, 0x3f, 0xbb, 0x05,
+  0xc5, 0xff, 0x23, 0x02, 0xff, 0x00, 0x26, 0x24, 0x48, 0x01, 0x68, 0x80,
+  0x20, 0xbf, 0x01, 0x40, 0x00, 0xd0, 0xf6, 0x43, 0x57, 0x02, 0x90, 0x51,
+  0x26, 0x7f, 0x12, 0xb2, 0x04, 0x2d, 0x00, 0xae, 0x2d, 0x08, 0x19, 0x2d,
+  0x00, 0xfd, 0x20, 0x2d, 0x0c, 0x00, 0x70, 0x00, 0x40, 0x00, 0x08, 0x5e,
+  0x2f, 0x00, 0x10, 0x02, 0x40, 0x0c, 0x03, 0x00, 0x2c, 0x03, 0x00, 0xc5,
+  0x8f, 0x0e, 0x00, 0x34, 0x07, 0x00, 0x19, 0x00, 0x00, 0x02, 0x50, 0xff,
+  0xf7, 0xfc, 0xeb, 0xeb, 0x7a, 0x01, 0x50, 0x40, 0x04, 0x00, 0xa7, 0x00,
+  0x0c, 0x38, 0x39, 0x00, 0x03, 0x00, 0x0d, 0x18, 0x00, 0xf8, 0xaf, 0x1f,
+  0x00, 0x20, 0xf4, 0x03, 0x00, 0xf0, 0x03, 0x00, 0xec, 0xaa, 0x03, 0x00,
+  0xe8, 0x03, 0x00, 0x28, 0x1b, 0x00, 0x24, 0x03, 0x00, 0x1c, 0xfa, 0x03,
+  0x00, 0xb4, 0x87, 0x04, 0x07, 0x63, 0x65, 0x78, 0x70, 0xfb, 0x65, 0x63,
+  0x03, 0x01, 0x38, 0x68, 0x01, 0xb4, 0x01, 0xff, 0x30, 0x38, 0x60, 0x00,
+  0xf0, 0x0b, 0xf8, 0x01, 0xdb, 0xbc, 0x06, 0x05, 0x05, 0x2c, 0x27, 0x23,
+  0x02, 0x06, 0x61, 0xdf, 0x63, 0x63, 0x65, 0x70, 0x74, 0xd5, 0x00, 0x02,
+  0xcf, 0xff, 0x01, 0x39, 0x00, 0x22, 0xff, 0xf7, 0x38, 0xff, 0xff, 0x30,
+  0x00, 0x40, 0xcf, 0x7f, 0x28, 0x09, 0xd0, 0xff, 0x20, 0x28, 0x19, 0xd2,
+  0x09, 0x28, 0x16, 0xd0, 0xff, 0x0a, 0x28, 0x1f, 0xd0, 0x0d, 0x28, 0x1d,
+  0xd0, 0xff, 0x08, 0x28, 0xef, 0xd1, 0x00, 0x2a, 0xed, 0xd0, 0xff, 0x00,
+  0xf0, 0x15, 0xf9, 0x03, 0x08, 0x20, 0x08, 0xff, 0x00, 0x2a, 0xe7, 0xd0,
+  0x88, 0x5c, 0x01, 0x3a, 0x7f, 0x80, 0x23, 0x03, 0x40, 0xe2, 0xd0, 0x40,
+  0x05, 0x00, 0xff, 0xf5, 0xd0, 0xde, 0xe7, 0x20, 0x20, 0xb2, 0x42, 0xfb,
+  0xdb, 0xd2, 0xf1, 0x02, 0x06, 0x00, 0xff, 0xf7, 0x06, 0xff, 0xff, 0x01,
+  0x32, 0x88, 0x54, 0xd3, 0xe7, 0x16, 0x5f, 0x00, 0x00, 0xf0, 0xa8, 0xf8,
+  0x23, 0x03, 0x40, 0x77, 0x00, 0xbf, 0x40, 0x80, 0x03, 0x74, 0x69, 0x62,
+  0x23, 0x02, 0x2b, 0xbf, 0x4e, 0x70, 0x47, 0xc0, 0x46, 0x58, 0x13, 0x00,
+  0x81, 0x5f, 0x80, 0x03, 0x3e, 0x69, 0x6e, 0x13, 0x02, 0x27, 0x13, 0x00,
+  0xee, 0xfe, 0x02, 0xc0, 0x46, 0x80, 0x17, 0x00, 0x82, 0x80, 0x0e, 0xff,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x7f, 0x73, 0x6f, 0x75,
+  0x72, 0x63, 0x65, 0x00, 0x23, 0x02, 0xfd, 0x1f, 0x23, 0x08, 0xc4, 0x00,
+  0x00, 0x20, 0xc0, 0x46, 0xbd, 0x9c, 0xcb, 0x04, 0x09, 0x73, 0x65, 0x74,
+  0x22, 0x06, 0x17, 0xff, 0x48, 0x02, 0xcf, 0x06, 0x60, 0x41, 0x60, 0x40,
+  0xcf, 0xcf, 0x70, 0x47, 0xbc, 0xe7, 0x06, 0x3b, 0x10, 0x10, 0x4e, 0xff,
+  0x04, 0x3f, 0x70, 0x68, 0x38, 0x60, 0x36, 0x68, 0xfa, 0x7b, 0x02, 0xf4,
+  0x1f, 0x04, 0x05, 0x71, 0x75, 0x65, 0x72, 0xff, 0x79, 0x0f, 0xb5, 0x08,
+  0x48, 0x00, 0x21, 0x01, 0xcf, 0x60, 0xff, 0xf7, 0xb1, 0xb3, 0x05, 0x03,
+  0x02, 0xc8, 0x26, 0xff, 0xff, 0xf7, 0x70, 0xff, 0xff, 0xf7, 0xd5, 0xff,
+  0xab, 0x0f, 0xbd, 0x6d, 0x02, 0xe4, 0x6b, 0x01, 0xdc, 0x03, 0x00, 0x44,
+  0xfd, 0x28, 0x63, 0x07, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0xf7, 0x0f,
+  0xb5, 0x31, 0x35, 0x01, 0x01, 0xcf, 0x88, 0x42, 0xfb, 0x02, 0xd0, 0x5d,
+  0x01, 0x26, 0x0f, 0xbd, 0x02, 0xcf, 0xff, 0x00, 0x28, 0x10, 0xd0, 0x01,
+  0x38, 0x0a, 0x5c, 0xff, 0x33, 0x5c, 0x41, 0x2a, 0x02, 0xd3, 0x5b, 0x2a,
+  0xbf, 0x00, 0xd2, 0x20, 0x32, 0x41, 0x2b, 0x09, 0x00, 0x2b, 0xbe, 0x09,
+  0x00, 0x33, 0x9a, 0x42, 0xee, 0xd0, 0x27, 0x02, 0x00, 0xaf, 0x26, 0xf6,
+  0x43, 0x0f, 0x17, 0x01, 0x58, 0x4f, 0x04, 0x02, 0xfb, 0x63, 0x72, 0x8b,
+  0x01, 0x00, 0xf0, 0x64, 0xf8, 0x01, 0x6f, 0x0a, 0x00, 0xbd, 0x6c, 0x13,
+  0x06, 0x62, 0x6c, 0xb7, 0x04, 0xeb, 0x20, 0x26, 0xaf, 0x02, 0x80, 0x13,
+  0x04, 0x05, 0x73, 0x70, 0xf7, 0x61, 0x63, 0x65, 0x15, 0x06, 0x53, 0xe6,
+  0xa0, 0x28, 0xf4, 0xe3, 0x06, 0x13, 0x02, 0x73, 0x3f, 0x02, 0x2e, 0x03,
+  0xdd, 0xff, 0x7f, 0xf7, 0xf0, 0xff, 0x01, 0x3e, 0xfb, 0xd1, 0xeb, 0x03,
+  0xfd, 0xb0, 0x1f, 0x00, 0x50, 0x80, 0x06, 0x5b, 0x63, 0x68, 0x7f, 0x61,
+  0x72, 0x5d, 0x00, 0x05, 0xe0, 0xc8, 0x2f, 0x04, 0xf9, 0x04, 0x0e, 0x02,
+  0x2d, 0x00, 0x01, 0xf0, 0x15, 0xfc, 0x40, 0xbf, 0xcf, 0x36, 0x78, 0x00,
+  0xbd, 0xd8, 0x27, 0x02, 0x84, 0xfb, 0x01, 0x28, 0x57, 0x02, 0x29, 0x26,
+  0x06, 0xe0, 0xf4, 0xda, 0x0f, 0x06, 0x5c, 0x0f, 0x02, 0x00, 0x26, 0x29,
+  0x02, 0x0a, 0xfc, 0xfb, 0x04, 0x37, 0x51, 0x02, 0xc0, 0x46, 0x3c, 0x29,
+  0x00, 0xff, 0x00, 0x10, 0x80, 0x02, 0x2e, 0x22, 0x00, 0x9f, 0xf7, 0x48,
+  0x00, 0xb5, 0xef, 0x07, 0x00, 0xf0, 0xf8, 0xf9, 0xfe, 0x09, 0x02, 0x22,
+  0x26, 0x01, 0xf0, 0xf5, 0xfb, 0x00, 0x7f, 0xf0, 0x34, 0xfd, 0x00, 0xbd,
+  0x0a, 0xb4, 0x11, 0x02, 0xff, 0x76, 0x46, 0x01, 0x3e, 0x33, 0x78, 0x01,
+  0x21, 0xff, 0x01, 0x33, 0x19, 0x40, 0x5b, 0x18, 0x71, 0x46, 0xff, 0xc9,
+  0x18, 0x8e, 0x46, 0x0a, 0xbc, 0x3c, 0xe0, 0xf7, 0xc0, 0x46, 0x64, 0x47,
+  0x06, 0x63, 0x22, 0x00, 0x8e, 0x77, 0x48, 0xda, 0xe7, 0x2b, 0x2a, 0x70,
+  0x47, 0x90, 0x27, 0x06, 0x3f, 0x73, 0x22, 0x00, 0x85, 0x48, 0xc6, 0x27,
+  0x08, 0x05, 0x02, 0xb7, 0x01, 0x3e, 0x36, 0x2b, 0x00, 0x73, 0x1c, 0x2b,
+  0x12, 0xa8, 0xfd, 0x29, 0x23, 0x05, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x01,
+  0xdd, 0x36, 0x25, 0x0a, 0x70, 0x47, 0xd0, 0x17, 0x08, 0x74, 0x79, 0xff,
+  0x70, 0x65, 0x01, 0xb5, 0x30, 0x78, 0x00, 0x28, 0xfb, 0x07, 0xd0, 0x1f,
+  0x06, 0x36, 0x78, 0xff, 0xf7, 0xb0, 0xef, 0xfd, 0x01, 0x38, 0xf7, 0x2f,
+  0x01, 0x01, 0xbd, 0x00, 0x29, 0x2a, 0x1f, 0x05, 0x26, 0x02, 0x00, 0xd7,
+  0x03, 0x30, 0x03, 0x00, 0x55, 0x01, 0xdf, 0x29, 0x08, 0xd0, 0x00, 0x22,
+  0x2d, 0x02, 0x86, 0x5c, 0xff, 0xff, 0xf7, 0x99, 0xfd, 0x01, 0x32, 0x91,
+  0x42, 0xf3, 0xf7, 0xd1, 0x0b, 0x05, 0x2f, 0x06, 0x68, 0x65, 0x78, 0x2e,
+  0xf7, 0x00, 0x07, 0xb5, 0x31, 0x02, 0x20, 0x20, 0x0f, 0x22, 0xfb, 0x04,
+  0x38, 0x2b, 0x02, 0x0e, 0x00, 0xc6, 0x40, 0x16, 0xff, 0x40, 0x09, 0x2e,
+  0x01, 0xd9, 0x37, 0x36, 0x00, 0xff, 0xe0, 0x30, 0x36, 0xff, 0xf7, 0x7c,
+  0xfd, 0x00, 0xff, 0x28, 0xf0, 0xd1, 0xff, 0xf7, 0x20, 0xff, 0x07, 0xfa,
+  0x3b, 0x00, 0x4c, 0x3b, 0x04, 0x03, 0x68, 0x2e, 0x73, 0x1f, 0xbf, 0xb5,
+  0x4f, 0x4c, 0x0e, 0xe0, 0x5c, 0x0f, 0x06, 0x75, 0xbe, 0x0f, 0x02, 0x4c,
+  0x4c, 0x06, 0xe0, 0xdc, 0x0f, 0x04, 0x02, 0xff, 0x2e, 0x73, 0x00, 0x1f,
+  0xb5, 0x49, 0x4c, 0x4a, 0xff, 0x49, 0xc9, 0x1b, 0x89, 0x08, 0x49, 0x4a,
+  0x10, 0xff, 0x68, 0x03, 0xb4, 0x0a, 0x20, 0x10, 0x60, 0xff, 0xff, 0xf7,
+  0x4f, 0xff, 0x08, 0x53, 0x74, 0x61, 0x63, 0x9f, 0x6b, 0x3a, 0x20, 0x5b,
+  0x00, 0x6f, 0x06, 0xcf, 0x01, 0xfd, 0xff, 0xff, 0xf7, 0x43, 0xff, 0x02,
+  0x5d, 0x20, 0x00, 0xff, 0x03, 0xbc, 0x3e, 0x4a, 0x10, 0x60, 0x00, 0x29,
+  0xb7, 0x0a, 0xd0, 0x3d, 0x33, 0x00, 0x06, 0xb4, 0xa7, 0x07, 0xa0, 0xff,
+  0x47, 0x06, 0xbc, 0x04, 0x3a, 0x01, 0x39, 0xf5, 0xfe, 0x85, 0x00, 0x2f,
+  0xff, 0x06, 0x20, 0x54, 0x4f, 0x53, 0xeb, 0x3a, 0x20, 0x3d, 0x04, 0x36,
+  0x1b, 0x00, 0xff, 0xf7, 0x25, 0xff, 0xff, 0x04, 0x20, 0x2a, 0x3e, 0x0a,
+  0x00, 0x1f, 0xf6, 0x9f, 0x00, 0xa0, 0x2b, 0x33, 0x05, 0x77, 0x6f, 0x72,
+  0x64, 0xff, 0x73, 0x00, 0xb5, 0xff, 0xf7, 0x17, 0xff, 0x01, 0xff, 0x0a,
+  0x00, 0xf0, 0x9f, 0xfe, 0xff, 0xf7, 0x12, 0xff, 0xff, 0x09, 0x41, 0x64,
+  0x64, 0x72, 0x65, 0x73, 0xf7, 0x73, 0x3a, 0x20, 0x3b, 0x02, 0xff, 0xf7,
+  0x81, 0xff, 0xff, 0xff, 0xf7, 0x07, 0xff, 0x06, 0x4c, 0x69, 0x6e, 0xbd,
+  0x6b, 0x4f, 0x0a, 0x68, 0xff, 0xf7, 0x76, 0x15, 0x00, 0xfc, 0xbf, 0xfe,
+  0x07, 0x46, 0x6c, 0x61, 0x67, 0x29, 0x08, 0xb6, 0xef, 0x88, 0xff, 0xf7,
+  0x6b, 0x15, 0x00, 0xf1, 0xfe, 0x06, 0xef, 0x43, 0x6f, 0x64, 0x65, 0x2b,
+  0x00, 0xb0, 0x1d, 0x00, 0x77, 0xf0, 0xb0, 0xfe, 0x9d, 0x06, 0xff, 0xf7,
+  0x5d, 0x1b, 0x00, 0x7f, 0xe3, 0xfe, 0x06, 0x4e, 0x61, 0x6d, 0x65, 0x47,
+  0x08, 0xb5, 0x06, 0x37, 0x01, 0x26, 0x15, 0x00, 0xd8, 0xfe, 0x7d, 0x02,
+  0x78, 0x6d, 0xfe, 0x91, 0x03, 0xbd, 0xd0, 0x95, 0x01, 0xbd, 0x1c, 0xd3,
+  0x01, 0xd5, 0x4a, 0x03, 0x00, 0x72, 0x03, 0x00, 0x0d, 0x2b, 0x01, 0xab,
+  0x44, 0xf7, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x8c, 0x02, 0x00, 0x20, 0xdf,
+  0xfc, 0x1f, 0x00, 0x20, 0x88, 0x07, 0x00, 0xf0, 0x2c, 0xfe, 0xc3, 0x02,
+  0x10, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0xef, 0x65, 0x72, 0x6c, 0x69,
+  0x04, 0x00, 0x61, 0x6c, 0x2c, 0xff, 0x00, 0x3f, 0xb5, 0xa6, 0x4b, 0x38,
+  0x68, 0x18, 0xff, 0x40, 0x98, 0x42, 0x0f, 0xd1, 0x38, 0x68, 0xc0, 0xff,
+  0x43, 0x38, 0x60, 0x40, 0xb4, 0x00, 0xf0, 0x0d, 0xfd, 0xf8, 0x71, 0x02,
+  0xa0, 0x4e, 0x01, 0xbc, 0x06, 0x43, 0xff, 0xc0, 0x00, 0x06, 0x43, 0x00,
+  0xf0, 0x90, 0xfb, 0xbf, 0x3f, 0xbd, 0x00, 0xf0, 0x01, 0xf8, 0x05, 0x00,
+  0xb5, 0xfd, 0x35, 0x79, 0x00, 0x29, 0x00, 0xc9, 0x00, 0x29, 0x43, 0xff,
+  0x2d, 0x02, 0x98, 0x48, 0x05, 0x43, 0xff, 0x23, 0xff, 0x00, 0x22, 0x30,
+  0x00, 0xd0, 0x40, 0x98, 0x43, 0xbf, 0x01, 0xd0, 0x01, 0x32, 0xf9, 0xe7,
+  0x0b, 0x02, 0x18, 0xf7, 0x40, 0x28, 0x43, 0xcb, 0x06, 0x00, 0xf0, 0x72,
+  0xfb, 0xfd, 0x90, 0x25, 0x00, 0x18, 0x00, 0x90, 0x40, 0x86, 0x43, 0x7f,
+  0x10, 0xd0, 0x00, 0x24, 0x30, 0x00, 0xe0, 0x2b, 0x06, 0xdf, 0x34, 0xf9,
+  0xe7, 0x10, 0x1b, 0xb1, 0x07, 0x80, 0x01, 0xfe, 0x65, 0x02, 0x5d, 0xfb,
+  0x22, 0x00, 0xdf, 0xe7, 0x00, 0x77, 0x2a, 0x06, 0xd0, 0x15, 0x06, 0x92,
+  0x01, 0x16, 0x15, 0x00, 0xbb, 0x52, 0xfb, 0xe5, 0x02, 0x1f, 0xb5, 0x31,
+  0x77, 0x00, 0x7e, 0xff, 0x4c, 0x0c, 0x43, 0xc9, 0x00, 0x0c, 0x43, 0x49,
+  0xfd, 0x01, 0xff, 0x02, 0x02, 0x0e, 0xff, 0x23, 0x1a, 0x40, 0x5f, 0x77,
+  0x4b, 0x0b, 0x43, 0x13, 0x6d, 0x04, 0x1e, 0x6d, 0x00, 0xeb, 0x3b, 0xfb,
+  0x09, 0x02, 0x26, 0x09, 0x00, 0x36, 0xfb, 0x02, 0xd5, 0x0c, 0x1f, 0x02,
+  0x72, 0x1f, 0x14, 0x2b, 0x1f, 0x0c, 0x26, 0xfb, 0xab, 0x02, 0x0a, 0x1f,
+  0x02, 0x6a, 0x1f, 0x14, 0x1b, 0x1f, 0x0c, 0x16, 0xd7, 0xfb, 0x02, 0x00,
+  0x1f, 0x02, 0x62, 0x1f, 0x14, 0x0b, 0xfb, 0xbf, 0x1f, 0xbd, 0xc0, 0x46,
+  0x60, 0x2d, 0x4f, 0x03, 0x05, 0xff, 0x63, 0x61, 0x6c, 0x6c, 0x2c, 0x0f,
+  0xb5, 0x33, 0xfa, 0x17, 0x00, 0x74, 0x91, 0x05, 0x1b, 0x1a, 0x04, 0x3b,
+  0x57, 0xff, 0x49, 0x19, 0x40, 0x00, 0x29, 0x0e, 0xd0, 0x56, 0x7f, 0x4a,
+  0x91, 0x42, 0x0b, 0xd0, 0x01, 0x36, 0x39, 0x02, 0xbf, 0x00, 0x26, 0xff,
+  0xf7, 0x49, 0xff, 0x09, 0x02, 0x52, 0xff, 0x4e, 0x00, 0xf0, 0xe9, 0xfa,
+  0x0f, 0xbd, 0x40, 0xbf, 0xcf, 0x5b, 0x08, 0x50, 0x48, 0x50, 0x2b, 0x00,
+  0x08, 0xef, 0x43, 0xdb, 0x0a, 0x4f, 0x07, 0x00, 0x09, 0x04, 0x08, 0xff,
+  0x43, 0x9b, 0x0a, 0x01, 0x21, 0x19, 0x40, 0x89, 0xbb, 0x06, 0x08, 0x3d,
+  0x0d, 0x03, 0xfb, 0x0f, 0x6f, 0x00, 0x94, 0x5a, 0x6f, 0x04, 0x08, 0xb7,
+  0x0d, 0x00, 0xb5, 0x1f, 0x02, 0x43, 0x4b, 0x00, 0xab, 0xc3, 0xfa, 0x09,
+  0x02, 0x41, 0x09, 0x00, 0xbe, 0x09, 0x04, 0x06, 0xae, 0x69, 0x00, 0x14,
+  0xff, 0x00, 0x33, 0x00, 0xbc, 0x33, 0x04, 0x06, 0xbf, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x31, 0x00, 0x00, 0xff, 0xf0, 0x3d, 0xf8, 0x2d, 0x20,
+  0x00, 0x02, 0xdb, 0xf7, 0x30, 0x80, 0x47, 0x29, 0x02, 0x76, 0x46, 0x01,
+  0x3e, 0xfe, 0x27, 0x02, 0x14, 0x2e, 0x00, 0x00, 0x20, 0x80, 0x05, 0x5f,
+  0x64, 0x6f, 0x65, 0x73, 0x3e, 0x1f, 0x1a, 0x70, 0x09, 0x0c, 0xff, 0x2a,
+  0x4a, 0x13, 0x68, 0x2a, 0x49, 0x09, 0x68, 0xff, 0x02, 0x20, 0x08, 0x40,
+  0x00, 0xd1, 0x02, 0x31, 0xaf, 0x02, 0x31, 0x11, 0x60, 0xdb, 0x0e, 0x30,
+  0xdb, 0x04, 0x1b, 0xfe, 0x85, 0x00, 0x7b, 0xfa, 0x13, 0x60, 0x00, 0xf0,
+  0xea, 0xdf, 0xf9, 0x00, 0xbd, 0x98, 0x2e, 0x7f, 0x02, 0x07, 0x3c, 0xbf,
+  0x62, 0x75, 0x69, 0x6c, 0x64, 0x73, 0x7f, 0x02, 0x92, 0xff, 0xfb, 0x00,
+  0xf0, 0xe0, 0xfd, 0x02, 0x20, 0x06, 0xdf, 0x40, 0x40, 0xcf, 0x04, 0xd1,
+  0x31, 0x02, 0x36, 0x26, 0x57, 0x00, 0xf0, 0x62, 0xb7, 0x04, 0x14, 0x3b,
+  0x00, 0x5d, 0x09, 0x04, 0xfd, 0x10, 0x13, 0x00, 0xcb, 0xfa, 0x00, 0xbd,
+  0x00, 0x00, 0xaf, 0xff, 0xff, 0xc0, 0x43, 0x43, 0x00, 0x20, 0x03, 0x00,
+  0x10, 0xfa, 0x03, 0x00, 0x02, 0x03, 0x00, 0x30, 0x00, 0x00, 0x01, 0x00,
+  0xb7, 0xc0, 0xff, 0x00, 0x03, 0x00, 0x80, 0x47, 0x0f, 0x00, 0xf8, 0xef,
+  0x00, 0xf0, 0xff, 0x07, 0x29, 0x00, 0x03, 0x00, 0x00, 0xcf, 0x04, 0x3f,
+  0x00, 0x00, 0x8d, 0x00, 0x00, 0x02, 0x20, 0x14, 0xde, 0x35, 0x02, 0xb5,
+  0x00, 0x00, 0xa4, 0x83, 0x00, 0x50, 0x80, 0x7f, 0x03, 0x5b, 0x27, 0x5d,
+  0x03, 0xe0, 0xbc, 0x8f, 0x04, 0xff, 0x01, 0x27, 0x00, 0xb5, 0x01, 0xf0,
+  0x1d, 0xf9, 0xef, 0x00, 0xf0, 0x38, 0xfd, 0xb1, 0x03, 0x00, 0xbd, 0xf4,
+  0xfe, 0x17, 0x00, 0x30, 0x80, 0x08, 0x70, 0x6f, 0x73, 0x74, 0xf7, 0x70,
+  0x6f, 0x6e, 0x29, 0x03, 0xff, 0xf7, 0xed, 0xff, 0xfe, 0x7f, 0x07, 0x39,
+  0x68, 0x3e, 0x60, 0x0e, 0x46, 0xff, 0xbf, 0xf7, 0x47, 0xff, 0xff, 0xf7,
+  0x45, 0x13, 0x04, 0xe4, 0x6f, 0x4e, 0xff, 0xf7, 0x06, 0x5f, 0x05, 0x40,
+  0x2f, 0xdf, 0x04, 0xff, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x00,
+  0xff, 0xb5, 0xde, 0x49, 0xdf, 0x4a, 0xdf, 0x4b, 0x30, 0xbf, 0x88, 0x88,
+  0x42, 0x08, 0xd0, 0x90, 0x03, 0x00, 0x98, 0xf7, 0x42, 0x06, 0xd0, 0xc5,
+  0x0b, 0xf0, 0xf9, 0x02, 0x36, 0xfb, 0xf1, 0xe7, 0x6d, 0x02, 0x0e, 0xb4,
+  0xd5, 0x4a, 0xd6, 0xff, 0x4b, 0x01, 0x88, 0x02, 0x30, 0x91, 0x42, 0x01,
+  0xff, 0xd0, 0x99, 0x42, 0xf9, 0xd1, 0x0e, 0xbc, 0x70, 0xfb, 0x47, 0x54,
+  0x4b, 0x04, 0x04, 0x72, 0x65, 0x74, 0x2c, 0xfd, 0x00, 0x33, 0x02, 0xcc,
+  0x4e, 0xd6, 0xe1, 0x64, 0x2f, 0xfe, 0x97, 0x02, 0x04, 0x65, 0x78, 0x69,
+  0x74, 0x00, 0xf4, 0xef, 0xe7, 0xc0, 0x46, 0x7c, 0x0f, 0x04, 0x07, 0x72,
+  0x65, 0xdf, 0x63, 0x75, 0x72, 0x73, 0x65, 0x25, 0x02, 0xc5, 0x4e, 0xdf,
+  0x36, 0x68, 0xbf, 0xe6, 0x94, 0x17, 0x00, 0x81, 0x80, 0xe7, 0x05, 0x73,
+  0x74, 0xe6, 0x01, 0x15, 0x02, 0xc0, 0x4e, 0x70, 0xf6, 0x19, 0x03, 0x00,
+  0xa8, 0x53, 0x04, 0x01, 0x5d, 0xbc, 0x48, 0xff, 0x00, 0x21, 0xc9, 0x43,
+  0x01, 0x60, 0x70, 0x47, 0xf7, 0xc0, 0x46, 0xb8, 0x13, 0x00, 0x10, 0x80,
+  0x01, 0x5b, 0xe9, 0xb7, 0x13, 0x00, 0x11, 0x02, 0xd8, 0x23, 0x06, 0x3a,
+  0x00, 0xb5, 0xf7, 0xb4, 0x48, 0x07, 0xb7, 0x01, 0xc1, 0xfa, 0xb1, 0x48,
+  0x75, 0x01, 0x19, 0x00, 0xb1, 0x1f, 0x04, 0x00, 0xbd, 0x44, 0x6f, 0x01,
+  0xff, 0x30, 0x88, 0x01, 0x3b, 0x00, 0xb5, 0xac, 0x48, 0xff, 0x01, 0x68,
+  0xb9, 0x42, 0x0e, 0xd0, 0xff, 0xf7, 0xff, 0x97, 0xfc, 0x15, 0x20, 0x53,
+  0x74, 0x61, 0x63, 0xff, 0x6b, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x61,
+  0xff, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x2e, 0x0a, 0xff, 0x01, 0xf0,
+  0xf0, 0xfb, 0xa1, 0x48, 0x00, 0x68, 0xff, 0x41, 0x1c, 0x0e, 0xd0, 0x0b,
+  0x28, 0x04, 0xd8, 0x5a, 0x8b, 0x02, 0xa0, 0xd5, 0x01, 0x15, 0xf9, 0x09,
+  0x02, 0x99, 0x09, 0x00, 0xff, 0x6d, 0xf9, 0x01, 0xf0, 0xe5, 0xfa, 0x04,
+  0xe0, 0xea, 0x0f, 0x02, 0x94, 0x0f, 0x00, 0x65, 0x85, 0x01, 0xd5, 0xf8,
+  0x94, 0xb6, 0x6b, 0x08, 0x58, 0x30, 0x4f, 0x05, 0x65, 0x78, 0xe0, 0x00,
+  0x74, 0xbd, 0x65, 0x9b, 0x03, 0x87, 0x46, 0x70, 0x30, 0xaf, 0x02, 0x09,
+  0xbf, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0xdf, 0x08, 0x10, 0x5f, 0x26,
+  0xeb, 0xe0, 0x88, 0x30, 0xd7, 0x03, 0x06, 0x7b, 0x07, 0xfe, 0x31, 0x05,
+  0x20, 0x26, 0xe0, 0xe0, 0xc0, 0x46, 0xa4, 0xfe, 0x2f, 0x04, 0x0b, 0x63,
+  0x6f, 0x6d, 0x70, 0x69, 0x6c, 0xdf, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x1b,
+  0x02, 0x30, 0x26, 0xf5, 0xd2, 0x1b, 0x00, 0xc0, 0x33, 0x04, 0x0a, 0x30,
+  0x2d, 0x66, 0xbf, 0x6f, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x37, 0x06, 0x40,
+  0xab, 0x26, 0xc4, 0x1b, 0x00, 0xdc, 0x1b, 0x06, 0x31, 0x1b, 0x16, 0x41,
+  0xab, 0x26, 0xb6, 0x1b, 0x00, 0xf8, 0x1b, 0x06, 0x32, 0x1b, 0x16, 0x42,
+  0x5b, 0x26, 0xa8, 0x1b, 0x00, 0x14, 0x31, 0x1b, 0x04, 0x33, 0x1b, 0x16,
+  0x57, 0x43, 0x26, 0x9a, 0x1b, 0x00, 0x30, 0x1b, 0x06, 0x34, 0x1b, 0x16,
+  0x57, 0x44, 0x26, 0x8c, 0x1b, 0x00, 0x4c, 0x1b, 0x06, 0x35, 0x1b, 0x16,
+  0x57, 0x45, 0x26, 0x7e, 0x1b, 0x00, 0x68, 0x1b, 0x06, 0x36, 0x1b, 0x16,
+  0x57, 0x46, 0x26, 0x70, 0x1b, 0x00, 0x84, 0x1b, 0x06, 0x37, 0x1b, 0x16,
+  0xb7, 0x47, 0x26, 0x62, 0x1b, 0x00, 0xb4, 0x31, 0x3f, 0x03, 0x08, 0xff,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0xff, 0x00, 0x00, 0xb5,
+  0x00, 0xf0, 0xd9, 0xf9, 0xff, 0xd7, 0xf7, 0xe9, 0xfd, 0x23, 0x02, 0x39,
+  0x6f, 0x01, 0xad, 0xf8, 0xff, 0xff, 0xf7, 0x85, 0xff, 0x00, 0xf0, 0x1b,
+  0xf8, 0xdf, 0x00, 0xbd, 0xc0, 0x46, 0xd8, 0x2f, 0x04, 0x09, 0x32, 0xfc,
+  0x30, 0x0c, 0x2f, 0x00, 0xc1, 0xf9, 0x39, 0x68, 0x3e, 0x60, 0xff, 0x0e,
+  0x46, 0xff, 0xf7, 0xce, 0xfd, 0xe1, 0xe7, 0xef, 0xc0, 0x46, 0x38, 0x32,
+  0x23, 0x02, 0x06, 0x73, 0x6d, 0xef, 0x75, 0x64, 0x67, 0x65, 0x51, 0x00,
+  0x2d, 0x48, 0x01, 0xff, 0x68, 0x2c, 0x4a, 0x91, 0x42, 0x1c, 0xd2, 0x02,
+  0xff, 0x39, 0x0a, 0x88, 0x2b, 0x4b, 0x9a, 0x42, 0x04, 0xf5, 0xd1, 0x5d,
+  0x02, 0x29, 0x5d, 0x00, 0x7e, 0xf8, 0x00, 0xf0, 0xbf, 0x6b, 0xf8, 0x28,
+  0x48, 0x00, 0x68, 0x11, 0x02, 0x06, 0xff, 0x00, 0x26, 0x49, 0x09, 0x68,
+  0x04, 0x31, 0x21, 0xff, 0x4a, 0x13, 0x68, 0x11, 0x60, 0x00, 0xf0, 0x6f,
+  0xff, 0xf8, 0x13, 0x60, 0xfe, 0xf7, 0x8d, 0xfe, 0x00, 0xdf, 0xbd, 0x00,
+  0xf0, 0x58, 0xf8, 0x21, 0x02, 0x1f, 0x4e, 0xf7, 0x08, 0xe0, 0xb8, 0x5f,
+  0x04, 0x08, 0x73, 0x65, 0x74, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x61,
+  0x00, 0x15, 0x61, 0x00, 0xed, 0x14, 0x61, 0x00, 0x05, 0xd2, 0x09, 0x02,
+  0x31, 0x43, 0x01, 0xff, 0x60, 0x40, 0xcf, 0x00, 0xbd, 0x32, 0x00, 0x40,
+  0xfb, 0xcf, 0x12, 0x59, 0x02, 0x30, 0x01, 0x88, 0x0e, 0x4b, 0xff, 0x99,
+  0x42, 0x01, 0xd1, 0x11, 0x00, 0x00, 0xe0, 0xff, 0x11, 0x43, 0x01, 0x80,
+  0x00, 0xbd, 0xfa, 0x44, 0xf5, 0x00, 0xeb, 0x02, 0x00, 0x59, 0x00, 0x00,
+  0x70, 0x47, 0x00, 0xff, 0x00, 0x14, 0x00, 0x00, 0x20, 0xd8, 0x1f, 0x00,
+  0xeb, 0x20, 0x10, 0x07, 0x00, 0x5c, 0x03, 0x00, 0x20, 0x08, 0x00, 0xda,
+  0x00, 0x02, 0x20, 0x04, 0x02, 0xff, 0xff, 0x08, 0x04, 0x20, 0x04, 0xde,
+  0x06, 0x02, 0x80, 0x00, 0x00, 0xd4, 0x7f, 0x00, 0x41, 0x80, 0xff, 0x07,
+  0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x7f, 0x01, 0x20, 0x30, 0x40,
+  0x36, 0x18, 0x02, 0x05, 0x04, 0xd7, 0x70, 0x47, 0xf8, 0x9b, 0x04, 0x05,
+  0x1b, 0x04, 0x00, 0xb5, 0xfd, 0x8c, 0x8d, 0x00, 0x02, 0x20, 0x01, 0x40,
+  0x04, 0xd0, 0x6a, 0xbb, 0x02, 0x89, 0xef, 0x00, 0x06, 0x45, 0x01, 0x3c,
+  0x33, 0x23, 0x02, 0xff, 0x02, 0x68, 0x2c, 0x00, 0x0f, 0xb5, 0xb6, 0xb2,
+  0xfd, 0x85, 0x23, 0x00, 0x00, 0x29, 0x02, 0xd0, 0x01, 0x31, 0x5f, 0x00,
+  0xd0, 0x01, 0x60, 0x7f, 0x0d, 0x00, 0x7e, 0xc9, 0x04, 0xfe, 0x31, 0x02,
+  0x0e, 0x00, 0xfe, 0xf7, 0x31, 0xfe, 0x02, 0xed, 0xe0, 0xc9, 0x02, 0x0a,
+  0x80, 0x11, 0x02, 0x02, 0x26, 0x00, 0xbf, 0xf0, 0x57, 0xf8, 0x0f, 0xbd,
+  0x58, 0x43, 0x04, 0x01, 0xf7, 0x2c, 0x00, 0xb5, 0x15, 0x02, 0xff, 0xf7,
+  0xda, 0xff, 0xbf, 0x36, 0x0c, 0xff, 0xf7, 0xd7, 0xff, 0xa3, 0x03, 0x74,
+  0xce, 0x1b, 0x04, 0x03, 0x3e, 0x3c, 0x1d, 0x08, 0x19, 0x02, 0xca, 0xff,
+  0xd7, 0xff, 0xf7, 0xc8, 0x1d, 0x00, 0xdc, 0x1b, 0x04, 0x07, 0x73, 0xff,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x07, 0xb5, 0x7f, 0xff, 0x21, 0x31,
+  0x40, 0x40, 0xcf, 0x30, 0x5f, 0x00, 0xf7, 0x00, 0x29, 0x05, 0x95, 0x05,
+  0x00, 0x26, 0xff, 0xf7, 0xef, 0xb3, 0xff, 0x07, 0xbd, 0x8f, 0x05, 0x78,
+  0x36, 0x02, 0xff, 0x0e, 0x43, 0xff, 0xf7, 0xab, 0xff, 0x01, 0x30, 0xbf,
+  0x01, 0x39, 0x02, 0x29, 0x0a, 0xd3, 0x15, 0x02, 0x46, 0xee, 0x15, 0x00,
+  0x02, 0x78, 0x16, 0x17, 0x00, 0x9f, 0xff, 0x02, 0xff, 0x30, 0x02, 0x39,
+  0xf2, 0xe7, 0x00, 0x29, 0x00, 0xdd, 0xd1, 0x31, 0x0a, 0xff, 0xf7, 0x94,
+  0x3d, 0x00, 0x38, 0x34, 0x5e, 0x07, 0x09, 0x6c, 0x6f, 0x74, 0x4a, 0xd3,
+  0x00, 0x49, 0xd3, 0x00, 0xdb, 0x0f, 0xd2, 0xc7, 0x02, 0x89, 0x18, 0x0b,
+  0x02, 0x19, 0xd3, 0xff, 0xff, 0xf7, 0x8d, 0xfa, 0x0b, 0x46, 0x6c, 0x61,
+  0xff, 0x73, 0x68, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x0a, 0xef, 0x01, 0xf0,
+  0xeb, 0xf9, 0x1f, 0x06, 0x42, 0x4a, 0x12, 0xef, 0x68, 0x91, 0x42, 0x08,
+  0x21, 0x00, 0x7c, 0xfa, 0x09, 0xf7, 0x52, 0x61, 0x6d, 0x1f, 0x0a, 0xdb,
+  0xf9, 0x01, 0x60, 0xdf, 0x70, 0x47, 0xc0, 0x46, 0x5c, 0x5b, 0x04, 0x09,
+  0x66, 0xff, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x72, 0x61, 0x6d, 0xfe, 0xc7,
+  0x01, 0xf0, 0x25, 0xf8, 0x31, 0x48, 0x35, 0x49, 0xdf, 0x01, 0x60, 0x35,
+  0x48, 0x36, 0x05, 0x00, 0x00, 0xbd, 0xfd, 0x84, 0x23, 0x04, 0x0d, 0x63,
+  0x6f, 0x6d, 0x70, 0x69, 0xaf, 0x6c, 0x65, 0x74, 0x6f, 0x26, 0x00, 0x3f,
+  0xdd, 0x06, 0x27, 0xff, 0x48, 0x00, 0x68, 0x26, 0x49, 0x88, 0x42, 0x48,
+  0xbf, 0xd3, 0xf6, 0x43, 0x70, 0x47, 0xa4, 0x27, 0x04, 0x0c, 0xd6, 0x27,
+  0x12, 0x00, 0x1e, 0x21, 0x00, 0x1d, 0x21, 0x00, 0x11, 0xd3, 0xaf, 0x70,
+  0x47, 0x3c, 0x35, 0x1f, 0x02, 0x0e, 0x1f, 0x0c, 0x66, 0xd6, 0xb0, 0x02,
+  0x00, 0x16, 0x21, 0x00, 0x15, 0x21, 0x00, 0x00, 0xd2, 0xff, 0x70, 0x47,
+  0x19, 0x48, 0x1a, 0x49, 0x02, 0x68, 0xff, 0x0b, 0x68, 0x0a, 0x60, 0x03,
+  0x60, 0x10, 0x48, 0xf5, 0x18, 0x0b, 0x0c, 0x11, 0x23, 0x00, 0x83, 0x42,
+  0x15, 0xd3, 0xff, 0x00, 0xb5, 0xff, 0xf7, 0x18, 0xfa, 0x23, 0x20, 0xff,
+  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0xff, 0x73, 0x20, 0x63,
+  0x6f, 0x6c, 0x6c, 0x69, 0x64, 0xff, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x64, 0xff, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0xbf,
+  0x79, 0x0a, 0x00, 0xbd, 0x70, 0x47, 0x6d, 0x00, 0x20, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0xd8, 0x1f, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x01, 0x00, 0x24,
+  0x0f, 0x00, 0x4c, 0x04, 0x57, 0x00, 0x20, 0x04, 0x07, 0x00, 0xc0, 0x1c,
+  0x00, 0x1c, 0x07, 0x00, 0xed, 0x18, 0x03, 0x00, 0x28, 0x36, 0x97, 0x02,
+  0x08, 0x28, 0x63, 0x7f, 0x72, 0x65, 0x61, 0x74, 0x65, 0x29, 0x00, 0x03,
+  0x03, 0xff, 0xcd, 0xfd, 0x00, 0x2e, 0x0e, 0xd1, 0xff, 0xf7, 0xdf, 0xe1,
+  0xf9, 0x15, 0x20, 0x43, 0x17, 0x04, 0x20, 0x6e, 0xff, 0x65, 0x65, 0x64,
+  0x73, 0x20, 0x6e, 0x61, 0x6d, 0xf7, 0x65, 0x20, 0x21, 0x41, 0x01, 0x3a,
+  0xf9, 0x38, 0x68, 0xfe, 0x05, 0x03, 0x04, 0x3f, 0x38, 0x60, 0x00, 0xf0,
+  0xa3, 0x7d, 0xf9, 0xf5, 0x01, 0x2e, 0x40, 0xcf, 0x11, 0xd0, 0x15, 0x0e,
+  0xff, 0xff, 0xf7, 0xc2, 0xf9, 0x09, 0x52, 0x65, 0x64, 0xff, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0xff, 0xf7, 0xff, 0x1b, 0xfa, 0xff, 0xf7, 0xb9,
+  0xf9, 0x02, 0x2e, 0xff, 0x20, 0x00, 0xff, 0xf7, 0x97, 0xfe, 0x00, 0xf0,
+  0xd7, 0x1b, 0xfa, 0x8d, 0xd7, 0x00, 0x8c, 0xfb, 0x00, 0x1c, 0xd2, 0xe7,
+  0x8b, 0x48, 0x8c, 0x6b, 0x01, 0xf5, 0x05, 0x26, 0xff, 0xf7, 0xff, 0x0c,
+  0xff, 0xfd, 0xf7, 0xd2, 0xfc, 0xff, 0xf7, 0xf7, 0xd5, 0xfe, 0x87, 0xef,
+  0x01, 0x0a, 0x68, 0x87, 0x4b, 0xff, 0x9a, 0x42, 0x07, 0xd1, 0x81, 0x4a,
+  0x13, 0x68, 0xfd, 0x11, 0x23, 0x04, 0xff, 0xf7, 0xa9, 0xfe, 0x13, 0x60,
+  0xff, 0x06, 0x60, 0x40, 0xcf, 0x10, 0xe0, 0x7f, 0x48, 0xbe, 0x35, 0x04,
+  0x68, 0xff, 0xf7, 0x9f, 0xfe, 0x09, 0x02, 0x7c, 0xff, 0x4e, 0xff, 0xf7,
+  0x79, 0xfe, 0x79, 0x48, 0x31, 0xba, 0xff, 0x01, 0x01, 0x29, 0x00, 0xb3,
+  0xfe, 0x73, 0x43, 0x00, 0x77, 0x5d, 0x48, 0xc9, 0x03, 0xc0, 0x46, 0x40,
+  0xeb, 0x06, 0x76, 0x40, 0x09, 0x7d, 0x00, 0x31, 0x02, 0x01, 0x26, 0x13,
+  0xe0, 0x58, 0x17, 0x04, 0xf3, 0x09, 0x32, 0x18, 0x0a, 0x17, 0x02, 0x02,
+  0x26, 0x07, 0xe0, 0xcb, 0x30, 0x37, 0x17, 0x04, 0x6e, 0x30, 0x0c, 0x81,
+  0x01, 0x6f, 0xff, 0xfd, 0x5f, 0x51, 0x00, 0x5e, 0x4a, 0x91, 0x42, 0x33,
+  0xd2, 0x7f, 0x0f, 0x20, 0x06, 0x40, 0xb2, 0x00, 0x61, 0x0f, 0x00, 0xf7,
+  0x89, 0x1a, 0x60, 0x11, 0x00, 0x0b, 0xd2, 0xff, 0xf7, 0xff, 0x47, 0xf9,
+  0x0f, 0x4e, 0x6f, 0x74, 0x20, 0x65, 0xff, 0x6e, 0x6f, 0x75, 0x67, 0x68,
+  0x20, 0x52, 0x41, 0xad, 0x4d, 0x2d, 0x01, 0xa3, 0xf8, 0xdd, 0x06, 0x0e,
+  0xfb, 0x00, 0x61, 0x75, 0xfb, 0x09, 0x02, 0x56, 0xa7, 0x00, 0x25, 0xfe,
+  0x30, 0xa5, 0x00, 0xff, 0x02, 0x00, 0x00, 0x28, 0x05, 0xd0, 0x0e, 0x60,
+  0xff, 0x04, 0x31, 0xff, 0xf7, 0x3d, 0xfe, 0x01, 0x38, 0xfb, 0xf9, 0xd1,
+  0x1f, 0x02, 0x80, 0x26, 0x16, 0x43, 0xff, 0xff, 0xf7, 0xb7, 0xfd, 0xff,
+  0xf7, 0x84, 0xfd, 0x00, 0xbf, 0xbd, 0x00, 0xf0, 0x84, 0xf9, 0x02, 0x6b,
+  0x00, 0x40, 0xab, 0xcf, 0x04, 0x1d, 0x04, 0x36, 0x25, 0x01, 0x06, 0xef,
+  0x04, 0x45, 0xaa, 0x47, 0x00, 0x31, 0x09, 0x04, 0x43, 0x09, 0x00, 0x2c,
+  0x09, 0x04, 0x3f, 0xf6, 0x09, 0x00, 0xf7, 0xfd, 0x5b, 0x02, 0x00, 0x28,
+  0x03, 0xd0, 0x57, 0xff, 0xf7, 0x12, 0x55, 0x00, 0xfb, 0xcd, 0x01, 0xc7,
+  0x53, 0x01, 0xdb, 0x5d, 0xfd, 0x07, 0x03, 0x1c, 0x38, 0xd7, 0x02, 0x07,
+  0x62, 0xbf, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3a, 0xd5, 0x02, 0x04, 0xff,
+  0xff, 0x01, 0x20, 0x30, 0x40, 0x36, 0x18, 0x02, 0xea, 0x05, 0x04, 0x26,
+  0xd1, 0x00, 0x25, 0xcf, 0x00, 0x26, 0xd2, 0x2a, 0xb6, 0xdb, 0x02, 0x1b,
+  0x29, 0xdb, 0x08, 0xd9, 0xf8, 0xdb, 0x1e, 0x35, 0xb6, 0xdb, 0x10, 0xf3,
+  0xfa, 0x09, 0x02, 0x1f, 0x4e, 0xb9, 0x06, 0xd6, 0x55, 0xfd, 0x0d, 0x02,
+  0x1e, 0x0d, 0x00, 0x53, 0x0d, 0x00, 0x20, 0xc7, 0x04, 0x55, 0x20, 0xc7,
+  0x1c, 0xa2, 0x25, 0x04, 0x13, 0x25, 0x00, 0xcd, 0x09, 0x04, 0x55, 0x11,
+  0x09, 0x00, 0xc8, 0x09, 0x04, 0x0d, 0x09, 0x00, 0x93, 0x39, 0x00, 0xdf,
+  0x04, 0xfe, 0xff, 0xf7, 0x69, 0xbb, 0x00, 0xff, 0xfc, 0xec, 0x41, 0x00,
+  0x00, 0x02, 0x20, 0x20, 0x03, 0x00, 0x00, 0x80, 0x00, 0x53, 0x00, 0x04,
+  0x07, 0x02, 0x00, 0x00, 0x14, 0x07, 0x00, 0x24, 0x03, 0x00, 0xff, 0x4c,
+  0x04, 0x00, 0x20, 0x70, 0x47, 0x00, 0x00, 0xfd, 0x3e, 0x91, 0x00, 0x02,
+  0x36, 0x7e, 0x46, 0x40, 0x81, 0xf7, 0x00, 0x00, 0x4c, 0xeb, 0x04, 0x0f,
+  0x64, 0x69, 0x63, 0xff, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x73,
+  0xff, 0x74, 0x61, 0x72, 0x74, 0x42, 0x48, 0x00, 0x68, 0xfb, 0x41, 0x49,
+  0x65, 0x02, 0x88, 0x42, 0x01, 0xd2, 0x3f, 0xff, 0x4e, 0x70, 0x47, 0x3f,
+  0x4e, 0x36, 0x68, 0x70, 0xaf, 0x47, 0xc0, 0x46, 0x88, 0x2f, 0x04, 0x0e,
+  0x2f, 0x0e, 0x6e, 0xff, 0x65, 0x78, 0x74, 0x00, 0x03, 0xb5, 0x31, 0x68,
+  0xff, 0x38, 0x48, 0x81, 0x42, 0x07, 0xd0, 0x88, 0x79, 0xbf, 0x00, 0x28,
+  0x04, 0xd0, 0x0e, 0x00, 0x3b, 0x02, 0x00, 0x77, 0x26, 0x03, 0xbd, 0x07,
+  0x06, 0xf6, 0x43, 0x03, 0x57, 0x01, 0xfd, 0xbc, 0x3b, 0x04, 0x0a, 0x73,
+  0x6b, 0x69, 0x70, 0x73, 0xff, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x31,
+  0x78, 0xff, 0x01, 0x31, 0x01, 0x22, 0x0a, 0x40, 0x89, 0x18, 0x7f, 0x76,
+  0x18, 0x70, 0x47, 0x06, 0xb4, 0x01, 0x0f, 0x0c, 0x6f, 0x40, 0x18, 0x06,
+  0xbc, 0x6f, 0x02, 0x4c, 0x39, 0x33, 0x02, 0xff, 0x04, 0x66, 0x69, 0x6e,
+  0x64, 0x00, 0x3f, 0xb5, 0x5f, 0x00, 0x22, 0x00, 0x23, 0x35, 0xb9, 0x01,
+  0x34, 0x03, 0x00, 0xff, 0xff, 0xf7, 0xac, 0xff, 0x1b, 0x48, 0xb1, 0x88,
+  0xef, 0x88, 0x42, 0x17, 0xd0, 0x65, 0x02, 0x06, 0x36, 0xff, 0xd7, 0xf7,
+  0x58, 0xf8, 0x09, 0x02, 0x26, 0x7d, 0x04, 0x2e, 0x00, 0xff, 0xfe, 0xf7,
+  0x83, 0xff, 0x00, 0x2e, 0x40, 0xcf, 0xff, 0x07, 0xd0, 0xb0, 0x1d, 0xff,
+  0xf7, 0xd0, 0xff, 0xff, 0x02, 0x00, 0x0b, 0x00, 0x0b, 0x48, 0x82, 0x42,
+  0xdd, 0x04, 0xab, 0x01, 0xa6, 0xff, 0x30, 0x43, 0x00, 0xde, 0xd0, 0xfd,
+  0x16, 0x2b, 0x04, 0x1e, 0x00, 0x3f, 0xbd, 0x00, 0xb5, 0xff, 0x31, 0x00,
+  0x38, 0x68, 0xff, 0xf7, 0xcc, 0xff, 0xff, 0x3a, 0x68, 0x00, 0x2a, 0x01,
+  0xd1, 0x00, 0xf0, 0xbb, 0x0b, 0xff, 0x51, 0x05, 0x20, 0xc0, 0x00, 0x4b,
+  0x0f, 0xa8, 0xfe, 0x8f, 0x04, 0x06, 0x63, 0x6a, 0x75, 0x6d, 0x70, 0x2c,
+  0xeb, 0x00, 0x32, 0x43, 0x00, 0x31, 0x03, 0x00, 0x8b, 0x1b, 0x04, 0xff,
+  0x3b, 0xd8, 0x49, 0x19, 0x40, 0x00, 0x29, 0x0d, 0xfb, 0xd0, 0xd7, 0x07,
+  0x01, 0x0a, 0xd0, 0xfe, 0xf7, 0xd2, 0xf7, 0xff, 0x0d, 0x4a, 0x24, 0x00,
+  0x20, 0x74, 0x6f, 0x6f, 0xff, 0x20, 0x66, 0x61, 0x72, 0x0a, 0x00, 0xf0,
+  0x2f, 0xff, 0xff, 0x5b, 0x10, 0xff, 0x21, 0x0b, 0x40, 0x13, 0xff, 0x43,
+  0x30, 0x00, 0x1e, 0x00, 0x00, 0xb5, 0xcd, 0xff, 0x4a, 0x13, 0x68, 0x10,
+  0x60, 0xff, 0xf7, 0xb0, 0xaf, 0xfc, 0x13, 0x60, 0x00, 0x1f, 0x01, 0xe0,
+  0x5b, 0x04, 0x05, 0xf8, 0x5a, 0x04, 0x55, 0x02, 0xa1, 0x02, 0x0b, 0x1a,
+  0x04, 0x3b, 0xc4, 0xfe, 0x59, 0x04, 0x02, 0xd0, 0xc3, 0x4a, 0x91, 0x42,
+  0xd2, 0x7f, 0xd1, 0x5b, 0x10, 0xc2, 0x4a, 0x13, 0x40, 0x03, 0x00, 0xdd,
+  0x43, 0xb9, 0x06, 0xda, 0xe7, 0xf8, 0x23, 0x07, 0x68, 0x65, 0x6b, 0x72,
+  0x65, 0xcd, 0x04, 0xb7, 0xab, 0x09, 0x20, 0x3b, 0x17, 0x02, 0xff, 0x0d,
+  0x66, 0x6c, 0x61, 0x73, 0x68, 0x76, 0x61, 0xd3, 0x72, 0x2d, 0x20, 0x02,
+  0x1f, 0x02, 0xb4, 0x1f, 0x04, 0x00, 0xb5, 0x7e, 0x0b, 0x02, 0xb2, 0x4e,
+  0xff, 0xf7, 0x70, 0xfc, 0x09, 0x02, 0xfd, 0xb1, 0x09, 0x00, 0x6b, 0xfc,
+  0x00, 0xbd, 0xdd, 0xe7, 0xff, 0x00, 0xb5, 0x00, 0xf0, 0x37, 0xf8, 0x39,
+  0x68, 0xaf, 0x3e, 0x60, 0x0e, 0x46, 0x19, 0x02, 0xab, 0x19, 0x00, 0x8a,
+  0x54, 0x0b, 0x03, 0x17, 0x00, 0x2b, 0x17, 0x10, 0xa6, 0x17, 0x00, 0x7e,
+  0x17, 0x04, 0x7f, 0xff, 0xf7, 0xd8, 0xff, 0x00, 0xf0, 0x1d, 0x1b, 0x10,
+  0xe9, 0xa0, 0x57, 0x02, 0x33, 0x08, 0x11, 0x17, 0x08, 0xff, 0xf7, 0x94,
+  0x7e, 0x2d, 0x08, 0xc1, 0xff, 0xff, 0xf7, 0xaa, 0xff, 0x27, 0x02, 0xbf,
+  0x02, 0x26, 0xff, 0xf7, 0xa3, 0xfc, 0x15, 0x06, 0xa1, 0xaa, 0x11, 0x0c,
+  0x9a, 0x11, 0x08, 0x98, 0x27, 0x00, 0x7a, 0x33, 0x08, 0x92, 0xaa, 0x1d,
+  0x04, 0x8a, 0x57, 0x00, 0x44, 0x11, 0x08, 0x89, 0x11, 0x04, 0x84, 0xea,
+  0x11, 0x00, 0x3b, 0x11, 0x04, 0xfc, 0xbf, 0x00, 0xfc, 0xf7, 0x9c, 0xef,
+  0xfb, 0xfc, 0xf7, 0x9f, 0x03, 0x00, 0xa2, 0xfb, 0x81, 0xff, 0x68, 0x28,
+  0x29, 0x01, 0xd1, 0xfc, 0xf7, 0xa9, 0xfa, 0x15, 0x00, 0x9d, 0xe3, 0x04,
+  0x7c, 0x4e, 0x09, 0x02, 0x0e, 0xaf, 0x43, 0xff, 0xf7, 0xf7, 0x1f, 0x00,
+  0x4d, 0x03, 0x00, 0x7a, 0xf5, 0xfb, 0x77, 0x03, 0x4c, 0x27, 0x01, 0x30,
+  0x80, 0x04, 0x74, 0xff, 0x68, 0x65, 0x6e, 0x00, 0x05, 0x2e, 0x01, 0xd1,
+  0xff, 0x40, 0xcf, 0xc0, 0xe7, 0xf1, 0xb2, 0x00, 0x29, 0x5b, 0x6e, 0xd1,
+  0x65, 0x02, 0x56, 0xff, 0xbd, 0x0a, 0x08, 0x65, 0x00, 0x7d, 0x68, 0x2b,
+  0x06, 0x65, 0x6c, 0x73, 0x65, 0x00, 0xdb, 0x02, 0xff, 0x35, 0xf8, 0xfc,
+  0xf7, 0x01, 0xfd, 0xff, 0xf7, 0xf5, 0xe3, 0x1b, 0x00, 0xbc, 0x1b, 0x02,
+  0x86, 0x02, 0x69, 0x66, 0xb5, 0x00, 0x37, 0x02, 0x8b, 0x9d, 0x04, 0x5e,
+  0x4e, 0x99, 0x06, 0xb4, 0xff, 0xfc, 0xfd, 0xf7, 0x49, 0xfd, 0x81, 0x6a,
+  0x00, 0xff, 0x29, 0x07, 0xd0, 0x02, 0xb4, 0xfc, 0xf7, 0x3d, 0x6f, 0xfb,
+  0xff, 0xf7, 0x85, 0x21, 0x04, 0x40, 0xbd, 0xf9, 0x02, 0xd7, 0xff, 0xf7,
+  0x22, 0xfd, 0x0c, 0x1b, 0xab, 0x04, 0x50, 0x4e, 0xfa, 0x9b, 0x02, 0xd8,
+  0x6f, 0x04, 0x05, 0x61, 0x68, 0x65, 0x61, 0xb5, 0x64, 0x55, 0x02, 0x6b,
+  0x25, 0x04, 0x05, 0x26, 0x1b, 0x02, 0xf4, 0xfe, 0x1b, 0x04, 0x06, 0x72,
+  0x65, 0x70, 0x65, 0x61, 0x74, 0x7e, 0x8d, 0x04, 0x5c, 0xf8, 0xff, 0xf7,
+  0x9e, 0xff, 0x1b, 0x02, 0xfb, 0x38, 0x3c, 0x8b, 0x02, 0x05, 0x77, 0x68,
+  0x69, 0x6c, 0x7d, 0x65, 0x37, 0x02, 0xb6, 0xff, 0xfc, 0xf7, 0xad, 0x55,
+  0x09, 0xf5, 0xb7, 0x0b, 0x00, 0xa7, 0x0b, 0x00, 0xfe, 0xf7, 0x80, 0xfe,
+  0xff, 0x17, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0xff, 0x72, 0x65,
+  0x73, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0xff, 0x74, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x0a, 0xdf, 0x00, 0xf0, 0xd8, 0xfd, 0x98, 0x43, 0x06, 0x75,
+  0x6e, 0xbf, 0x74, 0x69, 0x6c, 0x01, 0x2e, 0xe7, 0x17, 0x01, 0x09, 0xbf,
+  0xe7, 0x70, 0x47, 0x01, 0x2e, 0xe2, 0x09, 0x00, 0x00, 0x5f, 0xb5, 0xfd,
+  0xf7, 0xe1, 0xfc, 0xcf, 0x02, 0x0d, 0xcf, 0x04, 0xbf, 0xd5, 0xfa, 0xff,
+  0xf7, 0x1d, 0xff, 0xff, 0x0f, 0x40, 0xad, 0xbc, 0xff, 0x01, 0xfe, 0x00,
+  0xdb, 0x00, 0x33, 0xdb, 0x00, 0x10, 0xda, 0x19, 0x10, 0x1a, 0xaf, 0x01,
+  0x63, 0xfe, 0xa3, 0x02, 0xac, 0x3c, 0xfe, 0xdb, 0x06, 0x67, 0x61, 0x69,
+  0x6e, 0x01, 0x2e, 0xb7, 0xde, 0x55, 0x00, 0xe7, 0xe6, 0x00, 0x3d, 0x13,
+  0x04, 0x62, 0x65, 0xb7, 0x67, 0x69, 0x6e, 0xab, 0x02, 0xb8, 0xfe, 0x33,
+  0x02, 0x01, 0xfe, 0xef, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00,
+  0x3e, 0x03, 0x02, 0x00, 0x00, 0x20, 0x01, 0xf8, 0x07, 0x00, 0x03, 0x00,
+  0x7b, 0xff, 0x07, 0x0d, 0x00, 0xe0, 0x00, 0x00, 0x24, 0x13, 0x00, 0xef,
+  0x00, 0x2e, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xd1, 0xea, 0x03, 0x00,
+  0xd7, 0x03, 0x00, 0xd0, 0x03, 0x00, 0x28, 0x00, 0x00, 0xbd, 0x18, 0x53,
+  0x00, 0x20, 0x82, 0x01, 0x6b, 0x5f, 0x05, 0x9e, 0xfb, 0x70, 0x47, 0x07,
+  0x02, 0x8e, 0x4e, 0x0a, 0xe0, 0x44, 0x6a, 0x17, 0x06, 0x6a, 0x0f, 0x02,
+  0x00, 0x17, 0x08, 0x89, 0x4e, 0xad, 0x03, 0xff, 0x35, 0xfa, 0xfc, 0xf7,
+  0x12, 0xfb, 0x03, 0x60, 0xff, 0x1b, 0x02, 0x1e, 0x43, 0xff, 0xf7, 0xe0,
+  0xfa, 0xd7, 0x00, 0xbd, 0x70, 0x2b, 0x06, 0x69, 0x23, 0x02, 0x26, 0x00,
+  0xef, 0x70, 0x47, 0x00, 0xb5, 0x09, 0x02, 0x7f, 0x4e, 0xfc, 0x7b, 0xf7,
+  0x1f, 0x2b, 0x00, 0xfc, 0xfa, 0x03, 0x60, 0x29, 0x02, 0xeb, 0xcb, 0xfa,
+  0xd7, 0x02, 0xb0, 0xc3, 0x06, 0x6c, 0x65, 0x61, 0xfd, 0x76, 0x7b, 0x01,
+  0x77, 0x48, 0x01, 0x68, 0x3b, 0x00, 0xff, 0x04, 0x3f, 0x1a, 0x68, 0x04,
+  0x3b, 0x1a, 0x60, 0xff, 0x08, 0x33, 0x8b, 0x42, 0xf9, 0xd1, 0x03, 0xb4,
+  0x7f, 0xff, 0xf7, 0x86, 0xfe, 0x03, 0xbc, 0x33, 0xaf, 0x00, 0xff, 0x04,
+  0x39, 0x0b, 0x60, 0x01, 0x60, 0x04, 0x39, 0xbf, 0x0a, 0x68, 0x01, 0x32,
+  0x0a, 0x60, 0x3f, 0x02, 0xc4, 0xfe, 0x6b, 0x02, 0x80, 0x06, 0x75, 0x6e,
+  0x6c, 0x6f, 0x6f, 0xff, 0x70, 0x00, 0x30, 0xbc, 0x70, 0x47, 0xc0, 0x46,
+  0xf5, 0xfc, 0x53, 0x06, 0x2b, 0x12, 0x02, 0x03, 0x2e, 0x00, 0xd0, 0x53,
+  0x20, 0xe7, 0x83, 0x03, 0x83, 0x02, 0x60, 0x4f, 0x01, 0x8f, 0xf7, 0x01,
+  0xff, 0x30, 0xfe, 0x1a, 0xe0, 0x80, 0x20, 0x00, 0x06, 0xff, 0x00, 0x19,
+  0xa4, 0x19, 0x40, 0x1b, 0x80, 0x19, 0x5b, 0x40, 0xcf, 0x37, 0x02, 0x40,
+  0x3e, 0x37, 0x02, 0x04, 0x49, 0x04, 0xaa, 0x37, 0x02, 0x04, 0x37, 0x0c,
+  0x53, 0x37, 0x00, 0x73, 0x37, 0x00, 0x08, 0xff, 0xfe, 0x00, 0xf0, 0x4a,
+  0xf9, 0x4d, 0x48, 0x31, 0xe8, 0x8b, 0x00, 0x87, 0x00, 0x19, 0x00, 0x4d,
+  0x19, 0x00, 0x66, 0xf8, 0x00, 0x5f, 0xbd, 0x01, 0x34, 0xac, 0x42, 0x43,
+  0x02, 0x88, 0x43, 0x02, 0x5f, 0x82, 0x02, 0x64, 0x6f, 0x00, 0x39, 0x06,
+  0x46, 0x1f, 0x00, 0x67, 0x56, 0xf8, 0x41, 0xd7, 0x00, 0x0d, 0x02, 0x0e,
+  0x00, 0x3f, 0x05, 0x7f, 0x26, 0x07, 0x60, 0xff, 0xf7, 0xe1, 0xfd, 0x0b,
+  0x02, 0xfd, 0x03, 0xad, 0x03, 0xb5, 0x00, 0xf0, 0x2e, 0xf8, 0xec, 0x6f,
+  0xe7, 0x30, 0xb4, 0x34, 0x57, 0x00, 0x35, 0x00, 0x8d, 0x02, 0x9b, 0x80,
+  0x3f, 0x47, 0x02, 0x03, 0x3f, 0x48, 0x00, 0x47, 0x04, 0x34, 0xd6, 0x47,
+  0x00, 0x32, 0xf8, 0x09, 0x02, 0x33, 0x09, 0x00, 0x2d, 0xfa, 0xfd, 0x2c,
+  0x51, 0x0c, 0xff, 0xf7, 0xf7, 0xfd, 0x01, 0x36, 0xd6, 0xf9, 0x07, 0x27,
+  0x48, 0x59, 0x02, 0xb4, 0x59, 0x14, 0x01, 0xf8, 0xfb, 0xe3, 0xe7, 0xa7,
+  0x03, 0x09, 0xfb, 0xfc, 0xf7, 0x7b, 0xbe, 0x7f, 0x01, 0xa2, 0xf9, 0xfc,
+  0xf7, 0xa5, 0x03, 0x00, 0xa8, 0xf5, 0xf9, 0x25, 0x02, 0x20, 0x4d, 0x00,
+  0x06, 0xfa, 0x01, 0x68, 0xef, 0x28, 0x29, 0x07, 0xd0, 0x0f, 0x02, 0x1d,
+  0x4e, 0xc9, 0x7b, 0x00, 0x0e, 0x9d, 0x01, 0xfc, 0xf9, 0x07, 0xe0, 0xbf,
+  0x04, 0xfe, 0x65, 0x04, 0x04, 0x26, 0xfe, 0xf7, 0x4e, 0xfe, 0x81, 0xaa,
+  0x25, 0x0c, 0x15, 0x25, 0x08, 0xe9, 0x25, 0x08, 0xc6, 0x25, 0x04, 0x05,
+  0xbe, 0x25, 0x00, 0x3b, 0xfe, 0xfc, 0xf7, 0x36, 0x5d, 0x00, 0x34, 0xfe,
+  0x03, 0x00, 0x81, 0xf9, 0x00, 0xbd, 0x02, 0x98, 0x00, 0xab, 0x00, 0x00,
+  0x03, 0x00, 0x20, 0x06, 0x00, 0x0c, 0x06, 0x00, 0xea, 0xaa, 0x9b, 0x01,
+  0x38, 0x23, 0x01, 0xbe, 0x07, 0x00, 0x7c, 0x07, 0x00, 0xac, 0xbd, 0x42,
+  0xe7, 0x00, 0xb4, 0x00, 0x00, 0x04, 0x1f, 0x00, 0x05, 0xf6, 0x03, 0x00,
+  0xa0, 0x3f, 0x83, 0x05, 0x63, 0x61, 0x73, 0x65, 0x4d, 0x00, 0xb5, 0x02,
+  0xae, 0xfa, 0x31, 0x07, 0x05, 0x02, 0x08, 0xd1, 0x00, 0xfd, 0xb8, 0x1f,
+  0x04, 0x03, 0x3f, 0x6f, 0x66, 0x68, 0x48, 0xbf, 0x0a, 0xe0, 0x01, 0x3e,
+  0xb6, 0x41, 0xbb, 0x07, 0x58, 0xfd, 0x40, 0x77, 0x05, 0x6f, 0x66, 0x00,
+  0x63, 0x48, 0x08, 0xf6, 0xbb, 0x01, 0x26, 0xe6, 0xbb, 0x0b, 0x06, 0x00,
+  0xfe, 0xf7, 0xff, 0x95, 0xff, 0xff, 0xf7, 0x64, 0xfd, 0x39, 0x68, 0xaa,
+  0x2f, 0x01, 0x46, 0x2b, 0x07, 0x09, 0x51, 0x04, 0x59, 0xfd, 0x00, 0x87,
+  0xd4, 0xa5, 0x00, 0x31, 0x02, 0x0d, 0x31, 0x04, 0xfc, 0xd3, 0x00, 0xfc,
+  0xf7, 0xd5, 0x10, 0x03, 0x00, 0x13, 0x03, 0x00, 0x16, 0x23, 0x05, 0x50,
+  0x4e, 0xff, 0xfc, 0xf7, 0x1d, 0xfa, 0x0e, 0x43, 0x02, 0x68, 0xff, 0x28,
+  0x2a, 0x0d, 0xd1, 0x42, 0x68, 0xff, 0x2a, 0xef, 0x07, 0xd8, 0x40, 0xcf,
+  0x19, 0x02, 0x4b, 0x4e, 0x16, 0xff, 0x43, 0x09, 0x02, 0x0e, 0x43, 0x04,
+  0xe0, 0xfc, 0xff, 0xf7, 0x02, 0xfa, 0x0a, 0x00, 0xd2, 0x00, 0x16, 0xfa,
+  0x15, 0x01, 0x5e, 0x39, 0x00, 0xb4, 0xf8, 0xfc, 0xf7, 0x01, 0xef, 0xf9,
+  0xc3, 0xe7, 0x30, 0xcd, 0x01, 0xb0, 0x42, 0x70, 0xfb, 0x47, 0x90, 0x9f,
+  0x02, 0x80, 0x05, 0x65, 0x6e, 0x64, 0xb7, 0x6f, 0x66, 0x09, 0x6d, 0x00,
+  0xd6, 0xe5, 0x6d, 0x02, 0x40, 0xbf, 0xb4, 0x40, 0xcf, 0xff, 0xf7, 0x17,
+  0x99, 0x08, 0xff, 0xdb, 0xf7, 0x2a, 0xb9, 0x05, 0x40, 0xbc, 0xed, 0x0a,
+  0xc0, 0x46, 0xc5, 0xe0, 0x37, 0x04, 0x07, 0x37, 0x00, 0x12, 0x03, 0xa7,
+  0x02, 0xb9, 0xe5, 0x1a, 0xd9, 0x0a, 0x29, 0xbd, 0x00, 0x28, 0xf9, 0xe1,
+  0x03, 0xe9, 0x03, 0x69, 0x02, 0xff, 0x00, 0x28, 0x0d, 0xd0, 0x03, 0xb4,
+  0x01, 0x21, 0xff, 0x31, 0x40, 0x00, 0x29, 0x03, 0xd0, 0x01, 0x3e, 0xff,
+  0xff, 0xf7, 0xf8, 0xfc, 0x01, 0xe0, 0xff, 0xf7, 0xff, 0xef, 0xfc, 0x03,
+  0xbc, 0x01, 0x38, 0xef, 0xe7, 0xf7, 0x00, 0xbd, 0xf4, 0x4f, 0x00, 0x00,
+  0x80, 0x05, 0x74, 0xef, 0x6f, 0x6b, 0x65, 0x6e, 0xff, 0x05, 0x26, 0x05,
+  0xe0, 0xfb, 0x64, 0x41, 0x13, 0x04, 0x70, 0x61, 0x72, 0x73, 0x65, 0x7f,
+  0x10, 0xb5, 0xfe, 0xf7, 0x52, 0xfb, 0x31, 0x4b, 0x00, 0xfe, 0x4f, 0x02,
+  0x14, 0x4a, 0x12, 0x68, 0x84, 0x18, 0x20, 0xff, 0x2e, 0x07, 0xd1, 0x91,
+  0x42, 0x0f, 0xd0, 0x83, 0xff, 0x5c, 0xb3, 0x42, 0x02, 0xd1, 0x01, 0x32,
+  0x84, 0xbf, 0x18, 0xf7, 0xe7, 0x91, 0x42, 0x07, 0x0f, 0x00, 0x01, 0xff,
+  0x32, 0xb3, 0x42, 0xf9, 0xd1, 0x86, 0x18, 0x36, 0xdf, 0x1b, 0x01, 0x3e,
+  0x01, 0xe0, 0x07, 0x02, 0x04, 0x3f, 0xff, 0x3c, 0x60, 0x06, 0x48, 0x02,
+  0x60, 0x10, 0xbd, 0x97, 0x00, 0x00, 0xae, 0xab, 0x01, 0x50, 0x6f, 0x00,
+  0x97, 0x00, 0x00, 0xfd, 0x80, 0xe7, 0x01, 0x00, 0x28, 0x00, 0x00, 0xe4,
+  0x1f, 0xf7, 0x00, 0x20, 0xa4, 0x6f, 0x06, 0x64, 0x69, 0x67, 0x69, 0xff,
+  0x74, 0xd4, 0x4b, 0x1b, 0x68, 0x30, 0x3e, 0x0b, 0xff, 0xd3, 0x0a, 0x2e,
+  0x0b, 0xd3, 0x07, 0x3e, 0x0a, 0xaf, 0x2e, 0x06, 0xd3, 0x24, 0x03, 0x00,
+  0x20, 0x09, 0x00, 0x01, 0xfe, 0x09, 0x00, 0x01, 0xd3, 0x00, 0x26, 0x70,
+  0x47, 0x9e, 0xf7, 0x42, 0xfb, 0xd2, 0xab, 0x02, 0x00, 0x26, 0xf6, 0x43,
+  0xfa, 0xeb, 0x03, 0xb0, 0x4b, 0x02, 0x80, 0x06, 0x6e, 0x75, 0x6d, 0xbf,
+  0x62, 0x65, 0x72, 0x00, 0x3f, 0xb5, 0xad, 0x02, 0x70, 0xff, 0x1e, 0x01,
+  0x26, 0x01, 0x22, 0x04, 0xb4, 0xc0, 0xfe, 0x4f, 0x00, 0x00, 0x24, 0x00,
+  0x25, 0x00, 0x29, 0x3c, 0xff, 0xd0, 0x01, 0x30, 0x01, 0x39, 0x02, 0x78,
+  0x2d, 0xff, 0x2a, 0x04, 0xd1, 0x01, 0xb0, 0x00, 0x22, 0xd2, 0xff, 0x43,
+  0x04, 0xb4, 0xf3, 0xe7, 0x23, 0x2a, 0x01, 0xbf, 0xd1, 0x0a, 0x23, 0xef,
+  0xe7, 0x24, 0x07, 0x00, 0x10, 0xef, 0x23, 0xeb, 0xe7, 0x25, 0x07, 0x00,
+  0x02, 0x23, 0xe7, 0xfb, 0xe7, 0x2e, 0x07, 0x02, 0x26, 0xe3, 0xe7, 0x2c,
+  0x2a, 0xfb, 0x36, 0xd0, 0x6b, 0x02, 0x16, 0x00, 0xff, 0xf7, 0xb3, 0xbf,
+  0xff, 0x00, 0x2e, 0x40, 0xcf, 0x2b, 0x0f, 0x04, 0x26, 0xb5, 0x00, 0x05,
+  0x02, 0x2e, 0x05, 0x04, 0x1e, 0x00, 0x8d, 0x06, 0x0f, 0xff, 0xb4, 0xfc,
+  0xf7, 0x68, 0xfb, 0x0f, 0xbc, 0x35, 0xfa, 0x7f, 0x00, 0x34, 0xe5, 0x02,
+  0x22, 0xa4, 0x19, 0x55, 0x41, 0xff, 0x40, 0xcf, 0xc0, 0xe7, 0x04, 0xbc,
+  0x00, 0x2a, 0xff, 0x04, 0xd5, 0x00, 0x22, 0xe4, 0x43, 0xed, 0x43, 0xff,
+  0x01, 0x34, 0x55, 0x41, 0x33, 0x00, 0x26, 0x00, 0x6f, 0x01, 0x2b, 0x02,
+  0xd0, 0x43, 0x12, 0x3f, 0xbd, 0x95, 0x00, 0xff, 0x26, 0x3f, 0xbd, 0x25,
+  0x00, 0x00, 0x24, 0x02, 0xff, 0x26, 0x00, 0x29, 0xe4, 0xd0, 0x42, 0x5c,
+  0x01, 0xaf, 0x39, 0x2e, 0x2a, 0xf9, 0x7f, 0x0c, 0x73, 0x7f, 0x04, 0xeb,
+  0x91, 0xd0, 0x53, 0x03, 0x33, 0x06, 0x71, 0x02, 0xe3, 0x71, 0x00, 0x6d,
+  0x02, 0x40, 0xbf, 0xcf, 0xe4, 0xe7, 0xc0, 0x46, 0xd4, 0x0b, 0x07, 0x2e,
+  0xfa, 0x4c, 0x05, 0x00, 0x35, 0x01, 0xd2, 0x30, 0x36, 0x70, 0x47, 0xb6,
+  0x39, 0x01, 0xd2, 0x37, 0x07, 0x00, 0x23, 0x26, 0x2f, 0x03, 0x0c, 0xfd,
+  0x43, 0x23, 0x02, 0x04, 0x68, 0x6f, 0x6c, 0x64, 0x00, 0xfd, 0x33, 0x39,
+  0x00, 0x78, 0x48, 0x01, 0x78, 0x3f, 0x29, 0xff, 0x0d, 0xd2, 0x01, 0x31,
+  0x01, 0x70, 0x40, 0x18, 0xff, 0x01, 0x29, 0x07, 0xd0, 0x01, 0x38, 0x02,
+  0x78, 0xff, 0x01, 0x30, 0x02, 0x70, 0x01, 0x38, 0x01, 0x39, 0xbf, 0x01,
+  0x29, 0xf7, 0xd1, 0x03, 0x70, 0x37, 0x02, 0x2c, 0xaa, 0x37, 0x04, 0x05,
+  0x37, 0x02, 0x3c, 0x37, 0x02, 0x6a, 0x37, 0x04, 0x02, 0xbe, 0x37, 0x04,
+  0x43, 0x54, 0x70, 0x47, 0x44, 0x57, 0x06, 0x73, 0xff, 0x69, 0x67, 0x6e,
+  0x00, 0x00, 0x2e, 0x01, 0xd4, 0x7e, 0x85, 0x01, 0x47, 0x2d, 0x26, 0xcd,
+  0xe7, 0x58, 0x17, 0x04, 0x7f, 0x02, 0x23, 0x3e, 0x00, 0x5e, 0x48, 0x06,
+  0x57, 0x00, 0xdf, 0x38, 0x60, 0x70, 0x47, 0x70, 0x13, 0x04, 0x03, 0x66,
+  0xff, 0x23, 0x53, 0x10, 0xb5, 0x20, 0x24, 0x00, 0xf0, 0xff, 0x08, 0xf8,
+  0x01, 0x3c, 0xfb, 0xd1, 0x10, 0xbd, 0x7d, 0x94, 0x2b, 0x06, 0x66, 0x23,
+  0x00, 0x00, 0xb5, 0xe3, 0x02, 0xff, 0x50, 0x4e, 0x36, 0x68, 0xfc, 0xf7,
+  0x8f, 0xfa, 0xff, 0xff, 0xf7, 0x99, 0xff, 0xff, 0xf7, 0xc4, 0xff, 0xd3,
+  0x00, 0xbd, 0xef, 0x01, 0x4f, 0x08, 0x53, 0x23, 0x00, 0x00, 0xf0, 0xff,
+  0x0a, 0xf8, 0x00, 0x2e, 0xfb, 0xd1, 0x38, 0x68, 0x7f, 0x00, 0x28, 0xf8,
+  0xd1, 0x00, 0xbd, 0xdc, 0x1b, 0x04, 0xcb, 0x01, 0x23, 0x3d, 0x06, 0x41,
+  0x3d, 0x00, 0x9b, 0x07, 0xfc, 0xf7, 0xff, 0x6f, 0xfb, 0xfc, 0xf7, 0xca,
+  0xf8, 0x40, 0xcf, 0x57, 0xff, 0xf7, 0x74, 0x49, 0x00, 0x83, 0x49, 0x00,
+  0xf0, 0x47, 0x06, 0xff, 0x3c, 0x23, 0x00, 0x38, 0x48, 0x00, 0x21, 0x01,
+  0xe6, 0xe3, 0x04, 0x04, 0x44, 0x7f, 0x06, 0x95, 0x07, 0x20, 0x26, 0x05,
+  0xdf, 0xe0, 0xc0, 0x46, 0x54, 0x44, 0xab, 0x06, 0x2e, 0x6e, 0xef, 0x00,
+  0xb5, 0x10, 0xb4, 0x6b, 0x03, 0xfc, 0xf7, 0x7f, 0xdf, 0xfd, 0xfc, 0xf7,
+  0xc3, 0xf9, 0x5b, 0x06, 0xff, 0xf7, 0x7d, 0xdf, 0x51, 0x00, 0xb9, 0xff,
+  0x40, 0xcf, 0x2c, 0x0b, 0x00, 0xff, 0x72, 0xff, 0x00, 0x2c, 0x03, 0xd0,
+  0xff, 0xf7, 0x6b, 0x9f, 0xff, 0xd1, 0x04, 0xbc, 0x71, 0x02, 0x78, 0xff,
+  0x29, 0x02, 0xf4, 0xb3, 0x05, 0x4f, 0x00, 0x6c, 0x4f, 0x06, 0x75, 0x64,
+  0x2e, 0x00, 0xef, 0xb5, 0xff, 0xf7, 0xc1, 0x3b, 0x00, 0x9b, 0xff, 0x12,
+  0xf2, 0x17, 0x00, 0xa0, 0x7b, 0x06, 0x16, 0x00, 0x00, 0xb5, 0xfc, 0xf7,
+  0x7d, 0x4e, 0x61, 0x00, 0x92, 0xf9, 0xff, 0xf7, 0xb1, 0x1f, 0x00, 0xff,
+  0x8b, 0xff, 0xfc, 0xf7, 0x59, 0xfd, 0xff, 0xf7, 0xfd, 0x54, 0x0b, 0x00,
+  0x5d, 0xff, 0xfe, 0xf7, 0xa2, 0xfa, 0xaf, 0xfe, 0xf7, 0xee, 0xf9, 0x0b,
+  0x03, 0xb4, 0x33, 0x06, 0x75, 0xfe, 0xaf, 0x06, 0x00, 0x26, 0xd5, 0xe7,
+  0xc0, 0x46, 0x7c, 0xf5, 0x46, 0x03, 0x05, 0x2e, 0x11, 0x02, 0xf6, 0x17,
+  0xd8, 0xe7, 0xff, 0xfc, 0x1f, 0x00, 0x20, 0x84, 0x00, 0x00, 0x20, 0xff,
+  0x30, 0xb5, 0xd7, 0x4c, 0x25, 0x68, 0x00, 0x2d, 0xff, 0x01, 0xd1, 0x3d,
+  0x00, 0x25, 0x60, 0x30, 0xbd, 0xef, 0x30, 0xb5, 0xd3, 0x4c, 0x09, 0x0a,
+  0xd0, 0x4c, 0x00, 0xfd, 0x25, 0x09, 0x02, 0xce, 0x4b, 0x1b, 0x68, 0xdb,
+  0x1b, 0x7f, 0x9b, 0x08, 0x70, 0x47, 0x00, 0xb5, 0x31, 0xe9, 0x00, 0xff,
+  0xcb, 0x48, 0x08, 0x40, 0x02, 0xd0, 0x00, 0xf0, 0xdf, 0xa1, 0xf8, 0x00,
+  0xbd, 0xc9, 0x0b, 0x00, 0x01, 0xd1, 0xbf, 0xfd, 0xf7, 0x41, 0xf8, 0x32,
+  0x00, 0xd5, 0x02, 0xd7, 0xdb, 0xff, 0xc6, 0x11, 0x00, 0x03, 0xd0, 0x67,
+  0x02, 0x16, 0x00, 0xff, 0x00, 0xbd, 0xff, 0xf7, 0xe0, 0xff, 0x80, 0x20,
+  0xdf, 0x08, 0x40, 0x06, 0xd1, 0x40, 0x05, 0x00, 0x09, 0xd0, 0xbd, 0x0f,
+  0x05, 0x00, 0x83, 0x42, 0x05, 0xd3, 0x1f, 0x06, 0xfe, 0xbf, 0xf7, 0x82,
+  0xfd, 0x00, 0xbd, 0xba, 0x31, 0x00, 0x14, 0x9f, 0xd0, 0xfb, 0xf7, 0xc6,
+  0xfd, 0x15, 0x06, 0x05, 0x02, 0x0e, 0xbf, 0x00, 0x00, 0xf0, 0x30, 0xf8,
+  0x10, 0x21, 0x00, 0xdd, 0x7f, 0xfc, 0x42, 0x1c, 0xb3, 0x48, 0x90, 0x47,
+  0xf5, 0x02, 0x77, 0xfb, 0xf7, 0xc3, 0x2f, 0x00, 0xfb, 0xf7, 0xb1, 0x29,
+  0x18, 0xff, 0x1b, 0xf8, 0xfb, 0xf7, 0x3c, 0xfe, 0xff, 0xf7, 0xf7, 0xa5,
+  0xff, 0xa9, 0x8f, 0x04, 0xfb, 0xf7, 0xa4, 0xff, 0xae, 0x21, 0x06, 0x10,
+  0x22, 0x0a, 0xab, 0x00, 0xfe, 0x39, 0x01, 0x00, 0xfb, 0xbd, 0x20, 0x0b,
+  0x08, 0xa0, 0xfc, 0x00, 0xbd, 0xfe, 0x7f, 0xf7, 0x9a, 0xfb, 0x00, 0xbd,
+  0x0f, 0xb5, 0xb5, 0x02, 0xfd, 0x33, 0x03, 0x00, 0x9c, 0x48, 0x01, 0x68,
+  0x06, 0x29, 0xff, 0x07, 0xd2, 0x06, 0x20, 0x41, 0x43, 0x9a, 0x48, 0xff,
+  0x40, 0x18, 0x03, 0x80, 0x1b, 0x0c, 0x43, 0x80, 0xf7, 0x82, 0x80, 0x96,
+  0x17, 0x00, 0x01, 0x31, 0x01, 0x60, 0xf5, 0x0f, 0x2b, 0x00, 0x93, 0x23,
+  0x04, 0x1e, 0xd8, 0x92, 0x48, 0xef, 0x01, 0x39, 0x1c, 0xd0, 0x7b, 0x06,
+  0xfe, 0xf7, 0x79, 0x7d, 0xfe, 0x09, 0x02, 0x06, 0x88, 0xfe, 0xf7, 0x74,
+  0x09, 0x04, 0xd5, 0x46, 0x09, 0x00, 0x6f, 0x09, 0x04, 0x86, 0x09, 0x00,
+  0x6a, 0xfe, 0xbf, 0x06, 0x30, 0x01, 0x39, 0xed, 0xd1, 0x0f, 0x02, 0x7d,
+  0x7f, 0x4e, 0xfe, 0xf7, 0x05, 0xfe, 0x0f, 0xbd, 0x0b, 0x02, 0xff, 0x40,
+  0x26, 0xfe, 0xf7, 0xff, 0xfd, 0x0f, 0xbd, 0xe7, 0x00, 0xb5, 0x30, 0x7d,
+  0x00, 0x27, 0x00, 0xfc, 0x01, 0x88, 0xfb, 0x02, 0x30, 0x49, 0x06, 0x42,
+  0x88, 0x12, 0x04, 0x16, 0xfd, 0x43, 0x41, 0x06, 0x03, 0xb4, 0xff, 0xf7,
+  0x44, 0xff, 0xfb, 0x03, 0xbc, 0x45, 0x02, 0xef, 0xd1, 0x00, 0xbd, 0xc4,
+  0xfe, 0xc7, 0x05, 0x08, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0xff, 0x74,
+  0x65, 0x00, 0x00, 0xb5, 0xfe, 0xf7, 0x8c, 0xff, 0xf8, 0x01, 0xcf, 0x01,
+  0xb4, 0x40, 0xb4, 0x40, 0xfb, 0xcf, 0x6d, 0xa1, 0x00, 0x02, 0xb4, 0x00,
+  0x21, 0x01, 0xfd, 0x60, 0x8d, 0x00, 0xf8, 0x00, 0xf0, 0x14, 0xf8, 0x68,
+  0xdf, 0x48, 0x02, 0xbc, 0x01, 0x60, 0x71, 0x04, 0xbc, 0x01, 0xaf, 0xbc,
+  0x04, 0x3f, 0x38, 0x19, 0x00, 0x67, 0xb7, 0x01, 0xc0, 0xfd, 0x47, 0x47,
+  0x02, 0x09, 0x69, 0x6e, 0x74, 0x65, 0x72, 0xff, 0x70, 0x72, 0x65, 0x74,
+  0x00, 0xb5, 0x5f, 0x48, 0xff, 0x87, 0x42, 0x0b, 0xd9, 0xfe, 0xf7, 0x1e,
+  0xf9, 0xff, 0x10, 0x53, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x75, 0xff, 0x6e,
+  0x64, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0xdf, 0x0a, 0x00, 0x79, 0xe0,
+  0x58, 0x1d, 0x00, 0x0a, 0xd2, 0xdf, 0xfe, 0xf7, 0x0f, 0xf9, 0x0f, 0x1d,
+  0x06, 0x6f, 0x76, 0xbe, 0x1c, 0x08, 0x6b, 0xe0, 0xff, 0xf7, 0xdc, 0x7b,
+  0x01, 0xea, 0xff, 0xfc, 0x00, 0x2e, 0x02, 0xd1, 0x04, 0x37, 0x40, 0x9f,
+  0xcf, 0x00, 0xbd, 0x38, 0x68, 0x71, 0x02, 0x6d, 0x02, 0xff, 0xcf, 0xf7,
+  0xcc, 0xf8, 0x31, 0xe1, 0x00, 0x67, 0x03, 0x00, 0x2a, 0xff, 0x15, 0xd1,
+  0x38, 0x68, 0x31, 0x00, 0xfc, 0xf7, 0xbf, 0x2a, 0xff, 0xff, 0xf7, 0x35,
+  0xfd, 0x13, 0x06, 0xc2, 0xff, 0xd1, 0xfe, 0xf7, 0x48, 0xf9, 0xfe, 0xf7,
+  0xe2, 0xff, 0xf8, 0x0c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0xfd, 0x6f,
+  0x78, 0x00, 0x2e, 0x0a, 0x00, 0x3f, 0xe0, 0x3c, 0xff, 0x4b, 0x1b, 0x68,
+  0x00, 0x2b, 0x1c, 0xd1, 0xff, 0xff, 0xf7, 0xb9, 0xfe, 0x30, 0x23, 0x0b,
+  0x40, 0x30, 0xeb, 0x2b, 0x0e, 0x2b, 0x00, 0x2e, 0x2b, 0x00, 0xcc, 0xf8,
+  0x12, 0xff, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0xff, 0x69,
+  0x6c, 0x65, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0xe6, 0x31, 0x00, 0x26, 0xe0,
+  0x7d, 0x02, 0xf7, 0x07, 0xfe, 0xf7, 0x55, 0xe7, 0xfc, 0x95, 0xe7, 0x0f,
+  0x0e, 0xad, 0x07, 0xff, 0xf7, 0x9e, 0xef, 0xfe, 0x8a, 0xe7, 0xdc, 0xfb,
+  0x00, 0x81, 0x80, 0x09, 0xff, 0x68, 0x6f, 0x6f, 0x6b, 0x2d, 0x71, 0x75,
+  0x69, 0xfd, 0x74, 0x1b, 0x02, 0x22, 0x4e, 0x70, 0x47, 0x18, 0x48, 0xaf,
+  0x00, 0x00, 0x74, 0x48, 0x17, 0x03, 0x04, 0x16, 0x02, 0x00, 0xff, 0x1e,
+  0x48, 0x85, 0x46, 0x19, 0x4f, 0xfd, 0xf7, 0x1f, 0xa1, 0xfb, 0x1d, 0x48,
+  0x0a, 0x53, 0x01, 0x1f, 0x00, 0x05, 0x00, 0xff, 0x0b, 0x48, 0x01, 0x60,
+  0xfb, 0xf7, 0x4a, 0xfd, 0xf3, 0x12, 0x48, 0x11, 0x02, 0x03, 0x00, 0x49,
+  0x41, 0x60, 0x13, 0xff, 0x48, 0x00, 0x68, 0x87, 0x46, 0xfd, 0xf7, 0xd6,
+  0xfe, 0xd7, 0x00, 0x5a, 0xff, 0xfe, 0xf7, 0x7c, 0xf8, 0x05, 0xff, 0x20,
+  0x6f, 0x6b, 0x2e, 0x0a, 0xf5, 0xe7, 0x08, 0xdf, 0x00, 0x00, 0x20, 0x00,
+  0x10, 0x53, 0x00, 0x04, 0x00, 0x7e, 0x09, 0x02, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x28, 0x09, 0x02, 0xea, 0x18, 0x00, 0x5c, 0x07, 0x00, 0x60, 0x03,
+  0x00, 0xe4, 0x1f, 0x00, 0xf7, 0x20, 0x8c, 0x02, 0x03, 0x00, 0x01, 0x00,
+  0x20, 0xd8, 0x7a, 0x0b, 0x00, 0xd4, 0x0f, 0x02, 0x03, 0x00, 0x20, 0xfc,
+  0x07, 0x00, 0xd5, 0xdc, 0x03, 0x00, 0xc4, 0x23, 0x00, 0x90, 0x97, 0x04,
+  0x05, 0x65, 0xfa, 0xb0, 0x01, 0x3f, 0xaf, 0x02, 0xef, 0xf3, 0x10, 0x86,
+  0x01, 0xff, 0x3e, 0xb6, 0x41, 0x70, 0x47, 0xc0, 0x46, 0xa0, 0xee, 0x1b,
+  0x00, 0x20, 0x80, 0x04, 0x1b, 0x02, 0x00, 0x62, 0xb6, 0x57, 0x70, 0x47,
+  0xb0, 0x0f, 0x06, 0x64, 0x0f, 0x02, 0x72, 0x0f, 0x00, 0x7d, 0xc8, 0x0f,
+  0x06, 0x69, 0x70, 0x73, 0x72, 0x00, 0x3b, 0x06, 0xeb, 0x05, 0x86, 0x37,
+  0x02, 0xd4, 0x53, 0x04, 0x03, 0x6e, 0x6f, 0xf5, 0x70, 0xfb, 0x00, 0x49,
+  0x0b, 0x02, 0x09, 0x75, 0x6e, 0x68, 0xff, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+  0x64, 0x00, 0xb5, 0xbf, 0xfe, 0xf7, 0x19, 0xf8, 0x14, 0x55, 0x0f, 0x0a,
+  0x20, 0xff, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0xfb, 0x74,
+  0x20, 0x43, 0x0c, 0xfe, 0xf7, 0x80, 0xf8, 0xfe, 0xff, 0xf7, 0x06, 0xf8,
+  0x02, 0x21, 0x0a, 0x00, 0x00, 0xef, 0xbd, 0xc0, 0x46, 0x2c, 0x43, 0x04,
+  0x05, 0x72, 0x65, 0xff, 0x73, 0x65, 0x74, 0x87, 0x48, 0x88, 0x49, 0x01,
+  0xdf, 0x60, 0xc0, 0x46, 0x50, 0x49, 0x6b, 0x03, 0x0b, 0x69, 0xff, 0x72,
+  0x71, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x69, 0xab, 0x63, 0x6b, 0x3d, 0x02,
+  0x82, 0x6d, 0x01, 0xe4, 0x7d, 0x00, 0x80, 0xea, 0x37, 0x05, 0x74, 0x23,
+  0x04, 0x09, 0x23, 0x02, 0x66, 0x61, 0x75, 0xd5, 0x6c, 0x8f, 0x05, 0x7a,
+  0x21, 0x08, 0x78, 0x21, 0x04, 0xc0, 0x46, 0xf5, 0x9c, 0x23, 0x04, 0x0e,
+  0x23, 0x02, 0x63, 0x6f, 0x6c, 0x6c, 0xbf, 0x65, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x89, 0x04, 0x71, 0xaa, 0x29, 0x08, 0x6f, 0x29, 0x04, 0xbc, 0x27,
+  0x04, 0x07, 0x27, 0x02, 0x72, 0xab, 0x74, 0x63, 0x1f, 0x02, 0x6a, 0x1f,
+  0x08, 0x68, 0x1f, 0x04, 0xe0, 0xfe, 0x8f, 0x0e, 0x65, 0x78, 0x74, 0x69,
+  0x30, 0x5f, 0x31, 0x6a, 0x23, 0x02, 0x62, 0x23, 0x08, 0x60, 0x23, 0x04,
+  0x04, 0x4a, 0x23, 0x14, 0x57, 0x32, 0x5f, 0x33, 0x23, 0x02, 0x5a, 0x23,
+  0x08, 0x58, 0x23, 0x04, 0xf5, 0x2c, 0x23, 0x04, 0x0c, 0x23, 0x0a, 0x34,
+  0x5f, 0x31, 0x35, 0x6a, 0x8d, 0x04, 0x51, 0x25, 0x08, 0x4f, 0xb7, 0x08,
+  0x50, 0x4a, 0xdb, 0x0c, 0x5f, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x23, 0x02,
+  0x49, 0x23, 0x08, 0xd5, 0x47, 0x23, 0x08, 0x74, 0x23, 0x04, 0x08, 0x23,
+  0x02, 0x64, 0x6d, 0xab, 0x61, 0x31, 0x47, 0x04, 0x41, 0x23, 0x08, 0x3f,
+  0x23, 0x08, 0x98, 0xa2, 0x23, 0x04, 0x0a, 0x23, 0x08, 0x92, 0x00, 0x25,
+  0x04, 0x39, 0x25, 0x08, 0x37, 0x5c, 0xfb, 0x06, 0x23, 0x14, 0x34, 0x5f,
+  0x37, 0x23, 0x04, 0x31, 0x23, 0x08, 0x6d, 0x2f, 0x23, 0x04, 0xdc, 0x4a,
+  0x1f, 0x0d, 0x61, 0x64, 0x1f, 0x05, 0xb5, 0x2a, 0x1f, 0x08, 0x28, 0x1f,
+  0x04, 0x00, 0x4b, 0x43, 0x0c, 0x6c, 0xaf, 0x70, 0x74, 0x69, 0x6d, 0x8d,
+  0x06, 0x22, 0x23, 0x08, 0x20, 0xa6, 0x23, 0x04, 0x24, 0x4b, 0xaf, 0x0c,
+  0x21, 0x00, 0x32, 0x21, 0x04, 0x1a, 0xda, 0x21, 0x08, 0x18, 0xaf, 0x08,
+  0x88, 0x4b, 0x67, 0x0c, 0x64, 0x61, 0xea, 0x67, 0x04, 0x13, 0x21, 0x08,
+  0x11, 0x21, 0x04, 0x0c, 0xed, 0x00, 0xff, 0xe0, 0x04, 0x00, 0xfa, 0x05,
+  0xd0, 0x1f, 0x00, 0xab, 0x20, 0xcc, 0x03, 0x00, 0xc8, 0x03, 0x00, 0xc4,
+  0x03, 0x00, 0xc0, 0xaa, 0x03, 0x00, 0xbc, 0x03, 0x00, 0xb8, 0x03, 0x00,
+  0xb4, 0x03, 0x00, 0xb0, 0xaa, 0x03, 0x00, 0xac, 0x03, 0x00, 0xa8, 0x03,
+  0x00, 0xa4, 0x03, 0x00, 0xa0, 0x2a, 0x03, 0x00, 0x9c, 0x03, 0x00, 0x98,
+  0x17, 0x02, 0x4b, 0x5b, 0x0f, 0x87, 0x00, 0xaa, 0xc9, 0x05, 0x94, 0x65,
+  0x08, 0x92, 0x87, 0x08, 0xd0, 0x23, 0x16, 0x32, 0xaa, 0x23, 0x02, 0x8c,
+  0x23, 0x08, 0x8a, 0x23, 0x08, 0xf4, 0xcf, 0x0e, 0x69, 0xab, 0x32, 0x63,
+  0xf1, 0x06, 0x84, 0x23, 0x08, 0x82, 0x23, 0x08, 0x18, 0xa9, 0x4c, 0x23,
+  0x12, 0xf3, 0x06, 0x7c, 0x23, 0x08, 0x7a, 0x23, 0x08, 0x3c, 0xae, 0x23,
+  0x0e, 0x73, 0x70, 0x69, 0x47, 0x06, 0x74, 0x23, 0x08, 0x72, 0x52, 0x23,
+  0x08, 0x60, 0x23, 0x14, 0x47, 0x06, 0x6c, 0x23, 0x08, 0x6a, 0x23, 0x08,
+  0xfb, 0x84, 0x4c, 0x83, 0x0d, 0x75, 0x73, 0x61, 0x72, 0x74, 0x2a, 0x49,
+  0x06, 0x64, 0x25, 0x08, 0x62, 0x25, 0x04, 0xa8, 0x23, 0x18, 0x49, 0x06,
+  0xb5, 0x5c, 0x23, 0x08, 0x5a, 0x23, 0x04, 0xc8, 0x4c, 0x83, 0x0d, 0x72,
+  0xab, 0x6e, 0x67, 0x1f, 0x02, 0x55, 0x1f, 0x08, 0x53, 0x1f, 0x04, 0xe8,
+  0xae, 0x1f, 0x0e, 0x6c, 0x63, 0x64, 0x1f, 0x02, 0x4e, 0x1f, 0x08, 0x4c,
+  0x76, 0x1f, 0x04, 0x08, 0x4d, 0x1f, 0x0c, 0x75, 0x73, 0x62, 0x1f, 0x02,
+  0x75, 0x47, 0x1f, 0x08, 0x45, 0x1f, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xff, 0x18, 0x2d, 0x2d, 0x2d, 0x20, 0x46, 0x6c, 0x61, 0xff, 0x73, 0x68,
+  0x20, 0x44, 0x69, 0x63, 0x74, 0x69, 0xbf, 0x6f, 0x6e, 0x61, 0x72, 0x79,
+  0x20, 0x14, 0x00, 0x00, 0xff, 0x3c, 0x48, 0x85, 0x46, 0x3c, 0x4f, 0x2a,
+  0x26, 0x7f, 0x3c, 0x48, 0x3d, 0x49, 0x01, 0x60, 0x3d, 0x05, 0x04, 0xfe,
+  0x45, 0x02, 0x3b, 0x4e, 0x3c, 0x4d, 0xb1, 0x88, 0x3c, 0xff, 0x4b, 0x99,
+  0x42, 0x24, 0xd0, 0x3b, 0x4b, 0x0b, 0xff, 0x40, 0x0a, 0xd0, 0xb0, 0x1d,
+  0xfe, 0xf7, 0xa8, 0xff, 0xfd, 0xfe, 0xf7, 0xe7, 0xf8, 0x03, 0x88, 0x40,
+  0xff, 0x88, 0x00, 0x04, 0x03, 0x43, 0xed, 0x1a, 0x16, 0xff, 0xe0, 0x80,
+  0x23, 0x0b, 0x40, 0x13, 0xd0, 0x0f, 0x7f, 0x23, 0x19, 0x40, 0x89, 0x00,
+  0x6d, 0x1a, 0x23, 0x02, 0xad, 0x96, 0x23, 0x00, 0xd5, 0xf8, 0x43, 0x02,
+  0x06, 0xef, 0x04, 0x2e, 0xfe, 0x05, 0x04, 0x0e, 0x00, 0xfc, 0xf7, 0xcf,
+  0xfc, 0xfe, 0xff, 0xf7, 0x64, 0xfd, 0x30, 0x00, 0x40, 0xcf, 0xd1, 0xff,
+  0xd0, 0x27, 0x48, 0x06, 0x60, 0x40, 0xcf, 0x27, 0xff, 0x48, 0x05, 0x60,
+  0x27, 0x48, 0x27, 0x49, 0x22, 0xff, 0x4a, 0x88, 0x42, 0x04, 0xd0, 0x02,
+  0x38, 0x03, 0xff, 0x88, 0x93, 0x42, 0xf9, 0xd0, 0x02, 0x30, 0x24, 0xff,
+  0x49, 0x08, 0x60, 0xfd, 0xf7, 0xb7, 0xf8, 0x23, 0xb7, 0x48, 0x00, 0x21,
+  0x8f, 0x06, 0x21, 0x4e, 0x05, 0x02, 0x04, 0xff, 0x26, 0xfe, 0xf7, 0x76,
+  0xfd, 0x40, 0xcf, 0x00, 0xff, 0x2e, 0x02, 0xd0, 0xfe, 0xf7, 0x36, 0xf9,
+  0x14, 0xff, 0xe5, 0x40, 0xcf, 0xfd, 0xe4, 0x69, 0x6e, 0x69, 0xbf, 0x74,
+  0x94, 0x1f, 0x00, 0x20, 0x90, 0x03, 0x00, 0x8c, 0xaa, 0x03, 0x00, 0x88,
+  0x03, 0x00, 0x84, 0x03, 0x00, 0x80, 0x03, 0x00, 0x7c, 0xaa, 0x03, 0x00,
+  0x78, 0x03, 0x00, 0x74, 0x03, 0x00, 0x70, 0x03, 0x00, 0x6c, 0xba, 0x23,
+  0x02, 0x03, 0x03, 0x00, 0x02, 0x00, 0x20, 0x18, 0x01, 0x20, 0x5f, 0x4c,
+  0x04, 0x00, 0x20, 0x04, 0x07, 0x00, 0xc0, 0x26, 0x03, 0xfd, 0x20, 0x13,
+  0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1c, 0xa2, 0x0d, 0x00, 0x24, 0x11,
+  0x02, 0x0c, 0x02, 0x43, 0x01, 0x18, 0x0b, 0x00, 0x08, 0x0e, 0x03, 0x00,
+  0xec, 0x4d, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x42, 0xff,
+  0x80, 0x04, 0x69, 0x6e, 0x69, 0x74, 0x00, 0xfd, 0x7f, 0xf7, 0x10, 0xfa,
+  0xfc, 0xf7, 0x33, 0xff,
@@ -13,7 +13,8 @@
 #define ERROR_PIN   16  // P3A: analog  pin on JeePort #3
 #define START_PIN   3   // IRQ: interrupt pin on all JeePorts
 
-#define BOOT_LOADER "l052-mecrisp.h"
+#define BOOT_LOADER "l052-mecrisp-lz.h" // made with isp_prepare/lzpack.tcl
+#define PACKED      1   // set to 0 for a plain image, such as l052-mecrisp.h
 
 #define RESET() ((void (*)()) 0)()
 
@@ -21,6 +22,14 @@ const uint8_t data[] PROGMEM = {
 #include BOOT_LOADER
 };
 
+#if PACKED
+#include <LZunpack.h>
+LZUnpack image (data);
+#define IMAGE_SIZE image.size()
+#else
+#define IMAGE_SIZE sizeof data
+#endif
+
 ParitySerial Target (RX_PIN, TX_PIN); // defaults to even parity
 uint8_t check;
 
@@ -40,7 +49,12 @@ enum {
 };
 
 static uint8_t getData (uint16_t index) {
+#if PACKED
+    // a packed image can only be read in sequence, the last page is padded
+    return index < IMAGE_SIZE ? image.get() : 0xFF;
+#else
     return pgm_read_byte(data + index);
+#endif
 }
 
 static uint8_t getReply () {
@@ -136,7 +150,7 @@ static void massErase () {
     // ... so erase a list of segments instead, 1 more than needed
     // this will only erase the pages to be programmed!
     sendCmd(EXTERA_CMD);
-    uint16_t pages = (sizeof data + 127) / 128;
+    uint16_t pages = (IMAGE_SIZE + 127) / 128;
     send2Bytes(pages - 1);
     for (int i = 0; i < pages; ++i)
         send2Bytes(i);
@@ -170,7 +184,7 @@ void setup () {
     Serial.print("[uploadJNZ] ");
     Serial.print(BOOT_LOADER);
     Serial.print(' ');
-    Serial.println(sizeof data);
+    Serial.println(IMAGE_SIZE);
     Serial.println();
 
     digitalWrite(ERROR_PIN, 0); pinMode(ERROR_PIN, OUTPUT);
@@ -216,7 +230,7 @@ void setup () {
     Serial.println("OK");
     
     Serial.print("     Writing: ");
-    for (uint16_t offset = 0; offset < sizeof data; offset += 256) {
+    for (uint16_t offset = 0; offset < IMAGE_SIZE; offset += 256) {
         digitalWrite(ERROR_PIN, 1);
         Serial.print('.');
         sendCmd(WRITE_CMD);
@@ -238,7 +252,7 @@ void setup () {
     Serial.println(" OK");
 
     Serial.print("        Done: ");
-    Serial.print(sizeof data);
+    Serial.print(IMAGE_SIZE);
     Serial.println(" bytes uploaded.");
     digitalWrite(GREEN_PIN, 1);
 
@@ -9,13 +9,13 @@
 #define RF69_COMPAT 0 // define this to use the RF69 driver i.s.o. RF12
 
 #include <JeeLib.h>
+#include <RF12ook.h>
 #include <util/crc16.h>
 #include <avr/eeprom.h>
 #include <avr/pgmspace.h>
-#include <util/parity.h>
 
 #define MAJOR_VERSION RF12_EEPROM_VERSION // bump when EEPROM layout changes
-#define MINOR_VERSION 2                   // bump on other non-trivial changes
+#define MINOR_VERSION 3                   // bump on other non-trivial changes
 #define VERSION "[RF12demo.12]"           // keep in sync with the above
 
 #if defined(__AVR_ATtiny84__) || defined(__AVR_ATtiny44__)
@@ -153,7 +153,8 @@ typedef struct {
     byte hex_output   :2;   // 0 = dec, 1 = hex, 2 = hex+ascii
     byte collect_mode :1;   // 0 = ack, 1 = don't send acks
     byte quiet_mode   :1;   // 0 = show all, 1 = show only valid packets
-    byte spare_flags  :4;
+    byte unique_mode  :1;   // 0 = show all, 1 = don't show repeated packets
+    byte spare_flags  :3;
     word frequency_offset;  // used by rf12_config, offset 4
     byte pad[RF12_EEPROM_SIZE-8];
     word crc;
@@ -163,7 +164,10 @@ static RF12Config config;
 static char cmd;
 static word value;
 static byte stack[RF12_MAXDATA+4], top, sendLen, dest;
-static byte testCounter;
+static byte testCounter, ookActive;
+#if !TINY
+static DedupCache recent (8, 20); // packets seen in the last 2 seconds
+#endif
 
 static void showNibble (byte nibble) {
     char c = '0' + (nibble & 0x0F);
@@ -221,54 +225,20 @@ static void fs20cmd(word house, byte addr, byte cmd) {}
 static void kakuSend(char addr, byte device, byte on) {}
 #else
 
-// Turn transmitter on or off, but also apply asymmetric correction and account
-// for 25 us SPI overhead to end up with the proper on-the-air pulse widths.
-// With thanks to JGJ Veken for his help in getting these values right.
-static void ookPulse(int on, int off) {
-    rf12_onOff(1);
-    delayMicroseconds(on + 150);
-    rf12_onOff(0);
-    delayMicroseconds(off - 200);
-}
+// Packets are sent from the timer interrupt, see RF12ook.h - the buffer is
+// static because it's still in use after these functions have returned.
+static OokPacket ookPacket;
 
-static void fs20sendBits(word data, byte bits) {
-    if (bits == 8) {
-        ++bits;
-        data = (data << 1) | parity_even_bit(data);
-    }
-    for (word mask = bit(bits-1); mask != 0; mask >>= 1) {
-        int width = data & mask ? 600 : 400;
-        ookPulse(width, width);
-    }
-}
+ISR(TIMER1_COMPA_vect) { rf12_ookTimer(); }
 
 static void fs20cmd(word house, byte addr, byte cmd) {
-    byte sum = 6 + (house >> 8) + house + addr + cmd;
-    for (byte i = 0; i < 3; ++i) {
-        fs20sendBits(1, 13);
-        fs20sendBits(house >> 8, 8);
-        fs20sendBits(house, 8);
-        fs20sendBits(addr, 8);
-        fs20sendBits(cmd, 8);
-        fs20sendBits(sum, 8);
-        fs20sendBits(0, 1);
-        delay(10);
-    }
+    ookPacket.fs20(house, addr, cmd);
+    rf12_ookSend(ookPacket);
 }
 
 static void kakuSend(char addr, byte device, byte on) {
-    int cmd = 0x600 | ((device - 1) << 4) | ((addr - 1) & 0xF);
-    if (on)
-        cmd |= 0x800;
-    for (byte i = 0; i < 4; ++i) {
-        for (byte bit = 0; bit < 12; ++bit) {
-            ookPulse(375, 1125);
-            int on = bitRead(cmd, bit) ? 1125 : 375;
-            ookPulse(on, 1500 - on);
-        }
-        ookPulse(375, 375);
-        delay(11); // approximate
-    }
+    ookPacket.kaku(addr, device, on);
+    rf12_ookSend(ookPacket);
 }
 
 #endif
@@ -305,6 +275,7 @@ const char helpText1[] PROGMEM =
     "  ...,<nn> a - send data packet to node <nn>, request ack\n"
     "  ...,<nn> s - send data packet to node <nn>, no ack\n"
     "  <n> q      - set quiet mode (1 = don't report bad packets)\n"
+    "  <n> u      - set unique mode (1 = don't report repeated packets)\n"
     "  <n> x      - set reporting format (0: decimal, 1: hex, 2: hex+ascii)\n"
     "  123 z      - total power down, needs a reset to start up again\n"
     "Remote control commands:\n"
@@ -445,16 +416,14 @@ static void handleInput (char c) {
             rf12_initialize(0, RF12_868MHZ, 0);
             activityLed(1);
             fs20cmd(256 * stack[0] + stack[1], stack[2], value);
-            activityLed(0);
-            rf12_configSilent();
+            ookActive = 1; // the radio is restored in loop(), once sent
             break;
 
         case 'k': // send KAKU command: <addr>,<dev>,<on>k
             rf12_initialize(0, RF12_433MHZ, 0);
             activityLed(1);
             kakuSend(stack[0], stack[1], value);
-            activityLed(0);
-            rf12_configSilent();
+            ookActive = 1; // the radio is restored in loop(), once sent
             break;
 
         case 'z': // put the ATmega in ultra-low power mode (reset needed)
@@ -472,6 +441,11 @@ static void handleInput (char c) {
             saveConfig();
             break;
 
+        case 'u': // turn unique mode on or off (don't report repeats)
+            config.unique_mode = value;
+            saveConfig();
+            break;
+
         case 'x': // set reporting mode to decimal (0), hex (1), hex+ascii (2)
             config.hex_output = value;
             saveConfig();
@@ -575,14 +549,31 @@ void setup () {
 
 void loop () {
 #if TINY
-    if (_receive_buffer_index)
+    if (_receive_buffer_index && !ookActive)
         handleInput(inChar());
 #else
-    if (Serial.available())
+    if (Serial.available() && !ookActive)
         handleInput(Serial.read());
 #endif
+    if (ookActive) {
+        if (rf12_ookBusy())
+            return; // leave the radio alone until the OOK packet is out
+        ookActive = 0;
+        activityLed(0);
+        rf12_configSilent();
+    }
+
     if (rf12_recvDone()) {
         byte n = rf12_len;
+#if !TINY
+        // retries and repeats which were seen recently are only acked
+        if (rf12_crc == 0 && config.unique_mode &&
+                recent.seen(rf12_hdr, (const void*) rf12_data, rf12_len)) {
+            if (RF12_WANTS_ACK && (config.collect_mode) == 0)
+                rf12_sendStart(RF12_ACK_REPLY, 0, 0);
+            return;
+        }
+#endif
         if (rf12_crc == 0)
             showString(PSTR("OK"));
         else {
@@ -0,0 +1,64 @@
+/// @dir crypBench
+/// Compare the time taken by XXTEA and authenticated encryption, per packet.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+// No radio is needed, this only runs the en-/decryption code on rf12_buf.
+// The key used is whatever happens to be stored at RF12_EEPROM_EKEY.
+
+#include <JeeLib.h>
+
+#define TIMES 20 // repeat each measurement this often, to improve resolution
+
+extern void (*crypter)(uint8_t); // the active en-/decryption code in RF12.cpp
+
+static void fillBuffer (byte len) {
+    rf12_grp = 212;
+    rf12_hdr = 1;
+    rf12_len = len;
+    for (byte i = 0; i < len; ++i)
+        rf12_data[i] = i;
+}
+
+// returns the average time in µs for one encryption + one decryption
+static word timeIt (byte len) {
+    word total = 0;
+    for (byte i = 0; i < TIMES; ++i) {
+        fillBuffer(len);
+        unsigned long start = micros();
+        crypter(1);
+        rf12_crc = 0;
+        crypter(0);
+        total += micros() - start;
+    }
+    return total / TIMES;
+}
+
+static void report (const char* name, byte len) {
+    word us = timeIt(len);
+    Serial.print(name);
+    Serial.print(" len ");
+    Serial.print((int) len);
+    Serial.print(": ");
+    Serial.print(us);
+    Serial.print(" us, ");
+    // at 16 MHz, there are 16 cycles per µs
+    Serial.print(us * (F_CPU / 1000000L) / (len > 0 ? len : 1));
+    Serial.print(" cycles/byte, seq ");
+    Serial.println(rf12_seq);
+}
+
+void setup () {
+    Serial.begin(57600);
+    Serial.println("\n[crypBench]");
+
+    static const byte sizes[] = { 2, 4, 8, 16, 32, 58 };
+    for (byte i = 0; i < sizeof sizes; ++i) {
+        rf12_encrypt(RF12_EEPROM_EKEY);
+        report("xxtea", sizes[i]);
+        rf12_encryptAuth(RF12_EEPROM_EKEY);
+        report("auth ", sizes[i]);
+    }
+    Serial.println("done");
+}
+
+void loop () {}
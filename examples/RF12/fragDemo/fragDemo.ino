@@ -0,0 +1,87 @@
+/// @dir fragDemo
+/// Send a block of EEPROM contents to another node, using the RF12frag layer.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Load this sketch on two nodes, each configured with RF12demo to a different
+// node ID in the same group. Then enter "<node> s" on one of them, e.g. "2 s",
+// to send a copy of the first 512 bytes of its EEPROM to that node. Both nodes
+// report the checksum, and the time it took. See host/fragSim.cpp for a
+// simulation of how the transfer time goes up with packet loss.
+
+#include <JeeLib.h>
+#include <RF12frag.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+#define BLOB_SIZE 512 // one copy to send and one to receive, in 2 Kb of RAM
+
+RF12Frag frag (1, BLOB_SIZE);
+byte image [BLOB_SIZE];
+word value;
+byte sending;
+unsigned long sendStart, recvStart;
+
+static word checksum (const byte* ptr, word len) {
+    word crc = ~0;
+    while (len-- > 0)
+        crc = _crc16_update(crc, *ptr++);
+    return crc;
+}
+
+void setup () {
+    Serial.begin(57600);
+    Serial.println("\n[fragDemo]");
+    if (frag.slots() == 0)
+        Serial.println("no memory to receive, can only send");
+    frag.begin(rf12_configSilent());
+    rf12_configDump();
+}
+
+void loop () {
+    if (Serial.available()) {
+        char c = Serial.read();
+        if ('0' <= c && c <= '9')
+            value = 10 * value + c - '0';
+        else {
+            if (c == 's') {
+                eeprom_read_block(image, 0, sizeof image);
+                if (frag.send(value, image, sizeof image)) {
+                    Serial.print("sending, crc ");
+                    Serial.println(checksum(image, sizeof image), HEX);
+                    sendStart = millis();
+                    sending = 1;
+                }
+            }
+            value = 0;
+        }
+    }
+
+    if (rf12_recvDone() && rf12_crc == 0 && frag.accept() && recvStart == 0)
+        recvStart = millis();
+    frag.poll();
+
+    if (sending && frag.sendStatus() != RF12Frag::BUSY) {
+        Serial.print(frag.sendStatus() == RF12Frag::DONE ? "sent" : "failed");
+        Serial.print(", ");
+        Serial.print(millis() - sendStart);
+        Serial.println(" ms");
+        sending = 0;
+    }
+
+    word len;
+    byte node;
+    const byte* data = frag.received(len, node);
+    if (data != 0) {
+        Serial.print("got ");
+        Serial.print(len);
+        Serial.print(" bytes from node ");
+        Serial.print(node);
+        Serial.print(", crc ");
+        Serial.print(checksum(data, len), HEX);
+        Serial.print(", ");
+        Serial.print(millis() - recvStart);
+        Serial.println(" ms");
+        frag.release();
+        recvStart = 0;
+    }
+}
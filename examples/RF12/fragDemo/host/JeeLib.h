@@ -0,0 +1,26 @@
+// Stand-in for the parts of JeeLib used by RF12frag.cpp, for fragSim.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define bit(b)              (1UL << (b))
+
+// the simulated time, see fragSim.cpp
+unsigned long millis ();
+
+// same as in Ports.h
+class MilliTimer {
+    word next;
+    byte armed;
+public:
+    MilliTimer () : armed (0) {}
+    byte poll(word ms =0);
+    void set(word ms);
+};
+
+#include <RF12.h>
@@ -0,0 +1,225 @@
+// Simulate RF12frag message transfers over a lossy link, with two senders.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o fragSim fragSim.cpp
+//
+// Usage: fragSim [-b] [-r runs]
+//  -b          send all packets as broadcasts, with the sender's ID in the
+//              header, as the driver does with RF12_COMPAT
+//  -r runs     messages from each sender for each loss rate, default 100
+//
+// Nodes 1 and 3 both send a message of 1 to 4096 random bytes to node 2 at
+// the same time, which has 2 slots to receive them in. Each packet is lost at
+// random, for each receiving node on its own. Packets are never sent at the
+// same time, since rf12_canSend() here knows exactly when the air is free.
+// Without -b, packets sent with RF12_HDR_DST only reach that node, as with
+// the RF12 driver. With -b, the senders also hear each other's fragments and
+// all status replies, which they have to ignore.
+//
+// A message which does not arrive intact at node 2, or which the sender takes
+// as delivered when it was not, is reported as corrupt. One line of results
+// is printed for each loss rate, with the average time until both senders
+// are done, the goodput in bytes per second of the messages which got
+// through, and the number of packets sent per message. The link rate is
+// 49230 bit/s, i.e. at most 6150 bytes/s. Exits with status 1 if anything
+// was corrupt.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <deque>
+#include <vector>
+
+#include "../../../../RF12frag.cpp"
+
+#define SLOTSIZE    4096    // max message size at node 2
+#define MAXTIME     60      // seconds, after which a run is given up
+
+// the RF12 driver state used by RF12frag.cpp
+volatile uint16_t rf12_crc;
+volatile uint8_t rf12_buf [RF12_MAXDATA + 5];
+
+static uint64_t now;        // simulated time, in us
+static bool broadcast;
+static double loss;
+
+unsigned long millis () {
+    return now / 1000;
+}
+
+// same as in Ports.cpp
+byte MilliTimer::poll(word ms) {
+    byte ready = 0;
+    if (armed) {
+        word remain = next - millis();
+        if (remain <= 60000)
+            return 0;
+        ready = -remain;
+    }
+    set(ms);
+    return ready;
+}
+
+void MilliTimer::set(word ms) {
+    armed = ms != 0;
+    if (armed)
+        next = millis() + ms - 1;
+}
+
+static double rnd () {
+    return rand() / (RAND_MAX + 1.0);
+}
+
+struct Packet {
+    uint64_t at;    // when it has been received, i.e. at the end of sending
+    byte hdr, len, data [RF12_MAXDATA];
+};
+
+struct Node {
+    byte id;
+    std::deque<Packet> inbox;
+    long sent;
+};
+
+static Node nodes [3];
+static Node* current;       // the node calling the rf12_* functions
+static uint64_t airBusy;    // until when a packet is being sent
+
+uint8_t rf12_canSend () {
+    return now >= airBusy;
+}
+
+void rf12_sendStart (uint8_t hdr, const void* ptr, uint8_t len) {
+    if (!rf12_canSend()) {
+        printf("rf12_sendStart called while busy\n");
+        exit(1);
+    }
+    airBusy = now + (len + 9) * 8 * 1000000ULL / 49230;
+    ++current->sent;
+    Packet p;
+    p.at = airBusy;
+    p.len = len;
+    memcpy(p.data, ptr, len);
+    byte dest = hdr & RF12_HDR_DST ? hdr & RF12_HDR_MASK : 0;
+    if (broadcast) {
+        p.hdr = (hdr & (RF12_HDR_CTL | RF12_HDR_ACK)) | current->id;
+        dest = 0;
+    } else
+        p.hdr = dest ? hdr : (hdr & ~RF12_HDR_MASK) | current->id;
+    for (int i = 0; i < 3; ++i)
+        if (&nodes[i] != current && (dest == 0 || dest == nodes[i].id) &&
+                rnd() >= loss)
+            nodes[i].inbox.push_back(p);
+}
+
+uint8_t rf12_recvDone () {
+    std::deque<Packet>& inbox = current->inbox;
+    if (inbox.empty() || inbox.front().at > now)
+        return 0;
+    const Packet& p = inbox.front();
+    rf12_buf[1] = p.hdr;
+    rf12_buf[2] = p.len;
+    memcpy((byte*) rf12_buf + 3, p.data, p.len);
+    rf12_crc = 0;
+    inbox.pop_front();
+    return 1;
+}
+
+int main (int argc, char** argv) {
+    int runs = 100, opt;
+    while ((opt = getopt(argc, argv, "br:")) != -1)
+        switch (opt) {
+            case 'b': broadcast = true; break;
+            case 'r': runs = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-b] [-r runs]\n", argv[0]);
+                return 1;
+        }
+    if (runs < 1) {
+        fprintf(stderr, "%s: need at least 1 run\n", argv[0]);
+        return 1;
+    }
+
+    printf("%s, %d messages from each sender\n\n",
+            broadcast ? "all packets broadcast" : "packets addressed",
+            runs);
+    printf("loss     ok  fail corrupt  ms/run  bytes/s  pkts/msg\n");
+    static const double losses[] = { 0, 0.01, 0.05, 0.1, 0.2, 0.3, 0.5 };
+    bool allOk = true;
+    for (unsigned l = 0; l < sizeof losses / sizeof *losses; ++l) {
+        loss = losses[l];
+        srand(1);
+        long ok = 0, failed = 0, corrupt = 0, packets = 0, bytes = 0;
+        uint64_t busyTime = 0;
+        for (int run = 0; run < runs; ++run) {
+            // start at a random time, to see the millis() roll-over as well
+            now = (uint64_t) rand() * 64;
+            airBusy = 0;
+            for (int i = 0; i < 3; ++i) {
+                nodes[i] = Node();
+                nodes[i].id = i + 1;
+            }
+            RF12Frag frag [3] = { RF12Frag (), RF12Frag (2, SLOTSIZE),
+                                  RF12Frag () };
+            std::vector<byte> msg [3];
+            byte got [3] = { 0 };
+            for (int i = 0; i < 3; ++i) {
+                frag[i].begin(nodes[i].id);
+                if (i != 1) {
+                    msg[i].resize(1 + rand() % SLOTSIZE);
+                    for (size_t j = 0; j < msg[i].size(); ++j)
+                        msg[i][j] = rand();
+                    frag[i].send(2, &msg[i][0], msg[i].size());
+                }
+            }
+
+            const uint64_t start = now;
+            while (now - start < MAXTIME * 1000000ULL &&
+                    (frag[0].sendStatus() == RF12Frag::BUSY ||
+                     frag[2].sendStatus() == RF12Frag::BUSY)) {
+                for (int i = 0; i < 3; ++i) {
+                    current = &nodes[i];
+                    if (rf12_recvDone() && rf12_crc == 0)
+                        frag[i].accept();
+                    frag[i].poll();
+                    word len;
+                    byte node;
+                    const byte* data = frag[i].received(len, node);
+                    if (data != 0) {
+                        // only node 2 should ever get a message
+                        if (i != 1 || (node != 1 && node != 3) ||
+                                got[node-1]++ || len != msg[node-1].size() ||
+                                memcmp(data, &msg[node-1][0], len) != 0)
+                            ++corrupt;
+                        frag[i].release();
+                    }
+                }
+                now += 20;
+            }
+
+            for (int i = 0; i < 3; i += 2) {
+                byte status = frag[i].sendStatus();
+                if (status == RF12Frag::DONE && !got[i])
+                    ++corrupt;
+                else if (status == RF12Frag::DONE) {
+                    ++ok;
+                    bytes += msg[i].size();
+                } else
+                    ++failed;
+                packets += nodes[i].sent;
+            }
+            packets += nodes[1].sent;
+            busyTime += now - start;
+        }
+        printf("%3.0f%% %6ld %5ld %7ld %7.0f %8.0f %9.1f\n",
+                loss * 100, ok, failed, corrupt,
+                busyTime / 1000.0 / runs,
+                busyTime ? bytes / (busyTime / 1e6) : 0,
+                (double) packets / (2 * runs));
+        if (corrupt)
+            allOk = false;
+    }
+    return !allOk;
+}
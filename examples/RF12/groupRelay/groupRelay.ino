@@ -8,6 +8,7 @@
 
 byte buf[66], inputValue;
 MilliTimer timer;
+DedupCache recent (8, 20); // packets relayed in the last 2 seconds
 
 // configuration settings, saved in eeprom, can be changed from serial port
 struct {
@@ -149,6 +150,10 @@ void loop () {
         wantsAck = false;
         hdr &= ~ RF12_HDR_ACK;
     }
+
+    // don't relay the same packet again, unless an ack has to come back
+    if (recent.seen(hdr, buf, len + config.multi_node) && !wantsAck)
+        return;
     
     // switch to outgoing group
     rf12_initialize(config.out_node, code2type(config.freq), config.out_group);
@@ -0,0 +1,74 @@
+/// @dir hopBeacon
+/// Frequency hopping demo: one node sends out beacons, the others follow it.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Load this with NODE_ID set to CENTRAL on one node, and with other IDs on a
+// few more nodes. The central node sends a beacon with its slot number right
+// at the start of every BEACON'th slot, the other nodes use it to stay in step
+// and send a counter with an ack request every 5 seconds. The central node
+// reports these counters, the other nodes report whether they got an ack.
+//
+// Nodes which are not yet in step only hear the beacons now and then, when
+// they happen to be tuned to the same channel. See host/hopSim.cpp for a
+// simulation of how well hopping holds up against a jammer.
+
+#include <JeeLib.h>
+
+#define NODE_ID     2       // set to CENTRAL on one node
+#define CENTRAL     1       // the node ID of the node sending out beacons
+#define GROUP       212
+#define DWELL       100     // ms per hop slot
+#define BEACON      20      // slots between beacons, i.e. once every 2 s
+#define BEACON_AIR  2       // ms it takes to send a beacon
+
+// 4 channels, 200 kHz apart, between 868.0 and 868.6 MHz
+static uint16_t channels[] = { 1600, 1640, 1680, 1720 };
+
+MilliTimer sendTimer;
+word lastBeacon = ~0;
+word counter;
+byte synced;
+
+void setup () {
+    Serial.begin(57600);
+    Serial.print("\n[hopBeacon] node ");
+    Serial.println(NODE_ID);
+    rf12_initialize(NODE_ID, RF12_868MHZ, GROUP);
+    rf12_hopInit(channels, sizeof channels / sizeof *channels, DWELL);
+}
+
+void loop () {
+    if (rf12_recvDone() && rf12_crc == 0) {
+        byte from = rf12_hdr & RF12_HDR_MASK;
+        if (NODE_ID == CENTRAL) {
+            Serial.print("node ");
+            Serial.print(from);
+            Serial.print(": ");
+            Serial.println(*(word*) rf12_data);
+            if (RF12_WANTS_ACK)
+                rf12_sendStart(RF12_ACK_REPLY, 0, 0);
+        } else if (rf12_hdr & RF12_HDR_CTL) {
+            Serial.println("ack");
+        } else if (from == CENTRAL && rf12_len == 2) {
+            if (!synced)
+                Serial.println("in step");
+            rf12_hopSync(*(word*) rf12_data, BEACON_AIR);
+            synced = 1;
+        }
+    }
+
+    if (NODE_ID == CENTRAL) {
+        word slot = rf12_hopSlot();
+        if (slot % BEACON == 0 && slot != lastBeacon && rf12_canSend()) {
+            rf12_sendStart(0, &slot, sizeof slot);
+            lastBeacon = slot;
+        }
+    } else if (synced && sendTimer.poll(5000)) {
+        while (!rf12_canSend())
+            rf12_recvDone();
+        ++counter;
+        rf12_sendStart(RF12_HDR_ACK, &counter, sizeof counter);
+        Serial.print("sent ");
+        Serial.println(counter);
+    }
+}
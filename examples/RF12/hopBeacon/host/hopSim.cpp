@@ -0,0 +1,248 @@
+// Simulate goodput with and without frequency hopping under a jammer.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -o hopSim hopSim.cpp
+//
+// Usage: hopSim [-n nodes] [-i interval] [-c channels] [-d dwell] [-s skew]
+//  -n nodes      sending nodes, all reporting to one central node, default 5
+//  -i interval   ms between new readings on each node, +/- 5%, default 2000
+//  -c channels   number of channels in the hop table, default 8
+//  -d dwell      ms per hop slot, as passed to rf12_hopInit(), default 100
+//  -s skew       max ms each node's slots are off from the central node's,
+//                i.e. how well the beacons keep them in step, default 3
+//
+// Each node sends 8-byte readings with an ack request. Missing acks are
+// retried every second, up to 8 times, as in rf12_easyPoll(). Senders wait
+// until their channel is free, as rf12_canSend() does with its RSSI check.
+// Packets are lost when they overlap another packet or the jammer on the
+// same channel, when a retune happens in the middle of them, or at random,
+// with a 1% chance.
+//
+// The hop sequence is the same as in RF12.cpp, for net group 212. The jammer
+// is a narrowband signal on one channel, which is also the only channel used
+// without hopping. It's either on all the time, or 50% of the time in 20 ms
+// bursts. One line of results is printed for each combination, with the
+// fraction of readings delivered and the goodput in payload bytes per second.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <deque>
+#include <queue>
+#include <vector>
+
+#define GROUP       212
+#define LEN         8       // payload bytes per reading
+#define RETRIES     8       // same as in RF12.cpp
+#define RETRY_MS    1000
+#define LOSS        0.01    // random loss, e.g. due to weak signals
+#define SECONDS     3600    // simulated time per run
+
+static int nodes = 5, interval = 2000, channels = 8, dwell = 100, skew = 3;
+static int hopping;         // 0 = stay on channel 0, the jammed one
+static int duty;            // jammer duty cycle in %, 0 = off
+
+static double rnd () {
+    return rand() / (RAND_MAX + 1.0);
+}
+
+// same as the avr-libc routine used by rf12_hopFrequency() in RF12.cpp
+static uint16_t crc16_update (uint16_t crc, uint8_t a) {
+    crc ^= a;
+    for (int i = 0; i < 8; ++i)
+        crc = crc & 1 ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    return crc;
+}
+
+// the channel a node is on at time t (in us), given its slot offset
+static int channelAt (uint64_t t, long offset) {
+    if (!hopping)
+        return 0;
+    uint16_t slot = (t / 1000 + offset) / dwell;
+    uint16_t h = crc16_update(GROUP, slot);
+    h = crc16_update(h, slot >> 8);
+    return h % channels;
+}
+
+static uint64_t airtime (int len) {
+    return (len + 9) * 8 * 1000000ULL / 49230;
+}
+
+// whether the jammer is on at any time between from and to
+static bool jammed (int chan, uint64_t from, uint64_t to) {
+    if (chan != 0 || duty == 0)
+        return false;
+    if (duty >= 100)
+        return true;
+    const uint64_t burst = 20000, period = burst * 100 / duty;
+    return from % period < burst || from / period != to / period;
+}
+
+struct Packet {
+    int node, chan; // the node sending the reading, or receiving the ack
+    uint64_t start, end;
+    bool ack;
+};
+
+struct Event {
+    uint64_t at;
+    int node;       // -1 for the end of a transmission
+    long packet;
+    bool operator< (const Event& e) const { return at > e.at; }
+};
+
+struct Node {
+    long offset;
+    int tries;
+    bool pending;
+    uint64_t nextSend;
+};
+
+static std::deque<Packet> air;   // recent packets, to check for overlaps
+static long airBase;                // number of packets dropped from air
+static std::priority_queue<Event> events;
+static std::vector<Node> node;      // node 0 is the central node
+
+static void prune (uint64_t now) {
+    while (!air.empty() && air.front().end + 100000 < now) {
+        air.pop_front();
+        ++airBase;
+    }
+}
+
+static bool busy (int chan, uint64_t t) {
+    for (size_t i = 0; i < air.size(); ++i)
+        if (air[i].chan == chan && air[i].start <= t && t < air[i].end)
+            return true;
+    return jammed(chan, t, t);
+}
+
+// start sending a reading from node id, or an ack to it from the central node
+static void transmit (int id, bool ack, uint64_t now) {
+    Packet p;
+    p.node = id;
+    p.chan = channelAt(now, node[ack ? 0 : id].offset);
+    p.start = now;
+    p.end = now + airtime(ack ? 0 : LEN);
+    p.ack = ack;
+    air.push_back(p);
+    Event e = { p.end, -1, airBase + (long) air.size() - 1 };
+    events.push(e);
+}
+
+// whether the receiving node got the packet intact
+static bool received (const Packet& p) {
+    for (size_t i = 0; i < air.size(); ++i) {
+        const Packet& q = air[i];
+        if (&q != &p && q.chan == p.chan && q.start < p.end && p.start < q.end)
+            return false;
+    }
+    long offset = node[p.ack ? p.node : 0].offset;
+    return channelAt(p.start, offset) == p.chan &&
+            channelAt(p.end, offset) == p.chan &&
+            !jammed(p.chan, p.start, p.end) && rnd() >= LOSS;
+}
+
+static void run () {
+    air.clear();
+    airBase = 0;
+    events = std::priority_queue<Event>();
+    node.assign(nodes + 1, Node());
+    for (int i = 1; i <= nodes; ++i) {
+        node[i].offset = skew > 0 ? rand() % (2 * skew + 1) - skew : 0;
+        Event e = { (uint64_t) (rnd() * interval * 1000), i, -1 };
+        events.push(e);
+    }
+    long readings = 0, delivered = 0, sent = 0;
+    const uint64_t stop = SECONDS * 1000000ULL;
+    while (!events.empty() && events.top().at < stop) {
+        Event e = events.top();
+        events.pop();
+        uint64_t now = e.at;
+        prune(now);
+        if (e.node < 0) {
+            // a packet has been sent, the ack goes out right away if it was
+            // received, without checking whether the channel is free
+            const Packet& p = air[e.packet - airBase];
+            if (received(p)) {
+                if (!p.ack)
+                    transmit(p.node, true, now + 200);
+                else if (node[p.node].pending) {
+                    node[p.node].pending = false;
+                    ++delivered;
+                }
+            }
+            continue;
+        }
+        Node& n = node[e.node];
+        if (now >= n.nextSend && !n.pending) {
+            // time for a new reading, an undelivered one is dropped
+            ++readings;
+            n.pending = true;
+            n.tries = 0;
+            // sleep timing is not exact, add some jitter
+            n.nextSend = now + (uint64_t) ((0.95 + 0.1 * rnd()) * interval *
+                                                                    1000);
+        }
+        if (n.pending && n.tries < RETRIES) {
+            if (busy(channelAt(now, n.offset), now)) {
+                Event again = { now + 1000 + rand() % 4000, e.node, -1 };
+                events.push(again);
+                continue;
+            }
+            transmit(e.node, false, now);
+            ++n.tries;
+            ++sent;
+            // retries are not exactly on time either, the main loop of a
+            // sketch only polls every few ms
+            Event again = { now + RETRY_MS * 1000ULL + rand() % 5000,
+                            e.node, -1 };
+            events.push(again);
+            continue;
+        }
+        if (n.pending)
+            n.pending = false; // given up
+        uint64_t next = n.nextSend > now ? n.nextSend : now;
+        Event again = { next, e.node, -1 };
+        events.push(again);
+    }
+    printf("%-7s %4d%%  %7ld %6.1f%% %8.1f %9.2f\n",
+            hopping ? "hopping" : "fixed", duty, readings,
+            readings ? 100.0 * delivered / readings : 0,
+            delivered * (double) LEN / SECONDS,
+            delivered ? (double) sent / delivered : 0);
+}
+
+int main (int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "n:i:c:d:s:")) != -1)
+        switch (opt) {
+            case 'n': nodes = atoi(optarg); break;
+            case 'i': interval = atoi(optarg); break;
+            case 'c': channels = atoi(optarg); break;
+            case 'd': dwell = atoi(optarg); break;
+            case 's': skew = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n nodes] [-i interval]"
+                        " [-c channels] [-d dwell] [-s skew]\n", argv[0]);
+                return 1;
+        }
+    if (nodes < 1 || interval < 1 || channels < 1 || dwell < 1 || skew < 0) {
+        fprintf(stderr, "%s: all values must be positive\n", argv[0]);
+        return 1;
+    }
+
+    printf("%d nodes, a reading every %d ms, %d channels, %d ms dwell,"
+            " %d ms skew\n\n", nodes, interval, channels, dwell, skew);
+    printf("mode    jammer readings   sent  bytes/s pkts/rdng\n");
+    static const int duties[] = { 0, 50, 100 };
+    for (hopping = 0; hopping < 2; ++hopping)
+        for (int i = 0; i < 3; ++i) {
+            duty = duties[i];
+            srand(1);
+            run();
+        }
+    return 0;
+}
@@ -7,46 +7,30 @@
 // be limited, or maybe it's just because 868 is nearly a multiple of 433 ?
 
 #include <JeeLib.h>
-#include <util/parity.h>
+#include <RF12ook.h>
 
-// Turn transmitter on or off, but also apply asymmetric correction and account
-// for 25 us SPI overhead to end up with the proper on-the-air pulse widths.
-// With thanks to JGJ Veken for his help in getting these values right.
-static void ookPulse(int on, int off) {
-    rf12_onOff(1);
-    delayMicroseconds(on + 150);
-    rf12_onOff(0);
-    delayMicroseconds(off - 200);
-}
+// packets must stay as is while being sent, so set them up once in advance
+OokPacket on, off;
 
-static void kakuSend(char addr, byte device, byte on) {
-    int cmd = 0x600 | ((device - 1) << 4) | ((addr - 1) & 0xF);
-    if (on)
-        cmd |= 0x800;
-    for (byte i = 0; i < 4; ++i) {
-        for (byte bit = 0; bit < 12; ++bit) {
-            ookPulse(375, 1125);
-            int on = bitRead(cmd, bit) ? 1125 : 375;
-            ookPulse(on, 1500 - on);
-        }
-		ookPulse(375, 375);
-		delay(11); // approximate
-    }
-}
+ISR(TIMER1_COMPA_vect) { rf12_ookTimer(); }
 
 void setup() {
     Serial.begin(57600);
     Serial.println("\n[kaku_demo]");
     
     rf12_initialize(0, RF12_433MHZ);
+
+    // for the newer self-learning units, use on.kakuA(address, 1, 1), etc
+    on.kaku('B', 1, 1);
+    off.kaku('B', 1, 0);
 }
 
 void loop() {  
     Serial.println("off");
-    kakuSend('B', 1, 0);
+    rf12_ookSend(off);
     delay(2000);
     
     Serial.println("on");
-    kakuSend('B', 1, 1);
+    rf12_ookSend(on);
     delay(5000);
 }
@@ -7,16 +7,38 @@
 
 /// This is the general base class for implementing OOK decoders.
 class DecodeOOK {
+    friend class DecoderSet; // uses the width window of each decoder
 protected:
     byte bits, flip, state, pos, data[25];
     // the following fields are used to deal with duplicate packets
     word lastCrc, lastTime;
     byte repeats, minGap, minCount;
+    // pulses outside this range are skipped while idle, see nextPulse()
+    word minWidth, maxWidth;
+    // optional list of lo, hi pairs within that range, ending with a 0
+    const word* ranges;
 
     // gets called once per incoming pulse with the width in us
     // return values: 0 = keep going, 1 = done, -1 = no match
     virtual char decode (word width) =0;
     
+    // set the range of widths which can start a packet, i.e. for which
+    // decode() can return something other than -1 while idle
+    void window (word lo, word hi) {
+        minWidth = lo;
+        maxWidth = hi;
+    }
+    
+    // same, for several separate ranges, in increasing order, which only
+    // DecoderSet tells apart, nextPulse() uses the span of all of them
+    void window (const word* list) {
+        byte n = 0;
+        while (list[n] != 0)
+            n += 2;
+        window(list[0], list[n-1]);
+        ranges = list;
+    }
+    
     // add one bit to the packet data buffer
     void gotBit (char value) {
         byte *ptr = data + pos;
@@ -93,10 +115,14 @@ public:
     enum { UNKNOWN, T0, T1, T2, T3, OK, DONE };
 
     DecodeOOK (byte gap =5, byte count =0) 
-        : lastCrc (0), lastTime (0), repeats (0), minGap (gap), minCount (count)
+        : lastCrc (0), lastTime (0), repeats (0), minGap (gap), minCount (count),
+          minWidth (0), maxWidth (~0), ranges (0)
         { resetDecoder(); }
         
     bool nextPulse (word width) {
+        // most pulses are noise, don't call decode() when it can only fail
+        if (idle() && (width < minWidth || width >= maxWidth))
+            return false;
         if (state != DONE)
             switch (decode(width)) {
                 case -1: // decoding failed
@@ -111,6 +137,12 @@ public:
         return state == DONE;
     }
     
+    /// True while no packet has been started, i.e. only pulses within the
+    /// width window can lead to one.
+    bool idle () const {
+        return state == UNKNOWN && pos == 0 && bits == 0 && flip == 0;
+    }
+
     const byte* getData (byte& count) const {
         count = pos;
         return data; 
@@ -127,7 +159,7 @@ public:
 /// OOK decoder for Oregon Scientific devices.
 class OregonDecoder : public DecodeOOK {
 public:
-    OregonDecoder () {}
+    OregonDecoder () { window(200, 1200); }
     
     virtual char decode (word width) {
         if (200 <= width && width < 1200) {
@@ -167,7 +199,7 @@ public:
 class CrestaDecoder : public DecodeOOK {
   // http://members.upc.nl/m.beukelaar/Crestaprotocol.pdf
 public:
-    CrestaDecoder () {}
+    CrestaDecoder () { window(200, 1300); }
     
     virtual char decode (word width) {
         if (200 <= width && width < 1300) {
@@ -205,7 +237,7 @@ public:
 /// OOK decoder for Klik-Aan-Klik-Uit devices.
 class KakuDecoder : public DecodeOOK {
 public:
-    KakuDecoder () {}
+    KakuDecoder () { window(180, 450); } // a packet starts with a short pulse
     
     virtual char decode (word width) {
         if (180 <= width && width < 450 || 950 <= width && width < 1250) {
@@ -255,20 +287,22 @@ public:
 /// OOK decoder for Klik-Aan-Klik-Uit type A devices.
 class KakuADecoder : public DecodeOOK {
     enum { Pu, P1, P5, P10 }; //pulsetypes: Pu = unknown, P1 = between 100 and 600uS, P5 = between 800 and 1800uS, P10 = between 2 and 3 mS
-    uint8_t backBuffer[4]; //we need to keep a 4 bit history
     byte pulse;  
 
+    // the 4 pulse history is kept in flip, 2 bits each, newest in the lowest
+    // bits, so that resetDecoder() clears it, and the decoder is only idle()
+    // while it is empty, i.e. when a pulse outside the window changes nothing
+    byte backBuffer(byte n) const { return (flip >> 2 * n) & 3; }
+
   public:
     KakuADecoder () {
-      clearBackBuffer();
+      static const word starts [] = { 100, 601, 800, 1801, 2000, 3001, 0 };
+      window(starts);
     }
     
     void clearBackBuffer()
     {
-      backBuffer[0] = Pu;
-      backBuffer[1] = Pu;
-      backBuffer[2] = Pu;
-      backBuffer[3] = Pu;
+      flip = Pu;
     }
     
     virtual char decode (word width) {
@@ -284,15 +318,12 @@ class KakuADecoder : public DecodeOOK {
           return -1; //reset decoder
         }
         
-        backBuffer[3] = backBuffer[2];
-        backBuffer[2] = backBuffer[1];
-        backBuffer[1] = backBuffer[0];
-        backBuffer[0] = pulse;
+        flip = (flip << 2) | pulse;
         
         switch(state)
         {
           case UNKNOWN:
-          if( backBuffer[2] == P1 && backBuffer[1] == P10 && backBuffer[0] == P1 ) //received start/sync signal
+          if( backBuffer(2) == P1 && backBuffer(1) == P10 && backBuffer(0) == P1 ) //received start/sync signal
           {
             state = T0;
             clearBackBuffer();
@@ -305,12 +336,12 @@ class KakuADecoder : public DecodeOOK {
             clearBackBuffer();
             return -1; //reset decoder
           } 
-          if( backBuffer[3] != Pu ) //depending on the preceding pulsetypes we received a 1 or 0
+          if( backBuffer(3) != Pu ) //depending on the preceding pulsetypes we received a 1 or 0
           {
-            if ( (backBuffer[3] == P5) && (backBuffer[2] == P1) && (backBuffer[1] == P1) && (backBuffer[0] == P1))
+            if ( (backBuffer(3) == P5) && (backBuffer(2) == P1) && (backBuffer(1) == P1) && (backBuffer(0) == P1))
               gotBit(1);
             else
-            if ( (backBuffer[3] == P1) && (backBuffer[2] == P1) && (backBuffer[1] == P5) && (backBuffer[0] == P1))
+            if ( (backBuffer(3) == P1) && (backBuffer(2) == P1) && (backBuffer(1) == P5) && (backBuffer(0) == P1))
               gotBit(0);
             else
             { 
@@ -332,7 +363,7 @@ class KakuADecoder : public DecodeOOK {
 /// OOK decoder for X11 over RF devices.
 class XrfDecoder : public DecodeOOK {
 public:
-    XrfDecoder () {}
+    XrfDecoder () { window(4001, 5001); } // only the sync pulse leaves idle
     
     // see also http://davehouston.net/rf.htm
     virtual char decode (word width) {
@@ -366,7 +397,7 @@ public:
 /// OOK decoder for FS20 type HEZ devices.
 class HezDecoder : public DecodeOOK {
 public:
-    HezDecoder () {}
+    HezDecoder () { window(200, 1200); }
     
     // see also http://homeeasyhacking.wikia.com/wiki/Home_Easy_Hacking_Wiki
     virtual char decode (word width) {
@@ -387,7 +418,7 @@ public:
 /// OOK decoder for Elro devices.
 class ElroDecoder : public DecodeOOK {
 public:
-    ElroDecoder () {}
+    ElroDecoder () { window(50, 600); }
     
     virtual char decode (word width) {
         if (50 <= width && width < 600) {
@@ -440,7 +471,12 @@ public:
 /// OOK decoder for Flamingo devices.
 class FlamingoDecoder : public DecodeOOK {
 public:
-    FlamingoDecoder () {}
+    FlamingoDecoder () {
+        static const word starts [] = {
+            741, 780, 811, 950, 1041, 1450, 2651, 2750, 0
+        };
+        window(starts);
+    }
      
     virtual char decode (word width) {
         if ((width > 740 && width < 780) || (width > 2650 && width < 2750) ||
@@ -459,7 +495,10 @@ public:
 /// OOK decoder for Flamingo smoke devices.
 class SmokeDecoder : public DecodeOOK {
 public:
-    SmokeDecoder () {}
+    SmokeDecoder () {
+        static const word starts [] = { 6501, 6800, 6901, 7000, 20001, 21000, 0 };
+        window(starts);
+    }
      
     virtual char decode (word width) {
         if (width > 20000 && width < 21000 || width > 6900 && width < 7000 ||
@@ -478,7 +517,10 @@ public:
 /// OOK decoder for Byronbell devices.
 class ByronbellDecoder : public DecodeOOK {
 public:
-    ByronbellDecoder () {}
+    ByronbellDecoder () {
+        static const word starts [] = { 661, 715, 5101, 5400, 0 };
+        window(starts);
+    }
      
     virtual char decode (word width) {
         if (660 < width && width < 715 || 5100 < width && width < 5400) {
@@ -496,7 +538,7 @@ public:
 /// OOK decoder for Visonic devices.
 class VisonicDecoder : public DecodeOOK {
 public:
-    VisonicDecoder () {}
+    VisonicDecoder () { window(200, 1000); }
     
     virtual char decode (word width) {
         if (200 <= width && width < 1000) {
@@ -537,7 +579,7 @@ public:
 /// OOK decoder for FS20 type EM devices.
 class EMxDecoder : public DecodeOOK {
 public:
-    EMxDecoder () : DecodeOOK (30) {} // ignore packets repeated within 3 sec
+    EMxDecoder () : DecodeOOK (30) { window(200, 1000); } // 3 sec repeats
     
     // see also http://fhz4linux.info/tiki-index.php?page=EM+Protocol
     virtual char decode (word width) {
@@ -573,7 +615,7 @@ public:
 /// OOK decoder for FS20 type KS devices.
 class KSxDecoder : public DecodeOOK {
 public:
-    KSxDecoder () {}
+    KSxDecoder () { window(200, 1000); }
     
     // see also http://www.dc3yc.homepage.t-online.de/protocol.htm
     virtual char decode (word width) {
@@ -611,7 +653,7 @@ public:
 /// OOK decoder for FS20 type FS devices.
 class FSxDecoder : public DecodeOOK {
 public:
-    FSxDecoder () {}
+    FSxDecoder () { window(300, 775); }
     
     // see also http://fhz4linux.info/tiki-index.php?page=FS20%20Protocol
     virtual char decode (word width) {
@@ -655,3 +697,173 @@ typedef struct {
     const char* name;
     DecodeOOK* decoder;
 } DecoderInfo;
+
+/// Pulse widths collected in interrupt code, so that none are lost while the
+/// decoders are busy in the main loop. Only the ISR changes head, last, and
+/// lost. When the ring is full, pulses are dropped, and the next() call at
+/// that spot returns LOST, after which the decoders should be reset.
+class PulseRing {
+    enum { SIZE = 16 }; // must be a power of two
+    volatile byte head, tail;
+    byte lost;
+    word last, widths [SIZE];
+public:
+    enum { LOST = 0xFFFF }; ///< returned by next() where pulses were dropped
+
+    PulseRing () : head (0), tail (0), lost (0), last (0) {}
+    
+    /// Call this from the interrupt routine on each level change.
+    void add () {
+        word now = micros();
+        word width = now - last;
+        last = now; // the next width is right, even if this one is dropped
+        // 0 and LOST mean something else to next(), keep them out of the ring
+        if (width == 0)
+            width = 1;
+        else if (width == LOST)
+            width = LOST - 1;
+        byte next = (head + 1) & (SIZE - 1);
+        if (lost && next != tail) { // mark the spot where pulses were dropped
+            widths[head] = LOST;
+            head = next;
+            next = (head + 1) & (SIZE - 1);
+            lost = 0;
+        }
+        if (next != tail) {
+            widths[head] = width;
+            head = next;
+        } else
+            lost = 1; // the ring is full, drop this pulse
+    }
+    
+    /// Fetch the next pulse width from the ring, returns 0 if there is none,
+    /// or LOST if one or more pulses were dropped at this point.
+    word next () {
+        if (tail == head)
+            return 0;
+        // safe without cli(), the ISR won't touch this slot until tail moves
+        word width = widths[tail];
+        tail = (tail + 1) & (SIZE - 1);
+        return width;
+    }
+};
+
+/// Runs a list of decoders, as a single pass over a table per pulse. The table
+/// is built from the width windows of the decoders, including any separate
+/// ranges in them, and tells which decoders can start a packet with a pulse of
+/// a given width. Only those, plus the ones already busy with a packet, get to
+/// see it, i.e. a noise pulse costs one table lookup instead of a check in each
+/// decoder. The list is as in ookRelay2, ending with a typecode of -1, for up to
+/// 16 decoders. With more, or if there is no memory for the table, each pulse
+/// simply goes to all decoders.
+class DecoderSet {
+    DecoderInfo* list;
+    byte count, edges;  // number of decoders (0 until built), and boundaries
+    word busy;          // bit mask of the decoders which are not idle
+    word* table;        // sorted boundaries, then a decoder mask for each range
+
+    // collect the window boundaries, and which decoders accept each range,
+    // this is done on first use, when the decoders have set their windows
+    void build () {
+        count = edges = 0;
+        byte n = 0; // number of bounds, at most
+        for (; list[count].typecode >= 0; ++count) {
+            if (count >= 8 * sizeof busy)
+                return;
+            const DecodeOOK* d = list[count].decoder;
+            n += 2;
+            if (d->ranges)
+                for (const word* p = d->ranges; *p != 0; ++p)
+                    ++n;
+        }
+        if (count == 0)
+            return;
+        table = (word*) malloc((2 * n + 1) * sizeof *table);
+        if (table == 0)
+            return;
+        for (byte i = 0; i < count; ++i) {
+            const DecodeOOK* d = list[i].decoder;
+            addBound(d->minWidth);
+            addBound(d->maxWidth);
+            if (d->ranges)
+                for (const word* p = d->ranges; *p != 0; ++p)
+                    addBound(*p);
+        }
+        // range r goes from table[r-1] up to table[r], bounds never straddle
+        // one, so a width at its start tells which decoders accept all of it
+        for (byte r = 0; r <= edges; ++r) {
+            word lo = r == 0 ? 0 : table[r-1], mask = 0;
+            for (byte i = 0; i < count; ++i)
+                if (accepts(list[i].decoder, lo))
+                    mask |= 1 << i;
+            table[edges + r] = mask;
+        }
+    }
+
+    // insert a value in the sorted boundaries, unless it's already in there
+    void addBound (word value) {
+        byte i = edges;
+        while (i > 0 && table[i-1] > value)
+            --i;
+        if (i > 0 && table[i-1] == value)
+            return;
+        memmove(table + i + 1, table + i, (edges - i) * sizeof *table);
+        table[i] = value;
+        ++edges;
+    }
+
+    static bool accepts (const DecodeOOK* d, word width) {
+        if (d->ranges == 0)
+            return d->minWidth <= width && width < d->maxWidth;
+        for (const word* p = d->ranges; *p != 0; p += 2)
+            if (p[0] <= width && width < p[1])
+                return true;
+        return false;
+    }
+
+public:
+    DecoderSet (DecoderInfo* decoders)
+        : list (decoders), count (0), edges (0), busy (0), table (0) {}
+
+    /// Feed one pulse to the decoders, found() is called for each decoder
+    /// which has a packet, and should reset it once the data has been used.
+    void nextPulse (word width, void (*found)(DecoderInfo&)) {
+        if (count == 0)
+            build();
+        if (table == 0) {
+            for (DecoderInfo* di = list; di->typecode >= 0; ++di)
+                if (di->decoder->nextPulse(width))
+                    found(*di);
+            return;
+        }
+        // find the range of widths this pulse falls in, i.e. the number of
+        // bounds up to the width, the search always takes the same steps
+        byte lo = 0, n = edges;
+        while (n > 1) {
+            byte half = n / 2;
+            if (table[lo + half - 1] <= width)
+                lo += half;
+            n -= half;
+        }
+        if (n == 1 && table[lo] <= width)
+            ++lo;
+        word mask = table[edges + lo] | busy;
+        for (byte i = 0; mask != 0; ++i, mask >>= 1)
+            if (mask & 1) {
+                DecodeOOK* d = list[i].decoder;
+                if (d->nextPulse(width))
+                    found(list[i]);
+                if (d->idle())
+                    busy &= ~(1 << i);
+                else
+                    busy |= 1 << i;
+            }
+    }
+
+    /// Reset all decoders, e.g. after PulseRing::next() returned LOST.
+    void reset () {
+        for (DecoderInfo* di = list; di->typecode >= 0; ++di)
+            di->decoder->resetDecoder();
+        busy = 0;
+    }
+};
@@ -0,0 +1,20 @@
+// Minimal stand-ins for the Arduino API, enough to use decoders.h on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+// the time in the trace being replayed, set by ookReplay.cpp
+extern uint32_t replayMicros;
+
+static inline unsigned long micros () { return replayMicros; }
+static inline unsigned long millis () { return replayMicros / 1000; }
+
+#endif
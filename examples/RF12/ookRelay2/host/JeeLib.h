@@ -0,0 +1,12 @@
+// Stand-in for the parts of JeeLib used by RF12ook.cpp, for ookLoop.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include "Arduino.h"
+
+#define bit(b)              (1UL << (b))
+#define bitRead(v, b)       (((v) >> (b)) & 1)
+#define bitSet(v, b)        ((v) |= bit(b))
+#define bitClear(v, b)      ((v) &= ~bit(b))
+
+// called by the transmitter to switch the carrier, see ookLoop.cpp
+void rf12_onOff (uint8_t value);
@@ -0,0 +1,91 @@
+// Measure the false drop rate and lookup cost of the DedupCache class.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -DARDUINO=100 -I. -I../../../.. -o dedupBench dedupBench.cpp
+//
+// Usage: dedupBench [-n nodes] [-t tenths]
+//  -n nodes    number of nodes sending packets, default 30
+//  -t tenths   how long packets are remembered, default 10, i.e. 1 second
+//
+// The simulated traffic is a new packet from a random node every 0..60 ms,
+// followed by 0 to 3 repeats of it, as with retries or several relays. New
+// packets which are reported as seen are false drops, repeats which are not
+// reported as seen are let through. Both are counted for tables of 4 to 64
+// entries. Then the time per lookup is measured, with a 16-entry table and
+// each packet looked up 4 times.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// the implementation is included as is, it only needs millis() and the CRC
+#include "../../../../PortsDedup.cpp"
+
+uint32_t replayMicros; // the simulated time, used by millis() in Arduino.h
+
+#define ROUNDS      20      // with a cleared table and time reset in each
+#define PACKETS     100000  // per round, i.e. about 3000 s of traffic
+
+int main (int argc, char** argv) {
+    int nodes = 30, tenths = 10, opt;
+    while ((opt = getopt(argc, argv, "n:t:")) != -1)
+        switch (opt) {
+            case 'n': nodes = atoi(optarg); break;
+            case 't': tenths = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n nodes] [-t tenths]\n", argv[0]);
+                return 1;
+        }
+    if (nodes < 1 || nodes > 256 || tenths < 1) {
+        fprintf(stderr, "%s: need 1..256 nodes and a positive time\n",
+                argv[0]);
+        return 1;
+    }
+
+    printf("%d nodes, packets remembered for %d.%d s\n\n",
+            nodes, tenths / 10, tenths % 10);
+    printf("size      new  false drops  1 in    repeats  let through\n");
+    for (int size = 4; size <= 64; size *= 2) {
+        DedupCache cache (size, tenths);
+        srand(1);
+        word seq [256] = { 0 };
+        long fresh = 0, falseDrops = 0, repeats = 0, letThrough = 0;
+        // time is restarted in each round, to stay clear of the point where
+        // replayMicros wraps around, which would expire all entries at once
+        for (int round = 0; round < ROUNDS; ++round) {
+            cache.clear();
+            replayMicros = 0;
+            for (long i = 0; i < PACKETS; ++i) {
+                replayMicros += (rand() % 60) * 1000;
+                byte node = rand() % nodes;
+                word key = ++seq[node] * 40503U + rand();
+                ++fresh;
+                if (cache.seen(node, key))
+                    ++falseDrops;
+                for (int n = rand() % 4; n > 0; --n) {
+                    ++repeats;
+                    if (!cache.seen(node, key))
+                        ++letThrough;
+                }
+            }
+        }
+        printf("%4d %8ld %12ld %6.0f %10ld %12ld\n", size, fresh, falseDrops,
+                falseDrops ? (double) fresh / falseDrops : 0.0,
+                repeats, letThrough);
+    }
+
+    DedupCache cache (16, tenths);
+    const long count = 50000000;
+    unsigned hits = 0;
+    clock_t start = clock();
+    for (long i = 0; i < count; ++i) {
+        replayMicros = i << 6;
+        hits += cache.seen((i >> 2) % nodes, (word) (i >> 2));
+    }
+    double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("\n%.1f ns per lookup, %u hits\n", secs * 1e9 / count, hits);
+    return 0;
+}
@@ -0,0 +1,303 @@
+// Throughput of the OOK decoders, one by one and through DecoderSet.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o ookBench ookBench.cpp
+//
+// Usage: ookBench [-p pulses] [-n count] [-j us] [-v]
+//  -p pulses   length of the generated pulse stream, default 1000000
+//  -n count    time each method this many times, the fastest run counts
+//  -j us       max random deviation of each pulse width, default 20
+//  -v          list each decoded packet
+//
+// A pulse stream is generated with bursts of noise, i.e. random widths from
+// 20 to 3000 us, and between them a packet from one of the RF12ook.h encoders
+// (FS20, KAKU, KAKU type A, X10), with all its repeats, and random values.
+// The stream is then fed to all decoders of ookRelay2, both bands together,
+// in two ways:
+//  - each:  every pulse goes to each decoder's nextPulse(), which is how
+//           ookRelay2 did it before DecoderSet
+//  - set:   every pulse goes to DecoderSet::nextPulse() once
+// Both must report exactly the same packets, at the same pulses, and each
+// packet sent must be decoded by its own decoder. The pulses per second for
+// both go to stdout. These times are for the host CPU, and only useful to
+// compare the two. Exits with status 1 if the results differ, or if a packet
+// was missed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+uint32_t replayMicros;
+
+// timer 1 registers, only needed to build RF12ook.cpp for its encoders
+static uint16_t timer1 [6];
+#define TCCR1A  timer1[0]
+#define TCCR1B  timer1[1]
+#define TCNT1   timer1[2]
+#define OCR1A   timer1[3]
+#define TIFR1   timer1[4]
+#define TIMSK1  timer1[5]
+#define WGM12   3
+#define CS11    1
+#define OCF1A   1
+#define OCIE1A  1
+#define F_CPU   16000000UL
+
+#include "../../../../RF12ook.cpp"
+#include "../decoders.h"
+
+void rf12_onOff (uint8_t) {}
+
+OregonDecoder orsc;
+CrestaDecoder cres;
+KakuDecoder kaku;
+KakuADecoder kakuA;
+XrfDecoder xrf;
+HezDecoder hez;
+FlamingoDecoder fmgo;
+SmokeDecoder smk;
+ByronbellDecoder byr;
+ElroDecoder elro;
+VisonicDecoder viso;
+EMxDecoder emx;
+KSxDecoder ksx;
+FSxDecoder fsx;
+
+// same type codes and names as in ookRelay2.ino, both bands together
+DecoderInfo decoders[] = {
+    { 1, "VISO", &viso },
+    { 2, "EMX", &emx },
+    { 3, "KSX", &ksx },
+    { 4, "FSX", &fsx },
+    { 5, "ORSC", &orsc },
+    { 6, "CRES", &cres },
+    { 7, "KAKU", &kaku },
+    { 8, "XRF", &xrf },
+    { 9, "HEZ", &hez },
+    { 10, "ELRO", &elro },
+    { 11, "FMGO", &fmgo },
+    { 12, "SMK", &smk },
+    { 13, "BYR", &byr },
+    { 14, "KAKUA", &kakuA },
+    { -1, 0, 0 }
+};
+
+DecoderSet decoderSet (decoders);
+
+struct Pulse {
+    uint32_t time;  // end of this pulse, in us
+    word width;
+};
+
+struct Packet {
+    size_t pulse;   // index of the pulse which completed it
+    byte index, size, data [25];
+    bool operator== (const Packet& p) const {
+        return pulse == p.pulse && index == p.index && size == p.size &&
+                memcmp(data, p.data, size) == 0;
+    }
+};
+
+// a packet sent, with the pulses it spans and the decoder which should see it
+struct Sent {
+    size_t first, last;
+    byte index;
+};
+
+static std::vector<Pulse> pulses;
+static std::vector<Packet> packets;
+static std::vector<Sent> sent;
+static size_t current;  // index of the pulse being decoded
+static bool keep;       // whether to collect packets in this run
+static int jitter = 20;
+
+static int rnd (int range) {
+    return range > 0 ? rand() % (2 * range + 1) - range : 0;
+}
+
+// add a pulse, or lengthen the previous one if it has the same level
+static void addPulse (word width, byte level) {
+    static byte lastLevel;
+    if (width == 0)
+        return;
+    if (!pulses.empty() && level == lastLevel &&
+            pulses.back().width + (uint32_t) width < PulseRing::LOST) {
+        pulses.back().width += width;
+        pulses.back().time += width;
+        return;
+    }
+    Pulse p;
+    p.time = (pulses.empty() ? 0 : pulses.back().time) + width;
+    p.width = width;
+    pulses.push_back(p);
+    lastLevel = level;
+}
+
+static void addGap (uint32_t us) {
+    for (; us > 0; us -= us < 60000 ? us : 60000)
+        addPulse(us < 60000 ? us : 60000, 0);
+}
+
+// expand a packet into marks and spaces, with its repeats
+static void addPacket (const OokPacket& p) {
+    for (byte r = 0; r < p.repeats; ++r)
+        for (byte i = 0; i < p.count; ++i) {
+            byte s = p.symbol(i);
+            word mark = p.widths[2*s], space = p.widths[2*s+1];
+            if (mark)
+                addPulse(mark + rnd(jitter), 1);
+            if (space)
+                addPulse(space + rnd(jitter), 0);
+        }
+}
+
+static void generate (long count) {
+    while ((long) pulses.size() < count) {
+        for (int n = 200 + rand() % 2000; n > 0; --n)
+            addPulse(20 + rand() % 2981, pulses.size() % 2);
+        addGap(50000);
+        OokPacket p;
+        Sent s;
+        switch (rand() % 4) {
+            case 0: p.fs20(rand(), rand(), rand() % 32);
+                    s.index = 3; break;
+            case 1: p.kaku('A' + rand() % 16, 1 + rand() % 16, rand() & 1);
+                    s.index = 6; break;
+            case 2: p.kakuA(rand() & 0x3FFFFFF, 1 + rand() % 16, rand() & 1);
+                    s.index = 13; break;
+            case 3: p.x10(rand(), rand());
+                    s.index = 7; break;
+        }
+        s.first = pulses.size();
+        addPacket(p);
+        addGap(50000);
+        s.last = pulses.size();
+        sent.push_back(s);
+        // more than the 3 s repeat interval of EMX, so no packet is a repeat
+        addGap(3100000);
+    }
+}
+
+static void found (DecoderInfo& di) {
+    if (keep) {
+        Packet pkt;
+        pkt.pulse = current;
+        pkt.index = &di - decoders;
+        const byte* data = di.decoder->getData(pkt.size);
+        memcpy(pkt.data, data, pkt.size);
+        packets.push_back(pkt);
+    }
+    di.decoder->resetDecoder();
+}
+
+// the way ookRelay2 used to run its decoders, i.e. all of them on each pulse
+static void runEach () {
+    for (current = 0; current < pulses.size(); ++current) {
+        replayMicros = pulses[current].time;
+        for (DecoderInfo* di = decoders; di->typecode >= 0; ++di)
+            if (di->decoder->nextPulse(pulses[current].width))
+                found(*di);
+    }
+}
+
+static void runSet () {
+    for (current = 0; current < pulses.size(); ++current) {
+        replayMicros = pulses[current].time;
+        decoderSet.nextPulse(pulses[current].width, found);
+    }
+}
+
+// the fastest of a number of runs, as other processes only slow them down
+static double timeRun (void (*run)(), int repeat) {
+    double best = 0;
+    for (int r = 0; r < repeat; ++r) {
+        decoderSet.reset();
+        timespec t0, t1;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t0);
+        run();
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t1);
+        double t = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        if (r == 0 || t < best)
+            best = t;
+    }
+    return best;
+}
+
+int main (int argc, char** argv) {
+    long count = 1000000;
+    int repeat = 1, opt;
+    bool verbose = false;
+    while ((opt = getopt(argc, argv, "p:n:j:v")) != -1)
+        switch (opt) {
+            case 'p': count = atol(optarg); break;
+            case 'n': repeat = atoi(optarg); break;
+            case 'j': jitter = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [-p pulses] [-n count] [-j us] "
+                                "[-v]\n", argv[0]);
+                return 1;
+        }
+    if (count < 1 || repeat < 1 || jitter < 0 || jitter > 100) {
+        fprintf(stderr, "%s: need 1 or more pulses, jitter up to 100 us\n",
+                argv[0]);
+        return 1;
+    }
+
+    srand(1);
+    generate(count);
+
+    // the results, with a fresh state of the decoders for each method
+    keep = true;
+    decoderSet.reset();
+    runEach();
+    std::vector<Packet> each;
+    each.swap(packets);
+    decoderSet.reset();
+    runSet();
+    std::vector<Packet> set;
+    set.swap(packets);
+    keep = false;
+
+    if (verbose)
+        for (size_t i = 0; i < set.size(); ++i) {
+            printf("%10u %s", pulses[set[i].pulse].time,
+                    decoders[set[i].index].name);
+            for (byte j = 0; j < set[i].size; ++j)
+                printf(" %d", set[i].data[j]);
+            printf("\n");
+        }
+
+    double tEach = timeRun(runEach, repeat), tSet = timeRun(runSet, repeat);
+    size_t n = pulses.size();
+    printf("%zu pulses, %zu packets sent, %zu reported\n\n", n, sent.size(),
+            set.size());
+    printf("each   %8.2f Mpulses/s %8.1f ns/pulse\n", n / tEach * 1e-6,
+            tEach * 1e9 / n);
+    printf("set    %8.2f Mpulses/s %8.1f ns/pulse  %.2fx\n", n / tSet * 1e-6,
+            tSet * 1e9 / n, tEach / tSet);
+    printf("\n");
+
+    // every packet sent must show up with its own decoder, others may also
+    // report something, from the packet or from the noise
+    size_t missed = 0, k = 0;
+    for (size_t i = 0; i < sent.size(); ++i) {
+        while (k < set.size() && set[k].pulse < sent[i].first)
+            ++k;
+        size_t j = k;
+        while (j < set.size() && set[j].pulse <= sent[i].last &&
+                set[j].index != sent[i].index)
+            ++j;
+        missed += j >= set.size() || set[j].pulse > sent[i].last;
+    }
+    printf("packets not decoded %zu\n", missed);
+
+    bool same = each == set;
+    printf("results %s\n", same ? "identical" : "DIFFER");
+    return !same || missed != 0;
+}
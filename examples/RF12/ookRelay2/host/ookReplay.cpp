@@ -0,0 +1,235 @@
+// Replay pulse traces captured with ookScope2 through all OOK decoders.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -o ookReplay ookReplay.cpp
+//
+// Capture a trace by setting TRACE to 1 in ookScope2, then for example:
+//      stty -F /dev/ttyUSB0 57600 raw && cat /dev/ttyUSB0 >trace.bin
+//
+// Usage: ookReplay [-d] [-n count] trace.bin ...
+//  -d          dump each pulse as "time level width" instead of decoding
+//  -n count    run each decoder this many times, for more accurate timing
+//
+// Decoded packets go to stdout as "time name bytes...", in the same form as
+// ookRelay2 reports them, so the output can be compared against a previous
+// run. Counts and the time spent per pulse for each decoder go to stderr.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+uint32_t replayMicros;
+
+#include "../decoders.h"
+
+OregonDecoder orsc;
+CrestaDecoder cres;
+KakuDecoder kaku;
+KakuADecoder kakuA;
+XrfDecoder xrf;
+HezDecoder hez;
+FlamingoDecoder fmgo;
+SmokeDecoder smk;
+ByronbellDecoder byr;
+ElroDecoder elro;
+VisonicDecoder viso;
+EMxDecoder emx;
+KSxDecoder ksx;
+FSxDecoder fsx;
+
+// same type codes and names as in ookRelay2.ino, both bands together
+DecoderInfo decoders[] = {
+    { 1, "VISO", &viso },
+    { 2, "EMX", &emx },
+    { 3, "KSX", &ksx },
+    { 4, "FSX", &fsx },
+    { 5, "ORSC", &orsc },
+    { 6, "CRES", &cres },
+    { 7, "KAKU", &kaku },
+    { 8, "XRF", &xrf },
+    { 9, "HEZ", &hez },
+    { 10, "ELRO", &elro },
+    { 11, "FMGO", &fmgo },
+    { 12, "SMK", &smk },
+    { 13, "BYR", &byr },
+    { 14, "KAKUA", &kakuA },
+    { -1, 0, 0 }
+};
+
+struct Pulse {
+    uint32_t time;  // end of this pulse, in us
+    word width;     // in us
+    byte level;     // 0 or 1
+    byte resync;    // set if pulses were lost before this one
+};
+
+struct Packet {
+    uint32_t time;
+    byte index, size, data[25];
+    bool operator< (const Packet& p) const { return time < p.time; }
+};
+
+static std::vector<Pulse> pulses;
+static std::vector<Packet> packets;
+static unsigned lostCount;
+
+// parse one trace, see the format description in ookScope2.ino
+static void parseTrace (const byte* buf, size_t len) {
+    size_t i = 0;
+    // skip the startup text, up to the first sync
+    while (i < len && (buf[i] & 0xFC) != 0xC0)
+        ++i;
+    uint32_t now = 0;
+    byte level = 0, resync = 1;
+    while (i < len) {
+        byte b = buf[i++];
+        if ((b & 0xFC) == 0xC0) {
+            if (i + 4 > len)
+                break;
+            now = buf[i] | buf[i+1] << 8 | buf[i+2] << 16 |
+                    (uint32_t) buf[i+3] << 24;
+            i += 4;
+            level = b & 1;
+            if (b & 2) {
+                if (!pulses.empty()) // the first sync always has this flag
+                    ++lostCount;
+                resync = 1;
+            }
+        } else if (b < 0xC0) {
+            word units = b;
+            if (b & 0x80) {
+                if (i >= len)
+                    break;
+                units = (b & 0x3F) << 8 | buf[i++];
+            }
+            Pulse p;
+            now += units * 4;
+            p.time = now;
+            p.width = units * 4;
+            p.level = level;
+            p.resync = resync;
+            pulses.push_back(p);
+            level ^= 1;
+            resync = 0;
+        } else {
+            fprintf(stderr, "bad trace byte 0x%02X at offset %u\n",
+                        b, (unsigned) i - 1);
+            resync = 1;
+        }
+    }
+}
+
+static bool readTrace (const char* name) {
+    FILE* fp = strcmp(name, "-") == 0 ? stdin : fopen(name, "rb");
+    if (fp == 0) {
+        perror(name);
+        return false;
+    }
+    std::vector<byte> buf;
+    byte chunk [4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof chunk, fp)) > 0)
+        buf.insert(buf.end(), chunk, chunk + n);
+    if (fp != stdin)
+        fclose(fp);
+    if (!buf.empty())
+        parseTrace(&buf[0], buf.size());
+    return true;
+}
+
+static double elapsed (const timespec& t0) {
+    timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+}
+
+// feed all pulses to one decoder, return the number of packets found
+static unsigned runDecoder (byte index, bool keep) {
+    DecoderInfo& di = decoders[index];
+    unsigned count = 0;
+    di.decoder->resetDecoder();
+    for (size_t i = 0; i < pulses.size(); ++i) {
+        const Pulse& p = pulses[i];
+        replayMicros = p.time;
+        if (p.resync)
+            di.decoder->resetDecoder();
+        if (di.decoder->nextPulse(p.width)) {
+            ++count;
+            if (keep) {
+                Packet pkt;
+                pkt.time = p.time;
+                pkt.index = index;
+                const byte* data = di.decoder->getData(pkt.size);
+                memcpy(pkt.data, data, pkt.size);
+                packets.push_back(pkt);
+            }
+            di.decoder->resetDecoder();
+        }
+    }
+    return count;
+}
+
+int main (int argc, char** argv) {
+    bool dump = false;
+    int repeat = 1, opt;
+    while ((opt = getopt(argc, argv, "dn:")) != -1)
+        switch (opt) {
+            case 'd': dump = true; break;
+            case 'n': repeat = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-d] [-n count] trace...\n", argv[0]);
+                return 1;
+        }
+    if (optind >= argc || repeat < 1) {
+        fprintf(stderr, "usage: %s [-d] [-n count] trace...\n", argv[0]);
+        return 1;
+    }
+    for (int i = optind; i < argc; ++i)
+        if (!readTrace(argv[i]))
+            return 1;
+
+    if (dump) {
+        for (size_t i = 0; i < pulses.size(); ++i) {
+            const Pulse& p = pulses[i];
+            printf("%10u %d %5u%s\n", p.time, p.level, p.width,
+                        p.resync ? " resync" : "");
+        }
+        return 0;
+    }
+
+    fprintf(stderr, "%u pulses, %u lost sections\n",
+                (unsigned) pulses.size(), lostCount);
+    fprintf(stderr, "%-6s %8s %10s\n", "name", "packets", "ns/pulse");
+    double total = 0;
+    for (byte d = 0; decoders[d].typecode >= 0; ++d) {
+        timespec t0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        unsigned count = runDecoder(d, true);
+        for (int r = 1; r < repeat; ++r)
+            runDecoder(d, false);
+        double secs = elapsed(t0) / repeat;
+        total += secs;
+        fprintf(stderr, "%-6s %8u %10.1f\n", decoders[d].name, count,
+                    pulses.empty() ? 0 : secs * 1e9 / pulses.size());
+    }
+    if (!pulses.empty())
+        fprintf(stderr, "%-6s %8u %10.1f = %.2f Mpulses/s\n", "total",
+                    (unsigned) packets.size(), total * 1e9 / pulses.size(),
+                    pulses.size() / total * 1e-6);
+
+    std::stable_sort(packets.begin(), packets.end());
+    for (size_t i = 0; i < packets.size(); ++i) {
+        const Packet& pkt = packets[i];
+        printf("%u %s", pkt.time, decoders[pkt.index].name);
+        for (byte j = 0; j < pkt.size; ++j)
+            printf(" %d", pkt.data[j]);
+        printf("\n");
+    }
+    return 0;
+}
@@ -38,15 +38,13 @@ DecoderInfo di_868[] = {
     { 4, "FSX", &fsx },
     { -1, 0, 0 }
 };
+DecoderSet decoders_868 (di_868);
 
-// State to track pulse durations measured in the interrupt code
-volatile word pulse_868;
-word last_868; // never accessed outside ISR's
+// Pulse durations measured in the interrupt code
+PulseRing pulses_868;
 
 ISR(ANALOG_COMP_vect) {
-    word now = micros();
-    pulse_868 = now - last_868;
-    last_868 = now;
+    pulses_868.add();
 }
 #endif
 
@@ -75,10 +73,10 @@ DecoderInfo di_433[] = {
     { 14, "KAKUA", &kakuA },
     { -1, 0, 0 }
 };
+DecoderSet decoders_433 (di_433);
 
-// State to track pulse durations measured in the interrupt code
-volatile word pulse_433;
-word last_433; // never accessed outside ISR's
+// Pulse durations measured in the interrupt code
+PulseRing pulses_433;
 
 #if PIN_433 >= 14
 #define VECT PCINT1_vect
@@ -89,9 +87,7 @@ word last_433; // never accessed outside ISR's
 #endif
 
 ISR(VECT) {
-    word now = micros();
-    pulse_433 = now - last_433;
-    last_433 = now;
+    pulses_433.add();
 }
 #endif
 
@@ -101,6 +97,10 @@ byte packetBuffer [RF12_MAXDATA], packetFill;
 // Timer to only relay packets up to 10x per second, even if more come in.
 MilliTimer sendTimer;
 
+// Each decoder only suppresses repeats of its last packet, this also catches
+// repeats from several senders which interleave.
+DedupCache recent (16, 20);
+
 static void setupPinChangeInterrupt () {
 #if PIN_868
     pinMode(PIN_868, INPUT);
@@ -162,28 +162,22 @@ static void addToBuffer (byte code, const char* name, const byte* buf, byte len)
 static void addDecodedData (DecoderInfo& di) {
     byte size;
     const byte* data = di.decoder->getData(size);
-    addToBuffer(di.typecode, di.name, data, size);
+    if (!recent.seen(di.typecode, data, size))
+        addToBuffer(di.typecode, di.name, data, size);
     di.decoder->resetDecoder();
 }
 
-// Check for a new pulse and run the corresponding decoders for it
-static void runPulseDecoders (DecoderInfo* pdi, volatile word& pulse) {
-    // get next pulse with and reset it - need to protect against interrupts
-    cli();
-    word p = pulse;
-    pulse = 0;
-    sei();
-
-    // if we had a pulse, go through each of the decoders
-    if (p != 0) { 
+// Run the corresponding decoders for each pulse which came in since last time
+static void runPulseDecoders (DecoderSet& decoders, PulseRing& ring) {
+    word p;
+    while ((p = ring.next()) != 0) {
 #if DEBUG_LED
         digitalWrite(DEBUG_LED, 1);
 #endif
-        while (pdi->typecode >= 0) {
-            if (pdi->decoder->nextPulse(p))
-                addDecodedData(*pdi);
-            ++pdi;
-        }
+        if (p == PulseRing::LOST)
+            decoders.reset(); // pulses missing, start over
+        else
+            decoders.nextPulse(p, addDecodedData);
 #if DEBUG_LED
         digitalWrite(DEBUG_LED, 0);
 #endif
@@ -320,11 +314,11 @@ void setup () {
 
 void loop () {
 #if PIN_868
-    runPulseDecoders(di_868, pulse_868);    
+    runPulseDecoders(decoders_868, pulses_868);    
 #endif
 
 #if PIN_433
-    runPulseDecoders(di_433, pulse_433);   
+    runPulseDecoders(decoders_433, pulses_433);   
 #endif
 
 #if PIN_DCF
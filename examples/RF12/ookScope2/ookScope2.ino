@@ -7,18 +7,72 @@
 
 #define OOK_PIN   2   // this is the input pin with the signal to be analyzed
 #define OOK_POWER 12  // define this is a pin needs to be set to power up
-
-volatile byte next, fill, buf[256];
-static word last;
+#define TRACE 0       // set to 1 to send binary pulse traces, see below
 
 #if OOK_PIN >= 14
 #define VECT PCINT1_vect
+#define OOK_LEVEL bitRead(PINC, OOK_PIN - 14)
 #elif OOK_PIN >= 8
 #define VECT PCINT0_vect
+#define OOK_LEVEL bitRead(PINB, OOK_PIN - 8)
 #else
 #define VECT PCINT2_vect
+#define OOK_LEVEL bitRead(PIND, OOK_PIN)
 #endif
 
+#if TRACE
+
+// Pulse trace format, as sent out over the serial port:
+//  0x00..0x7F      width of the next pulse, in units of 4 us
+//  0x80..0xBF lo   width of the next pulse, 14 bits: (b & 0x3F) << 8 | lo
+//  0xC0..0xC3 t*4  sync: bit 0 = level after the last edge, bit 1 = pulses
+//                  were lost before this point, followed by a 32-bit time
+//                  of that edge in us, little-endian
+// The level of each pulse is the inverse of the one before it, starting from
+// the last sync. Syncs are sent at least every 256 pulses, right after the
+// startup text (which is to be skipped), and after pulses over 0x3FFF units,
+// i.e. 65.5 ms, which get clipped. See ookRelay2/host/ookReplay.cpp to read.
+
+// ring of 14-bit widths, and sync entries which are 0x8000 + flags followed
+// by the time as two words - the ISR always adds complete entries
+volatile byte next, fill;
+volatile word ring[128];
+static uint32_t lastEdge;
+static byte edges, lost;
+
+static void put (word value) {
+  ring[fill] = value;
+  fill = (fill + 1) % 128;
+}
+
+ISR(VECT) {
+  uint32_t now = micros(), width = (now - lastEdge) >> 2;
+  lastEdge = now;
+  if (((next - fill - 1) & 127) < 4) {
+    lost = 1; // no room for a width and a sync, drop this one
+    return;
+  }
+  if (lost == 0)
+    put(width <= 0x3FFF ? width : 0x3FFF);
+  if (lost || width > 0x3FFF || ++edges == 0) {
+    put(0x8000 | (lost << 1) | OOK_LEVEL);
+    put(now);
+    put(now >> 16);
+    lost = 0;
+  }
+}
+
+static word get () {
+  word value = ring[next]; // the ISR won't touch this slot until next moves
+  next = (next + 1) % 128;
+  return value;
+}
+
+#else
+
+volatile byte next, fill, buf[256];
+static word last;
+
 ISR(VECT) {
   // width is the pulse length in usecs, for either polarity
   word width = (micros() >> 2) - last;
@@ -50,6 +104,8 @@ ISR(VECT) {
   buf[fill++] = width;
 }
 
+#endif
+
 static void setupPinChangeInterrupt () {
   pinMode(OOK_PIN, INPUT);
   digitalWrite(OOK_PIN, 1);   // pull-up
@@ -71,15 +127,36 @@ void setup() {
 #ifdef OOK_POWER
   pinMode(OOK_POWER, OUTPUT);
   digitalWrite(OOK_POWER, HIGH);
+#endif
+#if TRACE
+  lost = 1; // start off with a sync on the first edge
 #endif
   setupPinChangeInterrupt();
 }
 
 void loop() {
+#if TRACE
+  if (next != fill) {
+    word w = get();
+    if (w & 0x8000) {
+      Serial.write(0xC0 | (w & 3));
+      uint32_t t = get();
+      t |= (uint32_t) get() << 16;
+      for (byte i = 0; i < 4; ++i)
+        Serial.write((byte) (t >> 8 * i));
+    } else if (w < 0x80)
+      Serial.write(w);
+    else {
+      Serial.write(0x80 | (w >> 8));
+      Serial.write((byte) w);
+    }
+  }
+#else
   if (next != fill) {
     cli();
     char b = buf[next++];
     sei();
     Serial.print(b);
   }
+#endif
 }
@@ -0,0 +1,76 @@
+/// @dir otaNode
+/// Fetch a new firmware image over the air into a Memory Plug, using RF12ota.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Requires a Memory Plug on port 4, and a node ID set up with RF12demo. The
+// images are served from a Linux box by the otaServer.tcl script, through a
+// JeeLink running RF12demo in the same group, e.g.
+//
+//      ./otaServer.tcl /dev/ttyUSB0 1:2:otaNode.cpp.hex
+//
+// This node checks for a new image on startup, and each time "c" is entered.
+// The staged image can then be flashed by a bootloader, which is not included.
+
+#include <JeeLib.h>
+#include <RF12ota.h>
+
+#define TYPE    1   // which firmware this is, must match the server's list
+#define VERSION 1   // bump this for each new image served
+
+PortI2C i2cBus (4);
+MemoryPlug mem (i2cBus);
+OtaMemoryPlug store (mem);
+RF12Ota ota (store, TYPE, VERSION);
+byte lastStatus = RF12Ota::IDLE;
+word lastChunk;
+
+static void showStatus () {
+    static const char* names[] = {
+        "idle", "checking", "loading", "staged", "failed"
+    };
+    const OtaHeader& image = ota.image();
+    Serial.print(names[ota.status()]);
+    if (ota.status() != RF12Ota::CHECKING && image.size > 0) {
+        Serial.print(", image ");
+        Serial.print(image.type);
+        Serial.print(':');
+        Serial.print(image.version);
+        Serial.print(' ');
+        Serial.print((long) image.next * RF12Ota::CHUNK);
+        Serial.print('/');
+        Serial.print(image.size);
+    }
+    Serial.println();
+}
+
+void setup () {
+    Serial.begin(57600);
+    Serial.print("\n[otaNode] type ");
+    Serial.print(TYPE);
+    Serial.print(" version ");
+    Serial.println(VERSION);
+    rf12_configSilent();
+    rf12_configDump();
+
+    if (mem.isPresent())
+        ota.check();
+    else
+        Serial.println("no memory plug");
+}
+
+void loop () {
+    if (Serial.read() == 'c')
+        ota.check();
+
+    if (rf12_recvDone() && rf12_crc == 0)
+        ota.accept();
+    ota.poll();
+
+    // report each change in status, and progress every 1 Kb
+    word chunk = ota.image().next;
+    if (ota.status() != lastStatus || chunk / 32 != lastChunk / 32) {
+        lastStatus = ota.status();
+        lastChunk = chunk;
+        showStatus();
+    }
+}
@@ -0,0 +1,318 @@
+#!/usr/bin/env tclsh
+
+# Serve firmware images to nodes using RF12ota.h, via a JeeLink with RF12demo
+# agent, 2026-10-19
+
+# Examples:
+#   ./otaServer.tcl /dev/ttyUSB0 1:2:otaNode.cpp.hex
+#   ./otaServer.tcl /dev/ttyUSB0 1:2:otaNode.cpp.hex 5:13:roomNode.cpp.hex
+#   ./otaServer.tcl -sim 5 -loss 10 1:2:otaNode.cpp.hex
+#
+# Each image is specified as type:version:file, nodes running firmware of that
+# type with a different version will fetch it. RF12demo must be set to the
+# group of the nodes, this script switches it to decimal output and turns off
+# unique mode, since repeated requests are how lost packets are recovered.
+#
+# With -sim, nothing is sent: the given number of nodes is simulated instead,
+# with a percentage of all packets lost, to see how long a transfer will take.
+
+set CHUNK 32
+set WINDOW 8
+set TIMEOUT 500 ;# ms, as in RF12ota.cpp
+set RETRIES 20
+
+# packet types, in the first payload byte
+set REQ 246
+set INFO 247
+set DATA 248
+
+proc usage {} {
+  puts stderr "Usage: [info script] device|-sim count ?-loss pct?\
+                type:version:file.hex ?...?"
+  exit 1
+}
+
+proc le16 {v} {
+  list [expr {$v & 255}] [expr {($v >> 8) & 255}]
+}
+
+proc le32 {v} {
+  concat [le16 $v] [le16 [expr {$v >> 16}]]
+}
+
+proc fnv {bytes} {
+  # 32-bit FNV-1a hash, same as RF12Ota::hash()
+  set h 2166136261
+  foreach b $bytes {
+    set h [expr {(($h ^ $b) * 16777619) & 0xFFFFFFFF}]
+  }
+  return $h
+}
+
+proc crc16 {bytes} {
+  # same as a loop over _crc16_update() from avr-libc, starting with ~0
+  set crc 0xFFFF
+  foreach b $bytes {
+    set crc [expr {$crc ^ $b}]
+    for {set i 0} {$i < 8} {incr i} {
+      set crc [expr {$crc & 1 ? ($crc >> 1) ^ 0xA001 : $crc >> 1}]
+    }
+  }
+  return $crc
+}
+
+proc readHex {name} {
+  # the data records of an Intel HEX file, as a list of bytes from address 0
+  set bytes {}
+  set fd [open $name]
+  while {[gets $fd line] >= 0} {
+    if {[scan $line {:%2x%4x%2x%s} count addr type data] == 4 && $type == 0} {
+      while {[llength $bytes] < $addr} {
+        lappend bytes 255 ;# pad with unset bytes if there is a gap
+      }
+      if {[llength $bytes] != $addr} {
+        puts stderr "$name: non-contiguous data ([llength $bytes] vs $addr)"
+      }
+      foreach {x y} [split [string range $data 0 end-2] ""] {
+        lappend bytes [scan $x$y %x]
+      }
+    }
+  }
+  close $fd
+  return $bytes
+}
+
+proc addImage {spec} {
+  # prepare all the chunks of an image up front, with their CRCs
+  global images CHUNK
+  if {![regexp {^(\d+):(\d+):(.+)$} $spec - type version name]} usage
+  set bytes [readHex $name]
+  set size [llength $bytes]
+  if {$size == 0 || $size > 65535} {
+    puts stderr "$name: can't serve an image of $size bytes"
+    exit 1
+  }
+  set chunks {}
+  for {set i 0} {$i < $size} {incr i $CHUNK} {
+    set data [lrange $bytes $i [expr {$i + $CHUNK - 1}]]
+    while {[llength $data] < $CHUNK} {
+      lappend data 255
+    }
+    lappend chunks [concat [le16 [crc16 $data]] $data]
+  }
+  set hash [fnv $bytes]
+  set images($type) [list $version $size $hash $chunks]
+  puts [format "type %d version %d: %s, %d bytes in %d chunks, hash %08X" \
+          $type $version $name $size [llength $chunks] $hash]
+}
+
+proc queue {packet} {
+  # several nodes asking for the same chunks only get them once
+  global outq
+  if {$packet ni $outq} {
+    lappend outq $packet
+  }
+}
+
+proc request {node req} {
+  # respond to an info or chunk request, which is a list of payload bytes
+  global images REQ INFO DATA
+  lassign $req cmd type version lo hi count
+  if {$cmd != $REQ || $count eq ""} return
+  set chunk [expr {$lo + ($hi << 8)}]
+  if {![info exists images($type)]} {
+    if {$chunk == 0xFFFF} {
+      queue [list $INFO $type $version 0 0 0 0 0 0] ;# nothing to offer
+    }
+    return
+  }
+  lassign $images($type) v size hash chunks
+  if {$chunk == 0xFFFF} {
+    if {$version != $v} {
+      puts "node $node: type $type version $version, offering version $v"
+    }
+    queue [concat $INFO $type $v [le16 $size] [le32 $hash]]
+  } elseif {$version == $v} {
+    set last [expr {min($chunk + $count, [llength $chunks]) - 1}]
+    if {$last == [llength $chunks] - 1} {
+      puts "node $node: last chunks of type $type version $v"
+    }
+    for {set i $chunk} {$i <= $last} {incr i} {
+      queue [concat $DATA $type $v [le16 $i] [lindex $chunks $i]]
+    }
+  }
+}
+
+# Serial mode, talking to RF12demo -------------------------------------------
+
+proc serialInput {} {
+  global fd outq busy
+  if {[gets $fd line] < 0} {
+    if {[eof $fd]} {
+      puts stderr "serial port closed"
+      exit 1
+    }
+    return
+  }
+  # strip the RSSI value, which RF69-based setups add at the end
+  regsub {\s*\(.*\)\s*$} $line {} line
+  if {[regexp {^OK (\d+)((?: \d+)+)$} $line - hdr data]} {
+    request [expr {$hdr & 31}] $data
+  } elseif {[regexp {^ -> \d+ b} $line]} {
+    set busy 0 ;# RF12demo has sent the previous packet
+  }
+  serialOutput
+}
+
+proc serialOutput {} {
+  # one packet at a time, since RF12demo overwrites what it has not yet sent
+  global fd outq busy
+  if {!$busy && [llength $outq] > 0} {
+    set outq [lassign $outq packet]
+    puts $fd "[join $packet ,],0s"
+    set busy 1
+    after 1000 {set busy 0; serialOutput} ;# in case the echo was missed
+  }
+}
+
+proc serialMode {device} {
+  global fd outq busy
+  set fd [open $device r+]
+  fconfigure $fd -mode 57600,n,8,1 -blocking 0 -buffering line \
+                  -translation {auto lf}
+  # wait for the reset after opening the port, then set up RF12demo
+  after 3000
+  puts $fd "0x 0u"
+  set busy 0
+  fileevent $fd readable serialInput
+  puts "serving images via $device"
+  vwait forever
+}
+
+# Simulation mode, with nodes running the same logic as RF12ota.cpp ----------
+
+proc airtime {len} {
+  # ms to send a packet with len payload bytes at 49.2 kbaud, plus overhead
+  expr {($len + 9) * 8 / 49.23}
+}
+
+proc lost {} {
+  global loss
+  expr {rand() * 100 < $loss}
+}
+
+proc simulate {count} {
+  global images outq CHUNK WINDOW TIMEOUT RETRIES REQ INFO DATA
+  set type [lindex [array names images] 0]
+  lassign $images($type) version size hash chunks
+  set total [llength $chunks]
+  # each node: state next windowEnd due-time retries requests done-time
+  for {set i 1} {$i <= $count} {incr i} {
+    set nodes($i) [list checking 0 0 0.0 0 0 0]
+  }
+  set now 0.0
+  set air 0.0
+  set sent 0
+  while 1 {
+    # the server sends as soon as it has something, otherwise the node with
+    # the earliest request due goes next
+    if {[llength $outq] > 0} {
+      set outq [lassign $outq packet]
+      set t [airtime [llength $packet]]
+      set air [expr {$air + $t}]
+      # include the time to pass the packet on to RF12demo as text
+      set now [expr {$now + $t + [string length [join $packet ,]] / 5.76}]
+      incr sent
+      for {set i 1} {$i <= $count} {incr i} {
+        if {[lost]} continue
+        lassign $nodes($i) state next wend due retries reqs done
+        set cmd [lindex $packet 0]
+        if {$cmd == $INFO && $state eq "checking"} {
+          set state loading
+          set due $now
+          set retries 0
+        } elseif {$cmd != $DATA || $state ne "loading"} {
+          continue
+        } elseif {[set chunk [expr {[lindex $packet 3] +
+                                    ([lindex $packet 4] << 8)}]] != $next} {
+          if {$chunk > $next && $chunk + 1 == $wend} {
+            set due $now ;# a gap in the window, ask again right away
+          }
+        } else {
+          set retries 0
+          if {[incr next] == $total} {
+            set state staged
+            set done $now
+          } elseif {$next >= $wend} {
+            set due $now
+          } else {
+            set due [expr {$now + $TIMEOUT}]
+          }
+        }
+        set nodes($i) [list $state $next $wend $due $retries $reqs $done]
+      }
+      continue
+    }
+    set first 0
+    for {set i 1} {$i <= $count} {incr i} {
+      lassign $nodes($i) state - - due
+      if {$state in {checking loading} &&
+            ($first == 0 || $due < [lindex $nodes($first) 3])} {
+        set first $i
+      }
+    }
+    if {$first == 0} break
+    lassign $nodes($first) state next wend due retries reqs done
+    if {$due > $now} {
+      # nothing arrived in time, this is a retry
+      set now $due
+      if {[incr retries] > $RETRIES} {
+        set nodes($first) [list failed $next $wend $due $retries $reqs $now]
+        continue
+      }
+    }
+    if {$state eq "checking"} {
+      set req [list $REQ $type [expr {$version - 1}] 255 255 0]
+    } else {
+      set req [concat $REQ $type $version [le16 $next] $WINDOW]
+      set wend [expr {min($next + $WINDOW, $total)}]
+    }
+    set t [airtime [llength $req]]
+    set now [expr {$now + $t}]
+    set air [expr {$air + $t}]
+    incr reqs
+    set nodes($first) [list $state $next $wend \
+                        [expr {$now + $TIMEOUT}] $retries $reqs $done]
+    if {![lost]} {
+      request $first $req
+    }
+  }
+  for {set i 1} {$i <= $count} {incr i} {
+    lassign $nodes($i) state next - - - reqs done
+    puts [format "node %d: %s after %.1f s, %d of %d chunks, %d requests" \
+            $i $state [expr {$done / 1000}] $next $total $reqs]
+  }
+  puts [format "%.1f s total, %d packets sent by the server, %.1f s airtime" \
+          [expr {$now / 1000}] $sent [expr {$air / 1000}]]
+}
+
+set outq {}
+set loss 0
+set argv [lassign $argv device]
+if {$device eq "-sim"} {
+  set argv [lassign $argv count]
+  if {[lindex $argv 0] eq "-loss"} {
+    set argv [lassign $argv - loss]
+  }
+  if {![string is integer -strict $count] || [llength $argv] != 1} usage
+}
+if {[llength $argv] == 0} usage
+foreach a $argv {
+  addImage $a
+}
+
+if {$device eq "-sim"} {
+  simulate $count
+} else {
+  serialMode $device
+}
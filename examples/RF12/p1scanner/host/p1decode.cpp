@@ -0,0 +1,73 @@
+// Decode p1scanner packets from RF12demo output, using the sketch's schema.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I../../../.. -o p1decode p1decode.cpp
+//
+// Usage: p1decode [-n node] <log
+//  -n node     node ID of the p1scanner, default 18
+//
+// Reads lines such as "OK 18 2 128 156 27 ..." as reported by RF12demo, and
+// prints one line per decoded packet with all the readings in it. Packets
+// which can't be decoded because an earlier one was missed are reported as
+// "skipped", the next full packet will get things going again.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../p1payload.h"
+
+static P1Payload p1;
+
+#define SHOW(enc, name) printf(" %s=%lu", #name, (unsigned long) p1.name);
+
+int main (int argc, char** argv) {
+    int node = 18, opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+        switch (opt) {
+            case 'n': node = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-n node] <log\n", argv[0]);
+                return 1;
+        }
+
+    char line [500];
+    while (fgets(line, sizeof line, stdin)) {
+        if (strncmp(line, "OK ", 3) != 0)
+            continue;
+        char* s = line + 3;
+        int hdr = strtol(s, &s, 10);
+        if ((hdr & RF12_HDR_MASK) != node)
+            continue;
+        uint8_t buf [RF12_MAXDATA];
+        uint8_t len = 0;
+        for (;;) {
+            char* t;
+            long v = strtol(s, &t, 10);
+            if (t == s || len >= sizeof buf)
+                break;
+            buf[len++] = v;
+            s = t;
+        }
+        if (len == 0)
+            continue;
+        if (buf[0] != 2) {
+            printf("format %d, %d bytes\n", buf[0], len);
+            continue;
+        }
+        if (len == 1) {
+            printf("restart\n");
+            p1.clear();
+        } else if (!p1.decode(buf + 1, len - 1))
+            printf("skipped\n");
+        else {
+            printf("%d bytes:", len);
+            P1_FIELDS(SHOW)
+            printf("\n");
+        }
+    }
+    return 0;
+}
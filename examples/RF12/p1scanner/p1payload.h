@@ -0,0 +1,20 @@
+// Payload layout of the packets sent by p1scanner, also used by host/p1decode.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <RF12pack.h>
+
+// all values are as parsed from the P1 telegram, i.e. with the decimal point
+// dropped, the meter totals go out as deltas since they change very slowly
+#define P1_FIELDS(F) \
+    F(PackDelta< PackVarint<uint32_t> >, use1)  /* 1.8.1 use, low tariff */ \
+    F(PackDelta< PackVarint<uint32_t> >, use2)  /* 1.8.2 use, high tariff */ \
+    F(PackDelta< PackVarint<uint32_t> >, gen1)  /* 2.8.1 gen, low tariff */ \
+    F(PackDelta< PackVarint<uint32_t> >, gen2)  /* 2.8.2 gen, high tariff */ \
+    F(PackVarint<uint32_t>, mode)               /* 96.14.0 current tariff */ \
+    F(PackVarint<uint32_t>, usew)               /* 1.7.0 actual use */ \
+    F(PackVarint<uint32_t>, genw)               /* 2.7.0 actual gen */ \
+    F(PackVarint<uint32_t>, gtype)              /* 24.1.0 gas meter type */ \
+    F(PackDelta< PackVarint<uint32_t> >, gas)   /* 24.2.0 gas total */ \
+    F(PackVarint<uint32_t>, valve)              /* 24.4.0 gas valve */
+
+RF12_SCHEMA(P1Payload, P1_FIELDS)
@@ -5,6 +5,7 @@
 
 #include <JeeLib.h>
 #include <SoftwareSerial.h>
+#include "p1payload.h"
 
 #define DEBUG 0   // set to 1 to use fake data instead of SoftwareSerial
 #define LED   9   // set to 0 to disable LED blinking
@@ -32,7 +33,8 @@ const char* data =
 "!\n"
 ;
 
-#define FORMAT 1
+#define FORMAT 2   // 1 was the same list of readings as plain varints
+#define FULL   10  // send a full packet every 10 telegrams
 #define NTYPES (sizeof typeMap / sizeof *typeMap)
 
 // list of codes to be sent out (only compares lower byte!)
@@ -42,10 +44,16 @@ const byte typeMap [] = {
 
 SoftwareSerial mySerial (7, 17, true); // inverted logic
 
-byte type;
+byte type, count;
 uint32_t value;
-uint32_t readings[NTYPES+1];
-byte payload[5*NTYPES], *fill;
+P1Payload p1;
+byte payload[1+P1Payload::MAXSIZE];
+
+// where each of the readings in typeMap ends up
+uint32_t* const readings [NTYPES] = {
+  &p1.use1, &p1.use2, &p1.gen1, &p1.gen2, &p1.mode,
+  &p1.usew, &p1.genw, &p1.gtype, &p1.gas, &p1.valve
+};
 
 static bool p1_scanner (char c) {
   switch (c) {
@@ -70,20 +78,14 @@ static bool p1_scanner (char c) {
   return false;
 }
 
-static void addValue (uint32_t v, byte mask =0x80) {
-  uint32_t w = v >> 7;
-  if (w)
-    addValue(w, 0);
-  *fill++ = (v & 0x7F) | mask;
-}
-
 static void collectData (bool empty =false) {
-  fill = payload;
-  addValue(FORMAT);
-  if (!empty)
-    for (byte i = 0; i < NTYPES; ++i)
-      addValue(readings[i]);
-  byte n = fill - payload;
+  payload[0] = FORMAT;
+  byte n = 1;
+  if (!empty) {
+    n += p1.encode(payload + 1, count == 0);
+    if (++count >= FULL)
+      count = 0;
+  }
   
   if (DEBUG) {
     for (byte i = 0; i < n; ++i) {
@@ -134,7 +136,8 @@ void loop () {
       break;
     case '!':
       collectData();
-      memset(readings, 0, sizeof readings);
+      for (byte i = 0; i < NTYPES; ++i)
+        *readings[i] = 0;
       if (LED)
         digitalWrite(LED, 1); // LED off
       break;
@@ -147,7 +150,7 @@ void loop () {
         }
         for (byte i = 0; i < NTYPES; ++i)
           if (type == typeMap[i]) {
-            readings[i] = value;
+            *readings[i] = value;
             break;
           }
     }
@@ -0,0 +1,44 @@
+// Minimal stand-ins for the Arduino API, enough to build RF12.cpp on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define LOW                 0
+#define HIGH                1
+#define INPUT               0
+#define OUTPUT              1
+
+#define bit(b)              (1UL << (b))
+#define bitRead(v, b)       (((v) >> (b)) & 1)
+#define bitSet(v, b)        ((v) |= bit(b))
+#define bitClear(v, b)      ((v) &= ~bit(b))
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t*) (p))
+#define pgm_read_word(p)    (*(const uint16_t*) (p))
+
+// the simulated time and the radio's IRQ pin, see bootSim.cpp
+unsigned long millis ();
+int digitalRead (uint8_t pin);
+void attachInterrupt (uint8_t irq, void (*fun)(), int mode);
+void detachInterrupt (uint8_t irq);
+
+static inline void pinMode (uint8_t, uint8_t) {}
+static inline void digitalWrite (uint8_t, uint8_t) {}
+
+// rf12_configDump() prints to the serial port, which is not used here
+struct HostSerial {
+    template< typename T > void print (T) {}
+    void println () {}
+};
+static HostSerial Serial;
+
+#endif
@@ -0,0 +1,2 @@
+// Stand-in for Ports.h, which RF12.cpp includes but does not need on Linux.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
@@ -0,0 +1,5 @@
+// Stand-in for the avr-libc header, the EEPROM is always erased here.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+static inline uint8_t eeprom_read_byte (const uint8_t*) { return 0xFF; }
+static inline uint16_t eeprom_read_word (const uint16_t*) { return 0xFFFF; }
@@ -0,0 +1,39 @@
+// Stand-in for the avr-libc header: the registers used by RF12.cpp, with the
+// RFM12B model in bootSim.cpp behind the SPI data and chip select registers.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define F_CPU       16000000L
+
+// writing a byte shifts it out to the radio, and the reply in
+struct SpiData {
+    uint8_t in;
+    SpiData& operator= (uint8_t out);
+    operator uint8_t () const { return in; }
+};
+
+// the radio sees the start and end of each command through its select pin
+struct SelectPort {
+    uint8_t bits;
+    SelectPort& operator|= (uint8_t mask);
+    SelectPort& operator&= (uint8_t mask);
+};
+
+extern SpiData spiData;
+extern SelectPort portB;
+extern uint8_t spiControl, spiStatus, ddrB, intMask;
+
+#define SPDR        spiData
+#define SPCR        spiControl
+#define SPSR        spiStatus
+#define PORTB       portB
+#define DDRB        ddrB
+#define EIMSK       intMask
+
+#define SPR0        0
+#define MSTR        4
+#define SPE         6
+#define SPI2X       0
+#define SPIF        7
+#define INT0        0
+
+#define _BV(b)      (1 << (b))
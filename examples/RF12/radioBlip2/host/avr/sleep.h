@@ -0,0 +1,8 @@
+// Stand-in for the avr-libc header, the host never sleeps.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#define SLEEP_MODE_IDLE         0
+#define SLEEP_MODE_PWR_DOWN     2
+
+#define set_sleep_mode(mode)
+#define sleep_mode()
@@ -0,0 +1,268 @@
+// Measure the time from rf12_initialize() until the first packet is sent.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o bootSim bootSim.cpp
+//
+// Usage: bootSim [-r ms] [-x us] [-t us]
+//  -r ms       time the RFM12B stays in power-up reset, default 100, which
+//              is a guess: the comment in RF12.cpp warns it can take seconds
+//  -x us       crystal oscillator start-up time, default 1000
+//  -t us       transmitter turn-on time, once the crystal runs, default 250
+//
+// The real RF12.cpp driver runs against a model of the RFM12B, which decodes
+// each SPI command, keeps the settings, raises the IRQ pin during power-up
+// reset and whenever the transmitter wants its next byte, and collects the
+// bytes sent. Each SPI byte takes 4 us, as with the 2 MHz clock used by the
+// driver on a 16 MHz ATmega. Time spent running code is not included.
+//
+// A node like radioBlip2 initializes the radio, sends 8 bytes, and puts the
+// radio to sleep. This is done in three ways for each modem profile:
+//  - cold:  right after power-up, through the power-up reset wait
+//  - full:  from sleep, with the full command sequence, as before the warm
+//           restart was added to rf12_initialize()
+//  - warm:  from sleep, the way rf12_initialize() does it now
+// One line of results is printed for each profile, with the microseconds
+// until the packet is out and the number of SPI commands, for each case.
+// Exits with status 1 if a packet was sent wrongly, or the radio was left
+// with other settings than the profile asks for.
+
+#define ARDUINO 105
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../../../RF12.cpp"
+
+#define NODE        17
+#define GROUP       212
+#define LEN         8       // payload bytes
+
+static uint64_t now;        // simulated time, in ns
+static uint64_t resetTime = 100000000, xtalTime = 1000000, txOnTime = 250000;
+
+unsigned long millis () {
+    return now / 1000000;
+}
+
+// the RFM12B, as far as needed to let the driver start up and send a packet
+struct Radio {
+    uint16_t regs [256];    // last command written, by its upper byte
+    bool resetting;         // power-up reset interrupt still pending
+    bool xtalOn, txOn;
+    uint64_t xtalReady;     // when the crystal oscillator is running
+    uint64_t txNext;        // when the TX register wants its next byte
+    uint64_t txEnd;         // when the transmitter was last turned off
+    uint16_t frame;         // bits shifted in for the current command
+    uint8_t count;          // bytes shifted in for the current command
+    uint16_t reply;
+    long commands;
+    std::vector<uint8_t> sent;
+
+    // start with the power-on settings, crystal on and everything else off
+    void powerUp () {
+        memset(regs, 0, sizeof regs);
+        regs[0x82] = 0x8208;
+        regs[0xC6] = 0xC623;
+        resetting = xtalOn = true;
+        txOn = false;
+        xtalReady = now + xtalTime;
+        txNext = txEnd = 0;
+        count = 0;
+        commands = 0;
+        sent.clear();
+    }
+
+    uint64_t byteTime () const {
+        // the bit rate is 10000 / 29 / (R + 1) / (1 + cs * 7) Kbps
+        uint8_t r = regs[0xC6] & 0x7F;
+        return 8 * 2900ULL * (r + 1) * (regs[0xC6] & 0x80 ? 8 : 1);
+    }
+
+    bool irq () const {
+        return (resetting && now < resetTime) || (txOn && now >= txNext);
+    }
+
+    uint16_t status () {
+        uint16_t s = irq() ? 0x8000 : 0;
+        if (resetting && now < resetTime)
+            s |= 0x4000;
+        else
+            resetting = false; // reading the status clears the reset flag
+        return s;
+    }
+
+    void command (uint16_t cmd) {
+        ++commands;
+        uint8_t type = cmd >> 8;
+        if ((cmd & 0x8000) == 0)
+            return; // status read, already handled in select()
+        if (type == 0x82) {
+            bool xtal = cmd & 0x08, tx = cmd & 0x20;
+            if (xtal && !xtalOn)
+                xtalReady = now + xtalTime;
+            xtalOn = xtal;
+            if (tx && !txOn) {
+                uint64_t t = now > xtalReady ? now : xtalReady;
+                txNext = t + txOnTime + byteTime();
+            } else if (!tx && txOn)
+                txEnd = now;
+            txOn = tx;
+        } else if (type == 0xB8) {
+            if (txOn) {
+                sent.push_back(cmd);
+                txNext += byteTime();
+            }
+            return; // not a setting
+        }
+        regs[type] = cmd;
+    }
+
+    // called as each byte goes out over SPI, returns the byte coming back
+    uint8_t transfer (uint8_t out) {
+        now += 4000;
+        frame = frame << 8 | out;
+        if (++count == 1) {
+            reply = (out & 0x80) == 0 ? status() : 0;
+            return reply >> 8;
+        }
+        return count == 2 ? reply : 0;
+    }
+
+    // the select pin is low during each command
+    void select (bool high) {
+        if (!high)
+            count = frame = 0;
+        else if (count == 2)
+            command(frame);
+    }
+};
+
+static Radio radio;
+static void (*handler)();
+
+SpiData spiData;
+SelectPort portB;
+uint8_t spiControl, spiStatus = _BV(SPIF), ddrB, intMask;
+
+SpiData& SpiData::operator= (uint8_t out) {
+    in = radio.transfer(out);
+    return *this;
+}
+
+SelectPort& SelectPort::operator|= (uint8_t mask) {
+    bits |= mask;
+    if (mask & bit(SS_BIT))
+        radio.select(true);
+    return *this;
+}
+
+SelectPort& SelectPort::operator&= (uint8_t mask) {
+    bits &= mask;
+    if (~mask & bit(SS_BIT))
+        radio.select(false);
+    return *this;
+}
+
+int digitalRead (uint8_t pin) {
+    return pin == RFM_IRQ ? !radio.irq() : 1;
+}
+
+void attachInterrupt (uint8_t, void (*fun)(), int) {
+    handler = fun;
+}
+
+void detachInterrupt (uint8_t) {
+    handler = 0;
+}
+
+// start the radio and send one packet, as in radioBlip2, print how long it took
+static void bootAndSend (bool& ok) {
+    static const uint8_t payload [LEN] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const uint64_t start = now;
+    const long commands = radio.commands;
+    radio.sent.clear();
+
+    rf12_initialize(NODE, RF12_868MHZ, GROUP);
+    rf12_sendNow(0, payload, sizeof payload);
+    // rf12_sendWait(), with the interrupts it waits for
+    while (rxstate != TXIDLE) {
+        if (now < radio.txNext)
+            now = radio.txNext;
+        if (handler != 0 && (intMask & bit(INT0)) && radio.irq())
+            handler();
+    }
+    rf12_sleep(RF12_SLEEP);
+
+    // the preamble bytes loaded at turn-on are not in radio.sent
+    const std::vector<uint8_t>& s = radio.sent;
+    uint16_t crc = ~0;
+    size_t i = 0;
+    while (i < s.size() && s[i] == 0xAA)
+        ++i;
+    ok = s.size() >= i + 6 + LEN && s[i] == 0x2D && s[i+1] == GROUP &&
+            s[i+2] == NODE && s[i+3] == LEN &&
+            memcmp(&s[i+4], payload, LEN) == 0;
+    for (size_t j = i + 1; ok && j < i + 4 + LEN; ++j)
+        crc = _crc16_update(crc, s[j]);
+    ok = ok && s[i+4+LEN] == (crc & 0xFF) && s[i+5+LEN] == crc >> 8;
+
+    printf(" %7.0f %3ld", (radio.txEnd - start) / 1000.0,
+            radio.commands - commands);
+}
+
+int main (int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "r:x:t:")) != -1)
+        switch (opt) {
+            case 'r': resetTime = atol(optarg) * 1000000ULL; break;
+            case 'x': xtalTime = atol(optarg) * 1000ULL; break;
+            case 't': txOnTime = atol(optarg) * 1000ULL; break;
+            default:
+                fprintf(stderr, "Usage: %s [-r ms] [-x us] [-t us]\n",
+                        argv[0]);
+                return 1;
+        }
+
+    printf("reset %llu ms, crystal %llu us, TX turn-on %llu us, "
+            "%d-byte packets\n\n", resetTime / 1000000ULL,
+            xtalTime / 1000ULL, txOnTime / 1000ULL, LEN);
+    printf("profile      cold cmds    full cmds    warm cmds"
+            "  (us until sent)\n");
+    static const char* names [] = {
+        "4.8k", "9.6k", "19.2k", "38.4k", "49.2k", "57.6k",
+    };
+    bool allOk = true;
+    for (uint8_t p = 0; p < sizeof names / sizeof *names; ++p) {
+        // power up, with the driver in its initial state
+        now = 0;
+        radio.powerUp();
+        radioBand = asleep = 0;
+        handler = 0;
+        rf12_setProfile(p, p % 8); // vary the power level as well
+
+        bool okCold, okFull, okWarm;
+        printf("%-7s", names[p]);
+        bootAndSend(okCold);
+        asleep = 0; // forces the full sequence, even though it slept
+        bootAndSend(okFull);
+        bootAndSend(okWarm);
+        printf("\n");
+
+        // the radio must still have the settings of this profile
+        bool okRegs = radio.regs[0xC6] == pgm_read_word(profileCmds[p]) &&
+                radio.regs[0x94] == pgm_read_word(profileCmds[p] + 1) &&
+                radio.regs[0x98] == (pgm_read_word(profileCmds[p] + 2) |
+                                        p % 8) &&
+                radio.regs[0x80] == 0x80E7 && radio.regs[0xCE] == 0xCED4;
+        if (!okCold || !okFull || !okWarm || !okRegs) {
+            printf("  ^ %s\n", okRegs ? "packet sent wrongly" :
+                                        "wrong radio settings");
+            allOk = false;
+        }
+    }
+    return !allOk;
+}
@@ -0,0 +1,49 @@
+// Stand-in for the parts of JeeLib used by RF12stream.cpp, for streamSim.cpp.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+
+// the simulated time, see streamSim.cpp
+unsigned long millis ();
+
+// same as in Ports.h
+class MilliTimer {
+    word next;
+    byte armed;
+public:
+    MilliTimer () : armed (0) {}
+    byte poll(word ms =0);
+    byte idle() const { return !armed; }
+    void set(word ms);
+};
+
+// the write() and flush() part of the Arduino Print and Stream classes
+class Print {
+public:
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t* ptr, size_t len) {
+        size_t n = 0;
+        while (len-- > 0)
+            n += write(*ptr++);
+        return n;
+    }
+    size_t write(const char* str) {
+        return write((const uint8_t*) str, strlen(str));
+    }
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+#include <RF12.h>
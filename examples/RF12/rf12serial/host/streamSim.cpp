@@ -0,0 +1,274 @@
+// Compare the throughput of RF12Stream with stop-and-wait over a lossy link.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+//
+// Build on Linux, from this directory:
+//      g++ -O2 -I. -I../../../.. -o streamSim streamSim.cpp
+//
+// Usage: streamSim [-p] [-r rate] [-n bytes]
+//  -p          let both sides pair up, i.e. start them with peer 0
+//  -r rate     bytes per second the stream receiver reads, default as fast as
+//              it can, to see the flow control at work
+//  -n bytes    bytes to send in each run, default 20000
+//
+// Node 1 sends random bytes to node 2, as fast as the stream accepts them.
+// The radio sends at 49230 bit/s, packets arrive 2 ms after they have been
+// sent, and each one is lost at random. Nodes wait for the air to be free, so
+// packets are never sent at the same time.
+//
+// The stop-and-wait model uses the timing of RF12sio's send() and poll():
+// data collects for 3 ms, then one packet goes out with an ack request, and
+// the next one waits for its ack. A missing ack causes a resend 500 ms later.
+// It always sends full packets, which is the best case for it. RF12sio itself
+// can't be used here, since it expects an older packet layout.
+//
+// One line of results is printed for each loss rate, with the bytes per second
+// of both, and the ratio. Exits with status 1 if any data arrived damaged.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <deque>
+#include <vector>
+
+#include "../../../../RF12stream.cpp"
+
+#define LATENCY     2000    // us from the end of sending to reception
+#define MAXTIME     600     // seconds, after which a run is given up
+
+// the RF12 driver state used by RF12stream.cpp
+volatile uint16_t rf12_crc;
+volatile uint8_t rf12_buf [RF12_MAXDATA + 5];
+
+static uint64_t now;        // simulated time, in us
+static double loss;
+
+unsigned long millis () {
+    return now / 1000;
+}
+
+// same as in Ports.cpp
+byte MilliTimer::poll(word ms) {
+    byte ready = 0;
+    if (armed) {
+        word remain = next - millis();
+        if (remain <= 60000)
+            return 0;
+        ready = -remain;
+    }
+    set(ms);
+    return ready;
+}
+
+void MilliTimer::set(word ms) {
+    armed = ms != 0;
+    if (armed)
+        next = millis() + ms - 1;
+}
+
+static double rnd () {
+    return rand() / (RAND_MAX + 1.0);
+}
+
+struct Packet {
+    uint64_t at;    // when it has been received
+    byte hdr, len, data [RF12_MAXDATA];
+};
+
+struct Node {
+    byte id;
+    std::deque<Packet> inbox;
+    uint64_t txEnd; // until when this node is sending
+};
+
+static Node nodes [2];
+static int current;         // index of the node calling the rf12_* functions
+static uint64_t airBusy;    // until when a packet is being sent
+
+uint8_t rf12_canSend () {
+    return now >= airBusy;
+}
+
+void rf12_sendStart (uint8_t hdr, const void* ptr, uint8_t len) {
+    if (!rf12_canSend()) {
+        printf("rf12_sendStart called while busy\n");
+        exit(1);
+    }
+    Node& me = nodes[current];
+    Node& other = nodes[1-current];
+    me.txEnd = airBusy = now + (len + 9) * 8 * 1000000ULL / 49230;
+    Packet p;
+    p.at = airBusy + LATENCY;
+    p.len = len;
+    memcpy(p.data, ptr, len);
+    p.hdr = hdr & RF12_HDR_DST ? hdr : (hdr & ~RF12_HDR_MASK) | me.id;
+    if ((hdr & RF12_HDR_DST) && (hdr & RF12_HDR_MASK) != other.id)
+        return;
+    if (rnd() >= loss)
+        other.inbox.push_back(p);
+}
+
+uint8_t rf12_recvDone () {
+    Node& me = nodes[current];
+    if (me.inbox.empty() || me.inbox.front().at > now || now < me.txEnd)
+        return 0;
+    const Packet& p = me.inbox.front();
+    rf12_buf[1] = p.hdr;
+    rf12_buf[2] = p.len;
+    memcpy((byte*) rf12_buf + 3, p.data, p.len);
+    rf12_crc = 0;
+    me.inbox.pop_front();
+    return 1;
+}
+
+// one side of the stop-and-wait link, the first data byte is a sequence number
+struct StopWait {
+    std::deque<byte> queue;         // bytes to send
+    std::vector<byte> received;
+    byte packet [RF12_MAXDATA], len, seq, rxSeq, ackTo, pending, waiting;
+    MilliTimer sendTimer, ackTimer;
+
+    StopWait () : len (0), seq (0), rxSeq (~0), ackTo (0), pending (0),
+                  waiting (0) {}
+
+    void poll () {
+        if (ackTo && rf12_canSend()) {
+            rf12_sendStart(RF12_HDR_CTL | RF12_HDR_DST | ackTo, &rxSeq, 1);
+            ackTo = 0;
+            return;
+        }
+        if (rf12_recvDone() && rf12_crc == 0) {
+            if (rf12_hdr & RF12_HDR_CTL) {
+                if (waiting && rf12_len == 1 && rf12_data[0] == seq) {
+                    waiting = len = 0;
+                    ++seq;
+                    ackTimer.set(0);
+                }
+            } else {
+                // a repeated packet is only acked again
+                if (rf12_data[0] != rxSeq) {
+                    rxSeq = rf12_data[0];
+                    for (byte i = 1; i < rf12_len; ++i)
+                        received.push_back((byte) rf12_data[i]);
+                }
+                ackTo = rf12_hdr & RF12_HDR_MASK;
+            }
+            return;
+        }
+        if (!waiting && len == 0 && !queue.empty() && sendTimer.idle())
+            sendTimer.set(3);
+        if (sendTimer.poll())
+            pending = 1;
+        if (ackTimer.poll())
+            sendTimer.set(500);
+        if (pending && rf12_canSend()) {
+            if (len == 0) {
+                packet[len++] = seq;
+                while (len < RF12_MAXDATA && !queue.empty()) {
+                    packet[len++] = queue.front();
+                    queue.pop_front();
+                }
+            }
+            rf12_sendStart(RF12_HDR_ACK, packet, len);
+            pending = 0;
+            waiting = 1;
+            ackTimer.set(50);
+        }
+    }
+};
+
+static bool pairing;
+static long readRate, total = 20000;
+
+// send all data through either kind of link, return the bytes per second
+static double run (bool stream, bool& intact) {
+    now = 1000000;
+    airBusy = 0;
+    for (int i = 0; i < 2; ++i) {
+        nodes[i] = Node();
+        nodes[i].id = i + 1;
+    }
+    RF12Stream a (pairing ? 0 : 2), b;
+    a.begin(1);
+    b.begin(2);
+    StopWait sa, sb;
+
+    std::vector<byte> data (total), got;
+    // there is no flow control with stop-and-wait, the receiver keeps it all
+    const std::vector<byte>& out = stream ? got : sb.received;
+    for (long i = 0; i < total; ++i)
+        data[i] = rand();
+    long fed = 0;
+    uint64_t nextRead = now;
+    const uint64_t start = now;
+    while ((long) out.size() < total && now - start < MAXTIME * 1000000ULL) {
+        bool reading = readRate == 0 || now >= nextRead;
+        if (stream) {
+            if (fed < total)
+                fed += a.write(&data[fed], total - fed);
+            current = 0;
+            if (rf12_recvDone() && rf12_crc == 0)
+                a.accept();
+            a.poll();
+            current = 1;
+            if (rf12_recvDone() && rf12_crc == 0)
+                b.accept();
+            b.poll();
+            while (reading && b.available()) {
+                got.push_back(b.read());
+                reading = readRate == 0;
+            }
+        } else {
+            // keep one packet's worth queued, as a sketch would
+            while (fed < total && sa.queue.size() < RF12_MAXDATA)
+                sa.queue.push_back(data[fed++]);
+            current = 0;
+            sa.poll();
+            current = 1;
+            sb.poll();
+        }
+        if (readRate && now >= nextRead)
+            nextRead += 1000000 / readRate;
+        now += 20;
+    }
+    intact = out == data;
+    return out.size() / ((now - start) / 1e6);
+}
+
+int main (int argc, char** argv) {
+    int opt;
+    while ((opt = getopt(argc, argv, "pr:n:")) != -1)
+        switch (opt) {
+            case 'p': pairing = true; break;
+            case 'r': readRate = atol(optarg); break;
+            case 'n': total = atol(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-p] [-r rate] [-n bytes]\n",
+                        argv[0]);
+                return 1;
+        }
+    if (readRate < 0 || readRate > 1000000 || total < 1) {
+        fprintf(stderr, "%s: need a rate of 0..1000000 and some bytes\n",
+                argv[0]);
+        return 1;
+    }
+
+    printf("%ld bytes, %s, %s\n\n", total,
+            pairing ? "paired through peer 0" : "sent to node 2",
+            readRate ? "reader limited" : "reader as fast as it can");
+    printf("loss   stream  stop-and-wait  ratio (bytes/s)\n");
+    static const double losses[] = { 0, 0.01, 0.05, 0.1, 0.2, 0.3 };
+    bool allOk = true;
+    srand(1);
+    for (unsigned l = 0; l < sizeof losses / sizeof *losses; ++l) {
+        loss = losses[l];
+        bool okStream, okWait;
+        double rateStream = run(true, okStream);
+        double rateWait = run(false, okWait);
+        printf("%3.0f%% %8.0f%s %14.0f%s %6.1fx\n", loss * 100,
+                rateStream, okStream ? "" : " BAD",
+                rateWait, okWait ? "" : " BAD", rateStream / rateWait);
+        allOk = allOk && okStream && okWait;
+    }
+    return !allOk;
+}
@@ -1,22 +1,31 @@
 /// @dir rf12serial
 /// Serial data over RF12 demo, works in both directions.
 // 2009-04-17 <jc@wippler.nl> http://opensource.org/licenses/mit-license.php
+//
+// Load this on two nodes with the same group and different node IDs, then
+// whatever is typed on one serial port comes out on the other. The first node
+// to send something pairs up with the other one, see RF12stream.h for details.
+// See host/streamSim.cpp for a simulation of its throughput with packet loss.
 
 #include <JeeLib.h>
-#include <RF12sio.h>
+#include <RF12stream.h>
 
-RF12 RF12;
+RF12Stream link;
 
 void setup() {
     Serial.begin(9600);
     Serial.print("\n[rf12serial]");
-    rf12_config();
+    link.begin(rf12_config());
 }
 
 void loop() {
-    if (Serial.available())
-        RF12.send(Serial.read());
+    if (Serial.available() && link.availableForWrite() > 0)
+        link.write(Serial.read());
     
-    if (RF12.poll())
-        Serial.print(RF12.read());
+    if (rf12_recvDone() && rf12_crc == 0)
+        link.accept();
+    link.poll();
+
+    if (link.available())
+        Serial.write(link.read());
 }
@@ -0,0 +1,170 @@
+#!/usr/bin/env tclsh
+
+# Summarize the occupancy reports sent out by the rfScanner sketch
+# agent, 2026-10-19
+
+# Examples:
+#   ./report.tcl scan.log             ;# report on the last scan in a log file
+#   ./report.tcl </dev/ttyUSB0        ;# report each time a new scan comes in
+#   ./report.tcl -sim                 ;# generate simulated scans, as a check
+
+set levels {-103 -97 -91 -85 -79 -73}
+
+# convert a frequency value for rf12_initialize() to MHz, depending on band
+proc mhz {band freq} {
+  switch $band {
+    1 { format %.3f [expr {430.0 + $freq * 0.0025}] }
+    2 { format %.3f [expr {860.0 + $freq * 0.005}] }
+    3 { format %.3f [expr {900.0 + $freq * 0.0075}] }
+    default { return ? }
+  }
+}
+
+# print one scan as a table, with the percentage of busy samples per level
+proc report {} {
+  global scan levels
+  set total [expr {$scan(samples) * $scan(sweeps)}]
+  if {$total == 0} return
+  puts [format "%-6s %-8s %s" freq MHz [join [lmap x $levels {
+                                                format %5s $x}] ""]]
+  foreach {freq counts} $scan(chans) {
+    set out [format "%-6d %-8s" $freq [mhz $scan(band) $freq]]
+    foreach x $counts {
+      append out [format %5d [expr {100 * $x / $total}]]
+    }
+    # show a bar, using the number of levels which are busy over 10% of time
+    set n 0
+    foreach x $counts {
+      if {10 * $x > $total} { incr n }
+    }
+    puts "$out  [string repeat # $n]"
+  }
+  puts "least busy: $scan(best) ([mhz $scan(band) $scan(best)] MHz),\
+          over $scan(sweeps) sweeps"
+  puts ""
+}
+
+# process one line of scanner output, returns true when a scan is complete
+proc parse {line} {
+  global scan
+  switch -- [lindex $line 0] {
+    S {
+      lassign $line - scan(band) scan(first) scan(step) scan(samples) \
+                      scan(sweeps)
+      set scan(chans) {}
+    }
+    C {
+      if {[info exists scan(chans)]} {
+        lappend scan(chans) [lindex $line 1] [lrange $line 2 end]
+      }
+    }
+    B {
+      if {[info exists scan(chans)]} {
+        set scan(best) [lindex $line 1]
+        return 1
+      }
+    }
+  }
+  return 0
+}
+
+# pick the least busy channel from a list of freq/counts pairs, using the same
+# rule as report() in rfScanner.ino: the lowest sum over all levels, and the
+# first such channel if there is a tie
+proc leastBusy {chans} {
+  set best 0
+  set bestScore Inf
+  foreach {freq counts} $chans {
+    set score [tcl::mathop::+ {*}$counts]
+    if {$score < $bestScore} {
+      set bestScore $score
+      set best $freq
+    }
+  }
+  return $best
+}
+
+# the chance that the RSSI bit is set at threshold l, for a channel with the
+# given activity level, i.e. the fraction of time it's busy at -103 dBm
+proc chance {level l} {
+  expr {$level / ($l + 1.0)}
+}
+
+# generate scanner output for 32 channels with the given activity levels, the
+# other channels have a bit of noise at the lower thresholds
+proc simulate {activity} {
+  set sweeps 100
+  set samples 8
+  set lines [list "S 2 96 120 $samples $sweeps"]
+  set chans {}
+  for {set c 0} {$c < 32} {incr c} {
+    set freq [expr {96 + $c * 120}]
+    set level 0.05
+    if {[dict exists $activity $freq]} {
+      set level [dict get $activity $freq]
+    }
+    set counts {}
+    for {set l 0} {$l < 6} {incr l} {
+      set p [chance $level $l]
+      set n 0
+      for {set i 0} {$i < $sweeps * $samples} {incr i} {
+        if {rand() < $p} { incr n }
+      }
+      lappend counts $n
+    }
+    lappend lines "C $freq $counts"
+    lappend chans $freq $counts
+  }
+  lappend lines "B [leastBusy $chans]"
+  return $lines
+}
+
+if {$argv eq "-sim"} {
+  # channels near the default frequency value of 1600 are made busy, and two
+  # channels are completely silent, the lower one of those should be reported
+  set activity {1536 0.9 1656 0.5 1776 0.2 3216 0 2496 0}
+  set expect 2496
+  set count 0
+  foreach line [simulate $activity] {
+    if {[parse $line]} {
+      report
+      if {$scan(best) != $expect} {
+        puts stderr "FAIL: $scan(best) reported as least busy, not $expect"
+        exit 1
+      }
+      incr count
+    }
+  }
+  puts "simulated scan ok"
+  exit [expr {$count != 1}]
+}
+
+if {[llength $argv] > 1} {
+  puts stderr "Usage: [info script] ?logfile | -sim?"
+  exit 1
+}
+
+if {$argv eq ""} {
+  # read from stdin, report as each scan comes in
+  while {[gets stdin line] >= 0} {
+    if {[parse $line]} {
+      report
+      flush stdout
+    }
+  }
+} else {
+  # read a log file, only report the last complete scan in it
+  set fd [open $argv]
+  set done 0
+  while {[gets $fd line] >= 0} {
+    if {[parse $line]} {
+      array set last [array get scan]
+      set done 1
+    }
+  }
+  close $fd
+  if {$done} {
+    array set scan [array get last]
+    report
+  }
+}
@@ -0,0 +1,110 @@
+/// @dir rfScanner
+/// Scan a range of frequencies and report how busy each of them is.
+// 2026-10-19 <agent@local> http://opensource.org/licenses/mit-license.php
+
+// The RFM12B only has a single RSSI bit, telling whether the received signal
+// is above a threshold set with the 0x94xx "receiver control" command. This
+// sketch sweeps across frequencies and all thresholds, and keeps counts of how
+// often the RSSI bit was set, giving an occupancy histogram per channel.
+//
+// Every REPORT ms, the counts are sent to the serial port as lines of text:
+//
+//   S <band> <first> <step> <samples> <sweeps>
+//   C <freq> <hits at -103 dBm> <-97> <-91> <-85> <-79> <-73>   (per channel)
+//   B <freq>
+//
+// where <freq> is the value to pass as last arg to rf12_initialize(), and the
+// "B" line reports the least busy channel. See report.tcl for a host-side
+// tool to turn this output into a readable table.
+
+#include <JeeLib.h>
+
+#define BAND     RF12_868MHZ
+#define FIRST    96     // first frequency to scan, same units as rf12_initialize
+#define STEP     120    // distance between scanned frequencies
+#define CHANNELS 32     // number of frequencies to scan
+#define LEVELS   6      // RSSI thresholds, from -103 dBm up in 6 dB steps
+#define SAMPLES  8      // RSSI bit samples per frequency and threshold
+#define REPORT   10000  // ms between reports on the serial port
+
+word hits [CHANNELS][LEVELS];   // how often the RSSI bit was set
+word sweeps;                    // how many sweeps the hits were collected over
+MilliTimer reportTimer;
+
+// return how many samples had the RSSI bit set, for the given threshold
+static byte sample (byte level) {
+    rf12_control(0x94A0 | level); // VDI,FAST,134kHz,0dBm,threshold
+    delayMicroseconds(500); // give the RSSI comparator some time to settle
+    byte n = 0;
+    for (byte i = 0; i < SAMPLES; ++i) {
+        if (rf12_control(0x0000) & 0x0100) // RSSI bit in the status word
+            ++n;
+        delayMicroseconds(100);
+    }
+    return n;
+}
+
+static void sweep () {
+    for (byte c = 0; c < CHANNELS; ++c) {
+        rf12_control(0xA000 + FIRST + c * STEP);
+        delayMicroseconds(300); // give the PLL some time to lock
+        for (byte l = 0; l < LEVELS; ++l)
+            hits[c][l] += sample(l);
+    }
+    // halve all the counts once in a while, so that old samples fade out
+    if (++sweeps >= 4096) {
+        for (byte c = 0; c < CHANNELS; ++c)
+            for (byte l = 0; l < LEVELS; ++l)
+                hits[c][l] /= 2;
+        sweeps /= 2;
+    }
+}
+
+static void report () {
+    Serial.print("S ");
+    Serial.print(BAND);
+    Serial.print(' ');
+    Serial.print(FIRST);
+    Serial.print(' ');
+    Serial.print(STEP);
+    Serial.print(' ');
+    Serial.print(SAMPLES);
+    Serial.print(' ');
+    Serial.println(sweeps);
+
+    byte best = 0;
+    long bestScore = 0x7FFFFFFF;
+    for (byte c = 0; c < CHANNELS; ++c) {
+        Serial.print("C ");
+        Serial.print(FIRST + c * STEP);
+        // a signal which trips higher thresholds counts more than once
+        long score = 0;
+        for (byte l = 0; l < LEVELS; ++l) {
+            Serial.print(' ');
+            Serial.print(hits[c][l]);
+            score += hits[c][l];
+        }
+        Serial.println();
+        if (score < bestScore) {
+            bestScore = score;
+            best = c;
+        }
+    }
+
+    Serial.print("B ");
+    Serial.println(FIRST + best * STEP);
+}
+
+void setup () {
+    Serial.begin(57600);
+    Serial.println("\n[rfScanner]");
+    // node ID zero, so the driver leaves the radio alone, no interrupts
+    rf12_initialize(0, BAND);
+    rf12_control(0x82DD); // receiver on
+}
+
+void loop () {
+    sweep();
+    if (reportTimer.poll(REPORT))
+        report();
+}
@@ -157,16 +157,11 @@ static void doMeasure() {
     payload.lobat = rf12_lowbat();
 
     #if SHT11_PORT
-#ifndef __AVR_ATtiny84__
         sht11.measure(SHT11::HUMI, shtDelay);        
         sht11.measure(SHT11::TEMP, shtDelay);
-        float h, t;
-        sht11.calculate(h, t);
-        int humi = h + 0.5, temp = 10 * t + 0.5;
-#else
-        //XXX TINY!
-        int humi = 50, temp = 25;
-#endif
+        int humi, temp;
+        sht11.calculateInt(humi, temp); // integer version, also fits on ATtiny
+        humi = (humi + 5) / 10;
         payload.humi = smoothedAverage(payload.humi, humi, firstTime);
         payload.temp = smoothedAverage(payload.temp, temp, firstTime);
     #endif